@@ -18,17 +18,19 @@
 
 #include <luci/Log.h>
 
+#include <chrono>
 #include <iostream>
 
 int entry(int argc, char **argv)
 {
   LOGGER(l);
 
-  if (argc != 5)
+  if (argc < 5 || argc > 7)
   {
     std::cerr
       << "Usage: " << argv[0]
-      << " <path/to/partition/config> <num_inputs> <path/to/input/prefix> <path/to/output/file>\n";
+      << " <path/to/partition/config> <num_inputs> <path/to/input/prefix> <path/to/output/file>"
+      << " [num_threads [num_records]]\n";
     return EXIT_FAILURE;
   }
   // NOTE: about input/output data file name
@@ -36,11 +38,23 @@ int entry(int argc, char **argv)
   // NOTE: about output shape
   // - file name with filename.ext0.shape, filename.ext1.shape, ...
   //   having one line text content of CSV format(like H,W or N,C,H,W)
+  // NOTE: about records
+  // - with num_records > 1, record R uses input files with filename.extN.R, falling back to
+  //   filename.extN if not exist, and outputs are saved to filename.extN.R
+  //   (record 0 uses file names without '.R')
 
   const char *config_filename = argv[1];
   const int32_t num_inputs = atoi(argv[2]);
   const char *input_prefix = argv[3];
   const char *output_file = argv[4];
+  // run models one by one by default, as each partitioned model may use threads of its own
+  const uint32_t num_threads = argc > 5 ? atoi(argv[5]) : 1;
+  const uint32_t num_records = argc > 6 ? atoi(argv[6]) : 1;
+  if (num_threads == 0 || num_records == 0)
+  {
+    std::cerr << "ERROR: num_threads and num_records should be positive" << std::endl;
+    return EXIT_FAILURE;
+  }
 
   prunner::PModelsRunner pmrunner;
 
@@ -49,11 +63,21 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
 
   INFO(l) << "Read input file: " << input_prefix << ", #inputs: " << num_inputs << std::endl;
-  pmrunner.load_inputs(input_prefix, num_inputs);
+  pmrunner.load_inputs(input_prefix, num_inputs, num_records);
 
-  INFO(l) << "Run all partitioned models..." << std::endl;
-  if (!pmrunner.run())
+  INFO(l) << "Run all partitioned models with " << num_threads << " threads..." << std::endl;
+  auto begin = std::chrono::steady_clock::now();
+  if (!pmrunner.run(num_threads))
     return EXIT_FAILURE;
+  auto end = std::chrono::steady_clock::now();
+
+  if (num_records > 1)
+  {
+    // NOTE elapsed time includes loading of partitioned models
+    std::chrono::duration<double> elapsed = end - begin;
+    std::cout << "Run " << num_records << " records in " << elapsed.count() << " sec, "
+              << num_records / elapsed.count() << " records/sec" << std::endl;
+  }
 
   INFO(l) << "Save output file: " << output_file << std::endl;
   pmrunner.save_outputs(output_file);
@@ -26,8 +26,14 @@
 #include <foder/FileLoader.h>
 #include <crew/PConfig.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
 #include <fstream>
 #include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
 #include <vector>
 #include <string>
 #include <stdexcept>
@@ -84,11 +90,63 @@ template <typename NodeT> size_t tensor_size(const NodeT *node)
   return tsize;
 }
 
+bool file_exists(const std::string &filename)
+{
+  std::ifstream fs(filename, std::ifstream::binary);
+  return fs.good();
+}
+
+using BufferRefs = std::map<std::string, const prunner::Buffer *>;
+
+/**
+ * @brief run a partitioned model with given input data and return its output data
+ */
+prunner::Buffers run_model(luci::Module *module, luci_interpreter::Interpreter &interpreter,
+                           const BufferRefs &inputs)
+{
+  // Set input
+  const auto input_nodes = loco::input_nodes(module->graph());
+  for (uint32_t i = 0; i < input_nodes.size(); i++)
+  {
+    const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[i]);
+
+    auto input_name = input_node->name();
+    assert(inputs.find(input_name) != inputs.end());
+
+    const auto *input_data = inputs.at(input_name);
+
+    interpreter.writeInputTensor(input_node, input_data->data(), input_data->size());
+  }
+
+  // Run interpreter
+  interpreter.interpret();
+
+  // Get output.
+  prunner::Buffers outputs;
+  const auto output_nodes = loco::output_nodes(module->graph());
+  for (uint32_t i = 0; i < module->graph()->outputs()->size(); i++)
+  {
+    const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
+    auto output_name = output_node->name();
+
+    prunner::Buffer output_data(tensor_size(output_node));
+
+    interpreter.readOutputTensor(output_node, output_data.data(), output_data.size());
+
+    outputs[output_name] = std::move(output_data);
+  }
+  return outputs;
+}
+
 } // namespace
 
 namespace prunner
 {
 
+PModelsRunner::PModelsRunner() = default;
+
+PModelsRunner::~PModelsRunner() = default;
+
 bool PModelsRunner::load_config(const std::string &filename)
 {
   if (!crew::read_ini(filename, _pconfig))
@@ -99,123 +157,236 @@ bool PModelsRunner::load_config(const std::string &filename)
 
   for (auto &part : _pconfig.parts)
   {
-    _models_to_run.push_back(part.model_file);
+    RunPart run_part;
+    run_part.model_file = part.model_file;
+    run_part.inputs = part.inputs;
+    _parts.push_back(std::move(run_part));
   }
   return true;
 }
 
-void PModelsRunner::load_inputs(const std::string &input_prefix, int32_t num_inputs)
+/**
+ * @brief load input data of each record
+ *
+ * @note  Record 0 is read from "input_prefix + N" and other record R is read from
+ *        "input_prefix + N + '.' + R" if the file exists, or reuses the data of record 0.
+ */
+void PModelsRunner::load_inputs(const std::string &input_prefix, int32_t num_inputs,
+                                uint32_t num_records)
 {
   LOGGER(l);
 
-  auto its = _pconfig.source.inputs.begin();
-  for (int32_t i = 0; i < num_inputs; ++i, ++its)
+  assert(num_records > 0);
+  _data_stages.resize(num_records);
+
+  for (uint32_t r = 0; r < num_records; ++r)
   {
-    std::string filename = input_prefix + std::to_string(i);
+    auto its = _pconfig.source.inputs.begin();
+    for (int32_t i = 0; i < num_inputs; ++i, ++its)
+    {
+      std::string input_name = *its;
+      std::string filename = input_prefix + std::to_string(i);
+      if (r > 0)
+      {
+        filename += "." + std::to_string(r);
+        if (not file_exists(filename))
+        {
+          _data_stages[r][input_name] = _data_stages[0][input_name];
+          continue;
+        }
+      }
 
-    INFO(l) << "Load input data: " << filename << std::endl;
-    foder::FileLoader file_loader{filename};
+      INFO(l) << "Load input data: " << filename << std::endl;
+      foder::FileLoader file_loader{filename};
 
-    std::string input_name = *its;
-    _data_stage[input_name] = file_loader.load();
+      _data_stages[r][input_name] = file_loader.load();
 
-    INFO(l) << "Input: [" << input_name << "], size " << _data_stage[input_name].size()
-            << std::endl;
+      INFO(l) << "Input: [" << input_name << "], size " << _data_stages[r][input_name].size()
+              << std::endl;
+    }
   }
 }
 
 /**
- * @brief return true if all inputs of the model is ready in _data_storage
+ * @brief return true if all inputs of the part are ready in data stage of the record
  */
-bool PModelsRunner::is_input_ready(const RunModel &model)
+bool PModelsRunner::is_input_ready(const RunPart &part, uint32_t record)
 {
-  for (auto &part : _pconfig.parts)
+  const auto &data_stage = _data_stages.at(record);
+  for (auto &input : part.inputs)
   {
-    if (part.model_file != model)
-      continue;
+    auto it = data_stage.find(input);
+    if (it == data_stage.end())
+      return false;
+  }
+  return true;
+}
 
-    for (auto &input : part.inputs)
+/**
+ * @brief return true if every part can run, that is, all parts can be ordered so that
+ *        inputs of a part are source inputs or outputs of the parts before it
+ */
+bool PModelsRunner::validate_dataflow(void)
+{
+  std::set<std::string> produced(_pconfig.source.inputs.begin(), _pconfig.source.inputs.end());
+  std::vector<bool> visited(_pconfig.parts.size(), false);
+
+  for (size_t num_visited = 0; num_visited < _pconfig.parts.size(); ++num_visited)
+  {
+    bool found_part = false;
+    for (size_t p = 0; p < _pconfig.parts.size() && not found_part; ++p)
     {
-      auto it = _data_stage.find(input);
-      if (it == _data_stage.end())
-        return false;
+      if (visited[p])
+        continue;
+
+      const auto &part = _pconfig.parts[p];
+      bool ready = true;
+      for (auto &input : part.inputs)
+        ready = ready && produced.find(input) != produced.end();
+      if (not ready)
+        continue;
+
+      for (auto &output : part.outputs)
+      {
+        // There should not exist same output names
+        // TODO check with multiple virtual outputs
+        if (not produced.insert(output).second)
+          return false;
+      }
+      visited[p] = true;
+      found_part = true;
     }
+    if (not found_part)
+      return false;
   }
   return true;
 }
 
-bool PModelsRunner::run(void)
+bool PModelsRunner::run(uint32_t num_threads)
 {
   LOGGER(l);
 
-  // for each partitioned model, if the inputs of the model are ready, run the model
-  do
+  if (not validate_dataflow())
+  {
+    std::cerr << "ERROR: model partition or configuration has problems" << std::endl;
+    return false;
+  }
+
+  // Load each partitioned model once, interpreters are reused for all records
+  for (auto &part : _parts)
   {
-    bool found_model = false;
+    INFO(l) << "Load model: " << part.model_file << std::endl;
+    part.module = import_circle(part.model_file);
+    part.interpreter = std::make_unique<luci_interpreter::Interpreter>(part.module.get());
+  }
 
-    for (auto it = _models_to_run.begin(); it != _models_to_run.end(); ++it)
+  const auto num_parts = static_cast<uint32_t>(_parts.size());
+  const auto num_records = static_cast<uint32_t>(_data_stages.size());
+  const uint32_t num_tasks = num_parts * num_records;
+  num_threads = std::max(1u, std::min(num_threads, num_parts));
+  INFO(l) << "Run " << num_parts << " models for " << num_records << " records with "
+          << num_threads << " threads" << std::endl;
+
+  // Scheduler state, guarded by mutex
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<uint32_t> next_record(num_parts, 0);
+  std::vector<bool> busy(num_parts, false);
+  std::vector<uint32_t> parts_done(num_records, 0);
+  uint32_t tasks_done = 0;
+  std::exception_ptr error;
+
+  std::set<std::string> source_outputs(_pconfig.source.outputs.begin(),
+                                       _pconfig.source.outputs.end());
+
+  auto worker = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (tasks_done < num_tasks && error == nullptr)
     {
-      auto model_fname = *it;
-
-      INFO(l) << "Check model input ready: " << model_fname << std::endl;
-      if (is_input_ready(model_fname))
+      // find a part that is idle and whose inputs of its next record are ready
+      uint32_t p = 0;
+      for (; p < num_parts; ++p)
       {
-        found_model = true;
-
-        INFO(l) << "Run model: " << model_fname << std::endl;
-        auto module = import_circle(model_fname);
-
-        luci_interpreter::Interpreter interpreter(module.get());
+        if (busy[p] || next_record[p] >= num_records)
+          continue;
+        if (is_input_ready(_parts[p], next_record[p]))
+          break;
+      }
+      if (p == num_parts)
+      {
+        cv.wait(lock);
+        continue;
+      }
 
-        // Set input
-        const auto input_nodes = loco::input_nodes(module->graph());
-        int32_t num_inputs = static_cast<int32_t>(input_nodes.size());
-        for (int32_t i = 0; i < num_inputs; i++)
-        {
-          const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[i]);
+      auto &part = _parts[p];
+      const uint32_t record = next_record[p]++;
+      busy[p] = true;
 
-          auto input_name = input_node->name();
-          assert(_data_stage.find(input_name) != _data_stage.end());
+      // std::map does not move its elements on insertion, so the references are valid
+      // while other parts store their outputs
+      BufferRefs inputs;
+      for (auto &input : part.inputs)
+        inputs[input] = &_data_stages[record].at(input);
 
-          auto input_data = _data_stage[input_name];
+      lock.unlock();
+      Buffers outputs;
+      std::exception_ptr part_error;
+      try
+      {
+        outputs = run_model(part.module.get(), *part.interpreter, inputs);
+      }
+      catch (...)
+      {
+        part_error = std::current_exception();
+      }
+      lock.lock();
 
-          interpreter.writeInputTensor(input_node, input_data.data(), input_data.size());
-        }
+      if (part_error != nullptr)
+      {
+        error = part_error;
+        cv.notify_all();
+        break;
+      }
 
-        // Run interpreter
-        interpreter.interpret();
-        INFO(l) << "Run model: " << model_fname << " done" << std::endl;
+      auto &data_stage = _data_stages[record];
+      for (auto &output : outputs)
+        data_stage[output.first] = std::move(output.second);
 
-        // Get output.
-        const auto output_nodes = loco::output_nodes(module->graph());
-        for (uint32_t i = 0; i < module->graph()->outputs()->size(); i++)
+      // Intermediate data of a finished record is not needed any more
+      if (++parts_done[record] == num_parts)
+      {
+        for (auto it = data_stage.begin(); it != data_stage.end();)
         {
-          const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
-          auto output_name = output_node->name();
-
-          Buffer output_data(tensor_size(output_node));
-
-          interpreter.readOutputTensor(output_node, output_data.data(), output_data.size());
-
-          // There should not exist same output names
-          // TODO check with multiple virtual outputs
-          assert(_data_stage.find(output_name) == _data_stage.end());
-          _data_stage[output_name] = output_data;
+          if (source_outputs.find(it->first) == source_outputs.end())
+            it = data_stage.erase(it);
+          else
+            ++it;
         }
-
-        // We've ran this model, remove from the model list
-        _models_to_run.erase(it);
-        break;
       }
-    }
 
-    if (not found_model)
-    {
-      std::cerr << "ERROR: model partition or configuration has problems" << std::endl;
-      return false;
+      busy[p] = false;
+      ++tasks_done;
+      cv.notify_all();
     }
-  } while (not _models_to_run.empty());
+  };
 
+  if (num_threads == 1)
+  {
+    worker();
+  }
+  else
+  {
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < num_threads; ++t)
+      threads.emplace_back(worker);
+    for (auto &thread : threads)
+      thread.join();
+  }
+
+  if (error != nullptr)
+    std::rethrow_exception(error);
+
+  INFO(l) << "Run all models done" << std::endl;
   return true;
 }
 
@@ -231,19 +402,25 @@ void PModelsRunner::save_outputs(const std::string &output_file)
   auto module = import_circle(source_fname);
 
   const auto output_nodes = loco::output_nodes(module->graph());
-  for (uint32_t i = 0; i < module->graph()->outputs()->size(); i++)
+  for (uint32_t r = 0; r < _data_stages.size(); ++r)
   {
-    const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
+    auto &data_stage = _data_stages[r];
+    for (uint32_t i = 0; i < module->graph()->outputs()->size(); i++)
+    {
+      const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
 
-    auto output_name = output_node->name();
-    INFO(l) << "save_outputs() save output node: " << output_name << std::endl;
-    assert(_data_stage.find(output_name) != _data_stage.end());
+      auto output_name = output_node->name();
+      INFO(l) << "save_outputs() save output node: " << output_name << std::endl;
+      assert(data_stage.find(output_name) != data_stage.end());
 
-    auto tensor_data = _data_stage[output_name];
-    auto output_filename = output_file + std::to_string(i);
+      auto &tensor_data = data_stage[output_name];
+      auto output_filename = output_file + std::to_string(i);
+      if (r > 0)
+        output_filename += "." + std::to_string(r);
 
-    write_file(output_filename, tensor_data.data(), tensor_data.size());
-    save_shape(output_filename + ".shape", output_node);
+      write_file(output_filename, tensor_data.data(), tensor_data.size());
+      save_shape(output_filename + ".shape", output_node);
+    }
   }
 }
 
@@ -20,9 +20,20 @@
 #include <crew/PConfig.h>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
+namespace luci
+{
+class Module;
+} // namespace luci
+
+namespace luci_interpreter
+{
+class Interpreter;
+} // namespace luci_interpreter
+
 namespace prunner
 {
 
@@ -34,28 +45,47 @@ using RunModel = std::string;
 
 using RunModels = std::vector<RunModel>;
 
+/**
+ * @brief Partitioned model loaded once and reused for every input record
+ */
+struct RunPart
+{
+  RunModel model_file;
+  std::vector<std::string> inputs;
+  std::unique_ptr<luci::Module> module;
+  std::unique_ptr<luci_interpreter::Interpreter> interpreter;
+};
+
 /**
  * @brief PModelsRunner runs partitioned models from input data file and stores
  *        output data to a file
+ *
+ * Partitions are scheduled by dataflow: a partition runs as soon as all of its inputs are
+ * produced. With multiple threads, independent partitions run concurrently and, with multiple
+ * input records, a partition can start the next record while its successors are still working
+ * on the previous one. Each partition runs records one by one in order.
  */
 class PModelsRunner
 {
 public:
-  PModelsRunner() = default;
+  PModelsRunner();
+  ~PModelsRunner();
 
 public:
   bool load_config(const std::string &filename);
-  void load_inputs(const std::string &input_prefix, int32_t num_inputs);
-  bool run(void);
+  void load_inputs(const std::string &input_prefix, int32_t num_inputs, uint32_t num_records = 1);
+  bool run(uint32_t num_threads = 1);
   void save_outputs(const std::string &output_file);
 
 private:
-  bool is_input_ready(const RunModel &model);
+  bool is_input_ready(const RunPart &part, uint32_t record);
+  bool validate_dataflow(void);
 
 private:
   crew::PConfig _pconfig;
-  RunModels _models_to_run;
-  Buffers _data_stage;
+  std::vector<RunPart> _parts;
+  // data of each input record, tensor name to its data
+  std::vector<Buffers> _data_stages;
 };
 
 } // namespace prunner
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PModelsRunner.h"
+
+#include <luci/CircleExporter.h>
+#include <luci/CircleFileExpContract.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/Module.h>
+
+#include <crew/PConfig.h>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const uint32_t N = 4;
+
+/**
+ * @brief Builds a model of [1, N] float tensors whose nodes are named as their tensors
+ */
+class ModelBuilder
+{
+public:
+  ModelBuilder() : _module(luci::make_module()), _g(loco::make_graph()) {}
+
+public:
+  void input(const std::string &name)
+  {
+    auto graph_input = _g->inputs()->create();
+    auto node = _g->nodes()->create<luci::CircleInput>();
+    set(node, name);
+    node->index(graph_input->index());
+    graph_input->name(name);
+    graph_input->dtype(loco::DataType::FLOAT32);
+    graph_input->shape({1, N});
+    _nodes[name] = node;
+  }
+
+  template <class OP>
+  void binary(const std::string &lhs, const std::string &rhs, const std::string &name)
+  {
+    auto node = _g->nodes()->create<OP>();
+    node->x(_nodes.at(lhs));
+    node->y(_nodes.at(rhs));
+    node->fusedActivationFunction(luci::FusedActFunc::NONE);
+    set(node, name);
+    _nodes[name] = node;
+  }
+
+  void output(const std::string &name)
+  {
+    auto graph_output = _g->outputs()->create();
+    auto node = _g->nodes()->create<luci::CircleOutput>();
+    set(node, name);
+    node->from(_nodes.at(name));
+    node->index(graph_output->index());
+    graph_output->name(name);
+    graph_output->dtype(loco::DataType::FLOAT32);
+    graph_output->shape({1, N});
+  }
+
+  void write(const std::string &path)
+  {
+    _module->add(std::move(_g));
+    luci::CircleExporter exporter;
+    luci::CircleFileExpContract contract(_module.get(), path);
+    if (!exporter.invoke(&contract))
+      throw std::runtime_error("Failed to export " + path);
+  }
+
+private:
+  void set(luci::CircleNode *node, const std::string &name)
+  {
+    node->name(name);
+    node->dtype(loco::DataType::FLOAT32);
+    node->shape({1, N});
+    node->shape_status(luci::ShapeStatus::VALID);
+  }
+
+  std::unique_ptr<luci::Module> _module;
+  std::unique_ptr<loco::Graph> _g;
+  std::map<std::string, luci::CircleNode *> _nodes;
+};
+
+std::vector<float> read_floats(const std::string &path)
+{
+  std::ifstream fs(path, std::ifstream::binary);
+  std::vector<char> bytes{std::istreambuf_iterator<char>(fs), std::istreambuf_iterator<char>()};
+  std::vector<float> values(bytes.size() / sizeof(float));
+  std::copy(bytes.begin(), bytes.end(), reinterpret_cast<char *>(values.data()));
+  return values;
+}
+
+// File of record r, as PModelsRunner names them
+std::string record_path(const std::string &path, uint32_t r)
+{
+  return r > 0 ? path + "." + std::to_string(r) : path;
+}
+
+void write_floats(const std::string &path, const std::vector<float> &values)
+{
+  std::ofstream fs(path, std::ofstream::binary);
+  fs.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(float));
+}
+
+/**
+ * @brief Model of three partitions, where "a" and "b" are independent of each other
+ *
+ *   [ifm] -> ADD(ifm, ifm) -> [a] -+
+ *         -> MUL(ifm, ifm) -> [b] -+-> SUB(a, b) -> [ofm]
+ */
+class PModelsRunnerTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    _dir = ::testing::TempDir() + "prunner_" +
+           ::testing::UnitTest::GetInstance()->current_test_info()->name() + "_";
+
+    crew::PConfig pconfig;
+    pconfig.source = make_part("source", {"ifm"}, {"ofm"});
+    pconfig.parts.emplace_back(make_part("add", {"ifm"}, {"a"}));
+    pconfig.parts.emplace_back(make_part("mul", {"ifm"}, {"b"}));
+    pconfig.parts.emplace_back(make_part("sub", {"a", "b"}, {"ofm"}));
+
+    ModelBuilder source;
+    source.input("ifm");
+    source.binary<luci::CircleAdd>("ifm", "ifm", "a");
+    source.binary<luci::CircleMul>("ifm", "ifm", "b");
+    source.binary<luci::CircleSub>("a", "b", "ofm");
+    source.output("ofm");
+    source.write(pconfig.source.model_file);
+
+    ModelBuilder add;
+    add.input("ifm");
+    add.binary<luci::CircleAdd>("ifm", "ifm", "a");
+    add.output("a");
+    add.write(pconfig.parts[0].model_file);
+
+    ModelBuilder mul;
+    mul.input("ifm");
+    mul.binary<luci::CircleMul>("ifm", "ifm", "b");
+    mul.output("b");
+    mul.write(pconfig.parts[1].model_file);
+
+    ModelBuilder sub;
+    sub.input("a");
+    sub.input("b");
+    sub.binary<luci::CircleSub>("a", "b", "ofm");
+    sub.output("ofm");
+    sub.write(pconfig.parts[2].model_file);
+
+    write_config(pconfig);
+  }
+
+  crew::Part make_part(const std::string &name, const std::vector<std::string> &inputs,
+                       const std::vector<std::string> &outputs)
+  {
+    crew::Part part;
+    part.model_file = _dir + name + ".circle";
+    part.inputs = inputs;
+    part.outputs = outputs;
+    return part;
+  }
+
+  void write_config(const crew::PConfig &pconfig)
+  {
+    std::ofstream fs(config());
+    ASSERT_TRUE(crew::write_ini(fs, pconfig));
+  }
+
+  std::string config(void) const { return _dir + "conn.ini"; }
+
+  // Input of record r, whose values differ by records
+  std::vector<float> input(uint32_t r) const
+  {
+    std::vector<float> values(N);
+    for (uint32_t i = 0; i < N; ++i)
+      values[i] = 0.5f * i - 1.f + r;
+    return values;
+  }
+
+  void write_inputs(const std::string &prefix, uint32_t num_records) const
+  {
+    for (uint32_t r = 0; r < num_records; ++r)
+      write_floats(record_path(prefix + "0", r), input(r));
+  }
+
+  // Runs records with threads, and returns the output of each record
+  std::vector<std::vector<float>> run(const std::string &name, uint32_t num_threads,
+                                      uint32_t num_records)
+  {
+    const auto input_prefix = _dir + name + "_in";
+    const auto output_prefix = _dir + name + "_out";
+    write_inputs(input_prefix, num_records);
+
+    prunner::PModelsRunner runner;
+    EXPECT_TRUE(runner.load_config(config()));
+    runner.load_inputs(input_prefix, 1, num_records);
+    EXPECT_TRUE(runner.run(num_threads));
+    runner.save_outputs(output_prefix);
+
+    std::vector<std::vector<float>> outputs;
+    for (uint32_t r = 0; r < num_records; ++r)
+      outputs.emplace_back(read_floats(record_path(output_prefix + "0", r)));
+    return outputs;
+  }
+
+  // Output of record r, which is computed one record at a time with a single thread
+  std::vector<float> run_sequential(uint32_t r)
+  {
+    const auto name = "seq" + std::to_string(r);
+    const auto input_prefix = _dir + name + "_in";
+    const auto output_prefix = _dir + name + "_out";
+    write_floats(input_prefix + "0", input(r));
+
+    prunner::PModelsRunner runner;
+    EXPECT_TRUE(runner.load_config(config()));
+    runner.load_inputs(input_prefix, 1);
+    EXPECT_TRUE(runner.run(1));
+    runner.save_outputs(output_prefix);
+    return read_floats(output_prefix + "0");
+  }
+
+  std::string _dir;
+};
+
+} // namespace
+
+TEST_F(PModelsRunnerTest, sequential)
+{
+  const auto output = run_sequential(0);
+
+  // ofm = (x + x) - (x * x)
+  const auto x = input(0);
+  ASSERT_EQ(N, output.size());
+  for (uint32_t i = 0; i < N; ++i)
+    EXPECT_FLOAT_EQ(x[i] + x[i] - x[i] * x[i], output[i]);
+}
+
+TEST_F(PModelsRunnerTest, concurrent)
+{
+  const auto expected = run_sequential(0);
+
+  // "add" and "mul" can run at the same time
+  const auto outputs = run("concurrent", 3, 1);
+  ASSERT_EQ(1, outputs.size());
+  EXPECT_EQ(expected, outputs[0]);
+}
+
+TEST_F(PModelsRunnerTest, pipelined)
+{
+  const uint32_t num_records = 5;
+
+  // Parts run later records while their successors work on earlier ones
+  for (uint32_t num_threads : {1u, 2u, 3u, 8u})
+  {
+    const auto outputs = run("pipelined" + std::to_string(num_threads), num_threads, num_records);
+    ASSERT_EQ(num_records, outputs.size());
+    for (uint32_t r = 0; r < num_records; ++r)
+      EXPECT_EQ(run_sequential(r), outputs[r]) << "record " << r << ", threads " << num_threads;
+  }
+}
+
+TEST_F(PModelsRunnerTest, missing_input_NEG)
+{
+  crew::PConfig pconfig;
+  pconfig.source = make_part("source", {"ifm"}, {"ofm"});
+  pconfig.parts.emplace_back(make_part("sub", {"a", "b"}, {"ofm"}));
+  write_config(pconfig);
+  write_inputs(_dir + "neg_in", 1);
+
+  prunner::PModelsRunner runner;
+  ASSERT_TRUE(runner.load_config(config()));
+  runner.load_inputs(_dir + "neg_in", 1);
+  EXPECT_FALSE(runner.run(3));
+}
@@ -15,6 +15,8 @@
  */
 
 #include "PartitionRead.h"
+#include "PartitionBalance.h"
+#include "PartitionCost.h"
 #include "PartitionExport.h"
 #include "HelperPath.h"
 
@@ -42,6 +44,7 @@ const char *opt_def = "--default";
 const char *opt_part_file = "--part_file";
 const char *opt_input_file = "--input_file";
 const char *opt_work_path = "--work_path";
+const char *opt_cost_file = "--cost_file";
 
 void print_version(void)
 {
@@ -63,6 +66,7 @@ void build_arser(arser::Arser &arser)
   arser.add_argument(opt_input_file).required(true).help("Input circle model filename");
   arser.add_argument(opt_work_path)
     .help("Work folder of partition, input files exist and output files are produced");
+  arser.add_argument(opt_cost_file).help("Per-op cost file to use for 'comply=cost'");
 }
 
 std::unique_ptr<luci::Module> load_model(const std::string &input_path)
@@ -128,6 +132,7 @@ int entry(int argc, char **argv)
   // Read partition information
   INFO(l) << "--- Read PartitionConfig-----------------------" << std::endl;
   auto partition = partee::read(partition_path);
+  auto cost_config = partee::read_cost(partition_path);
   INFO(l) << partition << std::endl;
 
   // override with command line arguments
@@ -141,6 +146,10 @@ int entry(int argc, char **argv)
     {
       partition.default_group = arser.get<std::string>(opt_def);
     }
+    if (arser[opt_cost_file])
+    {
+      cost_config.cost_file = arser.get<std::string>(opt_cost_file);
+    }
   }
   if (!luci::validate(partition))
   {
@@ -148,6 +157,14 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
+  if (cost_config.enabled)
+  {
+    INFO(l) << "--- Balance partition by cost------------------" << std::endl;
+    partee::CostModel cost_model;
+    cost_model.load(cost_config, work_folder);
+    partition = partee::balance(module->graph(), partition, cost_model, cost_config.cut_weight);
+  }
+
   INFO(l) << "--- PartitionConfig final----------------------" << std::endl;
   INFO(l) << partition << std::endl;
 
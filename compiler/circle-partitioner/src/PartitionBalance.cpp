@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionBalance.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+
+bool is_op(const luci::CircleNode *node) { return !partee::opcode_name(node).empty(); }
+
+/**
+ * @brief Bytes of tensors crossing the boundary right after each op
+ *
+ * @return cut[p] is bytes of tensors produced by ops[0..p] and used by ops after p
+ */
+std::vector<uint64_t> cut_bytes(const std::vector<luci::CircleNode *> &ops)
+{
+  std::unordered_map<const loco::Node *, int64_t> position;
+  for (size_t i = 0; i < ops.size(); ++i)
+    position[ops[i]] = static_cast<int64_t>(i);
+
+  // last position of ops that use a tensor, -1 if not used by any op
+  auto last_use = [&position](const luci::CircleNode *tensor) {
+    int64_t last = -1;
+    for (auto succ : loco::succs(tensor))
+    {
+      auto it = position.find(succ);
+      if (it != position.end())
+        last = std::max(last, it->second);
+    }
+    return last;
+  };
+
+  std::vector<int64_t> diff(ops.size() + 1, 0);
+  for (size_t i = 0; i < ops.size(); ++i)
+  {
+    // Outputs of multi-output ops are held by virtual nodes like CircleSplitOut
+    std::vector<const luci::CircleNode *> tensors;
+    for (auto succ : loco::succs(ops[i]))
+    {
+      auto succ_node = loco::must_cast<luci::CircleNode *>(succ);
+      if (!is_op(succ_node) && dynamic_cast<luci::CircleOutput *>(succ_node) == nullptr)
+        tensors.push_back(succ_node);
+    }
+    if (tensors.empty())
+      tensors.push_back(ops[i]);
+
+    for (auto tensor : tensors)
+    {
+      auto last = last_use(tensor);
+      if (last > static_cast<int64_t>(i))
+      {
+        const auto bytes = static_cast<int64_t>(partee::tensor_bytes(tensor));
+        diff[i] += bytes;
+        diff[last] -= bytes;
+      }
+    }
+  }
+
+  std::vector<uint64_t> cut(ops.size(), 0);
+  int64_t acc = 0;
+  for (size_t p = 0; p < ops.size(); ++p)
+  {
+    acc += diff[p];
+    cut[p] = static_cast<uint64_t>(acc);
+  }
+  return cut;
+}
+
+} // namespace
+
+namespace partee
+{
+
+luci::PartitionTable balance(loco::Graph *graph, const luci::PartitionTable &table,
+                             const CostModel &cost_model, double cut_weight)
+{
+  LOGGER(l);
+
+  std::vector<luci::CircleNode *> ops;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(graph)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (is_op(circle_node))
+      ops.push_back(circle_node);
+  }
+
+  // Balanced table assigns ops by their names, so every op must have a unique name
+  std::unordered_set<std::string> names;
+  for (auto op : ops)
+  {
+    if (op->name().empty())
+      throw std::runtime_error("Op of " + opcode_name(op) +
+                               " has no name, cannot partition by cost");
+    if (!names.insert(op->name()).second)
+      throw std::runtime_error("Op name '" + op->name() +
+                               "' is not unique, cannot partition by cost");
+  }
+
+  const size_t n = ops.size();
+  const size_t stages = std::min(table.groups.size(), n);
+
+  luci::PartitionTable balanced = table;
+  balanced.comply = luci::PartitionTable::COMPLY::OPNAME;
+  balanced.byopcodes.clear();
+  balanced.byopnames.clear();
+  if (stages == 0)
+    return balanced;
+
+  const auto cut = cut_bytes(ops);
+
+  // prefix[s][i] is sum of costs of ops[0..i) run by group of stage s
+  std::vector<std::vector<double>> prefix(stages, std::vector<double>(n + 1, 0.0));
+  for (size_t s = 0; s < stages; ++s)
+  {
+    for (size_t i = 0; i < n; ++i)
+      prefix[s][i + 1] = prefix[s][i] + cost_model.cost(ops[i], table.groups[s]);
+  }
+
+  // Cost of stage s with ops[a..b), including tensors it receives and sends
+  auto stage_cost = [&](size_t s, size_t a, size_t b) {
+    double cost = prefix[s][b] - prefix[s][a];
+    if (a > 0)
+      cost += cut_weight * cut[a - 1];
+    if (b < n)
+      cost += cut_weight * cut[b - 1];
+    return cost;
+  };
+
+  // best[s][b] is the minimal maximum stage cost for ops[0..b) split into stages 0..s
+  // from[s][b] is where the last stage starts in that split
+  const double inf = std::numeric_limits<double>::infinity();
+  std::vector<std::vector<double>> best(stages, std::vector<double>(n + 1, inf));
+  std::vector<std::vector<size_t>> from(stages, std::vector<size_t>(n + 1, 0));
+  for (size_t b = 1; b <= n; ++b)
+    best[0][b] = stage_cost(0, 0, b);
+  for (size_t s = 1; s < stages; ++s)
+  {
+    // leave at least one op for each of the remaining stages
+    for (size_t b = s + 1; b <= n - (stages - 1 - s); ++b)
+    {
+      for (size_t a = s; a < b; ++a)
+      {
+        double cost = std::max(best[s - 1][a], stage_cost(s, a, b));
+        if (cost < best[s][b])
+        {
+          best[s][b] = cost;
+          from[s][b] = a;
+        }
+      }
+    }
+  }
+
+  // Walk back to assign ops of each stage
+  size_t end = n;
+  for (size_t s = stages; s-- > 0;)
+  {
+    const size_t begin = (s == 0) ? 0 : from[s][end];
+    const auto &group = table.groups[s];
+    INFO(l) << "Stage " << s << " (" << group << "): ops [" << begin << ", " << end
+            << "), cost " << stage_cost(s, begin, end) << std::endl;
+
+    for (size_t i = begin; i < end; ++i)
+      balanced.byopnames[ops[i]->name()] = group;
+    end = begin;
+  }
+  INFO(l) << "Maximum stage cost: " << best[stages - 1][n] << std::endl;
+
+  return balanced;
+}
+
+} // namespace partee
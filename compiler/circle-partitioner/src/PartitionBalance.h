@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CIRCLE_PARTITION_BALANCE_H__
+#define __CIRCLE_PARTITION_BALANCE_H__
+
+#include "PartitionCost.h"
+
+#include <loco.h>
+#include <luci/Partition.h>
+
+namespace partee
+{
+
+/**
+ * @brief Split ops of graph into contiguous stages, one for each group of table, so that
+ *        the maximum stage cost is minimized
+ *
+ * @param cut_weight cost of a tensor byte crossing stages, charged to both stages
+ *
+ * @return PartitionTable of OPNAME comply that assigns every op by its name
+ *
+ * @note Throws if an op has no name or shares its name with another op
+ */
+luci::PartitionTable balance(loco::Graph *graph, const luci::PartitionTable &table,
+                             const CostModel &cost_model, double cut_weight);
+
+} // namespace partee
+
+#endif // __CIRCLE_PARTITION_BALANCE_H__
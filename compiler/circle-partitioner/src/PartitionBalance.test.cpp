@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionBalance.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/test/TestIOGraph.h>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+using namespace luci::test;
+
+/**
+ * @brief Graph of input - relu_0 - relu_1 - ... - relu_(N-1) - output
+ */
+class ReluChainGraph : public TestIOGraph
+{
+public:
+  ReluChainGraph() = default;
+
+public:
+  void init(uint32_t count)
+  {
+    TestIOGraph::init({1, 4}, {1, 4});
+
+    loco::Node *prev = input();
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      auto relu = g()->nodes()->create<luci::CircleRelu>();
+      relu->features(prev);
+      relu->dtype(loco::DataType::FLOAT32);
+      relu->shape({1, 4});
+      relu->shape_status(luci::ShapeStatus::VALID);
+      relu->name("relu_" + std::to_string(i));
+      _relus.push_back(relu);
+      prev = relu;
+    }
+    output()->from(prev);
+  }
+
+public:
+  luci::CircleRelu *relu(uint32_t i) { return _relus.at(i); }
+
+private:
+  std::vector<luci::CircleRelu *> _relus;
+};
+
+luci::PartitionTable cpu_npu_table(void)
+{
+  luci::PartitionTable table;
+  table.groups = {"cpu", "npu"};
+  table.default_group = "cpu";
+  table.comply = luci::PartitionTable::COMPLY::OPCODE;
+  return table;
+}
+
+partee::CostModel cost_model(const std::vector<double> &costs)
+{
+  partee::CostConfig config;
+  for (size_t i = 0; i < costs.size(); ++i)
+    config.costs["relu_" + std::to_string(i)] = costs[i];
+
+  partee::CostModel model;
+  model.load(config, ".");
+  return model;
+}
+
+} // namespace
+
+TEST(PartitionBalanceTest, minimize_max_stage)
+{
+  ReluChainGraph g;
+  g.init(4);
+
+  // [0, 1] | [2, 3] gives max(2, 4) = 4, which is the best of all splits
+  auto balanced = partee::balance(g.g(), cpu_npu_table(), cost_model({1, 1, 3, 1}), 0.0);
+
+  EXPECT_EQ(luci::PartitionTable::COMPLY::OPNAME, balanced.comply);
+  ASSERT_EQ(4, balanced.byopnames.size());
+  EXPECT_EQ("cpu", balanced.byopnames.at("relu_0"));
+  EXPECT_EQ("cpu", balanced.byopnames.at("relu_1"));
+  EXPECT_EQ("npu", balanced.byopnames.at("relu_2"));
+  EXPECT_EQ("npu", balanced.byopnames.at("relu_3"));
+}
+
+TEST(PartitionBalanceTest, cut_weight)
+{
+  ReluChainGraph g;
+  g.init(3);
+  // Only tensor sizes matter here: cutting after relu_1 moves 256 bytes instead of 16
+  g.relu(1)->shape({1, 64});
+
+  auto costs = cost_model({1, 1, 3});
+
+  // Without cut cost, [0, 1] | [2] gives max(2, 3) = 3 and [0] | [1, 2] gives 4
+  auto balanced = partee::balance(g.g(), cpu_npu_table(), costs, 0.0);
+  EXPECT_EQ("cpu", balanced.byopnames.at("relu_1"));
+  EXPECT_EQ("npu", balanced.byopnames.at("relu_2"));
+
+  // With cut cost, [0] | [1, 2] gives max(1 + 16, 4 + 16) = 20 and [0, 1] | [2] gives 259
+  balanced = partee::balance(g.g(), cpu_npu_table(), costs, 1.0);
+  EXPECT_EQ("cpu", balanced.byopnames.at("relu_0"));
+  EXPECT_EQ("npu", balanced.byopnames.at("relu_1"));
+  EXPECT_EQ("npu", balanced.byopnames.at("relu_2"));
+}
+
+TEST(PartitionBalanceTest, more_groups_than_ops)
+{
+  ReluChainGraph g;
+  g.init(1);
+
+  auto balanced = partee::balance(g.g(), cpu_npu_table(), cost_model({1}), 0.0);
+
+  ASSERT_EQ(1, balanced.byopnames.size());
+  EXPECT_EQ("cpu", balanced.byopnames.at("relu_0"));
+}
+
+TEST(PartitionBalanceTest, duplicate_name_NEG)
+{
+  ReluChainGraph g;
+  g.init(3);
+  g.relu(2)->name("relu_0");
+
+  EXPECT_THROW(partee::balance(g.g(), cpu_npu_table(), cost_model({1, 1, 1}), 0.0),
+               std::runtime_error);
+}
+
+TEST(PartitionBalanceTest, empty_name_NEG)
+{
+  ReluChainGraph g;
+  g.init(3);
+  g.relu(1)->name("");
+
+  EXPECT_THROW(partee::balance(g.g(), cpu_npu_table(), cost_model({1, 1, 1}), 0.0),
+               std::runtime_error);
+}
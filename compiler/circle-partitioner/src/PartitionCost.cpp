@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionCost.h"
+
+#include <crew/PConfigIni.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+#include <loco.h>
+#include <loco/IR/DataTypeTraits.h>
+
+#include <json.h>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+const char *_section_partition = "partition";
+const char *_section_COST = "COST";
+
+const char *_comply_cost = "cost";
+
+const char *_key_comply = "comply";
+const char *_key_cost_file = "cost_file";
+const char *_key_cut_weight = "cut_weight";
+const char *_key_underscore = "_";
+
+// cost of a node that has no record
+const double _default_cost = 1.0;
+
+double to_cost(const std::string &key, const std::string &value)
+{
+  try
+  {
+    return std::stod(value);
+  }
+  catch (const std::exception &)
+  {
+    throw std::invalid_argument("Invalid cost value of '" + key + "': " + value);
+  }
+}
+
+std::string normalize(const std::string &name)
+{
+  std::string norm;
+  for (auto c : name)
+  {
+    if (c != '_')
+      norm.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+  }
+  return norm;
+}
+
+/**
+ * @brief Name of onert operation, normalized, that runs a circle OPCODE
+ *
+ * @note Most of OPCODE names match onert names after normalization.
+ *       Only those that differ are listed here.
+ */
+std::string onert_op_name(const std::string &opcode)
+{
+  static const std::unordered_map<std::string, std::string> aliases{
+    {"AVERAGE_POOL_2D", "avgpool2d"}, {"CONCATENATION", "concat"},
+    {"MEAN", "reducemean"},           {"SUM", "reducesum"},
+    {"MAXIMUM", "max"},               {"MINIMUM", "min"},
+    {"RELU6", "relu"},                {"RELU_N1_TO_1", "relu"},
+    {"ARG_MAX", "argminmax"},         {"ARG_MIN", "argminmax"},
+    {"EQUAL", "comparison"},          {"NOT_EQUAL", "comparison"},
+    {"LESS", "comparison"},           {"LESS_EQUAL", "comparison"},
+    {"GREATER", "comparison"},        {"GREATER_EQUAL", "comparison"},
+  };
+  auto it = aliases.find(opcode);
+  return it != aliases.end() ? it->second : normalize(opcode);
+}
+
+// Sum of input and output tensor sizes, same as onert measures an operation size
+uint64_t operation_size(const luci::CircleNode *node)
+{
+  uint64_t size = 0;
+  for (uint32_t i = 0; i < node->arity(); ++i)
+  {
+    auto input = loco::must_cast<luci::CircleNode *>(node->arg(i));
+    if (dynamic_cast<luci::CircleOutputExclude *>(input) == nullptr)
+      size += partee::tensor_bytes(input);
+  }
+  auto succs = loco::succs(node);
+  bool multi_out = !succs.empty();
+  for (auto succ : succs)
+  {
+    auto succ_node = loco::must_cast<luci::CircleNode *>(succ);
+    // Virtual output nodes such as CircleSplitOut hold outputs of multi-output nodes
+    multi_out &= partee::opcode_name(succ_node).empty() &&
+                 dynamic_cast<luci::CircleOutput *>(succ_node) == nullptr;
+  }
+  if (multi_out)
+  {
+    for (auto succ : succs)
+      size += partee::tensor_bytes(loco::must_cast<luci::CircleNode *>(succ));
+  }
+  else
+    size += partee::tensor_bytes(node);
+  return size;
+}
+
+} // namespace
+
+namespace partee
+{
+
+std::string opcode_name(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+#define CIRCLE_NODE(OPCODE, CLASS) \
+  case luci::CircleOpcode::OPCODE: \
+    return #OPCODE;
+#define CIRCLE_VNODE(OPCODE, CLASS) \
+  case luci::CircleOpcode::OPCODE: \
+    return "";
+#include <luci/IR/CircleNodes.lst>
+#undef CIRCLE_VNODE
+#undef CIRCLE_NODE
+    default:
+      break;
+  }
+  return "";
+}
+
+uint64_t tensor_bytes(const luci::CircleNode *node)
+{
+  if (node->shape_status() != luci::ShapeStatus::VALID)
+    return 0;
+  uint64_t size = loco::size(node->dtype());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    size *= node->dim(i).known() ? node->dim(i).value() : 1;
+  return size;
+}
+
+CostConfig read_cost(const std::string &path)
+{
+  CostConfig config;
+
+  auto sections = crew::read_ini(path);
+  auto partition = crew::find(sections, _section_partition);
+  if (crew::find(partition, _key_comply) != _comply_cost)
+    return config;
+
+  config.enabled = true;
+  config.cost_file = crew::find(partition, _key_cost_file);
+  auto cut_weight = crew::find(partition, _key_cut_weight);
+  if (!cut_weight.empty())
+    config.cut_weight = to_cost(_key_cut_weight, cut_weight);
+
+  auto costs = crew::find(sections, _section_COST);
+  for (auto &item : costs.items)
+    config.costs[item.first] = to_cost(item.first, item.second);
+
+  return config;
+}
+
+void CostModel::load(const CostConfig &config, const std::string &work_path)
+{
+  if (!config.cost_file.empty())
+  {
+    auto path = work_path + "/" + config.cost_file;
+    auto pos = path.find_last_of('.');
+    if (pos != std::string::npos && path.substr(pos) == ".json")
+      load_exec_time(path);
+    else
+      load_ini(path);
+  }
+
+  // costs in partition file override those of cost file
+  for (auto &item : config.costs)
+    _costs[item.first] = item.second;
+}
+
+void CostModel::load_ini(const std::string &path)
+{
+  auto sections = crew::read_ini(path);
+  auto costs = crew::find(sections, _section_COST);
+  for (auto &item : costs.items)
+    _costs[item.first] = to_cost(item.first, item.second);
+}
+
+void CostModel::load_exec_time(const std::string &path)
+{
+  std::ifstream file(path);
+  if (!file.is_open())
+    throw std::runtime_error("Failed to open cost file: " + path);
+
+  Json::Value root;
+  JSONCPP_STRING errs;
+  Json::CharReaderBuilder builder;
+  if (!Json::parseFromStream(builder, file, &root, &errs))
+    throw std::runtime_error("Failed to parse cost file: " + path + ". " + errs);
+
+  auto must_be = [&path](const Json::Value &value, Json::ValueType type) {
+    if (value.type() != type)
+      throw std::runtime_error("Invalid exec_time format of cost file: " + path);
+  };
+
+  // {"backend": {"op name": {"quantized": [[operation size, time], ...]}}}
+  must_be(root, Json::objectValue);
+  for (const auto &backend : root.getMemberNames())
+  {
+    const auto &ops = root[backend];
+    must_be(ops, Json::objectValue);
+    for (const auto &op : ops.getMemberNames())
+    {
+      const auto &quants = ops[op];
+      must_be(quants, Json::objectValue);
+      auto &op_times = _exec_times[backend][normalize(op)];
+      for (const auto &quant : quants.getMemberNames())
+      {
+        const auto &records = quants[quant];
+        must_be(records, Json::arrayValue);
+        auto &size_times = op_times[quant == "1"];
+        for (const auto &record : records)
+        {
+          if (!record.isArray() || record.size() != 2 || !record[0].isNumeric() ||
+              !record[1].isNumeric())
+            throw std::runtime_error("Invalid exec_time record of " + op);
+          size_times[record[0].asUInt64()] = record[1].asDouble();
+        }
+      }
+    }
+  }
+}
+
+double CostModel::cost(const luci::CircleNode *node, const std::string &group) const
+{
+  auto it = _costs.find(node->name());
+  if (it != _costs.end())
+    return it->second;
+
+  auto opcode = opcode_name(node);
+  it = _costs.find(opcode);
+  if (it != _costs.end())
+    return it->second;
+
+  if (!_exec_times.empty())
+  {
+    // Use records of the group if any, otherwise records of the first backend by name
+    auto backend = _exec_times.find(group);
+    if (backend == _exec_times.end())
+      backend = _exec_times.begin();
+
+    auto op = backend->second.find(onert_op_name(opcode));
+    if (op != backend->second.end())
+    {
+      // onert regards an operation quantized when its first input is uint8
+      bool quant = node->arity() > 0 &&
+                   loco::must_cast<luci::CircleNode *>(node->arg(0))->dtype() == loco::DataType::U8;
+      auto times = op->second.find(quant);
+      if (times == op->second.end())
+        times = op->second.begin();
+
+      // Take the record whose operation size is nearest
+      const auto &size_times = times->second;
+      const auto size = operation_size(node);
+      auto upper = size_times.lower_bound(size);
+      if (upper == size_times.end())
+        return std::prev(upper)->second;
+      if (upper == size_times.begin() || upper->first - size < size - std::prev(upper)->first)
+        return upper->second;
+      return std::prev(upper)->second;
+    }
+  }
+
+  it = _costs.find(_key_underscore);
+  if (it != _costs.end())
+    return it->second;
+
+  LOGGER(l);
+  INFO(l) << "No cost for " << node->name() << "(" << opcode << "), use default" << std::endl;
+  return _default_cost;
+}
+
+} // namespace partee
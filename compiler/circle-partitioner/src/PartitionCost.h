@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CIRCLE_PARTITION_COST_H__
+#define __CIRCLE_PARTITION_COST_H__
+
+#include <luci/IR/CircleNode.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+namespace partee
+{
+
+/**
+ * @brief Cost-model options for 'comply=cost' partitioning
+ */
+struct CostConfig
+{
+  bool enabled = false;
+  // file with per-op costs, onert exec_time JSON or INI with [COST] section
+  std::string cost_file;
+  // cost of a tensor byte crossing partitions
+  double cut_weight = 0.0;
+  // per-op costs by op name or OPCODE, given in [COST] section of partition file
+  std::unordered_map<std::string, double> costs;
+};
+
+/**
+ * @brief Reads cost-model options from partition file
+ */
+CostConfig read_cost(const std::string &path);
+
+/**
+ * @brief CostModel provides execution cost of a node when run by a group(backend)
+ */
+class CostModel final
+{
+public:
+  /**
+   * @brief Load costs of config, where cost_file is relative to work_path
+   */
+  void load(const CostConfig &config, const std::string &work_path);
+
+public:
+  double cost(const luci::CircleNode *node, const std::string &group) const;
+
+private:
+  void load_ini(const std::string &path);
+  void load_exec_time(const std::string &path);
+
+private:
+  // costs by op name or OPCODE
+  std::unordered_map<std::string, double> _costs;
+
+  // onert exec_time: backend -> normalized op name -> quantized -> operation size -> time
+  using SizeTimes = std::map<uint64_t, double>;
+  std::map<std::string, std::map<std::string, std::map<bool, SizeTimes>>> _exec_times;
+};
+
+/**
+ * @brief Name of OPCODE of a node, empty for virtual nodes such as CircleInput
+ */
+std::string opcode_name(const luci::CircleNode *node);
+
+/**
+ * @brief Size of tensor of a node in bytes, unknown dimensions are regarded as 1
+ */
+uint64_t tensor_bytes(const luci::CircleNode *node);
+
+} // namespace partee
+
+#endif // __CIRCLE_PARTITION_COST_H__
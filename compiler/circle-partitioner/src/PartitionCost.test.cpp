@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionCost.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/test/TestIOGraph.h>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+
+using namespace luci::test;
+
+/**
+ * @brief Graph of input - relu - output, with FLOAT32 [1, 4] tensors
+ */
+class ReluGraph : public TestIOGraph
+{
+public:
+  ReluGraph() = default;
+
+public:
+  void init(void)
+  {
+    TestIOGraph::init({1, 4}, {1, 4});
+
+    _relu = g()->nodes()->create<luci::CircleRelu>();
+    _relu->features(input());
+    _relu->dtype(loco::DataType::FLOAT32);
+    _relu->shape({1, 4});
+    _relu->shape_status(luci::ShapeStatus::VALID);
+    _relu->name("relu");
+    output()->from(_relu);
+  }
+
+public:
+  luci::CircleRelu *relu(void) { return _relu; }
+
+private:
+  luci::CircleRelu *_relu = nullptr;
+};
+
+std::string write_file(const std::string &name, const std::string &text)
+{
+  std::ofstream file(::testing::TempDir() + name);
+  file << text;
+  return name;
+}
+
+} // namespace
+
+TEST(PartitionCostTest, read_cost)
+{
+  const std::string text = "[partition]\n"
+                           "backends=cpu,npu\n"
+                           "default=cpu\n"
+                           "comply=cost\n"
+                           "cost_file=op.ini\n"
+                           "cut_weight=0.5\n"
+                           "[COST]\n"
+                           "RELU=2\n";
+  auto config = partee::read_cost(::testing::TempDir() + write_file("partee_cost.part", text));
+
+  EXPECT_TRUE(config.enabled);
+  EXPECT_EQ("op.ini", config.cost_file);
+  EXPECT_DOUBLE_EQ(0.5, config.cut_weight);
+  ASSERT_EQ(1, config.costs.size());
+  EXPECT_DOUBLE_EQ(2.0, config.costs.at("RELU"));
+}
+
+TEST(PartitionCostTest, ini_cost_file)
+{
+  ReluGraph g;
+  g.init();
+
+  partee::CostConfig config;
+  config.cost_file = write_file("partee_cost.ini", "[COST]\n"
+                                                   "RELU=3\n"
+                                                   "_=0.5\n");
+  partee::CostModel model;
+  model.load(config, ::testing::TempDir());
+
+  // By OPCODE
+  EXPECT_DOUBLE_EQ(3.0, model.cost(g.relu(), "cpu"));
+
+  // Op name has priority over OPCODE, and partition file overrides cost file
+  config.costs["relu"] = 7.0;
+  partee::CostModel model_name;
+  model_name.load(config, ::testing::TempDir());
+  EXPECT_DOUBLE_EQ(7.0, model_name.cost(g.relu(), "cpu"));
+
+  // '_' is used for nodes without any cost
+  EXPECT_DOUBLE_EQ(0.5, model.cost(g.input(), "cpu"));
+}
+
+TEST(PartitionCostTest, exec_time_cost_file)
+{
+  ReluGraph g;
+  g.init();
+
+  // Operation size of relu is 16 bytes of input plus 16 bytes of output
+  partee::CostConfig config;
+  config.cost_file = write_file("partee_cost.exec_time.json", R"({
+    "cpu": { "ReLU": { "0": [[30, 10.0], [320, 100.0]] } },
+    "npu": { "ReLU": { "0": [[32, 1.0]] } }
+  })");
+  partee::CostModel model;
+  model.load(config, ::testing::TempDir());
+
+  EXPECT_DOUBLE_EQ(10.0, model.cost(g.relu(), "cpu"));
+  EXPECT_DOUBLE_EQ(1.0, model.cost(g.relu(), "npu"));
+  // Unknown group uses records of the first backend by name
+  EXPECT_DOUBLE_EQ(10.0, model.cost(g.relu(), "gpu"));
+
+  // Bigger tensors take the record of nearest operation size
+  g.relu()->shape({1, 64});
+  EXPECT_DOUBLE_EQ(100.0, model.cost(g.relu(), "cpu"));
+}
+
+TEST(PartitionCostTest, invalid_exec_time_NEG)
+{
+  partee::CostConfig config;
+  config.cost_file = write_file("partee_invalid.exec_time.json", R"({ "cpu": { "ReLU": )");
+  partee::CostModel model;
+
+  EXPECT_THROW(model.load(config, ::testing::TempDir()), std::runtime_error);
+}
+
+TEST(PartitionCostTest, invalid_exec_time_record_NEG)
+{
+  partee::CostConfig config;
+  config.cost_file =
+    write_file("partee_invalid_record.exec_time.json", R"({ "cpu": { "ReLU": { "0": [[30]] } } })");
+  partee::CostModel model;
+
+  EXPECT_THROW(model.load(config, ::testing::TempDir()), std::runtime_error);
+}
+
+TEST(PartitionCostTest, invalid_cost_value_NEG)
+{
+  partee::CostConfig config;
+  config.cost_file = write_file("partee_invalid.ini", "[COST]\n"
+                                                      "RELU=fast\n");
+  partee::CostModel model;
+
+  EXPECT_THROW(model.load(config, ::testing::TempDir()), std::invalid_argument);
+}
@@ -34,6 +34,7 @@ const char *_section_OPNAME = "OPNAME";
 
 const char *_comply_opcode = "opcode";
 const char *_comply_opname = "opname";
+const char *_comply_cost = "cost";
 
 const char *_key_backends = "backends";
 const char *_key_default = "default";
@@ -78,6 +79,12 @@ luci::PartitionTable parse_table(const crew::Sections &sections)
         table.comply = luci::PartitionTable::COMPLY::OPNAME;
         continue;
       }
+      if (comply == _comply_cost)
+      {
+        // ops will be assigned by their names from cost model
+        table.comply = luci::PartitionTable::COMPLY::OPNAME;
+        continue;
+      }
       throw std::runtime_error("Invalid or comply is not set");
     }
   }
@@ -181,6 +181,8 @@ int entry(int argc, char **argv)
 
   const std::string gpd = "--generate_profile_data";
 
+  const std::string mmap_import = "--mmap_import";
+
   const std::string save_min_max = "--save_min_max";
 
   arser::Arser arser("circle-quantizer provides circle model quantization");
@@ -269,6 +271,13 @@ int entry(int argc, char **argv)
   arser.add_argument(gpd).nargs(0).required(false).default_value(false).help(
     "This will turn on profiling data generation.");
 
+  arser.add_argument(mmap_import)
+    .nargs(0)
+    .required(false)
+    .default_value(false)
+    .help("Map input model to memory and copy constants only when they are modified. "
+          "Input model file should not be modified while running.");
+
   try
   {
     arser.parse(argc, argv);
@@ -485,6 +494,8 @@ int entry(int argc, char **argv)
 
   if (arser[gpd])
     settings->set(luci::UserSettings::Key::ProfilingDataGen, true);
+  if (arser[mmap_import])
+    settings->set(luci::UserSettings::Key::MMapImport, true);
 
   // Load model from the file
   luci::ImporterEx importerex;
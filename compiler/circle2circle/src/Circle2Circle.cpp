@@ -214,6 +214,11 @@ int entry(int argc, char **argv)
   add_switch(arser, "--disable_validation",
              "This will turn off operator validations. May help input model investigation.");
   add_switch(arser, "--generate_profile_data", "This will turn on profiling data generation.");
+  add_switch(arser, "--mmap_import",
+             "Map input model to memory and copy constants only when they are modified. "
+             "Input model file should not be modified while running.");
+  add_switch(arser, "--report_pass_time",
+             "This will print the number of runs and elapsed time of each optimization pass.");
 
   // NOTE Experimental options; these will be removed someday
   //      Add experimental options here
@@ -368,6 +373,8 @@ int entry(int argc, char **argv)
     settings->set(luci::UserSettings::Key::DisableValidation, true);
   if (arser.get<bool>("--generate_profile_data"))
     settings->set(luci::UserSettings::Key::ProfilingDataGen, true);
+  if (arser.get<bool>("--mmap_import"))
+    settings->set(luci::UserSettings::Key::MMapImport, true);
 
   std::string input_path = arser.get<std::string>("input");
   std::string output_path = arser.get<std::string>("output");
@@ -393,6 +400,9 @@ int entry(int argc, char **argv)
                    arser.get<std::string>("--sparsify_block_map"));
   }
 
+  if (arser.get<bool>("--report_pass_time"))
+    options->param(AlgorithmParameters::Optimize_report_pass_time, "true");
+
   if (arser.get<bool>("--convert_nchw_to_nhwc"))
   {
     options->enable(Algorithms::ConvertNCHWToNHWC);
@@ -154,6 +154,21 @@ private:
   uint32_t _index;
 };
 
+/**
+ * @brief Observer of changes in the nodes of a graph
+ *
+ * NOTE A node is changed when it is created, or when an edge from or to the node is connected
+ *      or disconnected. Changes in the other attributes of a node are not notified.
+ */
+struct GraphObserver
+{
+  virtual ~GraphObserver() = default;
+
+  virtual void node_changed(Node *node) = 0;
+  // Called before a node is destroyed
+  virtual void node_destroyed(Node *node) = 0;
+};
+
 /**
  * @brief A neural network graph
  */
@@ -222,7 +237,14 @@ public:
   OutputContext *outputs(void) { return &_output_ctx; }
   const OutputContext *outputs(void) const { return &_output_ctx; }
 
+public:
+  GraphObserver *observer(void) const { return _observer; }
+  // Graph has at most one observer, and nullptr detaches it
+  void observer(GraphObserver *observer) { _observer = observer; }
+
 private:
+  // NOTE _observer is declared first so that it outlives nodes
+  GraphObserver *_observer = nullptr;
   NodeContext _node_ctx;
   InputContext _input_ctx;
   OutputContext _output_ctx;
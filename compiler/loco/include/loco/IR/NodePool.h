@@ -38,16 +38,16 @@ public:
   {
     std::unique_ptr<Derived> ptr{new Derived(std::forward<Args>(args)...)};
     ptr->graph(_graph);
-    return ObjectPool<Node>::take<Derived>(std::move(ptr));
+    auto node = ObjectPool<Node>::take<Derived>(std::move(ptr));
+    created(node);
+    return node;
   }
 
-  void destroy(Node *node)
-  {
-    if (!ObjectPool<Node>::erase(node))
-    {
-      throw std::invalid_argument{"node"};
-    }
-  }
+  void destroy(Node *node);
+
+private:
+  // Notify the observer of the graph that a node is created
+  void created(Node *node);
 
 private:
   /// Only "Graph" is permitted to invoke this private method.
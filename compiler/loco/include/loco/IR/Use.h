@@ -48,11 +48,7 @@ public:
   Use(const Use &) = delete;
   Use(Use &&) = delete;
 
-  ~Use()
-  {
-    // Unlink itself from the node
-    node(nullptr);
-  }
+  ~Use();
 
 public:
   Node *node(void) const { return _node; }
@@ -27,6 +27,16 @@ struct NamedElement final : private loco::NamedEntity
   LOCO_NAMED_ENTITY_EXPOSE;
 };
 
+/// @brief Record nodes that loco::GraphObserver is notified of
+struct RecordObserver final : public loco::GraphObserver
+{
+  void node_changed(loco::Node *node) final { changed.insert(node); }
+  void node_destroyed(loco::Node *node) final { destroyed.insert(node); }
+
+  std::set<loco::Node *> changed;
+  std::set<loco::Node *> destroyed;
+};
+
 } // namespace
 
 TEST(NamedTest, constructor)
@@ -227,3 +237,41 @@ TEST(GraphTest, graph_name_nullptr_NEG)
 
   EXPECT_ANY_THROW(g->name(nullptr));
 }
+
+TEST(GraphTest, observer)
+{
+  auto g = loco::make_graph();
+  auto pull = g->nodes()->create<loco::Pull>();
+  auto push = g->nodes()->create<loco::Push>();
+
+  RecordObserver observer;
+  g->observer(&observer);
+  ASSERT_EQ(&observer, g->observer());
+
+  // Created node
+  auto relu = g->nodes()->create<loco::ReLU>();
+  ASSERT_EQ(std::set<loco::Node *>({relu}), observer.changed);
+  observer.changed.clear();
+
+  // Both ends of connected edges
+  relu->input(pull);
+  push->from(relu);
+  ASSERT_EQ(std::set<loco::Node *>({pull, relu, push}), observer.changed);
+  observer.changed.clear();
+
+  // Setting the same input again is not a change
+  relu->input(pull);
+  ASSERT_TRUE(observer.changed.empty());
+
+  // Inputs of a destroyed node lose their user
+  push->from(pull);
+  observer.changed.clear();
+  g->nodes()->destroy(relu);
+  ASSERT_EQ(std::set<loco::Node *>({relu}), observer.destroyed);
+  ASSERT_EQ(std::set<loco::Node *>({pull}), observer.changed);
+
+  g->observer(nullptr);
+  observer.changed.clear();
+  g->nodes()->create<loco::ReLU>()->input(pull);
+  ASSERT_TRUE(observer.changed.empty());
+}
@@ -15,6 +15,7 @@
  */
 
 #include "loco/IR/NodePool.h"
+#include "loco/IR/Graph.h"
 
 namespace loco
 {
@@ -28,4 +29,25 @@ NodePool::~NodePool()
   }
 }
 
+void NodePool::destroy(Node *node)
+{
+  if (_graph != nullptr && _graph->observer() != nullptr && node->graph() == _graph)
+  {
+    _graph->observer()->node_destroyed(node);
+  }
+
+  if (!ObjectPool<Node>::erase(node))
+  {
+    throw std::invalid_argument{"node"};
+  }
+}
+
+void NodePool::created(Node *node)
+{
+  if (_graph != nullptr && _graph->observer() != nullptr)
+  {
+    _graph->observer()->node_changed(node);
+  }
+}
+
 } // namespace loco
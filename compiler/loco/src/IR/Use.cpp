@@ -16,18 +16,51 @@
 
 #include "loco/IR/Use.h"
 #include "loco/IR/Node.h"
+#include "loco/IR/Graph.h"
 
 #include <cassert>
 
+namespace
+{
+
+void notify_changed(loco::Node *node)
+{
+  auto g = node->graph();
+  if (g != nullptr && g->observer() != nullptr)
+  {
+    g->observer()->node_changed(node);
+  }
+}
+
+} // namespace
+
 namespace loco
 {
 
+Use::~Use()
+{
+  // Unlink itself from the node, where the user is being destroyed and is not notified
+  if (_node != nullptr)
+  {
+    assert(_node->_uses.find(this) != _node->_uses.end());
+    _node->_uses.erase(this);
+    notify_changed(_node);
+    _node = nullptr;
+  }
+}
+
 void Use::node(Node *node)
 {
+  if (_node == node)
+  {
+    return;
+  }
+
   if (_node != nullptr)
   {
     assert(_node->_uses.find(this) != _node->_uses.end());
     _node->_uses.erase(this);
+    notify_changed(_node);
     _node = nullptr;
   }
 
@@ -37,9 +70,12 @@ void Use::node(Node *node)
   {
     _node = node;
     _node->_uses.insert(this);
+    notify_changed(_node);
   }
 
   assert(_node == node);
+
+  notify_changed(_user);
 }
 
 } // namespace loco
@@ -34,6 +34,7 @@ struct UserSettings
     DisableValidation,
     ProfilingDataGen,
     ExecutionPlanGen,
+    MMapImport,
   };
 
   static UserSettings *settings();
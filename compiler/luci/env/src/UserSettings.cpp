@@ -32,6 +32,7 @@ private:
   bool _DisableValidation{false};
   bool _ProfilingDataGen{false};
   bool _ExecutionPlanGen{false};
+  bool _MMapImport{false};
 };
 
 void UserSettingsImpl::set(const Key key, bool value)
@@ -50,6 +51,9 @@ void UserSettingsImpl::set(const Key key, bool value)
     case Key::ExecutionPlanGen:
       _ExecutionPlanGen = value;
       break;
+    case Key::MMapImport:
+      _MMapImport = value;
+      break;
     default:
       throw std::runtime_error("Invalid key in boolean set");
       break;
@@ -68,6 +72,8 @@ bool UserSettingsImpl::get(const Key key) const
       return _ProfilingDataGen;
     case Key::ExecutionPlanGen:
       return _ExecutionPlanGen;
+    case Key::MMapImport:
+      return _MMapImport;
     default:
       throw std::runtime_error("Invalid key in boolean get");
       break;
@@ -87,6 +87,20 @@ TEST(UserSettings, ProfilingDataGen)
   ASSERT_TRUE(settings->get(luci::UserSettings::Key::ProfilingDataGen));
 }
 
+TEST(UserSettings, MMapImport)
+{
+  auto settings = luci::UserSettings::settings();
+  ASSERT_NE(nullptr, settings);
+
+  settings->set(luci::UserSettings::Key::MMapImport, false);
+  ASSERT_FALSE(settings->get(luci::UserSettings::Key::MMapImport));
+
+  settings->set(luci::UserSettings::Key::MMapImport, true);
+  ASSERT_TRUE(settings->get(luci::UserSettings::Key::MMapImport));
+
+  settings->set(luci::UserSettings::Key::MMapImport, false);
+}
+
 TEST(UserSettings, undefined_set_NEG)
 {
   auto settings = luci::UserSettings::settings();
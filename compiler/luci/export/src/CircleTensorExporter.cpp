@@ -350,21 +350,21 @@ encodeOpBufferByDType(FlatBufferBuilder &builder, SerializedModelData &md, luci:
 {
   using NativeType = typename loco::DataTypeImpl<DT>::Type;
 
-  std::vector<NativeType> raw_data;
-  const uint32_t size = c->size<DT>();
-  raw_data.reserve(size);
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    raw_data.push_back(c->at<DT>(i));
-  }
+  // NOTE read values with const accessor so that constants referring to external data,
+  //      like a memory mapped input model, are written without copying them first
+  const luci::CircleConst *cc = c;
+  const uint32_t size = cc->size<DT>();
   const size_t raw_size = size * sizeof(NativeType);
+  const uint8_t *raw_data =
+    size > 0 ? reinterpret_cast<const uint8_t *>(&cc->at<DT>(0)) : nullptr;
 
   if (md._ext_buffer)
   {
     // TODO optimize this if this operation takes long or much memory
     SerializedModelData::BufferData buffer_data;
     buffer_data.resize(raw_size);
-    std::memcpy(buffer_data.data(), raw_data.data(), raw_size);
+    if (raw_size > 0)
+      std::memcpy(buffer_data.data(), raw_data, raw_size);
 
     int32_t buffer_index = md._buffers.size();
     md._buffer_data_map.emplace(buffer_index, buffer_data);
@@ -373,7 +373,7 @@ encodeOpBufferByDType(FlatBufferBuilder &builder, SerializedModelData &md, luci:
     return circle::CreateBuffer(builder, 0 /* data */, 1 /* offset */, 1 /* size */);
   }
 
-  auto array_offset = builder.CreateVector(reinterpret_cast<uint8_t *>(raw_data.data()), raw_size);
+  auto array_offset = builder.CreateVector(raw_data, raw_size);
   return CreateBuffer(builder, array_offset);
 }
 
@@ -544,19 +544,24 @@ encodeSparsityParameters(FlatBufferBuilder &builder, luci::SparsityParam *sparsi
                                                 &sparsityparam->block_map, &dim_metadata_vec);
 }
 
-template <loco::DataType DT> bool has_same_elements(luci::CircleConst *lhs, luci::CircleConst *rhs)
+template <loco::DataType DT>
+bool has_same_elements(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   assert(lhs->dtype() == DT);
   assert(rhs->dtype() == DT);
   assert(lhs->size<DT>() == rhs->size<DT>());
 
+  // constants sharing the same external data, like clones of an imported constant
+  if (lhs->external_data() != nullptr && lhs->external_data() == rhs->external_data())
+    return true;
+
   for (uint32_t i = 0; i < lhs->size<DT>(); ++i)
     if (lhs->at<DT>(i) != rhs->at<DT>(i))
       return false;
   return true;
 }
 
-bool has_same_values(luci::CircleConst *lhs, luci::CircleConst *rhs)
+bool has_same_values(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   if (lhs->dtype() != rhs->dtype())
     return false;
@@ -123,11 +123,17 @@ public:
   const uint8_t *file_data(uint64_t offset) const;
   size_t file_size(void) const { return _file_size; }
 
+public:
+  // file data that constants can share instead of copying, nullptr if not shareable
+  void shared_file_data(std::shared_ptr<const uint8_t> data) { _shared_file_data = data; }
+  const std::shared_ptr<const uint8_t> &shared_file_data(void) const { return _shared_file_data; }
+
 private:
   const circle::Model *_model{nullptr};
   const circle::SubGraph *_current_subgraph{nullptr};
   const uint8_t *_file_data{nullptr};
   size_t _file_size{0};
+  std::shared_ptr<const uint8_t> _shared_file_data;
 };
 
 } // namespace luci
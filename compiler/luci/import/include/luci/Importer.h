@@ -45,11 +45,14 @@ public:
   // TODO move to private
   std::unique_ptr<Module> importModule(const circle::Model *model) const;
   std::unique_ptr<Module> importModule(const uint8_t *data, size_t size);
+  // constants refer to 'data' instead of copying it and keep it alive
+  std::unique_ptr<Module> importModule(std::shared_ptr<const uint8_t> data, size_t size);
 
 private:
   const GraphBuilderSource *_source = nullptr;
   const uint8_t *_file_data = nullptr;
   size_t _file_size = 0;
+  std::shared_ptr<const uint8_t> _shared_file_data;
 };
 
 } // namespace luci
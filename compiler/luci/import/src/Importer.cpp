@@ -283,6 +283,7 @@ std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
   {
     if (!reader.parse(model, _file_data, _file_size))
       return nullptr;
+    reader.shared_file_data(_shared_file_data);
   }
   else
   {
@@ -391,4 +392,12 @@ std::unique_ptr<Module> Importer::importModule(const uint8_t *data, size_t size)
   return importModule(circle_model);
 }
 
+std::unique_ptr<Module> Importer::importModule(std::shared_ptr<const uint8_t> data, size_t size)
+{
+  _shared_file_data = data;
+  auto module = importModule(data.get(), size);
+  _shared_file_data.reset();
+  return module;
+}
+
 } // namespace luci
@@ -17,7 +17,10 @@
 #include "luci/Importer.h"
 #include "luci/ImporterEx.h"
 
+#include <luci/UserSettings.h>
+
 #include <foder/FileLoader.h>
+#include <foder/FileMapper.h>
 
 #include <memory>
 #include <iostream>
@@ -27,12 +30,25 @@ namespace luci
 
 std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_path) const
 {
-  foder::FileLoader file_loader{input_path};
+  // NOTE with MMapImport, the file is mapped and constants refer to the mapping
+  //      so that large constants are neither read nor copied until they are used or modified
+  const bool mmap_import = UserSettings::settings()->get(UserSettings::Key::MMapImport);
+
   std::vector<char> model_data;
+  std::shared_ptr<const foder::MappedFile> mapped_data;
 
   try
   {
-    model_data = file_loader.load();
+    if (mmap_import)
+    {
+      foder::FileMapper file_mapper{input_path};
+      mapped_data = file_mapper.map();
+    }
+    else
+    {
+      foder::FileLoader file_loader{input_path};
+      model_data = file_loader.load();
+    }
   }
   catch (const std::runtime_error &err)
   {
@@ -40,8 +56,9 @@ std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_
     return nullptr;
   }
 
-  auto data_data = reinterpret_cast<uint8_t *>(model_data.data());
-  auto data_size = model_data.size();
+  auto data_data = mmap_import ? mapped_data->data()
+                               : reinterpret_cast<const uint8_t *>(model_data.data());
+  auto data_size = mmap_import ? mapped_data->size() : model_data.size();
 
   flatbuffers::Verifier verifier{data_data, data_size};
   if (!circle::VerifyModelBuffer(verifier))
@@ -51,6 +68,11 @@ std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_
   }
 
   Importer importer(_source);
+  if (mmap_import)
+  {
+    std::shared_ptr<const uint8_t> shared_data(mapped_data, data_data);
+    return importer.importModule(shared_data, data_size);
+  }
   return importer.importModule(data_data, data_size);
 }
 
@@ -19,6 +19,7 @@
 #include "luci/Import/CircleReader.h"
 
 #include <luci/IR/Nodes/CircleConst.h>
+#include <luci/IR/DataTypeHelper.h>
 #include <luci/Log.h>
 
 #include <loco.h>
@@ -139,6 +140,35 @@ void copy_data_4(const VectorWrapper<uint8_t> &raw_data, uint32_t num_elements,
   }
 }
 
+/**
+ * @brief return true if the constant can refer to raw data in shared file data
+ *        instead of copying it
+ */
+bool can_refer(const CircleReader *reader, loco::DataType dtype, const uint8_t *raw_data)
+{
+  if (reader->shared_file_data() == nullptr || raw_data == nullptr)
+    return false;
+
+  // NOTE STRING is de-serialized and 4bit types are unpacked so they are copied
+  switch (dtype)
+  {
+    case loco::DataType::FLOAT32:
+    case loco::DataType::FLOAT16:
+    case loco::DataType::U8:
+    case loco::DataType::S8:
+    case loco::DataType::S16:
+    case loco::DataType::S32:
+    case loco::DataType::S64:
+    case loco::DataType::BOOL:
+      break;
+    default:
+      return false;
+  }
+
+  // elements should be accessed with proper alignment
+  return reinterpret_cast<uintptr_t>(raw_data) % luci::size(dtype) == 0;
+}
+
 } // namespace
 
 namespace luci
@@ -170,10 +200,14 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
     // NOTE this shouldn't happen
     throw std::runtime_error("Cirlce file with invalid extended Buffer.");
   }
+  const auto dtype = luci_datatype(const_tensor->type());
   // temporary buffer to provide raw data from file
   // must have life time same or longer than 'buffer' variable
   std::vector<uint8_t> temp_buffer;
   luci::VectorWrapper<uint8_t> buffer(nullptr);
+  // raw data in shared file data the constant refers to, instead of 'buffer'
+  const uint8_t *ref_data = nullptr;
+  size_t ref_size = 0;
   if (r_buffer->offset() > 1)
   {
     if (r_buffer->size() >= std::numeric_limits<uint32_t>::max())
@@ -182,10 +216,6 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
       throw std::runtime_error("Cirlce file with invalid extended Buffer.");
     }
     uint32_t r_size = static_cast<uint32_t>(r_buffer->size());
-    // match binary level to flatbuffers::Vector
-    temp_buffer.resize(r_size + sizeof(uint32_t));
-
-    uint8_t *t_data = temp_buffer.data();
     const uint8_t *f_data = reader->file_data(r_buffer->offset());
     if (f_data == nullptr)
     {
@@ -193,28 +223,47 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
       assert(false);
       return nullptr;
     }
-    memcpy(t_data, &r_size, sizeof(r_size));
-    t_data = t_data + sizeof(r_size);
     if (r_buffer->offset() + r_buffer->size() > reader->file_size())
     {
       // NOTE this shouldn't happen
       assert(false);
       return nullptr;
     }
-    memcpy(t_data, f_data, r_buffer->size());
 
-    using fbv_t = flatbuffers::Vector<uint8_t>;
-    const fbv_t *v_data = reinterpret_cast<const fbv_t *>(temp_buffer.data());
-    buffer = wrap(v_data);
+    if (can_refer(reader, dtype, f_data))
+    {
+      ref_data = f_data;
+      ref_size = r_size;
+    }
+    else
+    {
+      // match binary level to flatbuffers::Vector
+      temp_buffer.resize(r_size + sizeof(uint32_t));
+
+      uint8_t *t_data = temp_buffer.data();
+      memcpy(t_data, &r_size, sizeof(r_size));
+      t_data = t_data + sizeof(r_size);
+      memcpy(t_data, f_data, r_buffer->size());
+
+      using fbv_t = flatbuffers::Vector<uint8_t>;
+      const fbv_t *v_data = reinterpret_cast<const fbv_t *>(temp_buffer.data());
+      buffer = wrap(v_data);
+    }
 
     context->ext_buffer(true);
   }
   else
   {
     buffer = wrap(r_buffer->data());
+    if (!buffer.empty() && can_refer(reader, dtype, buffer.data()))
+    {
+      ref_data = buffer.data();
+      ref_size = buffer.size();
+    }
   }
+  const bool buffer_empty = buffer.empty() && ref_size == 0;
   const auto const_dims = wrap(const_tensor->shape()); // in NHWC
-  if (const_dims.size() == 0 && buffer.empty())
+  if (const_dims.size() == 0 && buffer_empty)
   {
     // unknown shape tensor and scalar tensor
     return nullptr;
@@ -234,7 +283,7 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
     num_elements = num_elements * const_dims[r];
   }
 
-  if (buffer.empty() && num_elements > 0)
+  if (buffer_empty && num_elements > 0)
   {
     // normal empty tensor
     return nullptr;
@@ -245,9 +294,18 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
   const_node->shape_status(luci::ShapeStatus::VALID);
   INFO(l) << "[luci] NodeFinder const_node(" << tensor_index << ") -> " << const_node << " "
           << const_dims << std::endl;
-  if (num_elements > 0)
+  if (num_elements > 0 && ref_data != nullptr)
+  {
+    // TODO calculate the exact buffer size of sparse tensor
+    assert(const_node->sparsityparam() || ref_size == num_elements * luci::size(dtype));
+
+    // share file data and keep it alive while the constant refers to it
+    std::shared_ptr<const uint8_t> shared_data(reader->shared_file_data(), ref_data);
+    const_node->external_data(shared_data, ref_size);
+  }
+  else if (num_elements > 0)
   {
-    switch (luci_datatype(const_tensor->type()))
+    switch (dtype)
     {
       case loco::DataType::FLOAT32:
         copy_data<loco::DataType::FLOAT32>(buffer, num_elements, const_node);
@@ -24,6 +24,8 @@
 
 #include <loco/IR/DataTypeTraits.h>
 
+#include <memory>
+
 namespace luci
 {
 
@@ -42,8 +44,26 @@ public:
   template <loco::DataType DT> const typename loco::DataTypeImpl<DT>::Type &scalar(void) const;
   template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &scalar(void);
 
+public:
+  /**
+   * @brief Refer to 'size' bytes of external data, like a memory mapped model file,
+   *        instead of owning a copy of them
+   * @note  Data must be aligned for the element type and is not modified. Non-const accessors
+   *        copy data to own storage first, so const accessors should be used to read values.
+   */
+  void external_data(std::shared_ptr<const uint8_t> data, size_t size);
+  // return nullptr if this node owns its data
+  std::shared_ptr<const uint8_t> external_data(void) const { return _ext_data; }
+
+private:
+  size_t data_size(void) const;
+  const uint8_t *data(void) const;
+  uint8_t *data(void);
+
 private:
   std::vector<uint8_t> _data;
+  std::shared_ptr<const uint8_t> _ext_data;
+  size_t _ext_size = 0;
   // TODO use _data for STRING and remove _strings
   std::vector<std::string> _strings; // for STRING type
 };
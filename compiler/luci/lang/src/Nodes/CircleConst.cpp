@@ -21,16 +21,50 @@
 namespace luci
 {
 
+void CircleConst::external_data(std::shared_ptr<const uint8_t> data, size_t size)
+{
+  assert(dtype() != loco::DataType::STRING);
+  assert(data != nullptr || size == 0);
+
+  _data.clear();
+  _data.shrink_to_fit();
+  _ext_data = std::move(data);
+  _ext_size = size;
+}
+
+size_t CircleConst::data_size(void) const
+{
+  return _ext_data != nullptr ? _ext_size : _data.size();
+}
+
+const uint8_t *CircleConst::data(void) const
+{
+  return _ext_data != nullptr ? _ext_data.get() : _data.data();
+}
+
+uint8_t *CircleConst::data(void)
+{
+  // copy on write
+  if (_ext_data != nullptr)
+  {
+    _data.assign(_ext_data.get(), _ext_data.get() + _ext_size);
+    _ext_data.reset();
+    _ext_size = 0;
+  }
+  return _data.data();
+}
+
 template <loco::DataType DT> uint32_t CircleConst::size(void) const
 {
   assert(dtype() == DT);
-  assert(_data.size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
-  return _data.size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
+  assert(data_size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
+  return data_size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
 }
 
 template <loco::DataType DT> void CircleConst::size(uint32_t l)
 {
   assert(dtype() == DT);
+  data();
   _data.resize(l * sizeof(typename loco::DataTypeImpl<DT>::Type));
 }
 
@@ -39,27 +73,27 @@ const typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n) const
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(data()) + n);
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n)
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
-  return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
+  return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(data()) + n);
 }
 
 template <loco::DataType DT>
 const typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void) const
 {
   assert(dtype() == DT);
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(data()));
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void)
 {
   assert(dtype() == DT);
-  return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
+  return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(data()));
 }
 
 #define INSTANTIATE(DT)                                                                      \
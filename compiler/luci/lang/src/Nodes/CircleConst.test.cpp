@@ -21,6 +21,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 TEST(CircleConstTest, constructor)
 {
   luci::CircleConst const_node;
@@ -64,3 +66,46 @@ TEST(CircleConstTest, string)
   ASSERT_EQ(1, const_node.size<loco::DataType::STRING>());
   EXPECT_TRUE(std::string("Hello") == const_node.at<loco::DataType::STRING>(0));
 }
+
+TEST(CircleConstTest, external_data)
+{
+  auto buffer = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>{1, 2, 3});
+  std::shared_ptr<const uint8_t> ext_data(buffer,
+                                          reinterpret_cast<const uint8_t *>(buffer->data()));
+
+  luci::CircleConst const_node;
+  const_node.dtype(loco::DataType::S32);
+  const_node.external_data(ext_data, 3 * sizeof(int32_t));
+
+  const luci::CircleConst &cnode = const_node;
+  ASSERT_EQ(3, cnode.size<loco::DataType::S32>());
+  ASSERT_EQ(2, cnode.at<loco::DataType::S32>(1));
+  ASSERT_EQ(buffer->data() + 1, &cnode.at<loco::DataType::S32>(1));
+  ASSERT_NE(nullptr, cnode.external_data());
+}
+
+TEST(CircleConstTest, external_data_copy_on_write)
+{
+  auto buffer = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>{1, 2, 3});
+  std::shared_ptr<const uint8_t> ext_data(buffer,
+                                          reinterpret_cast<const uint8_t *>(buffer->data()));
+
+  luci::CircleConst const_node;
+  const_node.dtype(loco::DataType::S32);
+  const_node.external_data(ext_data, 3 * sizeof(int32_t));
+
+  const_node.at<loco::DataType::S32>(1) = 5;
+
+  ASSERT_EQ(nullptr, const_node.external_data());
+  ASSERT_EQ(3, const_node.size<loco::DataType::S32>());
+  ASSERT_EQ(1, const_node.at<loco::DataType::S32>(0));
+  ASSERT_EQ(5, const_node.at<loco::DataType::S32>(1));
+  // external data is not modified
+  ASSERT_EQ(2, buffer->at(1));
+
+  const_node.external_data(ext_data, 3 * sizeof(int32_t));
+  const_node.size<loco::DataType::S32>(4);
+  ASSERT_EQ(nullptr, const_node.external_data());
+  ASSERT_EQ(4, const_node.size<loco::DataType::S32>());
+  ASSERT_EQ(3, const_node.at<loco::DataType::S32>(2));
+}
@@ -127,6 +127,9 @@ public:
       // convert NCHW to NHWC
       NCHW_to_NHWC_input_shape,
       NCHW_to_NHWC_output_shape,
+
+      // report elapsed time of each pass of optimize
+      Optimize_report_pass_time,
     };
 
     virtual ~Options() = default;
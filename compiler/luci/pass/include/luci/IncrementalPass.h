@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __LUCI_INCREMENTAL_PASS_H__
+#define __LUCI_INCREMENTAL_PASS_H__
+
+#include <loco.h>
+
+#include <unordered_set>
+
+namespace luci
+{
+
+using NodeSet = std::unordered_set<loco::Node *>;
+
+/**
+ * @brief Pass that can update a graph only around the nodes changed by other passes
+ */
+class IncrementalPass
+{
+public:
+  virtual ~IncrementalPass() = default;
+
+public:
+  // Run pass starting from 'changed' nodes and return false if there was nothing changed
+  // NOTE Nodes whose attributes are changed, like shape or type, are inserted to 'updated' as
+  //      they are not visible to loco::GraphObserver
+  virtual bool run(loco::Graph *g, const NodeSet &changed, NodeSet &updated) = 0;
+};
+
+} // namespace luci
+
+#endif // __LUCI_INCREMENTAL_PASS_H__
@@ -19,6 +19,7 @@
 
 #include <loco.h>
 
+#include <luci/IncrementalPass.h>
 #include <luci/ModulePass.h>
 
 namespace luci
@@ -27,7 +28,7 @@ namespace luci
 /**
  * @brief Pass to infer shape of circle nodes
  */
-class CircleShapeInferencePass : public luci::Pass
+class CircleShapeInferencePass : public luci::Pass, public luci::IncrementalPass
 {
 public:
   virtual const char *name(void) const { return "luci::CircleShapeInferencePass"; }
@@ -35,6 +36,8 @@ public:
 public:
   bool run(luci::Module *m);
   bool run(loco::Graph *graph);
+  // infer changed nodes and their successors whose inputs are updated
+  bool run(loco::Graph *graph, const NodeSet &changed, NodeSet &updated);
 };
 
 } // namespace luci
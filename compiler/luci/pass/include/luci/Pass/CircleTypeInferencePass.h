@@ -19,6 +19,7 @@
 
 #include <loco.h>
 
+#include <luci/IncrementalPass.h>
 #include <luci/ModulePass.h>
 
 namespace luci
@@ -27,7 +28,7 @@ namespace luci
 /**
  * @brief Pass to infer type of circle nodes
  */
-class CircleTypeInferencePass : public luci::Pass
+class CircleTypeInferencePass : public luci::Pass, public luci::IncrementalPass
 {
 public:
   virtual const char *name(void) const { return "luci::CircleTypeInferencePass"; }
@@ -35,6 +36,8 @@ public:
 public:
   bool run(luci::Module *m);
   bool run(loco::Graph *g);
+  // infer changed nodes and their successors whose inputs are updated
+  bool run(loco::Graph *g, const NodeSet &changed, NodeSet &updated);
 };
 
 } // namespace luci
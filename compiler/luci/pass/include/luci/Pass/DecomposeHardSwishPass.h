@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to decompose HardSwish to Add, Mul and Relu6
  */
-struct DecomposeHardSwishPass final : public logo::Pass
+struct DecomposeHardSwishPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::DecomposeHardSwishPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to decompose Softmax into backend friendly structures
  */
-struct DecomposeSoftmaxPass final : public logo::Pass
+struct DecomposeSoftmaxPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::DecomposeSoftmaxPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
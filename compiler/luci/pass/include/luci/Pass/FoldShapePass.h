@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to fold Shape to a constant tensor
  */
-struct FoldShapePass final : public logo::Pass
+struct FoldShapePass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::FoldShapePass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,6 +19,8 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
@@ -26,11 +28,13 @@ namespace luci
  * @brief  Class to fold Squeeze to a constant tensor
  *
  */
-struct FoldSqueezePass final : public logo::Pass
+struct FoldSqueezePass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::FoldSqueezePass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to fuse activation functions into preceding operators
  */
-struct FuseActivationFunctionPass final : public logo::Pass
+struct FuseActivationFunctionPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::FuseActivationFunctionPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to fuse Add into CircleTransposeConv
  */
-struct FuseAddWithTConvPass final : public logo::Pass
+struct FuseAddWithTConvPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::FuseAddWithTConvPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to fuse Batch Normalization into CircleTransposeConv
  */
-struct FuseBatchNormWithTConvPass final : public logo::Pass
+struct FuseBatchNormWithTConvPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::FuseBatchNormWithTConvPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
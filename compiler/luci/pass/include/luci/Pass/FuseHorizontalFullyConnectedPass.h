@@ -19,14 +19,18 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
-struct FuseHorizontalFullyConnectedPass final : public logo::Pass
+struct FuseHorizontalFullyConnectedPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::FuseHorizontalFullyConnectedPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,6 +19,8 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
@@ -26,11 +28,13 @@ namespace luci
  * @brief  Class to fuse two Mean operations follow one by one into one Mean
  * with merge reduction indices
  */
-struct FuseMeanWithMeanPass final : public logo::Pass
+struct FuseMeanWithMeanPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::FuseMeanWithMeanPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -20,6 +20,7 @@
 #include <loco.h>
 
 #include <luci/ModulePass.h>
+#include <luci/TargetOpcodes.h>
 
 namespace luci
 {
@@ -27,11 +28,13 @@ namespace luci
 /**
  * @brief  Class to fuse Mul operation with a Div operation
  */
-struct FuseMulWithDivPass final : public logo::Pass
+struct FuseMulWithDivPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::FuseMulWithDivPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to fuse Mul into CircleFullyConnected
  */
-struct FuseMulWithFullyConnectedPass final : public logo::Pass
+struct FuseMulWithFullyConnectedPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::FuseMulWithFullyConnectedPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,6 +19,8 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
@@ -28,11 +30,13 @@ namespace luci
  *
  * For detailed subgraph pattern to be fused, please check its implementation.
  */
-struct FusePReluPass final : public logo::Pass
+struct FusePReluPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::FusePReluPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -18,6 +18,8 @@
 #define __LUCI_FUSE_PRE_ACTIVATION_BATCH_NORM_PASS_H__
 
 #include <logo/Pass.h>
+
+#include <luci/TargetOpcodes.h>
 #include <luci/IR/CircleNodes.h>
 
 namespace luci
@@ -26,12 +28,14 @@ namespace luci
 /**
  * @brief  Class to fuse batch normalization of pre-activation
  */
-struct FusePreActivationBatchNormPass final : public logo::Pass
+struct FusePreActivationBatchNormPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::FusePreActivationBatchNormPass"; }
 
   bool run(loco::Graph *g) final;
 
+  std::vector<CircleOpcode> target_opcodes(void) const final;
+
   std::vector<luci::CircleMul *> _mul_list;
   std::vector<luci::CircleAdd *> _add_list;
   std::vector<luci::CircleSub *> _sub_list; // inserted during fusion
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to fuse certain pattern of subgraph into CircleRsqrt
  */
-struct FuseRsqrtPass final : public logo::Pass
+struct FuseRsqrtPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::FuseRsqrtPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,6 +19,8 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
@@ -27,11 +29,13 @@ namespace luci
  *         This pass can change the execution result of the model.
  *         So, use it only when the impact is known to be acceptable.
  */
-struct MakeBatchNormGammaPositivePass final : public logo::Pass
+struct MakeBatchNormGammaPositivePass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::MakeBatchNormGammaPositivePass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
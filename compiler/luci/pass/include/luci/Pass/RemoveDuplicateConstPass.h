@@ -20,18 +20,22 @@
 #include <luci/IR/CircleNodes.h>
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to remove duplicate Const nodes.
  */
-struct RemoveDuplicateConstPass final : public logo::Pass
+struct RemoveDuplicateConstPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::RemoveDuplicateConstPass"; }
 
   bool run(loco::Graph *g) final;
 
+  std::vector<CircleOpcode> target_opcodes(void) const final;
+
 private:
   bool remove_duplicate_const();
 
@@ -19,6 +19,8 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
@@ -29,11 +31,13 @@ namespace luci
  *        This pass is to remove Add+FloorMod having INT32/INT64 dtypes
  *        for some backends cannot process this in quantized models.
  */
-struct RemoveGatherGuardPass final : public logo::Pass
+struct RemoveGatherGuardPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::RemoveGatherGuardPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
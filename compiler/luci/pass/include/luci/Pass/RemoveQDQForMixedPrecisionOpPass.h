@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to remove QDQ pattern for mixed-precision Ops
  */
-struct RemoveQDQForMixedPrecisionOpPass final : public logo::Pass
+struct RemoveQDQForMixedPrecisionOpPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::RemoveQDQForMixedPrecisionOpPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to Remove Quantize-Dequantize sequence.
  */
-struct RemoveQuantDequantSeqPass final : public logo::Pass
+struct RemoveQuantDequantSeqPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::RemoveQuantDequantSeqPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
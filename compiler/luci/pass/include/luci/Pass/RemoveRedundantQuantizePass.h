@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to remove redundant quantize operations
  */
-struct RemoveRedundantQuantizePass final : public logo::Pass
+struct RemoveRedundantQuantizePass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::RemoveRedundantQuantizePass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
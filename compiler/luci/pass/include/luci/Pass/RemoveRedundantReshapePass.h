@@ -19,6 +19,8 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
@@ -27,11 +29,13 @@ namespace luci
  * @details This class will update consecutive two Reshape node into single Reshape node.
  *          As Reshape operation just change shape, not buffer, former reshape could be unnecessary.
  */
-struct RemoveRedundantReshapePass final : public logo::Pass
+struct RemoveRedundantReshapePass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::RemoveRedundantReshapePass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief fuse or remove subsequent Transpose operators
  */
-struct RemoveRedundantTransposePass final : public logo::Pass
+struct RemoveRedundantTransposePass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::RemoveRedundantTransposePass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,6 +19,8 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
@@ -27,11 +29,13 @@ namespace luci
  * @details This class will remove unnecessary pre/post-Reshape nodes.
  *          See https://github.com/Samsung/ONE/issues/9600 for more details.
  */
-struct RemoveUnnecessaryReshapeNetPass final : public logo::Pass
+struct RemoveUnnecessaryReshapeNetPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::RemoveUnnecessaryReshapeNetPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to Remove Unnecessary(input shape and output shape same) Reshape node.
  */
-struct RemoveUnnecessaryReshapePass final : public logo::Pass
+struct RemoveUnnecessaryReshapePass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::RemoveUnnecessaryReshapePass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
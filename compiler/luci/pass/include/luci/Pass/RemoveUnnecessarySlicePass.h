@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to Remove Unnecessary(input and output are same) Slice node.
  */
-struct RemoveUnnecessarySlicePass final : public logo::Pass
+struct RemoveUnnecessarySlicePass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::RemoveUnnecessarySlicePass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
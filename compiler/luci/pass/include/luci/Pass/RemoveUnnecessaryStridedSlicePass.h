@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to Remove Unnecessary(input and output are same) StridedSlice node.
  */
-struct RemoveUnnecessaryStridedSlicePass final : public logo::Pass
+struct RemoveUnnecessaryStridedSlicePass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::RemoveUnnecessaryStridedSlicePass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
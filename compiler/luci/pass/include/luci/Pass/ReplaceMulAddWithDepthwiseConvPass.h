@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to replace channel-wise mul/add with CircleDepthwiseConv2D
  */
-struct ReplaceMulAddWithDepthwiseConvPass final : public logo::Pass
+struct ReplaceMulAddWithDepthwiseConvPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::ReplaceMulAddWithDepthwiseConvPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to replace "FC with non-const weight" with Batched MatMul
  */
-struct ReplaceNonConstFCWithBatchMatMulPass final : public logo::Pass
+struct ReplaceNonConstFCWithBatchMatMulPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::ReplaceNonConstFCWithBatchMatMulPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,6 +19,8 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
@@ -28,11 +30,13 @@ namespace luci
  * To see the target Op pattern, please visit implementation.
  * NOTE: The target pattern includes FC fused with div/mul Ops.
  */
-struct ReplaceWithFCGeluFCPass final : public logo::Pass
+struct ReplaceWithFCGeluFCPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::ReplaceWithFCGeluFCPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to resolve certain custom op of subgraph into batchmatmul op in circle schema.
  */
-struct ResolveCustomOpBatchMatMulPass final : public logo::Pass
+struct ResolveCustomOpBatchMatMulPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::ResolveCustomOpBatchMatMulPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to resolve certain custom op of subgraph into matmul op in circle schema.
  */
-struct ResolveCustomOpMatMulPass final : public logo::Pass
+struct ResolveCustomOpMatMulPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::ResolveCustomOpMatMulPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief Class to resolve custom op MaxPoolWithArgmax to subgraph with circle's MaxPool and ArgMax.
  */
-struct ResolveCustomOpMaxPoolWithArgmaxPass final : public logo::Pass
+struct ResolveCustomOpMaxPoolWithArgmaxPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::ResolveCustomOpMaxPoolWithArgmaxPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to resolve certain custom op of subgraph into splitv op in circle schema.
  */
-struct ResolveCustomOpSplitVPass final : public logo::Pass
+struct ResolveCustomOpSplitVPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::ResolveCustomOpSplitVPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,6 +19,8 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
@@ -28,11 +30,13 @@ namespace luci
  * @details This pass changes a op formerly used as a custom op to builtin op
  *          from schema version upgrade.
  */
-struct ResolveFormerCustomOpPass final : public logo::Pass
+struct ResolveFormerCustomOpPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::ResolveFormerCustomOpPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief Class to convert weight format of FullyConnected to SHUFFLED16x1FLOAT32
  */
-struct ShuffleWeightTo16x1Float32Pass final : public logo::Pass
+struct ShuffleWeightTo16x1Float32Pass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::ShuffleWeightTo16x1Float32Pass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
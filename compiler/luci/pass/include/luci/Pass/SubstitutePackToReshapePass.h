@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to Substitute Pack with 1 input to single reshape node.
  */
-struct SubstitutePackToReshapePass final : public logo::Pass
+struct SubstitutePackToReshapePass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::SubstitutePackToReshapePass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to substitute PadV2 in certain condition to Pad.
  */
-struct SubstitutePadV2ToPadPass final : public logo::Pass
+struct SubstitutePadV2ToPadPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::SubstitutePadV2ToPadPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
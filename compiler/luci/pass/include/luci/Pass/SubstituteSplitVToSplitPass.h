@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to substitute certain SplitV to Split.
  */
-struct SubstituteSplitVToSplitPass final : public logo::Pass
+struct SubstituteSplitVToSplitPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::SubstituteSplitVToSplitPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to substitute Strided_Slice with certain condition to single reshape node.
  */
-struct SubstituteStridedSliceToReshapePass final : public logo::Pass
+struct SubstituteStridedSliceToReshapePass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::SubstituteStridedSliceToReshapePass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
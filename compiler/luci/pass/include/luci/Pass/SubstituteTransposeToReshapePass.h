@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to Substitute Transpose with certain input shape condition to single reshape node.
  */
-struct SubstituteTransposeToReshapePass final : public logo::Pass
+struct SubstituteTransposeToReshapePass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::SubstituteTransposeToReshapePass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
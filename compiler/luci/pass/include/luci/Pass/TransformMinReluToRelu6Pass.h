@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to transform Relu(Minimum(input, 6)) to Relu6
  */
-struct TransformMinReluToRelu6Pass final : public logo::Pass
+struct TransformMinReluToRelu6Pass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::TransformMinReluToRelu6Pass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
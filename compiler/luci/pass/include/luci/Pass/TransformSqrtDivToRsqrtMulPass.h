@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to transform Div(X,Sqrt(y)) to Mul(X,Rsqrt(y))
  */
-struct TransformSqrtDivToRsqrtMulPass final : public logo::Pass
+struct TransformSqrtDivToRsqrtMulPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::TransformSqrtDivToRsqrtMulPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -19,17 +19,21 @@
 
 #include <logo/Pass.h>
 
+#include <luci/TargetOpcodes.h>
+
 namespace luci
 {
 
 /**
  * @brief  Experimental Class to separate activation functions from TransposeConv
  */
-struct XpSepActFromTransposeConvPass final : public logo::Pass
+struct XpSepActFromTransposeConvPass final : public logo::Pass, public TargetOpcodes
 {
   const char *name(void) const final { return "luci::XpSepActFromTransposeConvPass"; }
 
   bool run(loco::Graph *g) final;
+
+  std::vector<CircleOpcode> target_opcodes(void) const final;
 };
 
 } // namespace luci
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_TARGET_OPCODES_H__
+#define __LUCI_TARGET_OPCODES_H__
+
+#include <luci/IR/CircleOpcode.h>
+
+#include <vector>
+
+namespace luci
+{
+
+/**
+ * @brief Pass that can match only nodes of some opcodes
+ *
+ * @note  WorklistPhaseRunner runs such a pass again only if a node of the opcodes is changed
+ *        or is next to a changed node. Passes without this interface can match any node.
+ */
+class TargetOpcodes
+{
+public:
+  virtual ~TargetOpcodes() = default;
+
+public:
+  // Opcodes of all the nodes the pass matches, including constants it reads
+  virtual std::vector<CircleOpcode> target_opcodes(void) const = 0;
+};
+
+} // namespace luci
+
+#endif // __LUCI_TARGET_OPCODES_H__
@@ -107,6 +107,7 @@
 
 #include "ModulePhase.h"
 #include "ProgressReporter.h"
+#include "WorklistPhase.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <logo/Phase.h>
@@ -407,7 +408,9 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   /* TRANSFORM DECLARATION END */
 
   ProgressReporter prog(g, logo::PhaseStrategy::Restart);
-  logo::PhaseRunner<logo::PhaseStrategy::Restart> phase_runner{g};
+  prog.time_report(_options->param(Options::AlgorithmParameters::Optimize_report_pass_time) ==
+                   "true");
+  luci::WorklistPhaseRunner phase_runner{g};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
 }
@@ -64,4 +64,40 @@ bool CircleShapeInferencePass::run(loco::Graph *g)
   return changed;
 }
 
+bool CircleShapeInferencePass::run(loco::Graph *g, const NodeSet &changed, NodeSet &updated)
+{
+  luci::sinf::Rule shape_infer_rule;
+  bool inferred = false;
+
+  // successors are added when shape of a node is updated
+  NodeSet targets = changed;
+
+  // NOTE candidates are in topological order so that inputs are inferred first
+  for (auto node : inference_candidates(g))
+  {
+    if (targets.find(node) == targets.end())
+      continue;
+
+    loco::TensorShape shape;
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+
+    if (shape_infer_rule.infer(circle_node, shape) && !is_same_shape(circle_node, shape))
+    {
+      circle_node->rank(shape.rank());
+      for (uint32_t i = 0; i < shape.rank(); ++i)
+        circle_node->dim(i) = shape.dim(i);
+
+      circle_node->shape_status(luci::ShapeStatus::VALID);
+
+      for (auto succ : loco::succs(node))
+        targets.insert(succ);
+
+      updated.insert(node);
+      inferred = true;
+    }
+  }
+
+  return inferred;
+}
+
 } // namespace luci
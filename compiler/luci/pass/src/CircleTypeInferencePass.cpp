@@ -58,4 +58,36 @@ bool CircleTypeInferencePass::run(loco::Graph *g)
   return changed;
 }
 
+bool CircleTypeInferencePass::run(loco::Graph *g, const NodeSet &changed, NodeSet &updated)
+{
+  luci::tinf::Rule type_infer_rule;
+  bool inferred = false;
+
+  // successors are added when type of a node is updated
+  NodeSet targets = changed;
+
+  // NOTE candidates are in topological order so that inputs are inferred first
+  for (auto node : inference_candidates(g))
+  {
+    if (targets.find(node) == targets.end())
+      continue;
+
+    loco::DataType dtype;
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+
+    if (type_infer_rule.infer(circle_node, dtype) && circle_node->dtype() != dtype)
+    {
+      circle_node->dtype(dtype);
+
+      for (auto succ : loco::succs(node))
+        targets.insert(succ);
+
+      updated.insert(node);
+      inferred = true;
+    }
+  }
+
+  return inferred;
+}
+
 } // namespace luci
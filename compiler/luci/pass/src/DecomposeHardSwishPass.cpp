@@ -125,6 +125,12 @@ bool decompose_hardswish(luci::CircleHardSwish *hardswish)
 namespace luci
 {
 
+std::vector<CircleOpcode> DecomposeHardSwishPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::HARD_SWISH, CircleOpcode::MUL,
+          CircleOpcode::RELU6};
+}
+
 bool DecomposeHardSwishPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -159,6 +159,12 @@ bool decompose_softmax(luci::CircleSoftmax *softmax)
 namespace luci
 {
 
+std::vector<CircleOpcode> DecomposeSoftmaxPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::DIV, CircleOpcode::EXP, CircleOpcode::MUL,
+          CircleOpcode::REDUCE_MAX, CircleOpcode::SOFTMAX, CircleOpcode::SUB, CircleOpcode::SUM};
+}
+
 bool DecomposeSoftmaxPass::run(loco::Graph *g)
 {
   bool changed = false;
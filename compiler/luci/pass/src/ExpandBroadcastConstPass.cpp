@@ -157,6 +157,11 @@ bool expand_broadcast_const(luci::CircleConst *node)
 namespace luci
 {
 
+std::vector<CircleOpcode> ExpandBroadcastConstPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::DIV, CircleOpcode::MUL};
+}
+
 /**
  * Broadcast expanding for Const nodes
  **/
@@ -92,6 +92,11 @@ template <loco::DataType T> bool fold_add_v2(luci::CircleCustom *add_v2)
 namespace luci
 {
 
+std::vector<CircleOpcode> FoldAddV2Pass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::CIRCLECUSTOMOUT, CircleOpcode::CUSTOM};
+}
+
 /**
  * Constant Folding for AddV2 Op
  **/
@@ -104,6 +104,11 @@ bool fold_cast(luci::CircleCast *cast)
 namespace luci
 {
 
+std::vector<CircleOpcode> FoldCastPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CAST, CircleOpcode::CIRCLECONST};
+}
+
 /**
  * Constant Folding for Cast Op
  **/
@@ -144,6 +144,11 @@ bool fold_densify(luci::CircleDensify *densify)
 namespace luci
 {
 
+std::vector<CircleOpcode> FoldDensifyPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::DENSIFY};
+}
+
 /**
  * BEFORE
  *
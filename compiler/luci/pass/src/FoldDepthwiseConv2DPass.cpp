@@ -141,6 +141,11 @@ bool fold_depthwise_conv_2d(luci::CircleDepthwiseConv2D *node)
 
 } // namespace
 
+std::vector<CircleOpcode> FoldDepthwiseConv2DPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::DEPTHWISE_CONV_2D};
+}
+
 /**
  * Constant Folding for DepthwiseConv2D Op
  **/
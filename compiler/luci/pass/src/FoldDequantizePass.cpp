@@ -179,6 +179,12 @@ bool replace_const_node(loco::Node *node, luci::CircleConst *const_node)
 namespace luci
 {
 
+std::vector<CircleOpcode> FoldDequantizePass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::DEQUANTIZE, CircleOpcode::FULLY_CONNECTED,
+          CircleOpcode::GATHER};
+}
+
 /**
  *
  * Folding pattern 1 - When input of Dequantize is foldable constant
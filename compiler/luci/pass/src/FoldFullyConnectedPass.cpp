@@ -150,6 +150,11 @@ bool fold_fully_connected(luci::CircleFullyConnected *node)
 
 } // namespace
 
+std::vector<CircleOpcode> FoldFullyConnectedPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::FULLY_CONNECTED};
+}
+
 /**
  * Constant Folding for FullyConnected Op
  **/
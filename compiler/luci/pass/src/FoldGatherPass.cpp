@@ -163,6 +163,11 @@ bool fold_gather(luci::CircleGather *gather_node)
 namespace luci
 {
 
+std::vector<CircleOpcode> FoldGatherPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::GATHER};
+}
+
 /**
  * Constant Folding for Gather Op
  **/
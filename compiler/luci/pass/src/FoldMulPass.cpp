@@ -106,6 +106,11 @@ bool fold_mul(luci::CircleMul *mul)
 namespace luci
 {
 
+std::vector<CircleOpcode> FoldMulPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::MUL};
+}
+
 /**
  * Constant Folding for Mul Op
  **/
@@ -105,6 +105,11 @@ bool fold_reshape(luci::CircleReshape *reshape)
 namespace luci
 {
 
+std::vector<CircleOpcode> FoldReshapePass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::RESHAPE};
+}
+
 /**
  * Constant Folding for Reshape Op
  **/
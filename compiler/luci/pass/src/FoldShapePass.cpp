@@ -72,6 +72,11 @@ template <loco::DataType OutType> bool fold_shape(luci::CircleShape *shape)
 namespace luci
 {
 
+std::vector<CircleOpcode> FoldShapePass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::SHAPE};
+}
+
 /**
  * BEFORE
  *
@@ -120,6 +120,11 @@ bool fold_sparse_to_dense(luci::CircleSparseToDense *stod)
 namespace luci
 {
 
+std::vector<CircleOpcode> FoldSparseToDensePass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::SPARSE_TO_DENSE};
+}
+
 /**
  * Constant Folding for SparseToDense Op
  **/
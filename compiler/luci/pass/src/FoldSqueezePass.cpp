@@ -100,6 +100,11 @@ bool fold_squeeze(luci::CircleSqueeze *squeeze)
 namespace luci
 {
 
+std::vector<CircleOpcode> FoldSqueezePass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::SQUEEZE};
+}
+
 /**
  * Constant Folding for Squeeze Op
  **/
@@ -89,6 +89,11 @@ bool fuse_activation_function(luci::CircleNode *node)
   return true;
 }
 
+std::vector<CircleOpcode> FuseActivationFunctionPass::target_opcodes(void) const
+{
+  return {CircleOpcode::RELU, CircleOpcode::RELU6, CircleOpcode::RELU_N1_TO_1};
+}
+
 bool FuseActivationFunctionPass::run(loco::Graph *g)
 {
   bool changed = false;
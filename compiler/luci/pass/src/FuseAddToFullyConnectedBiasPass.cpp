@@ -106,6 +106,11 @@ bool fuse_add_to_fc_bias(luci::CircleFullyConnected *fc)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseAddToFullyConnectedBiasPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::FULLY_CONNECTED};
+}
+
 bool FuseAddToFullyConnectedBiasPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -143,6 +143,11 @@ bool fused_add_with_conv(luci::CircleAdd *add)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseAddWithConvPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::CONV_2D};
+}
+
 bool FuseAddWithConvPass::run(loco::Graph *g)
 {
   bool changed = false;
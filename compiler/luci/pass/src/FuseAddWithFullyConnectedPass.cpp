@@ -309,6 +309,11 @@ bool fuse_add_with_s16_fc(luci::CircleFullyConnected *fc)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseAddWithFullyConnectedPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::FULLY_CONNECTED};
+}
+
 bool FuseAddWithFullyConnectedPass::run(loco::Graph *g)
 {
   bool changed = false;
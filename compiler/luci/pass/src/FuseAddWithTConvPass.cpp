@@ -127,6 +127,12 @@ bool fuse_add_with_tconv(luci::CircleAdd *add)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseAddWithTConvPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::RELU, CircleOpcode::RELU6,
+          CircleOpcode::TRANSPOSE_CONV};
+}
+
 bool FuseAddWithTConvPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -178,6 +178,11 @@ bool fused_batch_norm_with_conv(luci::CircleAdd *add)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseBatchNormWithConvPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::CONV_2D, CircleOpcode::MUL};
+}
+
 bool FuseBatchNormWithConvPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -223,6 +223,12 @@ bool fused_batch_norm_with_dwconv(luci::CircleAdd *add)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseBatchNormWithDwConvPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::DEPTHWISE_CONV_2D,
+          CircleOpcode::MUL};
+}
+
 bool FuseBatchNormWithDwConvPass::run(loco::Graph *g)
 {
   bool changed = false;
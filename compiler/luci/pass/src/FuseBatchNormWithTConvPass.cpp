@@ -256,6 +256,12 @@ bool fused_batch_norm_with_tconv(luci::CircleAdd *add)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseBatchNormWithTConvPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::MUL, CircleOpcode::RELU,
+          CircleOpcode::RELU6, CircleOpcode::TRANSPOSE_CONV};
+}
+
 bool FuseBatchNormWithTConvPass::run(loco::Graph *g)
 {
   bool changed = false;
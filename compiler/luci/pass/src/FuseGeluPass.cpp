@@ -327,6 +327,12 @@ bool fuse_gelu(luci::CircleMul *mul)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseGeluPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::CIRCLECUSTOMOUT,
+          CircleOpcode::CUSTOM, CircleOpcode::GELU, CircleOpcode::MUL};
+}
+
 bool FuseGeluPass::run(loco::Graph *g)
 {
   bool changed = false;
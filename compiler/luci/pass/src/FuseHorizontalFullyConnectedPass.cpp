@@ -171,6 +171,11 @@ bool fuse_horizontal_fc_nodes(CircleAdd *add_node)
 
 } // namespace
 
+std::vector<CircleOpcode> FuseHorizontalFullyConnectedPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::FULLY_CONNECTED};
+}
+
 /**
  * @brief  Class to fuse horizontal FC layers
  *
@@ -1263,6 +1263,14 @@ bool post_fusion(luci::CircleInstanceNorm *inst_norm)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseInstanceNormPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::DIV,
+          CircleOpcode::INSTANCE_NORM, CircleOpcode::MEAN, CircleOpcode::MUL, CircleOpcode::POW,
+          CircleOpcode::RESHAPE, CircleOpcode::RSQRT, CircleOpcode::SQRT, CircleOpcode::SQUARE,
+          CircleOpcode::SQUARED_DIFFERENCE, CircleOpcode::SUB};
+}
+
 bool FuseInstanceNormPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -153,6 +153,11 @@ bool fuse_mean_with_mean(luci::CircleMean *mean)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseMeanWithMeanPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::MEAN};
+}
+
 bool FuseMeanWithMeanPass::run(loco::Graph *g)
 {
   bool changed = false;
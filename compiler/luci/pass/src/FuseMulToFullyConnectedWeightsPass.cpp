@@ -101,6 +101,11 @@ bool fuse_fc_with_mul(luci::CircleFullyConnected *fc)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseMulToFullyConnectedWeightsPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::FULLY_CONNECTED, CircleOpcode::MUL};
+}
+
 bool FuseMulToFullyConnectedWeightsPass::run(loco::Graph *g)
 {
   bool changed = false;
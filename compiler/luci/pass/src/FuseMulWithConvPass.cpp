@@ -189,6 +189,11 @@ bool fuse_mul_with_conv(luci::CircleMul *mul)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseMulWithConvPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::CONV_2D, CircleOpcode::MUL};
+}
+
 bool FuseMulWithConvPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -224,6 +224,11 @@ bool fuse_mul_with_div_to_mul(luci::CircleDiv *div)
 
 } // namespace
 
+std::vector<CircleOpcode> FuseMulWithDivPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::DIV, CircleOpcode::MUL};
+}
+
 bool FuseMulWithDivPass::run(loco::Graph *g)
 {
   bool changed = false;
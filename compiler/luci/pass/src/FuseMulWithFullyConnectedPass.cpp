@@ -224,6 +224,11 @@ bool fuse_mul_with_fc(luci::CircleMul *mul)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseMulWithFullyConnectedPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::FULLY_CONNECTED, CircleOpcode::MUL};
+}
+
 bool FuseMulWithFullyConnectedPass::run(loco::Graph *g)
 {
   bool changed = false;
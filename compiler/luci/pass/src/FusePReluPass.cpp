@@ -182,6 +182,12 @@ bool fuse_prelu(luci::CircleAdd *add)
 namespace luci
 {
 
+std::vector<CircleOpcode> FusePReluPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ABS, CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::MUL,
+          CircleOpcode::PRELU, CircleOpcode::RELU, CircleOpcode::SUB};
+}
+
 bool FusePReluPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -574,6 +574,12 @@ bool swap_mul_add(luci::CircleAdd *add, std::vector<luci::CircleMul *> &mul_list
   return true;
 }
 
+std::vector<CircleOpcode> FusePreActivationBatchNormPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::CONV_2D, CircleOpcode::MEAN,
+          CircleOpcode::MUL, CircleOpcode::RELU, CircleOpcode::SUB};
+}
+
 bool FusePreActivationBatchNormPass::run(loco::Graph *g)
 {
   LOGGER(l);
@@ -166,6 +166,11 @@ bool fuse_rsqrt(luci::CircleDiv *div)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseRsqrtPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::DIV, CircleOpcode::RSQRT, CircleOpcode::SQRT};
+}
+
 bool FuseRsqrtPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -269,6 +269,11 @@ bool fuse_slice_with_tconv(luci::CircleSlice *slice)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseSliceWithTConvPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::SLICE, CircleOpcode::TRANSPOSE_CONV};
+}
+
 bool FuseSliceWithTConvPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -145,6 +145,11 @@ bool fuse_transpose_with_mean(luci::CircleMean *mean)
 namespace luci
 {
 
+std::vector<CircleOpcode> FuseTransposeWithMeanPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::MEAN, CircleOpcode::TRANSPOSE};
+}
+
 bool FuseTransposeWithMeanPass::run(loco::Graph *g)
 {
   bool changed = false;
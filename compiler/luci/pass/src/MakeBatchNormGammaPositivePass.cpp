@@ -69,6 +69,11 @@ bool make_positive_gamma(luci::CircleAdd *add)
 namespace luci
 {
 
+std::vector<CircleOpcode> MakeBatchNormGammaPositivePass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::MUL};
+}
+
 /**
  * Make negative gamma values of Mul-Add (as BatchNorm) to a small positive value (1e-10)
  *
@@ -23,6 +23,9 @@
 #include <logo/Pass.h>
 
 #include <cassert>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
 
 namespace
 {
@@ -51,6 +54,8 @@ void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::Phase
 {
   LOGGER(prime);
 
+  _pass_times.clear();
+
   INFO(prime) << "==============================================================";
   INFO(prime) << "PhaseRunner<" << to_str(strategy()) << ">";
   INFO(prime) << "Initial graph";
@@ -62,6 +67,26 @@ void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::Phase
   LOGGER(prime);
 
   INFO(prime) << "PhaseRunner<" << to_str(strategy()) << "> - done";
+
+  std::ostringstream oss;
+  oss << std::setw(48) << std::left << "Pass" << std::setw(8) << std::right << "Runs"
+      << std::setw(10) << "Changed" << std::setw(12) << "Time(ms)" << std::endl;
+  double total_ms = 0.0;
+  for (const auto &it : _pass_times)
+  {
+    const auto &time = it.second;
+    const double ms = std::chrono::duration<double, std::milli>(time.elapsed).count();
+    oss << std::setw(48) << std::left << it.first << std::setw(8) << std::right << time.runs
+        << std::setw(10) << time.changed << std::setw(12) << std::fixed << std::setprecision(3)
+        << ms << std::endl;
+    total_ms += ms;
+  }
+  oss << std::setw(78) << std::left << "Total" << std::right << std::fixed
+      << std::setprecision(3) << total_ms << std::endl;
+
+  INFO(prime) << oss.str();
+  if (_time_report)
+    std::cout << oss.str();
 }
 
 void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassBegin> *info)
@@ -70,12 +95,20 @@ void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassB
 
   INFO(prime) << "--------------------------------------------------------------";
   INFO(prime) << "Before " << logo::pass_name(info->pass());
+
+  _pass_begin = std::chrono::steady_clock::now();
 }
 
 void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassEnd> *info)
 {
   LOGGER(prime);
 
+  auto &time = _pass_times[logo::pass_name(info->pass())];
+  time.elapsed += std::chrono::steady_clock::now() - _pass_begin;
+  time.runs++;
+  if (info->changed())
+    time.changed++;
+
   INFO(prime) << "After " << logo::pass_name(info->pass())
               << " (changed: " << to_char(info->changed()) << ")";
   INFO(prime) << luci::fmt(graph());
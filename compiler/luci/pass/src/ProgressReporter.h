@@ -23,6 +23,10 @@
 
 #include <luci/IR/Module.h>
 
+#include <chrono>
+#include <map>
+#include <string>
+
 namespace luci
 {
 
@@ -45,9 +49,25 @@ public:
   loco::Graph *graph(void) const { return _graph; }
   logo::PhaseStrategy strategy(void) const { return _strategy; }
 
+public:
+  // Print elapsed time of each pass to standard output when the phase ends
+  void time_report(bool enable) { _time_report = enable; }
+
+private:
+  struct PassTime
+  {
+    uint32_t runs = 0;
+    uint32_t changed = 0;
+    std::chrono::steady_clock::duration elapsed{0};
+  };
+
 private:
   loco::Graph *_graph;
   logo::PhaseStrategy _strategy;
+  bool _time_report = false;
+
+  std::chrono::steady_clock::time_point _pass_begin;
+  std::map<std::string, PassTime> _pass_times;
 };
 
 class ModuleProgressReporter : public logo::PhaseEventListener
@@ -172,6 +172,11 @@ void RemoveDuplicateConstPass::add_to_map(luci::CircleConst *const_node)
   }
 }
 
+std::vector<CircleOpcode> RemoveDuplicateConstPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST};
+}
+
 /**
  * Remove duplicate Const nodes.
  *
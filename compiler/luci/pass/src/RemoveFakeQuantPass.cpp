@@ -34,6 +34,11 @@ void remove_fake_quant(luci::CircleFakeQuant *fakequant)
 
 namespace luci
 {
+std::vector<CircleOpcode> RemoveFakeQuantPass::target_opcodes(void) const
+{
+  return {CircleOpcode::FAKE_QUANT};
+}
+
 /**
  * BEFORE
  *
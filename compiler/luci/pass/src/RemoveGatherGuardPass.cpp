@@ -110,6 +110,12 @@ bool remove_guards(luci::CircleGather *gather)
 namespace luci
 {
 
+std::vector<CircleOpcode> RemoveGatherGuardPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::FLOOR_MOD,
+          CircleOpcode::GATHER};
+}
+
 bool RemoveGatherGuardPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -81,6 +81,11 @@ bool remove_qdq_for_mpo(luci::CircleDequantize *node)
 namespace luci
 {
 
+std::vector<CircleOpcode> RemoveQDQForMixedPrecisionOpPass::target_opcodes(void) const
+{
+  return {CircleOpcode::DEQUANTIZE, CircleOpcode::QUANTIZE};
+}
+
 bool RemoveQDQForMixedPrecisionOpPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -40,6 +40,11 @@ bool remove_quant_dequant(luci::CircleDequantize *dequant)
 
 namespace luci
 {
+std::vector<CircleOpcode> RemoveQuantDequantSeqPass::target_opcodes(void) const
+{
+  return {CircleOpcode::DEQUANTIZE, CircleOpcode::QUANTIZE};
+}
+
 /**
  * BEFORE
  *
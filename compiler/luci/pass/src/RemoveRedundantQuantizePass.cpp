@@ -87,6 +87,11 @@ bool remove_redundant_subsequent_quantize(luci::CircleQuantize *node)
 namespace luci
 {
 
+std::vector<CircleOpcode> RemoveRedundantQuantizePass::target_opcodes(void) const
+{
+  return {CircleOpcode::QUANTIZE};
+}
+
 bool RemoveRedundantQuantizePass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -36,6 +36,11 @@ bool remove_redundant_reshape(luci::CircleReshape *node)
 namespace luci
 {
 
+std::vector<CircleOpcode> RemoveRedundantReshapePass::target_opcodes(void) const
+{
+  return {CircleOpcode::RESHAPE};
+}
+
 /**
  * BEFORE
  *
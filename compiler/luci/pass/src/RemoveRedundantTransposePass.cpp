@@ -93,6 +93,11 @@ bool remove_consecutive_transpose_function(luci::CircleTranspose *target_node)
 namespace luci
 {
 
+std::vector<CircleOpcode> RemoveRedundantTransposePass::target_opcodes(void) const
+{
+  return {CircleOpcode::TRANSPOSE, CircleOpcode::CIRCLECONST};
+}
+
 /**
  *  BEFORE
  *         |
@@ -70,6 +70,11 @@ bool remove_no_effect_add(luci::CircleNode *node)
 namespace luci
 {
 
+std::vector<CircleOpcode> RemoveUnnecessaryAddPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST};
+}
+
 /**
  * BEFORE
  *
@@ -133,6 +133,12 @@ bool remove_unnecessary_reshape_net(luci::CircleReshape *reshape)
 namespace luci
 {
 
+std::vector<CircleOpcode> RemoveUnnecessaryReshapeNetPass::target_opcodes(void) const
+{
+  return {CircleOpcode::RESHAPE, CircleOpcode::ADD, CircleOpcode::MUL, CircleOpcode::TANH,
+          CircleOpcode::LOGISTIC, CircleOpcode::RELU};
+}
+
 /**
  * BEFORE
  *
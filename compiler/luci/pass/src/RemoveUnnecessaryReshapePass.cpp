@@ -77,6 +77,11 @@ namespace luci
  *     This pass will remove Reshape when input and output has same shape
  */
 
+std::vector<CircleOpcode> RemoveUnnecessaryReshapePass::target_opcodes(void) const
+{
+  return {CircleOpcode::RESHAPE, CircleOpcode::CIRCLECONST};
+}
+
 bool RemoveUnnecessaryReshapePass::run(loco::Graph *g)
 {
   bool changed = false;
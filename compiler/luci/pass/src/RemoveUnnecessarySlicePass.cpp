@@ -75,6 +75,11 @@ bool remove_no_effect_slice(luci::CircleNode *node)
 
 namespace luci
 {
+std::vector<CircleOpcode> RemoveUnnecessarySlicePass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::SLICE};
+}
+
 /**
  * BEFORE
  *
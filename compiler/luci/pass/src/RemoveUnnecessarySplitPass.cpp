@@ -47,6 +47,11 @@ bool remove_unnecessary_split(luci::CircleNode *node)
 namespace luci
 {
 
+std::vector<CircleOpcode> RemoveUnnecessarySplitPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLESPLITOUT, CircleOpcode::SPLIT};
+}
+
 bool RemoveUnnecessarySplitPass::run(loco::Graph *g)
 {
   bool changed = false;
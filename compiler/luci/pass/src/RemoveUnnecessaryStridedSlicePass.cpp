@@ -85,6 +85,11 @@ bool remove_no_effect_strided_slice(luci::CircleStridedSlice *target_node)
 
 namespace luci
 {
+std::vector<CircleOpcode> RemoveUnnecessaryStridedSlicePass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::STRIDED_SLICE};
+}
+
 /**
  * BEFORE
  *
@@ -479,6 +479,11 @@ namespace luci
  *
  */
 
+std::vector<CircleOpcode> RemoveUnnecessaryTransposeNetPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::RESHAPE, CircleOpcode::TRANSPOSE};
+}
+
 bool RemoveUnnecessaryTransposeNetPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -162,6 +162,12 @@ bool replace_mul_add_with_dwconv(luci::CircleAdd *add)
 namespace luci
 {
 
+std::vector<CircleOpcode> ReplaceMulAddWithDepthwiseConvPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::DEPTHWISE_CONV_2D,
+          CircleOpcode::MUL};
+}
+
 bool ReplaceMulAddWithDepthwiseConvPass::run(loco::Graph *g)
 {
   bool changed = false;
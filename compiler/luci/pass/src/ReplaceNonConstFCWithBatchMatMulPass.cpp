@@ -227,6 +227,14 @@ bool replace_fc_with_matmul(luci::CircleFullyConnected *fc)
 namespace luci
 {
 
+std::vector<CircleOpcode> ReplaceNonConstFCWithBatchMatMulPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::BATCH_MATMUL, CircleOpcode::CIRCLECONST,
+          CircleOpcode::FULLY_CONNECTED, CircleOpcode::RELU, CircleOpcode::RELU6,
+          CircleOpcode::RELU_N1_TO_1, CircleOpcode::RESHAPE, CircleOpcode::TANH,
+          CircleOpcode::TRANSPOSE};
+}
+
 bool ReplaceNonConstFCWithBatchMatMulPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -58,6 +58,11 @@ bool replace_sub_with_const_rhs(luci::CircleSub *sub)
 namespace luci
 {
 
+std::vector<CircleOpcode> ReplaceSubWithAddPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::SUB};
+}
+
 bool ReplaceSubWithAddPass::run(loco::Graph *g)
 {
   bool changed = false;
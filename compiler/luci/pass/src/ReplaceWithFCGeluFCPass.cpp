@@ -296,6 +296,13 @@ bool replace_fc_gelu_fc(luci::CircleFullyConnected *fc)
 namespace luci
 {
 
+std::vector<CircleOpcode> ReplaceWithFCGeluFCPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::CIRCLECUSTOMOUT,
+          CircleOpcode::CUSTOM, CircleOpcode::FULLY_CONNECTED, CircleOpcode::GELU,
+          CircleOpcode::MUL};
+}
+
 bool ReplaceWithFCGeluFCPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -221,6 +221,12 @@ bool resolve_custom_op(luci::CircleCustom *addv2)
 namespace luci
 {
 
+std::vector<CircleOpcode> ResolveCustomOpAddPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::BROADCAST_TO, CircleOpcode::CIRCLECONST,
+          CircleOpcode::CIRCLECUSTOMOUT, CircleOpcode::CUSTOM};
+}
+
 bool ResolveCustomOpAddPass::run(loco::Graph *g)
 {
   bool changed = false;
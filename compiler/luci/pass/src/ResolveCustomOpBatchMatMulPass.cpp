@@ -61,6 +61,11 @@ bool resolve_custom_op(luci::CircleCustom *cop)
 namespace luci
 {
 
+std::vector<CircleOpcode> ResolveCustomOpBatchMatMulPass::target_opcodes(void) const
+{
+  return {CircleOpcode::BATCH_MATMUL, CircleOpcode::CIRCLECUSTOMOUT, CircleOpcode::CUSTOM};
+}
+
 /**
  *  BEFORE
  *         |             |
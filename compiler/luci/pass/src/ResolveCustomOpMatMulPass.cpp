@@ -131,6 +131,11 @@ bool resolve_matmul(luci::CircleCustom *cop)
 namespace luci
 {
 
+std::vector<CircleOpcode> ResolveCustomOpMatMulPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CUSTOM, CircleOpcode::FULLY_CONNECTED, CircleOpcode::TRANSPOSE};
+}
+
 bool ResolveCustomOpMatMulPass::run(loco::Graph *g)
 {
   bool changed = false;
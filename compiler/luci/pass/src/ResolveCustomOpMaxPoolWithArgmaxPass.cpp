@@ -828,6 +828,15 @@ bool resolve_max_pool_with_argmax(luci::CircleCustom *cop)
 namespace luci
 {
 
+std::vector<CircleOpcode> ResolveCustomOpMaxPoolWithArgmaxPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::ARG_MAX, CircleOpcode::CAST, CircleOpcode::CIRCLECONST,
+          CircleOpcode::CIRCLECUSTOMOUT, CircleOpcode::CIRCLESPLITOUT, CircleOpcode::CONCATENATION,
+          CircleOpcode::CONV_2D, CircleOpcode::CUSTOM, CircleOpcode::DEPTHWISE_CONV_2D,
+          CircleOpcode::FLOOR, CircleOpcode::MAX_POOL_2D, CircleOpcode::MUL, CircleOpcode::NEG,
+          CircleOpcode::PADV2, CircleOpcode::RESHAPE, CircleOpcode::SPLIT};
+}
+
 /**
  * BEFORE
  *                 |
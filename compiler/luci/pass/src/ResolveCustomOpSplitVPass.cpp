@@ -154,6 +154,12 @@ bool resolve_splitv(luci::CircleCustom *node)
 namespace luci
 {
 
+std::vector<CircleOpcode> ResolveCustomOpSplitVPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::CIRCLECUSTOMOUT, CircleOpcode::CIRCLESPLITVOUT,
+          CircleOpcode::CUSTOM, CircleOpcode::SPLIT_V};
+}
+
 bool ResolveCustomOpSplitVPass::run(loco::Graph *g)
 {
   bool changed = false;
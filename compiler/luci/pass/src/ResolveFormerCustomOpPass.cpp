@@ -78,6 +78,11 @@ bool resolve_custom_op(luci::CircleCustom *node)
 namespace luci
 {
 
+std::vector<CircleOpcode> ResolveFormerCustomOpPass::target_opcodes(void) const
+{
+  return {CircleOpcode::BROADCAST_TO, CircleOpcode::CUSTOM};
+}
+
 bool ResolveFormerCustomOpPass::run(loco::Graph *g)
 {
   bool changed = false;
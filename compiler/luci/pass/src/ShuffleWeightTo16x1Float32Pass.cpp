@@ -113,6 +113,11 @@ luci::CircleConst *shuffle_weight(luci::CircleFullyConnected *fc)
 namespace luci
 {
 
+std::vector<CircleOpcode> ShuffleWeightTo16x1Float32Pass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::FULLY_CONNECTED};
+}
+
 bool ShuffleWeightTo16x1Float32Pass::run(loco::Graph *g)
 {
   bool changed = false;
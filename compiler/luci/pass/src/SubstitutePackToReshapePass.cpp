@@ -90,6 +90,11 @@ bool substitute_pack_to_reshape(luci::CircleNode *node)
 namespace luci
 {
 
+std::vector<CircleOpcode> SubstitutePackToReshapePass::target_opcodes(void) const
+{
+  return {CircleOpcode::PACK, CircleOpcode::CIRCLECONST};
+}
+
 /**
  * BEFORE
  *           |
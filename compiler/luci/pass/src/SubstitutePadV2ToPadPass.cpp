@@ -386,6 +386,12 @@ bool substitute_padv2_to_pad(luci::CircleMaxPool2D *maxp)
 namespace luci
 {
 
+std::vector<CircleOpcode> SubstitutePadV2ToPadPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::MAX_POOL_2D, CircleOpcode::PAD,
+          CircleOpcode::PADV2, CircleOpcode::RELU, CircleOpcode::TRANSPOSE};
+}
+
 /**
  * Case 1) Basic case
  *
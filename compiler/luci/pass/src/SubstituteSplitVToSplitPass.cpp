@@ -83,6 +83,12 @@ bool resolve_splitv(luci::CircleSplitV *sv)
 namespace luci
 {
 
+std::vector<CircleOpcode> SubstituteSplitVToSplitPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::CIRCLESPLITOUT, CircleOpcode::CIRCLESPLITVOUT,
+          CircleOpcode::SPLIT, CircleOpcode::SPLIT_V};
+}
+
 /**
  *  EXAMPLE (SplitV with num_split = 2)
  *
@@ -148,6 +148,11 @@ bool substitute_squeeze_to_reshape(luci::CircleSqueeze *squeeze)
 namespace luci
 {
 
+std::vector<CircleOpcode> SubstituteSqueezeToReshapePass::target_opcodes(void) const
+{
+  return {CircleOpcode::SQUEEZE, CircleOpcode::CIRCLECONST};
+}
+
 /**
  * BEFORE
  *           |
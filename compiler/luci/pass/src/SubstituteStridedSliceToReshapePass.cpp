@@ -176,6 +176,11 @@ bool substitute_strided_slice_to_reshape(luci::CircleStridedSlice *ss_node)
 namespace luci
 {
 
+std::vector<CircleOpcode> SubstituteStridedSliceToReshapePass::target_opcodes(void) const
+{
+  return {CircleOpcode::STRIDED_SLICE, CircleOpcode::CIRCLECONST};
+}
+
 /**
  * BEFORE
  *          |
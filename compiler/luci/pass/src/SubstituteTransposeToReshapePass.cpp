@@ -100,6 +100,11 @@ bool substitute_transpose_to_reshape(luci::CircleTranspose *node)
 namespace luci
 {
 
+std::vector<CircleOpcode> SubstituteTransposeToReshapePass::target_opcodes(void) const
+{
+  return {CircleOpcode::TRANSPOSE, CircleOpcode::CIRCLECONST};
+}
+
 /**
  * BEFORE
  *
@@ -114,6 +114,12 @@ template <loco::DataType DT> bool transform_min_max_pattern(luci::CircleMaximum
 namespace luci
 {
 
+std::vector<CircleOpcode> TransformMinMaxToRelu6Pass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::MAXIMUM, CircleOpcode::MINIMUM,
+          CircleOpcode::RELU6};
+}
+
 bool TransformMinMaxToRelu6Pass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -104,6 +104,12 @@ template <loco::DataType DT> bool transform_min_relu_pattern(luci::CircleRelu *r
 namespace luci
 {
 
+std::vector<CircleOpcode> TransformMinReluToRelu6Pass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::MINIMUM, CircleOpcode::RELU,
+          CircleOpcode::RELU6};
+}
+
 bool TransformMinReluToRelu6Pass::run(loco::Graph *g)
 {
   bool changed = false;
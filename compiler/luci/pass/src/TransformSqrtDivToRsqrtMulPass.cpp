@@ -82,6 +82,12 @@ bool transform_sqrtdiv_to_rsqrtmul(luci::CircleDiv *div)
 namespace luci
 {
 
+std::vector<CircleOpcode> TransformSqrtDivToRsqrtMulPass::target_opcodes(void) const
+{
+  return {CircleOpcode::CIRCLECONST, CircleOpcode::DIV, CircleOpcode::MUL, CircleOpcode::RSQRT,
+          CircleOpcode::SQRT};
+}
+
 bool TransformSqrtDivToRsqrtMulPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -650,6 +650,15 @@ bool unroll_lstm(luci::CircleUnidirectionalSequenceLSTM *lstm)
 namespace luci
 {
 
+std::vector<CircleOpcode> UnrollUnidirectionalSequenceLSTMPass::target_opcodes(void) const
+{
+  return {CircleOpcode::ADD, CircleOpcode::CIRCLECONST, CircleOpcode::CIRCLESPLITOUT,
+          CircleOpcode::CIRCLEUNPACKOUT, CircleOpcode::FULLY_CONNECTED, CircleOpcode::LOGISTIC,
+          CircleOpcode::MUL, CircleOpcode::PACK, CircleOpcode::RESHAPE, CircleOpcode::SPLIT,
+          CircleOpcode::TANH, CircleOpcode::TRANSPOSE, CircleOpcode::UNIDIRECTIONAL_SEQUENCE_LSTM,
+          CircleOpcode::UNPACK};
+}
+
 bool UnrollUnidirectionalSequenceLSTMPass::run(loco::Graph *g)
 {
   bool changed = false;
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WorklistPhase.h"
+
+#include <luci/IncrementalPass.h>
+#include <luci/TargetOpcodes.h>
+#include <luci/IR/CircleNode.h>
+#include <luci/Log.h>
+
+#include <set>
+#include <vector>
+
+namespace
+{
+
+using OpcodeSet = std::set<luci::CircleOpcode>;
+
+/**
+ * @brief Collect nodes of a graph that are changed or destroyed while it is alive
+ */
+class ChangeCollector final : public loco::GraphObserver
+{
+public:
+  ChangeCollector(loco::Graph *g) : _graph{g}, _prev{g->observer()} { _graph->observer(this); }
+
+  ~ChangeCollector() { _graph->observer(_prev); }
+
+public:
+  void node_changed(loco::Node *node) final
+  {
+    _changed.insert(node);
+    if (_prev != nullptr)
+      _prev->node_changed(node);
+  }
+
+  void node_destroyed(loco::Node *node) final
+  {
+    _changed.erase(node);
+    _destroyed.insert(node);
+    if (_prev != nullptr)
+      _prev->node_destroyed(node);
+  }
+
+public:
+  // Nodes that are changed and still alive
+  const luci::NodeSet &changed(void) const { return _changed; }
+  const luci::NodeSet &destroyed(void) const { return _destroyed; }
+
+  void clear(void)
+  {
+    _changed.clear();
+    _destroyed.clear();
+  }
+
+private:
+  loco::Graph *_graph;
+  loco::GraphObserver *_prev;
+  luci::NodeSet _changed;
+  luci::NodeSet _destroyed;
+};
+
+/**
+ * @brief Return changed nodes with their inputs and users
+ */
+luci::NodeSet neighborhood(const luci::NodeSet &changed)
+{
+  luci::NodeSet nodes;
+  for (auto node : changed)
+  {
+    nodes.insert(node);
+    for (uint32_t i = 0; i < node->arity(); ++i)
+    {
+      if (node->arg(i) != nullptr)
+        nodes.insert(node->arg(i));
+    }
+    for (auto succ : loco::succs(node))
+      nodes.insert(succ);
+  }
+  return nodes;
+}
+
+bool intersects(const OpcodeSet &lhs, const OpcodeSet &rhs)
+{
+  for (auto opcode : lhs)
+  {
+    if (rhs.find(opcode) != rhs.end())
+      return true;
+  }
+  return false;
+}
+
+} // namespace
+
+namespace luci
+{
+
+void WorklistPhaseRunner::run(const logo::Phase &phase) const
+{
+  LOGGER(l);
+
+  const auto num_passes = phase.size();
+
+  std::vector<OpcodeSet> targets(num_passes);
+  std::vector<luci::IncrementalPass *> incrementals(num_passes, nullptr);
+  for (size_t i = 0; i < num_passes; ++i)
+  {
+    if (auto target = dynamic_cast<luci::TargetOpcodes *>(phase[i].get()))
+    {
+      auto opcodes = target->target_opcodes();
+      targets[i].insert(opcodes.begin(), opcodes.end());
+    }
+    incrementals[i] = dynamic_cast<luci::IncrementalPass *>(phase[i].get());
+  }
+
+  // Pass should run over the whole graph
+  std::vector<bool> full(num_passes, true);
+  // Graph is changed after the pass ran
+  std::vector<bool> pending(num_passes, false);
+  // Opcodes of changed nodes and their neighbors after the pass ran
+  std::vector<OpcodeSet> pending_opcodes(num_passes);
+  // Changed nodes and their neighbors after the pass ran, only for incremental passes
+  std::vector<NodeSet> pending_nodes(num_passes);
+
+  auto need_run = [&](size_t i) {
+    if (full[i])
+      return true;
+    if (not pending[i])
+      return false;
+    return targets[i].empty() || intersects(pending_opcodes[i], targets[i]);
+  };
+
+  ChangeCollector collector{_graph};
+  bool changed_in_sweep = false;
+  uint32_t num_runs = 0;
+  uint32_t num_sweeps = 1;
+
+  notifyPhaseBegin();
+
+  while (true)
+  {
+    size_t p = 0;
+    while (p < num_passes && not need_run(p))
+      ++p;
+
+    if (p == num_passes)
+    {
+      if (not changed_in_sweep)
+        break;
+
+      // Run all passes over the whole graph again to confirm nothing is left,
+      // as changes in attributes of nodes are not collected
+      full.assign(num_passes, true);
+      changed_in_sweep = false;
+      ++num_sweeps;
+      continue;
+    }
+
+    auto pass = phase[p].get();
+    notifyPassBegin(pass);
+
+    bool pass_changed = false;
+    NodeSet updated;
+    if (incrementals[p] != nullptr)
+    {
+      if (full[p])
+      {
+        auto nodes = loco::all_nodes(_graph);
+        pending_nodes[p].insert(nodes.begin(), nodes.end());
+      }
+      pass_changed = incrementals[p]->run(_graph, pending_nodes[p], updated);
+    }
+    else
+    {
+      pass_changed = pass->run(_graph);
+    }
+    ++num_runs;
+
+    notifyPassEnd(pass, pass_changed);
+
+    full[p] = false;
+    pending[p] = false;
+    pending_opcodes[p].clear();
+    pending_nodes[p].clear();
+
+    for (auto node : collector.destroyed())
+    {
+      for (auto &nodes : pending_nodes)
+        nodes.erase(node);
+    }
+
+    NodeSet changed = collector.changed();
+    changed.insert(updated.begin(), updated.end());
+    collector.clear();
+
+    if (not pass_changed)
+      continue;
+
+    changed_in_sweep = true;
+
+    if (changed.empty())
+    {
+      // Nothing is collected, like when only constant values are updated
+      full.assign(num_passes, true);
+      continue;
+    }
+
+    auto nodes = neighborhood(changed);
+    OpcodeSet opcodes;
+    for (auto node : nodes)
+    {
+      if (auto circle_node = dynamic_cast<luci::CircleNode *>(node))
+        opcodes.insert(circle_node->opcode());
+    }
+
+    for (size_t i = 0; i < num_passes; ++i)
+    {
+      pending[i] = true;
+      pending_opcodes[i].insert(opcodes.begin(), opcodes.end());
+      if (incrementals[i] != nullptr)
+        pending_nodes[i].insert(nodes.begin(), nodes.end());
+    }
+  }
+
+  notifyPhaseEnd();
+
+  INFO(l) << "WorklistPhaseRunner: " << num_runs << " pass runs, " << num_sweeps << " sweeps"
+          << std::endl;
+}
+
+} // namespace luci
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __LUCI_WORKLIST_PHASE_H__
+#define __LUCI_WORKLIST_PHASE_H__
+
+#include <logo/Phase.h>
+
+#include <loco.h>
+
+namespace luci
+{
+
+/**
+ * @brief Run passes like logo::PhaseRunner<logo::PhaseStrategy::Restart> while skipping passes
+ *        that cannot match anything new
+ *
+ * While a pass runs, nodes that are created, connected or disconnected are collected through
+ * loco::GraphObserver, and only passes matching them or their neighbors are queued again, see
+ * luci::TargetOpcodes. luci::IncrementalPass runs on changed nodes only and reports nodes whose
+ * shape or type it updates. When the queue is empty, all passes run once more over the whole
+ * graph so the result is a fixed point of all passes like Restart strategy.
+ */
+class WorklistPhaseRunner final : public logo::PhaseRunnerMixinObservable
+{
+public:
+  WorklistPhaseRunner(loco::Graph *graph) : _graph{graph}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void run(const logo::Phase &) const;
+
+private:
+  loco::Graph *_graph;
+};
+
+} // namespace luci
+
+#endif // __LUCI_WORKLIST_PHASE_H__
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "WorklistPhase.h"
+
+#include <luci/IncrementalPass.h>
+#include <luci/TargetOpcodes.h>
+#include <luci/IR/CircleNodes.h>
+
+#include <luci/test/TestIOGraph.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+class ReluGraph : public TestIOGraph
+{
+public:
+  void init(void)
+  {
+    TestIOGraph::init({1}, {1});
+
+    _relu = g()->nodes()->create<luci::CircleRelu>();
+    _relu->features(input());
+    _relu->name("relu");
+
+    output()->from(_relu);
+  }
+
+public:
+  luci::CircleRelu *_relu = nullptr;
+};
+
+// Count runs and never change the graph
+class CountPass : public logo::Pass, public luci::TargetOpcodes
+{
+public:
+  CountPass(uint32_t *runs, const std::vector<luci::CircleOpcode> &opcodes = {})
+    : _runs{runs}, _opcodes{opcodes}
+  {
+  }
+
+  const char *name(void) const final { return "CountPass"; }
+
+  bool run(loco::Graph *) final
+  {
+    (*_runs)++;
+    return false;
+  }
+
+  std::vector<luci::CircleOpcode> target_opcodes(void) const final { return _opcodes; }
+
+private:
+  uint32_t *_runs;
+  std::vector<luci::CircleOpcode> _opcodes;
+};
+
+// Insert Abs before Relu at the first run
+class InsertAbsPass : public logo::Pass
+{
+public:
+  InsertAbsPass(luci::CircleRelu *relu, uint32_t *runs) : _relu{relu}, _runs{runs} {}
+
+  const char *name(void) const final { return "InsertAbsPass"; }
+
+  bool run(loco::Graph *g) final
+  {
+    (*_runs)++;
+    if (dynamic_cast<luci::CircleAbs *>(_relu->features()) != nullptr)
+      return false;
+
+    auto abs = g->nodes()->create<luci::CircleAbs>();
+    abs->x(_relu->features());
+    abs->name("abs");
+    _relu->features(abs);
+    return true;
+  }
+
+private:
+  luci::CircleRelu *_relu;
+  uint32_t *_runs;
+};
+
+// Remove Abs before Relu
+class RemoveAbsPass : public logo::Pass
+{
+public:
+  RemoveAbsPass(luci::CircleRelu *relu) : _relu{relu} {}
+
+  const char *name(void) const final { return "RemoveAbsPass"; }
+
+  bool run(loco::Graph *g) final
+  {
+    auto abs = dynamic_cast<luci::CircleAbs *>(_relu->features());
+    if (abs == nullptr)
+      return false;
+
+    _relu->features(abs->x());
+    g->nodes()->destroy(abs);
+    return true;
+  }
+
+private:
+  luci::CircleRelu *_relu;
+};
+
+// Record nodes given at each run, and report 'node' as updated at the first run
+class RecordIncrementalPass : public logo::Pass, public luci::IncrementalPass
+{
+public:
+  RecordIncrementalPass(std::vector<luci::NodeSet> *runs, loco::Node *node = nullptr)
+    : _runs{runs}, _node{node}
+  {
+  }
+
+  const char *name(void) const final { return "RecordIncrementalPass"; }
+
+  bool run(loco::Graph *) final { throw std::runtime_error("Not expected"); }
+
+  bool run(loco::Graph *, const luci::NodeSet &changed, luci::NodeSet &updated) final
+  {
+    _runs->emplace_back(changed);
+    if (_node == nullptr || _runs->size() > 1)
+      return false;
+
+    updated.insert(_node);
+    return true;
+  }
+
+private:
+  std::vector<luci::NodeSet> *_runs;
+  loco::Node *_node;
+};
+
+} // namespace
+
+TEST(WorklistPhaseRunnerTest, no_change)
+{
+  ReluGraph g;
+  g.init();
+
+  uint32_t runs = 0;
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<CountPass>(&runs));
+
+  luci::WorklistPhaseRunner runner{g.g()};
+  runner.run(phase);
+
+  EXPECT_EQ(1, runs);
+  EXPECT_EQ(nullptr, g.g()->observer());
+}
+
+TEST(WorklistPhaseRunnerTest, skip_unmatched_pass)
+{
+  ReluGraph g;
+  g.init();
+
+  uint32_t tanh_runs = 0;
+  uint32_t relu_runs = 0;
+  uint32_t abs_runs = 0;
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<CountPass>(
+    &tanh_runs, std::vector<luci::CircleOpcode>{luci::CircleOpcode::TANH}));
+  phase.emplace_back(std::make_unique<CountPass>(
+    &relu_runs, std::vector<luci::CircleOpcode>{luci::CircleOpcode::RELU}));
+  phase.emplace_back(std::make_unique<InsertAbsPass>(g._relu, &abs_runs));
+
+  luci::WorklistPhaseRunner runner{g.g()};
+  runner.run(phase);
+
+  EXPECT_NE(nullptr, dynamic_cast<luci::CircleAbs *>(g._relu->features()));
+  // first run and the final sweep, Tanh is not next to the changed nodes
+  EXPECT_EQ(2, tanh_runs);
+  // first run, after Relu is changed and the final sweep
+  EXPECT_EQ(3, relu_runs);
+  EXPECT_EQ(3, abs_runs);
+}
+
+TEST(WorklistPhaseRunnerTest, incremental_pass)
+{
+  ReluGraph g;
+  g.init();
+
+  uint32_t abs_runs = 0;
+  std::vector<luci::NodeSet> runs;
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<RecordIncrementalPass>(&runs));
+  phase.emplace_back(std::make_unique<InsertAbsPass>(g._relu, &abs_runs));
+
+  luci::WorklistPhaseRunner runner{g.g()};
+  runner.run(phase);
+
+  // first run, after Abs is inserted and the final sweep
+  ASSERT_EQ(3, runs.size());
+  EXPECT_EQ(3, runs[0].size());
+  auto abs = g._relu->features();
+  EXPECT_NE(runs[1].end(), runs[1].find(abs));
+  EXPECT_NE(runs[1].end(), runs[1].find(g._relu));
+  EXPECT_EQ(4, runs[2].size());
+}
+
+TEST(WorklistPhaseRunnerTest, updated_nodes)
+{
+  ReluGraph g;
+  g.init();
+
+  uint32_t tanh_runs = 0;
+  uint32_t relu_runs = 0;
+  std::vector<luci::NodeSet> runs;
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<CountPass>(
+    &tanh_runs, std::vector<luci::CircleOpcode>{luci::CircleOpcode::TANH}));
+  phase.emplace_back(std::make_unique<CountPass>(
+    &relu_runs, std::vector<luci::CircleOpcode>{luci::CircleOpcode::RELU}));
+  phase.emplace_back(std::make_unique<RecordIncrementalPass>(&runs, g._relu));
+
+  luci::WorklistPhaseRunner runner{g.g()};
+  runner.run(phase);
+
+  // Relu updated without changes in edges is still matched
+  EXPECT_EQ(2, tanh_runs);
+  EXPECT_EQ(3, relu_runs);
+}
+
+TEST(WorklistPhaseRunnerTest, destroyed_node)
+{
+  ReluGraph g;
+  g.init();
+
+  auto abs = g.g()->nodes()->create<luci::CircleAbs>();
+  abs->x(g.input());
+  abs->name("abs");
+  g._relu->features(abs);
+
+  std::vector<luci::NodeSet> runs;
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<RecordIncrementalPass>(&runs));
+  phase.emplace_back(std::make_unique<RemoveAbsPass>(g._relu));
+
+  luci::WorklistPhaseRunner runner{g.g()};
+  runner.run(phase);
+
+  EXPECT_EQ(g.input(), g._relu->features());
+  ASSERT_EQ(3, runs.size());
+  EXPECT_NE(runs[0].end(), runs[0].find(abs));
+  // destroyed Abs is not given to the pass
+  EXPECT_EQ(runs[1].end(), runs[1].find(abs));
+  EXPECT_NE(runs[1].end(), runs[1].find(g._relu));
+}
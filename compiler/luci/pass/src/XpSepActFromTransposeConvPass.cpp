@@ -108,6 +108,11 @@ bool separate_activation_fuction(luci::CircleTransposeConv *trconv)
 
 } // namespace
 
+std::vector<CircleOpcode> XpSepActFromTransposeConvPass::target_opcodes(void) const
+{
+  return {CircleOpcode::RELU, CircleOpcode::RELU6, CircleOpcode::TRANSPOSE_CONV};
+}
+
 bool XpSepActFromTransposeConvPass::run(loco::Graph *g)
 {
   bool changed = false;
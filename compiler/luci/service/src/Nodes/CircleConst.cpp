@@ -37,6 +37,13 @@ void copy_values(const luci::CircleConst *node, luci::CircleConst *cloned)
   assert(T == cloned->dtype());
 
   const auto size = node->size<T>();
+  if (auto ext_data = node->external_data())
+  {
+    // share read-only external data, each node copies it when modified
+    cloned->external_data(ext_data, size * sizeof(typename loco::DataTypeImpl<T>::Type));
+    return;
+  }
+
   cloned->size<T>(size);
   for (uint32_t i = 0; i < size; i++)
     cloned->at<T>(i) = node->at<T>(i);
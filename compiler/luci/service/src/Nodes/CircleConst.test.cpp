@@ -22,6 +22,9 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <vector>
+
 namespace
 {
 
@@ -182,6 +185,32 @@ TEST(CircleConstTest, clone_BOOL)
   ASSERT_EQ(loco::DataType::BOOL, const_cloned->dtype());
 }
 
+TEST(CircleConstTest, clone_external_data)
+{
+  auto g = loco::make_graph();
+
+  auto buffer = std::make_shared<std::vector<float>>(std::vector<float>{1.0f, 2.0f});
+  std::shared_ptr<const uint8_t> ext_data(buffer,
+                                          reinterpret_cast<const uint8_t *>(buffer->data()));
+
+  auto circle_const = g->nodes()->create<luci::CircleConst>();
+  circle_const->dtype(loco::DataType::FLOAT32);
+  circle_const->rank(1);
+  circle_const->dim(0).set(2);
+  circle_const->external_data(ext_data, 2 * sizeof(float));
+
+  auto const_cloned = luci::clone(circle_const);
+
+  // clone shares external data until it is modified
+  ASSERT_EQ(ext_data, const_cloned->external_data());
+  const_cloned->at<loco::DataType::FLOAT32>(0) = 3.0f;
+  ASSERT_EQ(nullptr, const_cloned->external_data());
+  ASSERT_EQ(ext_data, circle_const->external_data());
+  ASSERT_EQ(1.0f, buffer->at(0));
+  ASSERT_EQ(3.0f, const_cloned->at<loco::DataType::FLOAT32>(0));
+  ASSERT_EQ(2.0f, const_cloned->at<loco::DataType::FLOAT32>(1));
+}
+
 TEST(CloneNodeTest, clone_Const)
 {
   auto g = loco::make_graph();
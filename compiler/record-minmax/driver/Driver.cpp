@@ -91,6 +91,12 @@ int entry(const int argc, char **argv)
     .default_value(false)
     .help("This will turn on profiling data generation.");
 
+  arser.add_argument("--mmap_import")
+    .nargs(0)
+    .default_value(false)
+    .help("Map input model to memory and copy constants only when they are modified. "
+          "Input model file should not be modified while running.");
+
   try
   {
     arser.parse(argc, argv);
@@ -128,6 +134,8 @@ int entry(const int argc, char **argv)
     ::get_values_from<std::string>(arser, "--input_data_format", "h5");
   if (arser["--generate_profile_data"])
     settings->set(luci::UserSettings::Key::ProfilingDataGen, true);
+  if (arser["--mmap_import"])
+    settings->set(luci::UserSettings::Key::MMapImport, true);
 
   std::unique_ptr<MinMaxComputer> computer;
   {
@@ -21,7 +21,11 @@
 #include <ruy/context.h>     // from @ruy
 #include <ruy/thread_pool.h> // from @ruy
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <stdexcept>
+#include <vector>
 
 namespace nnfw
 {
@@ -44,6 +48,70 @@ void Execute(int tasks_count, TaskType *tasks, ruy::Context *ruy_context)
   ruy_context->mutable_thread_pool()->Execute(tasks_count, tasks);
 }
 
+// Elements a task of a memory-bound kernel should touch at least to pay off waking up a worker
+constexpr int64_t kMinElementsPerTask = 16 * 1024;
+// Cost of an element of kernels computing exp, tanh and so on, relative to a copy
+constexpr int64_t kTranscendentalCost = 8;
+
+template <typename Fn> struct RangeTask : Task
+{
+  RangeTask(const Fn &fn, int begin, int end) : fn_(&fn), begin_(begin), end_(end) {}
+
+  void Run() override { (*fn_)(begin_, end_); }
+
+private:
+  const Fn *fn_;
+  int begin_;
+  int end_;
+};
+
+/**
+ * @brief Return how many threads ParallelFor would split items into
+ */
+inline int ParallelForThreadCount(int size, int64_t item_cost, ruy::Context *ruy_context)
+{
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int64_t cost = static_cast<int64_t>(size) * std::max<int64_t>(item_cost, 1);
+  return static_cast<int>(
+    std::max<int64_t>(1, std::min<int64_t>({max_threads, size, cost / kMinElementsPerTask})));
+}
+
+/**
+ * @brief Run fn(begin, end) over contiguous ranges of items [0, size) on threads of ruy_context
+ *
+ * Items are split so that each task touches at least kMinElementsPerTask elements, so small
+ * inputs run on the caller thread only. fn must be safe to run on disjoint ranges concurrently.
+ *
+ * @param size        Number of items, e.g. elements or rows
+ * @param item_cost   Number of elements an item touches, weighted more for costly math
+ * @param ruy_context Context whose threads to use, or nullptr to run on the caller thread
+ * @param fn          Functor to process items in [begin, end)
+ */
+template <typename Fn>
+void ParallelFor(int size, int64_t item_cost, ruy::Context *ruy_context, const Fn &fn)
+{
+  if (size <= 0)
+    return;
+
+  const int thread_count = ParallelForThreadCount(size, item_cost, ruy_context);
+  if (thread_count == 1)
+  {
+    fn(0, size);
+    return;
+  }
+
+  std::vector<RangeTask<Fn>> tasks;
+  tasks.reserve(thread_count);
+  int begin = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    const int end = begin + (size - begin) / (thread_count - i);
+    tasks.emplace_back(fn, begin, end);
+    begin = end;
+  }
+  Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
 } // namespace cpu_backend_threadpool
 } // namespace cker
 } // namespace nnfw
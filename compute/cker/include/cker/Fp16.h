@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FP16_H__
+#define __NNFW_CKER_FP16_H__
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace nnfw
+{
+namespace cker
+{
+
+// IEEE 754 binary16 values are kept in uint16_t, as C++ has no portable half type
+
+inline float HalfToFloat(uint16_t h)
+{
+  const uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16;
+  uint32_t exponent = (h >> 10) & 0x1f;
+  uint32_t mantissa = h & 0x3ff;
+  uint32_t bits;
+  if (exponent == 0x1f)
+  {
+    // Inf or NaN
+    bits = sign | 0x7f800000 | (mantissa << 13);
+  }
+  else if (exponent != 0)
+  {
+    bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+  }
+  else if (mantissa == 0)
+  {
+    bits = sign;
+  }
+  else
+  {
+    // Subnormal half is a normal float
+    exponent = 113;
+    while ((mantissa & 0x400) == 0)
+    {
+      mantissa <<= 1;
+      --exponent;
+    }
+    bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+  }
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+// Rounds to nearest even, saturates to Inf and keeps NaN
+inline uint16_t FloatToHalf(float f)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &f, sizeof(bits));
+  const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+  const uint32_t abs = bits & 0x7fffffff;
+  if (abs >= 0x7f800000)
+    return sign | 0x7c00 | (abs > 0x7f800000 ? 0x200 : 0);
+  // 65520 and above round to Inf
+  if (abs >= 0x477ff000)
+    return sign | 0x7c00;
+  // Below 2^-14 is subnormal in half
+  if (abs < 0x38800000)
+  {
+    // Below half of the smallest subnormal rounds to 0
+    if (abs < 0x33000000)
+      return sign;
+    const uint32_t shift = 126 - (abs >> 23);
+    const uint32_t mantissa = (abs & 0x7fffff) | 0x800000;
+    uint32_t half = mantissa >> shift;
+    const uint32_t remainder = mantissa & ((1u << shift) - 1);
+    const uint32_t halfway = 1u << (shift - 1);
+    if (remainder > halfway || (remainder == halfway && (half & 1)))
+      ++half;
+    return sign | static_cast<uint16_t>(half);
+  }
+  uint32_t half = ((abs >> 13) - (112 << 10));
+  const uint32_t remainder = abs & 0x1fff;
+  if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+    ++half;
+  return sign | static_cast<uint16_t>(half);
+}
+
+// Widens size halfs to floats, with F16C on x86 and NEON on aarch64 if available
+inline void HalfToFloat(const uint16_t *src, float *dst, int size)
+{
+  int i = 0;
+#if defined(__F16C__)
+  for (; i + 8 <= size; i += 8)
+  {
+    const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+  }
+#elif defined(__aarch64__)
+  for (; i + 4 <= size; i += 4)
+  {
+    const float16x4_t h = vreinterpret_f16_u16(vld1_u16(src + i));
+    vst1q_f32(dst + i, vcvt_f32_f16(h));
+  }
+#endif
+  for (; i < size; ++i)
+    dst[i] = HalfToFloat(src[i]);
+}
+
+inline void FloatToHalf(const float *src, uint16_t *dst, int size)
+{
+  for (int i = 0; i < size; ++i)
+    dst[i] = FloatToHalf(src[i]);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FP16_H__
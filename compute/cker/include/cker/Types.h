@@ -301,6 +301,17 @@ struct GatherParams
   int32_t axis;
 };
 
+struct BCQFullyConnectedParams
+{
+  float float_activation_min;
+  float float_activation_max;
+};
+
+struct BCQGatherParams
+{
+  int32_t axis;
+};
+
 struct InstanceNormParams
 {
   float epsilon;
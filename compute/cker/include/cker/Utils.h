@@ -23,7 +23,9 @@
 #include "neon/neon_check.h"
 
 #include <algorithm>
+#include <cassert>
 #include <cstdint>
+#include <limits>
 #include <fixedpoint/fixedpoint.h>
 
 namespace nnfw
@@ -36,6 +38,12 @@ template <typename T> struct is_quant8
   static constexpr bool value = std::is_same<T, uint8_t>::value || std::is_same<T, int8_t>::value;
 };
 
+// Quantized types, including int16 which is symmetric(zero point 0)
+template <typename T> struct is_quant
+{
+  static constexpr bool value = is_quant8<T>::value || std::is_same<T, int16_t>::value;
+};
+
 template <typename T>
 inline T ActivationFunctionWithMinMax(T x, T output_activation_min, T output_activation_max)
 {
@@ -99,6 +107,25 @@ inline int32_t MultiplyByQuantizedMultiplier(int32_t x, int32_t quantized_multip
     right_shift);
 }
 
+// For 64-bit accumulators of int16 x int8 operations (from tflite's reference implementation)
+// The multiplier is reduced to 16 bits so that the product fits in int64.
+inline int32_t MultiplyByQuantizedMultiplier(int64_t x, int32_t quantized_multiplier, int shift)
+{
+  assert(quantized_multiplier >= 0);
+  assert(shift >= -31 && shift < 8);
+  assert(x >= -(static_cast<int64_t>(1) << 47) && x < (static_cast<int64_t>(1) << 47));
+
+  const int32_t reduced_multiplier =
+    (quantized_multiplier < 0x7FFF0000) ? ((quantized_multiplier + (1 << 15)) >> 16) : 0x7FFF;
+  const int total_shift = 15 - shift;
+  const int64_t round = static_cast<int64_t>(1) << (total_shift - 1);
+  const int64_t result = (x * static_cast<int64_t>(reduced_multiplier) + round) >> total_shift;
+
+  assert(result >= std::numeric_limits<int32_t>::min() &&
+         result <= std::numeric_limits<int32_t>::max());
+  return static_cast<int32_t>(result);
+}
+
 inline int32_t MultiplyByQuantizedMultiplierGreaterThanOne(int32_t x, int32_t quantized_multiplier,
                                                            int left_shift)
 {
@@ -82,6 +82,16 @@ private:
   std::unique_ptr<Eigen::ThreadPool> pool_;
 };
 
+// Number of threads in the global threadpool, 0 for the number of cores.
+// This takes effect only when it is set before the threadpool is used.
+inline int &MaxNumThreads()
+{
+  static int max_num_threads = 0;
+  return max_num_threads;
+}
+
+inline void SetMaxNumThreads(int max_num_threads) { MaxNumThreads() = max_num_threads; }
+
 struct EigenContext
 {
   constexpr static int default_num_threadpool_threads = 4;
@@ -90,7 +100,7 @@ struct EigenContext
 
   EigenContext()
   {
-    int num_threads = std::thread::hardware_concurrency();
+    int num_threads = MaxNumThreads() > 0 ? MaxNumThreads() : std::thread::hardware_concurrency();
     if (num_threads == 0)
     {
       num_threads = default_num_threadpool_threads;
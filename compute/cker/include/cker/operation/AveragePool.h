@@ -518,6 +518,65 @@ void AveragePool<int8_t>(const PoolParams &params, const Shape &input_shape,
   }
 }
 
+template <>
+void AveragePool<int16_t>(const PoolParams &params, const Shape &input_shape,
+                          const int16_t *input_data, const Shape &output_shape,
+                          int16_t *output_data)
+{
+  assert(params.quantized_activation_min <= params.quantized_activation_max);
+  assert(input_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int stride_height = params.stride_height;
+  const int stride_width = params.stride_width;
+
+  // int32 accumulators hold sums of up to 65536 int16 values
+  std::vector<int32_t> acc(depth);
+  for (int batch = 0; batch < batches; ++batch)
+  {
+    for (int out_y = 0; out_y < output_height; ++out_y)
+    {
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        const int in_x_origin = (out_x * stride_width) - params.padding_values.width;
+        const int in_y_origin = (out_y * stride_height) - params.padding_values.height;
+        const int filter_x_start = std::max(0, -in_x_origin);
+        const int filter_x_end = std::min(params.filter_width, input_width - in_x_origin);
+        const int filter_y_start = std::max(0, -in_y_origin);
+        const int filter_y_end = std::min(params.filter_height, input_height - in_y_origin);
+        const int filter_count = (filter_x_end - filter_x_start) * (filter_y_end - filter_y_start);
+        assert(filter_count > 0);
+        std::fill(acc.begin(), acc.end(), 0);
+        for (int fy = filter_y_start; fy < filter_y_end; ++fy)
+        {
+          for (int fx = filter_x_start; fx < filter_x_end; ++fx)
+          {
+            const int16_t *input_ptr =
+              input_data + Offset(input_shape, batch, in_y_origin + fy, in_x_origin + fx, 0);
+            for (int channel = 0; channel < depth; ++channel)
+              acc[channel] += input_ptr[channel];
+          }
+        }
+        int16_t *output_ptr = output_data + Offset(output_shape, batch, out_y, out_x, 0);
+        for (int channel = 0; channel < depth; ++channel)
+        {
+          // Round half away from zero
+          int32_t a = acc[channel] > 0 ? (acc[channel] + filter_count / 2) / filter_count
+                                       : (acc[channel] - filter_count / 2) / filter_count;
+          a = std::max<int32_t>(a, params.quantized_activation_min);
+          a = std::min<int32_t>(a, params.quantized_activation_max);
+          output_ptr[channel] = static_cast<int16_t>(a);
+        }
+      }
+    }
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BCQ_FULLY_CONNECTED_H__
+#define __NNFW_CKER_BCQ_FULLY_CONNECTED_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/operation/Helper/BCQ.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace bcq
+{
+
+// Planes sharing an input vector from which building lookup tables pays off
+constexpr int32_t kMinPlanesForLookup = 64;
+// Upper bound of lookup table memory for a chunk of input columns
+constexpr size_t kMaxLookupBytes = 4 * 1024 * 1024;
+// How many plane words are needed to make it worth using one more thread
+constexpr int64_t kMinWordsPerThread = 1 << 14;
+
+struct BCQFullyConnectedWorkerTask : cpu_backend_threadpool::Task
+{
+  BCQFullyConnectedWorkerTask(const BCQFullyConnectedParams &params, const RowPlanes &row_planes,
+                              const float *scales_data, const int32_t *binary_data,
+                              const float *bias_data, const float *tables, bool use_lookup,
+                              int32_t words, int32_t table_size, int32_t batch, int32_t col_begin,
+                              int32_t col_end, float *output_data, int32_t row_begin,
+                              int32_t row_end)
+    : params_(params), row_planes_(row_planes), scales_data_(scales_data),
+      binary_data_(binary_data), bias_data_(bias_data), tables_(tables), use_lookup_(use_lookup),
+      words_(words), table_size_(table_size), batch_(batch), col_begin_(col_begin),
+      col_end_(col_end), output_data_(output_data), row_begin_(row_begin), row_end_(row_end)
+  {
+  }
+
+  void Run() override
+  {
+    for (int32_t r = row_begin_; r < row_end_; ++r)
+    {
+      const int32_t qbits = row_planes_.qbits[r];
+      const int32_t first_plane = row_planes_.first_plane[r];
+      const int32_t plane_stride = row_planes_.plane_stride[r];
+      const float bias = (bias_data_ != nullptr) ? bias_data_[r] : 0.f;
+
+      for (int32_t col = col_begin_; col < col_end_; ++col)
+      {
+        const float *table = tables_ + (col - col_begin_) * table_size_;
+        float acc = bias;
+        for (int32_t b = 0; b < qbits; ++b)
+        {
+          const int32_t plane_index = first_plane + b * plane_stride;
+          const int32_t *plane = binary_data_ + plane_index * words_;
+          const float dot = use_lookup_ ? PlaneDotLookup(plane, words_, table)
+                                        : PlaneDotDirect(plane, words_, table);
+          acc += scales_data_[plane_index] * dot;
+        }
+        output_data_[r * batch_ + col] =
+          std::min(std::max(acc, params_.float_activation_min), params_.float_activation_max);
+      }
+    }
+  }
+
+private:
+  const BCQFullyConnectedParams &params_;
+  const RowPlanes &row_planes_;
+  const float *scales_data_;
+  const int32_t *binary_data_;
+  const float *bias_data_;
+  const float *tables_;
+  bool use_lookup_;
+  int32_t words_;
+  int32_t table_size_;
+  int32_t batch_;
+  int32_t col_begin_;
+  int32_t col_end_;
+  float *output_data_;
+  int32_t row_begin_;
+  int32_t row_end_;
+};
+
+} // namespace bcq
+
+/**
+ * @brief BCQFullyConnected computes output[rows, batch] = W[rows, hidden] x input[hidden, batch]
+ *        with BCQ weights W (see cker/operation/Helper/BCQ.h for the weight layout)
+ *
+ * When many planes share an input column, partial sums of every 8 inputs are tabulated once for
+ * all 256 sign patterns so that each plane costs one table lookup per 8 weights.
+ * Output rows are distributed over threads of ruy_context.
+ *
+ * @param scratch Buffer for lookup tables, resized as needed and reusable across calls
+ */
+inline void BCQFullyConnected(const BCQFullyConnectedParams &params, const Shape &input_shape,
+                              const float *input_data, const float *scales_data,
+                              const int32_t *binary_data, const float *bias_data,
+                              const bcq::RowPlanes &row_planes, const Shape &output_shape,
+                              float *output_data, std::vector<float> &scratch,
+                              ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 2);
+  assert(output_shape.DimensionsCount() == 2);
+  const int32_t hidden_size = input_shape.Dims(0);
+  const int32_t batch = MatchingDim(input_shape, 1, output_shape, 1);
+  const int32_t rows = output_shape.Dims(0);
+  assert(rows == row_planes.rows());
+
+  const int32_t words = bcq::WordsPerPlane(hidden_size);
+  int64_t num_planes = 0;
+  for (int32_t r = 0; r < rows; ++r)
+    num_planes += row_planes.qbits[r];
+
+  // Each input column gets either lookup tables or a zero-padded copy of itself
+  const bool use_lookup = num_planes >= bcq::kMinPlanesForLookup;
+  const int32_t table_size =
+    use_lookup ? bcq::LutGroups(hidden_size) * bcq::kLutEntries : words * 32;
+  const int32_t cols_per_chunk = std::max<int32_t>(
+    1, std::min<int64_t>(batch, bcq::kMaxLookupBytes / (table_size * sizeof(float))));
+  scratch.resize(static_cast<size_t>(cols_per_chunk) * table_size);
+
+  const auto max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int32_t thread_count = std::max<int32_t>(
+    1, std::min<int64_t>({static_cast<int64_t>(max_threads), static_cast<int64_t>(rows),
+                          num_planes * words * cols_per_chunk / bcq::kMinWordsPerThread}));
+
+  for (int32_t col_begin = 0; col_begin < batch; col_begin += cols_per_chunk)
+  {
+    const int32_t col_end = std::min(batch, col_begin + cols_per_chunk);
+    for (int32_t col = col_begin; col < col_end; ++col)
+    {
+      float *table = scratch.data() + (col - col_begin) * table_size;
+      if (use_lookup)
+      {
+        bcq::BuildLookupTable(input_data + col, batch, hidden_size, table);
+      }
+      else
+      {
+        for (int32_t j = 0; j < table_size; ++j)
+          table[j] = (j < hidden_size) ? input_data[j * batch + col] : 0.f;
+      }
+    }
+
+    std::vector<bcq::BCQFullyConnectedWorkerTask> tasks;
+    tasks.reserve(thread_count);
+    int32_t row_begin = 0;
+    for (int32_t i = 0; i < thread_count; ++i)
+    {
+      const int32_t row_end = row_begin + (rows - row_begin) / (thread_count - i);
+      tasks.emplace_back(params, row_planes, scales_data, binary_data, bias_data, scratch.data(),
+                         use_lookup, words, table_size, batch, col_begin, col_end, output_data,
+                         row_begin, row_end);
+      row_begin = row_end;
+    }
+
+    if (thread_count == 1)
+      tasks[0].Run();
+    else
+      cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BCQ_FULLY_CONNECTED_H__
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BCQ_GATHER_H__
+#define __NNFW_CKER_BCQ_GATHER_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/operation/Helper/BCQ.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace bcq
+{
+
+// How many output elements are needed to make it worth using one more thread
+constexpr int64_t kMinGatherElementsPerThread = 1 << 14;
+
+template <typename CoordsT> struct BCQGatherWorkerTask : cpu_backend_threadpool::Task
+{
+  BCQGatherWorkerTask(int32_t axis, const RowPlanes &row_planes, const float *scales_data,
+                      const int32_t *binary_data, int32_t hidden_size, const CoordsT *coords_data,
+                      int32_t coords_count, float *output_data, int32_t begin, int32_t end)
+    : axis_(axis), row_planes_(row_planes), scales_data_(scales_data), binary_data_(binary_data),
+      hidden_size_(hidden_size), coords_data_(coords_data), coords_count_(coords_count),
+      output_data_(output_data), begin_(begin), end_(end)
+  {
+  }
+
+  // axis 0 : [begin, end) is a range of coords, each coord selects a row
+  // axis 1 : [begin, end) is a range of rows, each coord selects a column in every row
+  void Run() override
+  {
+    if (axis_ == 0)
+    {
+      for (int32_t i = begin_; i < end_; ++i)
+      {
+        DequantizeRow(row_planes_, static_cast<int32_t>(coords_data_[i]), scales_data_,
+                      binary_data_, hidden_size_, output_data_ + i * hidden_size_);
+      }
+      return;
+    }
+
+    const int32_t words = WordsPerPlane(hidden_size_);
+    for (int32_t r = begin_; r < end_; ++r)
+    {
+      const int32_t qbits = row_planes_.qbits[r];
+      float *output = output_data_ + r * coords_count_;
+      for (int32_t i = 0; i < coords_count_; ++i)
+      {
+        const int32_t j = static_cast<int32_t>(coords_data_[i]);
+        float value = 0.f;
+        for (int32_t b = 0; b < qbits; ++b)
+        {
+          const int32_t plane_index = row_planes_.first_plane[r] + b * row_planes_.plane_stride[r];
+          const uint32_t word = static_cast<uint32_t>(binary_data_[plane_index * words + j / 32]);
+          const float alpha = scales_data_[plane_index];
+          value += ((word >> (j % 32)) & 1u) ? alpha : -alpha;
+        }
+        output[i] = value;
+      }
+    }
+  }
+
+private:
+  int32_t axis_;
+  const RowPlanes &row_planes_;
+  const float *scales_data_;
+  const int32_t *binary_data_;
+  int32_t hidden_size_;
+  const CoordsT *coords_data_;
+  int32_t coords_count_;
+  float *output_data_;
+  int32_t begin_;
+  int32_t end_;
+};
+
+} // namespace bcq
+
+/**
+ * @brief BCQGather gathers slices of BCQ weights W[rows, hidden] along the given axis
+ *        (see cker/operation/Helper/BCQ.h for the weight layout)
+ *
+ * Only the gathered elements are dequantized so the weights stay compressed in memory.
+ */
+template <typename CoordsT = int32_t>
+inline void BCQGather(const BCQGatherParams &params, const float *scales_data,
+                      const int32_t *binary_data, const bcq::RowPlanes &row_planes,
+                      int32_t hidden_size, const Shape &coords_shape, const CoordsT *coords_data,
+                      const Shape &output_shape, float *output_data, ruy::Context *ruy_context)
+{
+  const int32_t axis = params.axis;
+  if (axis != 0 && axis != 1)
+    throw std::runtime_error("BCQGather: axis must be 0 or 1");
+
+  const int32_t rows = row_planes.rows();
+  const int32_t coords_count = coords_shape.FlatSize();
+  const int32_t axis_size = (axis == 0) ? rows : hidden_size;
+  for (int32_t i = 0; i < coords_count; ++i)
+  {
+    if (coords_data[i] < 0 || coords_data[i] >= axis_size)
+      throw std::runtime_error("BCQGather: index out of range");
+  }
+
+  const int32_t work_count = (axis == 0) ? coords_count : rows;
+  const auto max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int32_t thread_count = std::max<int32_t>(
+    1, std::min<int64_t>({static_cast<int64_t>(max_threads), static_cast<int64_t>(work_count),
+                          output_shape.FlatSize() / bcq::kMinGatherElementsPerThread}));
+
+  std::vector<bcq::BCQGatherWorkerTask<CoordsT>> tasks;
+  tasks.reserve(thread_count);
+  int32_t begin = 0;
+  for (int32_t i = 0; i < thread_count; ++i)
+  {
+    const int32_t end = begin + (work_count - begin) / (thread_count - i);
+    tasks.emplace_back(axis, row_planes, scales_data, binary_data, hidden_size, coords_data,
+                       coords_count, output_data, begin, end);
+    begin = end;
+  }
+
+  if (thread_count == 1)
+    tasks[0].Run();
+  else
+    cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BCQ_GATHER_H__
@@ -20,6 +20,7 @@
 
 #include <functional>
 #include <stdexcept>
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/operation/optimized/BinaryArithmeticOps.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
 #include "cker/Shape.h"
@@ -209,7 +210,7 @@ inline bool ProcessBroadcastShapes(const Shape &shape0, const Shape &shape1,
 }
 
 template <BinaryArithmeticOpType op_type, typename T>
-inline typename std::enable_if_t<!is_quant8<T>::value && !std::is_same<T, bool>::value>
+inline typename std::enable_if_t<!is_quant<T>::value && !std::is_same<T, bool>::value>
 BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                    const T *input1_data, const Shape &input2_shape, const T *input2_data,
                    const Shape &output_shape, T *output_data)
@@ -219,7 +220,7 @@ BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_sh
 }
 
 template <BinaryArithmeticOpType op_type, typename T>
-inline typename std::enable_if_t<!is_quant8<T>::value && std::is_same<T, bool>::value>
+inline typename std::enable_if_t<!is_quant<T>::value && std::is_same<T, bool>::value>
 BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                    const T *input1_data, const Shape &input2_shape, const T *input2_data,
                    const Shape &output_shape, T *output_data)
@@ -229,7 +230,7 @@ BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_sh
 }
 
 template <BinaryArithmeticOpType op_type, typename T>
-inline typename std::enable_if_t<is_quant8<T>::value>
+inline typename std::enable_if_t<is_quant<T>::value>
 BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                    const T *input1_data, const Shape &input2_shape, const T *input2_data,
                    const Shape &output_shape, T *output_data)
@@ -284,8 +285,23 @@ inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shap
   }
 }
 
+// Splits elements of inputs of the same shape over threads of ruy_context
 template <BinaryArithmeticOpType op_type, typename T>
-inline typename std::enable_if_t<!is_quant8<T>::value>
+inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                               const T *input1_data, const Shape &input2_shape,
+                               const T *input2_data, const Shape &output_shape, T *output_data,
+                               ruy::Context *ruy_context)
+{
+  const int flat_size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
+  cpu_backend_threadpool::ParallelFor(flat_size, 1, ruy_context, [&](int begin, int end) {
+    const Shape range_shape{end - begin};
+    BinaryArithmeticOp<op_type>(params, range_shape, input1_data + begin, range_shape,
+                                input2_data + begin, range_shape, output_data + begin);
+  });
+}
+
+template <BinaryArithmeticOpType op_type, typename T>
+inline typename std::enable_if_t<!is_quant<T>::value>
 BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                             const T *input1_data, const Shape &input2_shape, const T *input2_data,
                             const Shape &output_shape, T *output_data)
@@ -296,7 +312,7 @@ BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1
 }
 
 template <BinaryArithmeticOpType op_type, typename T>
-inline typename std::enable_if_t<is_quant8<T>::value>
+inline typename std::enable_if_t<is_quant<T>::value>
 BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                             const T *input1_data, const Shape &input2_shape, const T *input2_data,
                             const Shape &output_shape, T *output_data)
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_CONCATENATION_H__
 #define __NNFW_CKER_CONCATENATION_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 
@@ -28,11 +29,41 @@ namespace nnfw
 {
 namespace cker
 {
+namespace concatenation
+{
+
+// Runs copy_fn(k, i, output_ptr, copy_size) that copies the k-th outer slice of the i-th input
+// into output_ptr, splitting the copies over threads of ruy_context
+template <typename Scalar, typename CopyFn>
+inline void ForEachCopy(int64_t outer_size, int inputs_count, int axis, int64_t concat_size,
+                        int64_t base_inner_size, const Shape *const *input_shapes,
+                        Scalar *output_data, ruy::Context *ruy_context, const CopyFn &copy_fn)
+{
+  const int64_t output_inner_size = concat_size * base_inner_size;
+  cpu_backend_threadpool::ParallelFor(
+    static_cast<int>(outer_size * inputs_count), output_inner_size / inputs_count, ruy_context,
+    [&](int begin, int end) {
+      Scalar *output_ptr = output_data + (begin / inputs_count) * output_inner_size;
+      for (int i = 0; i < begin % inputs_count; ++i)
+      {
+        output_ptr += input_shapes[i]->Dims(axis) * base_inner_size;
+      }
+      for (int copy = begin; copy < end; ++copy)
+      {
+        const int i = copy % inputs_count;
+        const int copy_size = input_shapes[i]->Dims(axis) * base_inner_size;
+        copy_fn(copy / inputs_count, i, output_ptr, copy_size);
+        output_ptr += copy_size;
+      }
+    });
+}
+
+} // namespace concatenation
 
 template <typename Scalar>
 inline void Concatenation(const ConcatenationParams &params, const Shape *const *input_shapes,
                           const Scalar *const *input_data, const Shape &output_shape,
-                          Scalar *output_data)
+                          Scalar *output_data, ruy::Context *ruy_context = nullptr)
 {
   int axis = params.axis;
   int inputs_count = params.inputs_count;
@@ -54,7 +85,6 @@ inline void Concatenation(const ConcatenationParams &params, const Shape *const
     concat_size += input_shapes[i]->Dims(axis);
   }
   assert(concat_size == output_shape.Dims(axis));
-  UNUSED_RELEASE(concat_size);
   int64_t outer_size = 1;
   for (int i = 0; i < axis; ++i)
   {
@@ -68,16 +98,11 @@ inline void Concatenation(const ConcatenationParams &params, const Shape *const
     base_inner_size *= output_shape.Dims(i);
   }
 
-  Scalar *output_ptr = output_data;
-  for (int k = 0; k < outer_size; k++)
-  {
-    for (int i = 0; i < inputs_count; ++i)
-    {
-      const int copy_size = input_shapes[i]->Dims(axis) * base_inner_size;
+  concatenation::ForEachCopy(
+    outer_size, inputs_count, axis, concat_size, base_inner_size, input_shapes, output_data,
+    ruy_context, [&](int k, int i, Scalar *output_ptr, int copy_size) {
       memcpy(output_ptr, input_data[i] + k * copy_size, copy_size * sizeof(Scalar));
-      output_ptr += copy_size;
-    }
-  }
+    });
 }
 
 // quantized as it takes scale as a floating point value. This should be fixed
@@ -85,7 +110,7 @@ inline void Concatenation(const ConcatenationParams &params, const Shape *const
 inline void ConcatenationWithScaling(const ConcatenationParams &params,
                                      const Shape *const *input_shapes,
                                      const uint8_t *const *input_data, const Shape &output_shape,
-                                     uint8_t *output_data)
+                                     uint8_t *output_data, ruy::Context *ruy_context = nullptr)
 {
   int axis = params.axis;
   const int32_t *input_zeropoint = params.input_zeropoint;
@@ -111,7 +136,6 @@ inline void ConcatenationWithScaling(const ConcatenationParams &params,
     concat_size += input_shapes[i]->Dims(axis);
   }
   assert(concat_size == output_shape.Dims(axis));
-  UNUSED_RELEASE(concat_size);
   int64_t outer_size = 1;
   for (int i = 0; i < axis; ++i)
   {
@@ -126,12 +150,9 @@ inline void ConcatenationWithScaling(const ConcatenationParams &params,
   }
 
   const float inverse_output_scale = 1.f / output_scale;
-  uint8_t *output_ptr = output_data;
-  for (int k = 0; k < outer_size; k++)
-  {
-    for (int i = 0; i < inputs_count; ++i)
-    {
-      const int copy_size = input_shapes[i]->Dims(axis) * base_inner_size;
+  concatenation::ForEachCopy(
+    outer_size, inputs_count, axis, concat_size, base_inner_size, input_shapes, output_data,
+    ruy_context, [&](int k, int i, uint8_t *output_ptr, int copy_size) {
       const uint8_t *input_ptr = input_data[i] + k * copy_size;
       if (input_zeropoint[i] == output_zeropoint && input_scale[i] == output_scale)
       {
@@ -148,9 +169,7 @@ inline void ConcatenationWithScaling(const ConcatenationParams &params,
           output_ptr[j] = static_cast<uint8_t>(std::max(std::min(255, value), 0));
         }
       }
-      output_ptr += copy_size;
-    }
-  }
+    });
 }
 
 } // namespace cker
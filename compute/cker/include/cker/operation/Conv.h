@@ -23,6 +23,9 @@
 #include "cker/Utils.h"
 #include "cker/operation/reference/Conv.h"
 #include "cker/operation/optimized/Conv.h"
+#include "cker/operation/optimized/GemmF16Weights.h"
+#include "cker/operation/optimized/integer_ops/ConvHybrid.h"
+#include "cker/operation/optimized/integer_ops/Gemm16x8.h"
 #include <iostream>
 #include <vector>
 
@@ -158,6 +161,87 @@ public:
                                    filter_shape, filter_data, nullptr /* filter_zero_point */,
                                    bias_shape, bias_data, output_shape, output_data);
   }
+
+  // int16 activations and int8 weights, per-channel quantized
+  void operator()(const ConvParams &params, const Shape &input_shape, const int16_t *input_data,
+                  const Shape &filter_shape, const int8_t *filter_data, const Shape &bias_shape,
+                  const int64_t *bias_data, const Shape &output_shape, int16_t *output_data,
+                  ruy::Context *ruy_context)
+  {
+    UNUSED_RELEASE(bias_shape);
+    const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+    const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+    const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+    const int output_height = output_shape.Dims(1);
+    const int output_width = output_shape.Dims(2);
+    const int gemm_depth = filter_shape.FlatSize() / output_depth;
+    assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+
+    const int16_t *gemm_input_data = input_data;
+    const bool need_im2col = params.stride_width != 1 || params.stride_height != 1 ||
+                             params.dilation_width_factor != 1 ||
+                             params.dilation_height_factor != 1 || filter_shape.Dims(1) != 1 ||
+                             filter_shape.Dims(2) != 1;
+    if (need_im2col)
+    {
+      Im2col16(params, input_shape, input_data, filter_shape, output_shape);
+      gemm_input_data = _im2col_int16.data();
+    }
+    UNUSED_RELEASE(input_depth);
+    assert(need_im2col || gemm_depth == input_depth);
+
+    optimized_integer_ops::Gemm16x8Params gemm_params;
+    gemm_params.output_multiplier = _per_channel_output_multiplier.data();
+    gemm_params.output_shift = _per_channel_output_shift.data();
+    gemm_params.quantized_activation_min = params.quantized_activation_min;
+    gemm_params.quantized_activation_max = params.quantized_activation_max;
+    optimized_integer_ops::Gemm16x8(gemm_params, filter_data, output_depth, gemm_depth,
+                                    gemm_input_data, batches * output_height * output_width,
+                                    bias_data, output_data, _accum_int32, ruy_context);
+  }
+
+  // fp16 filter widened to float while multiplied
+  void operator()(const ConvParams &params, const Shape &input_shape, const float *input_data,
+                  const Shape &filter_shape, const uint16_t *filter_data, const Shape &bias_shape,
+                  const float *bias_data, const Shape &output_shape, float *output_data,
+                  ruy::Context *ruy_context)
+  {
+    UNUSED_RELEASE(bias_shape);
+    const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+    const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+    const int filter_height = filter_shape.Dims(1);
+    const int filter_width = filter_shape.Dims(2);
+    const int output_height = output_shape.Dims(1);
+    const int output_width = output_shape.Dims(2);
+    const int gemm_depth = filter_shape.FlatSize() / output_depth;
+    const int gemm_cols = batches * output_height * output_width;
+    assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+
+    const bool need_dilated_im2col =
+      params.dilation_width_factor != 1 || params.dilation_height_factor != 1;
+    const bool need_im2col = params.stride_width != 1 || params.stride_height != 1 ||
+                             filter_height != 1 || filter_width != 1;
+
+    const float *gemm_input_data = input_data;
+    if (need_dilated_im2col || need_im2col)
+    {
+      const Shape im2col_shape{batches, output_height, output_width, gemm_depth};
+      _im2col_float.resize(im2col_shape.FlatSize());
+      if (need_dilated_im2col)
+        optimized::DilatedIm2col<float>(params, 0, input_shape, input_data, filter_shape,
+                                        output_shape, _im2col_float.data());
+      else
+        optimized::Im2col<float>(params, filter_height, filter_width, 0, input_shape, input_data,
+                                 im2col_shape, _im2col_float.data());
+      gemm_input_data = _im2col_float.data();
+    }
+
+    optimized::GemmF16Weights(filter_data, output_depth, gemm_depth, gemm_input_data, gemm_cols,
+                              bias_data, params.float_activation_min,
+                              params.float_activation_max, output_data, _f16_filter_tile,
+                              _f16_output_tile, ruy_context);
+  }
+
   std::vector<int32_t> &per_channel_output_multiplier() { return _per_channel_output_multiplier; }
   std::vector<int> &per_channel_output_shift() { return _per_channel_output_shift; }
 
@@ -179,6 +263,54 @@ private:
     is_replaced_weights = true;
   }
 
+  // Each output pixel takes a row of [filter_height, filter_width, input_depth] input values
+  // and padded area is filled with 0, the zero point of int16 activations
+  void Im2col16(const ConvParams &params, const Shape &input_shape, const int16_t *input_data,
+                const Shape &filter_shape, const Shape &output_shape)
+  {
+    const int batches = input_shape.Dims(0);
+    const int input_height = input_shape.Dims(1);
+    const int input_width = input_shape.Dims(2);
+    const int input_depth = input_shape.Dims(3);
+    const int filter_height = filter_shape.Dims(1);
+    const int filter_width = filter_shape.Dims(2);
+    const int output_height = output_shape.Dims(1);
+    const int output_width = output_shape.Dims(2);
+    const int row_size = filter_height * filter_width * input_depth;
+
+    _im2col_int16.resize(static_cast<size_t>(batches) * output_height * output_width * row_size);
+    int16_t *dst = _im2col_int16.data();
+    for (int b = 0; b < batches; ++b)
+    {
+      for (int out_y = 0; out_y < output_height; ++out_y)
+      {
+        const int in_y_origin = out_y * params.stride_height - params.padding_values.height;
+        for (int out_x = 0; out_x < output_width; ++out_x)
+        {
+          const int in_x_origin = out_x * params.stride_width - params.padding_values.width;
+          for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+          {
+            const int in_y = in_y_origin + params.dilation_height_factor * filter_y;
+            for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+            {
+              const int in_x = in_x_origin + params.dilation_width_factor * filter_x;
+              if (in_y >= 0 && in_y < input_height && in_x >= 0 && in_x < input_width)
+              {
+                const int16_t *src = input_data + Offset(input_shape, b, in_y, in_x, 0);
+                std::copy(src, src + input_depth, dst);
+              }
+              else
+              {
+                std::fill(dst, dst + input_depth, 0);
+              }
+              dst += input_depth;
+            }
+          }
+        }
+      }
+    }
+  }
+
   void IsRequiredIm2col(const Shape &input_shape, const Shape &kernel_shape,
                         const Shape &output_shape, uint32_t stride_width, uint32_t stride_height,
                         uint32_t dilation_width_factor, uint32_t dilation_height_factor)
@@ -206,13 +338,20 @@ private:
   // Per channel output multiplier and shift.
   std::vector<int32_t> _per_channel_output_multiplier;
   std::vector<int> _per_channel_output_shift;
+  // Buffers for int16 activations
+  std::vector<int16_t> _im2col_int16;
+  std::vector<int32_t> _accum_int32;
+  // Buffers for fp16 filter
+  std::vector<float> _im2col_float;
+  std::vector<float> _f16_filter_tile;
+  std::vector<float> _f16_output_tile;
 };
 
 struct ConvHybridTempArena
 {
   ConvHybridTempArena(int batch_size, int input_size)
   {
-    input_quantized.resize(input_size);
+    input_quantized.resize(batch_size * input_size);
     // TODO: Optimize the case of batch_size = 1
     input_scaling_factors.resize(batch_size);
     input_offsets.resize(batch_size);
@@ -220,6 +359,10 @@ struct ConvHybridTempArena
   std::vector<int8_t> input_quantized;
   std::vector<float> input_scaling_factors;
   std::vector<int32_t> input_offsets;
+  // For im2col and ruy GEMM
+  std::vector<int32_t> filter_row_sums;
+  std::vector<int8_t> im2col;
+  std::vector<int32_t> accum;
 };
 
 } // namespace cker
@@ -25,8 +25,10 @@
 #include "cker/operation/optimized/DepthwiseConvFloat.h"
 #include "cker/operation/optimized/DepthwiseConvUint8.h"
 #include "cker/operation/optimized/integer_ops/DepthwiseConvInt8.h"
+#include "cker/operation/optimized/integer_ops/DepthwiseConvHybrid.h"
 #include "cker/operation/reference/integer_ops/DepthwiseConvUInt8.h"
 #include "cker/operation/reference/integer_ops/DepthwiseConvHybrid.h"
+#include "cker/operation/reference/integer_ops/DepthwiseConvInt16.h"
 #include "cker/CpuBackendThreadpool.h"
 #include "cker/eigen/depthwise_conv_op.h"
 #include "cker/eigen/bias_op.h"
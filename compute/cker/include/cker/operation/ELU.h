@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_ELU_H__
 #define __NNFW_CKER_ELU_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 
 #include <cmath>
@@ -28,14 +29,18 @@ namespace cker
 {
 
 inline void ELU(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                float *output_data)
+                float *output_data, ruy::Context *ruy_context = nullptr)
 {
   const int flat_size = MatchingFlatSize(input_shape, output_shape);
-  for (int i = 0; i < flat_size; ++i)
-  {
-    const float val = input_data[i];
-    output_data[i] = val < 0.0 ? std::exp(val) - 1 : val;
-  }
+  cpu_backend_threadpool::ParallelFor(
+    flat_size, cpu_backend_threadpool::kTranscendentalCost, ruy_context,
+    [&](int begin, int end) {
+      for (int i = begin; i < end; ++i)
+      {
+        const float val = input_data[i];
+        output_data[i] = val < 0.0 ? std::exp(val) - 1 : val;
+      }
+    });
 }
 
 } // namespace cker
@@ -22,6 +22,8 @@
 #include "cker/operation/FullyConnectedDense16x1.h"
 #include "cker/operation/FullyConnectedSparse16x1.h"
 #include "cker/operation/optimized/Gemm.h"
+#include "cker/operation/optimized/GemmF16Weights.h"
+#include "cker/operation/optimized/integer_ops/Gemm16x8.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -57,6 +59,9 @@ public:
   std::vector<int8_t> input_quantized;
   std::vector<float> scaling_factors;
   std::vector<int32_t> accum_scratch;
+  // Widened tiles of fp16 weights and their results
+  std::vector<float> f16_weights_tile;
+  std::vector<float> f16_output_tile;
 };
 
 #if defined(CKER_X86_PLATFORM)
@@ -182,6 +187,53 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   }
 }
 
+// int16 activations and int8 weights, with per-channel output multipliers and shifts
+inline void FullyConnected16x8(const FullyConnectedParams &params, const int32_t *output_multiplier,
+                               const int *output_shift, const Shape &input_shape,
+                               const int16_t *input_data, const Shape &filter_shape,
+                               const int8_t *filter_data, const Shape &bias_shape,
+                               const int64_t *bias_data, const Shape &output_shape,
+                               int16_t *output_data, std::vector<int32_t> &accum_scratch,
+                               ruy::Context *ruy_context)
+{
+  UNUSED_RELEASE(input_shape);
+  UNUSED_RELEASE(bias_shape);
+  assert(filter_shape.DimensionsCount() >= 2);
+  assert(output_shape.DimensionsCount() >= 1);
+
+  const int output_dim_count = output_shape.DimensionsCount();
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  const int output_depth =
+    MatchingDim(filter_shape, filter_dim_count - 2, output_shape, output_dim_count - 1);
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+
+  optimized_integer_ops::Gemm16x8Params gemm_params;
+  gemm_params.output_multiplier = output_multiplier;
+  gemm_params.output_shift = output_shift;
+  gemm_params.quantized_activation_min = params.quantized_activation_min;
+  gemm_params.quantized_activation_max = params.quantized_activation_max;
+  optimized_integer_ops::Gemm16x8(gemm_params, filter_data, output_depth, accum_depth, input_data,
+                                  batches, bias_data, output_data, accum_scratch, ruy_context);
+}
+
+// Weights are fp16 and widened to float while multiplied
+inline void FullyConnectedF16Weights(const FullyConnectedParams &params, const Shape &input_shape,
+                                     const float *input_data, const Shape &weights_shape,
+                                     const uint16_t *weights_data, const Shape &,
+                                     const float *bias_data, const Shape &, float *output_data,
+                                     FCTempArena &temp_arena, ruy::Context *ruy_context)
+{
+  const int input_size = weights_shape.Dims(1);
+  const int batch_size = input_shape.FlatSize() / input_size;
+  const int num_units = weights_shape.Dims(0);
+
+  optimized::GemmF16Weights(weights_data, num_units, input_size, input_data, batch_size,
+                            bias_data, params.float_activation_min, params.float_activation_max,
+                            output_data, temp_arena.f16_weights_tile, temp_arena.f16_output_tile,
+                            ruy_context);
+}
+
 inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape &input_shape,
                                  const float *input_data, const Shape &filter_shape,
                                  const int8_t *filter_data, const Shape &, const float *bias_data,
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_HELPER_BCQ_H__
+#define __NNFW_CKER_HELPER_BCQ_H__
+
+/**
+ * Binary-coded quantization (BCQ) weight layout
+ *
+ * A BCQ weight matrix W[rows, hidden] is approximated as W[r] = sum_b alpha[r, b] * B[r, b],
+ * where B[r, b] is a vector of {-1, +1} called binary plane. Rows are grouped into clusters and
+ * all rows of a cluster share the number of planes (qbits).
+ *
+ * - clusters : INT32 [num_clusters, 2], (qbits, number of rows) for each cluster
+ * - scales   : FLOAT32 [num_planes], alpha of each plane
+ * - binary   : INT32 [num_planes, ceil(hidden / 32)], planes packed 32 weights per word.
+ *              Weight j is bit (j % 32) of word (j / 32) and bit 1 means +1, 0 means -1.
+ *
+ * Planes of a cluster are stored bit-major, that is, plane (b, r) of cluster c is at
+ * "first plane of c" + b * "rows of c" + (r - "first row of c").
+ */
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace bcq
+{
+
+/**
+ * @brief Plane information of each row, computed from BCQ clusters once
+ */
+struct RowPlanes
+{
+  // Index of the plane for bit 0 of the row
+  std::vector<int32_t> first_plane;
+  // Distance between planes of consecutive bits of the row
+  std::vector<int32_t> plane_stride;
+  // The number of planes of the row
+  std::vector<int32_t> qbits;
+
+  int32_t rows() const { return static_cast<int32_t>(first_plane.size()); }
+};
+
+inline RowPlanes BuildRowPlanes(const int32_t *clusters_data, int32_t num_clusters)
+{
+  RowPlanes info;
+  int32_t plane_offset = 0;
+  for (int32_t c = 0; c < num_clusters; ++c)
+  {
+    const int32_t qbits = clusters_data[c * 2];
+    const int32_t size = clusters_data[c * 2 + 1];
+    assert(qbits > 0 && size >= 0);
+    for (int32_t r = 0; r < size; ++r)
+    {
+      info.first_plane.push_back(plane_offset + r);
+      info.plane_stride.push_back(size);
+      info.qbits.push_back(qbits);
+    }
+    plane_offset += qbits * size;
+  }
+  return info;
+}
+
+// The number of int32 words that hold a binary plane of given hidden size
+inline int32_t WordsPerPlane(int32_t hidden_size) { return (hidden_size + 31) / 32; }
+
+// Lookup tables hold partial sums of 8 consecutive inputs for all 256 sign combinations
+constexpr int32_t kLutGroupSize = 8;
+constexpr int32_t kLutEntries = 1 << kLutGroupSize;
+
+inline int32_t LutGroups(int32_t hidden_size) { return WordsPerPlane(hidden_size) * 4; }
+
+/**
+ * @brief Build lookup tables of partial sums for an input vector
+ *
+ * lut[g * 256 + m] = sum_i (bit i of m ? +x[8g + i] : -x[8g + i]) for i in [0, 8).
+ * Inputs beyond hidden_size are regarded as zero.
+ *
+ * @param input        Input vector whose elements are input_stride apart
+ * @param input_stride Distance between consecutive elements of the input vector
+ * @param hidden_size  Length of the input vector
+ * @param lut          Output buffer with LutGroups(hidden_size) * kLutEntries elements
+ */
+inline void BuildLookupTable(const float *input, int32_t input_stride, int32_t hidden_size,
+                             float *lut)
+{
+  const int32_t num_groups = LutGroups(hidden_size);
+  for (int32_t g = 0; g < num_groups; ++g)
+  {
+    float x[kLutGroupSize];
+    float neg_sum = 0.f;
+    for (int32_t i = 0; i < kLutGroupSize; ++i)
+    {
+      const int32_t j = g * kLutGroupSize + i;
+      x[i] = (j < hidden_size) ? input[j * input_stride] : 0.f;
+      neg_sum -= x[i];
+    }
+
+    float *table = lut + g * kLutEntries;
+    table[0] = neg_sum;
+    for (int32_t m = 1; m < kLutEntries; ++m)
+    {
+      // Flip the lowest set bit from -x to +x on top of the entry without it
+      const int32_t low = m & -m;
+      const int32_t i = __builtin_ctz(static_cast<uint32_t>(m));
+      table[m] = table[m ^ low] + 2.f * x[i];
+    }
+  }
+}
+
+/**
+ * @brief Dot product of a binary plane and the input vector the lookup table is built from
+ */
+inline float PlaneDotLookup(const int32_t *plane, int32_t words, const float *lut)
+{
+  float acc = 0.f;
+  for (int32_t w = 0; w < words; ++w)
+  {
+    const uint32_t bits = static_cast<uint32_t>(plane[w]);
+    const float *table = lut + w * 4 * kLutEntries;
+    acc += table[bits & 0xff];
+    acc += table[kLutEntries + ((bits >> 8) & 0xff)];
+    acc += table[2 * kLutEntries + ((bits >> 16) & 0xff)];
+    acc += table[3 * kLutEntries + (bits >> 24)];
+  }
+  return acc;
+}
+
+/**
+ * @brief Dot product of a binary plane and an input vector without lookup tables
+ *
+ * It is cheaper than building lookup tables when only a few planes share the input vector.
+ * The input must be zero-padded up to WordsPerPlane(hidden_size) * 32 elements.
+ */
+inline float PlaneDotDirect(const int32_t *plane, int32_t words, const float *padded_input)
+{
+  float acc = 0.f;
+  for (int32_t w = 0; w < words; ++w)
+  {
+    const uint32_t bits = static_cast<uint32_t>(plane[w]);
+    const float *x = padded_input + w * 32;
+    for (int32_t i = 0; i < 32; ++i)
+      acc += ((bits >> i) & 1u) ? x[i] : -x[i];
+  }
+  return acc;
+}
+
+/**
+ * @brief Dequantize a row of BCQ weights
+ *
+ * @param row_planes  Plane information built by BuildRowPlanes
+ * @param row         Row to dequantize
+ * @param scales_data Scales of planes
+ * @param binary_data Binary planes
+ * @param hidden_size The number of elements of a row
+ * @param output      Output buffer with hidden_size elements
+ */
+inline void DequantizeRow(const RowPlanes &row_planes, int32_t row, const float *scales_data,
+                          const int32_t *binary_data, int32_t hidden_size, float *output)
+{
+  const int32_t words = WordsPerPlane(hidden_size);
+  const int32_t qbits = row_planes.qbits[row];
+
+  // W[j] = sum_b (bit ? +alpha_b : -alpha_b) = -sum_b alpha_b + 2 * sum_{b : bit set} alpha_b
+  float neg_sum = 0.f;
+  for (int32_t b = 0; b < qbits; ++b)
+    neg_sum -= scales_data[row_planes.first_plane[row] + b * row_planes.plane_stride[row]];
+  for (int32_t j = 0; j < hidden_size; ++j)
+    output[j] = neg_sum;
+
+  for (int32_t b = 0; b < qbits; ++b)
+  {
+    const int32_t plane_index = row_planes.first_plane[row] + b * row_planes.plane_stride[row];
+    const float twice_alpha = 2.f * scales_data[plane_index];
+    const int32_t *plane = binary_data + plane_index * words;
+    for (int32_t j = 0; j < hidden_size; ++j)
+    {
+      if ((static_cast<uint32_t>(plane[j / 32]) >> (j % 32)) & 1u)
+        output[j] += twice_alpha;
+    }
+  }
+}
+
+} // namespace bcq
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_HELPER_BCQ_H__
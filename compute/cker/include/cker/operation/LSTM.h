@@ -18,8 +18,12 @@
 #ifndef __NNFW_CKER_UNIDIRECTIONALSEQUENCELSTM_H__
 #define __NNFW_CKER_UNIDIRECTIONALSEQUENCELSTM_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/TensorUtils.h"
 #include "cker/Types.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/context.h>
 
 namespace nnfw
 {
@@ -365,6 +369,175 @@ inline void LstmStepFloat(
   }
 }
 
+// Computes the input-to-gate products of all timesteps with one GEMM
+//
+// Implements the following formula: (* is matrix multiply)
+//   input_projection[row] = W_input * input[row] + bias
+// input holds n_rows rows of n_input (every timestep and batch), and each row of
+// input_projection has n_cell. bias may be nullptr, e.g. for layer norm LSTM which adds the bias
+// after normalization.
+inline void LstmInputProjectionFloat(const float *input, int n_rows, int n_input,
+                                     const float *input_to_gate_weights, int n_cell,
+                                     const float *gate_bias, float *input_projection,
+                                     ruy::Context *ruy_context)
+{
+  MatrixParams<float> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = n_cell;
+  lhs_params.cols = n_input;
+
+  MatrixParams<float> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = n_input;
+  rhs_params.cols = n_rows;
+
+  MatrixParams<float> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = n_cell;
+  dst_params.cols = n_rows;
+
+  ruy::Matrix<float> ruy_lhs;
+  ruy::Matrix<float> ruy_rhs;
+  ruy::Matrix<float> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, input_to_gate_weights, &ruy_lhs);
+  ruy_support::MakeRuyMatrix(rhs_params, input, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, input_projection, &ruy_dst);
+
+  ruy::MulParams<float, float> ruy_mul_params;
+  if (gate_bias != nullptr)
+  {
+    ruy_mul_params.set_bias(gate_bias);
+  }
+  ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+}
+
+// Same as MatrixBatchVectorMultiplyAccumulate with result_stride 1, but the rows of matrix are
+// split over threads of ruy_context
+inline void MatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows, int m_cols,
+                                                const float *vector, int n_batch, float *result,
+                                                ruy::Context *ruy_context)
+{
+  cpu_backend_threadpool::ParallelFor(
+    m_rows, static_cast<int64_t>(m_cols) * n_batch, ruy_context, [&](int begin, int end) {
+      for (int b = 0; b < n_batch; b++)
+      {
+        MatrixBatchVectorMultiplyAccumulate(matrix + begin * m_cols, end - begin, m_cols,
+                                            vector + b * m_cols, /*n_batch=*/1,
+                                            result + b * m_rows + begin, /*result_stride=*/1);
+      }
+    });
+}
+
+// Calculates a single LSTM gate from the input projection of LstmInputProjectionFloat
+//
+// Same as CalculateLstmGateFloat without auxiliary input, except that
+//   W_input * input (+ bias unless layer norm)
+// is given as input_projection of size n_batch * n_cell.
+inline void CalculateLstmGateFloat(const float *input_projection, const float *output_state,
+                                   const float *recurrent_to_gate_weights, const float *cell_state,
+                                   const float *cell_to_gate_weights,
+                                   const float *layer_norm_coefficients, const float *gate_bias,
+                                   const int n_batch, const int n_output, const int n_cell,
+                                   const FusedActivationFunctionType activation, float *gate,
+                                   ruy::Context *ruy_context)
+{
+  const bool use_peephole = (cell_to_gate_weights != nullptr);
+  const bool use_layer_norm = (layer_norm_coefficients != nullptr);
+
+  std::copy_n(input_projection, n_cell * n_batch, gate);
+  // For each batch and cell: compute recurrent_weight * output_state.
+  MatrixBatchVectorMultiplyAccumulate(recurrent_to_gate_weights, n_cell, n_output, output_state,
+                                      n_batch, gate, ruy_context);
+  // For each batch and cell: compute cell_weight .* cell_state (peephole LSTM)
+  if (use_peephole)
+  {
+    VectorBatchVectorCwiseProductAccumulate(cell_to_gate_weights, n_cell, cell_state, n_batch,
+                                            gate);
+  }
+  // Do layer normalization (if layer norm LSTM)
+  if (use_layer_norm)
+  {
+    MeanStddevNormalization(gate, gate, n_cell, n_batch);
+    VectorBatchVectorCwiseProduct(layer_norm_coefficients, n_cell, gate, n_batch, gate);
+    VectorBatchVectorAdd(gate_bias, n_cell, n_batch, gate);
+  }
+  // Apply activation
+  ApplyActivationToVector(gate, n_batch * n_cell, activation, gate);
+}
+
+// Performs an LSTM batch inference step from the input projections of LstmInputProjectionFloat
+//
+// Same as LstmStepFloat without auxiliary input, except that the input-to-gate products of this
+// step are given as *_input_projection_ptr of size 'n_batch * n_cell' (input one is optional as
+// input_to_input_weights). Only the recurrent products are computed here, with rows split over
+// threads of ruy_context.
+inline void LstmStepFloat(
+  const float *input_input_projection_ptr, const float *forget_input_projection_ptr,
+  const float *cell_input_projection_ptr, const float *output_input_projection_ptr,
+  const float *recurrent_to_input_weights_ptr, const float *recurrent_to_forget_weights_ptr,
+  const float *recurrent_to_cell_weights_ptr, const float *recurrent_to_output_weights_ptr,
+  const float *cell_to_input_weights_ptr, const float *cell_to_forget_weights_ptr,
+  const float *cell_to_output_weights_ptr, const float *input_layer_norm_coefficients_ptr,
+  const float *forget_layer_norm_coefficients_ptr, const float *cell_layer_norm_coefficients_ptr,
+  const float *output_layer_norm_coefficients_ptr, const float *input_gate_bias_ptr,
+  const float *forget_gate_bias_ptr, const float *cell_gate_bias_ptr,
+  const float *output_gate_bias_ptr, const float *projection_weights_ptr,
+  const float *projection_bias_ptr, const LSTMParams *params, int n_batch, int n_cell,
+  int n_output, int output_batch_leading_dim, float *output_state_ptr, float *cell_state_ptr,
+  float *scratch0, float *scratch1, float *scratch2, float *scratch3, float *output_ptr,
+  ruy::Context *ruy_context)
+{
+  const bool use_cifg = (input_input_projection_ptr == nullptr);
+
+  // Make named scratch buffers.
+  float *input_gate_scratch = scratch0;
+  float *forget_gate_scratch = scratch1;
+  float *cell_gate_scratch = scratch2;
+  float *output_gate_scratch = scratch3;
+
+  if (!use_cifg)
+  {
+    // Calculate the input gate. (If not CIFG.)
+    CalculateLstmGateFloat(input_input_projection_ptr, output_state_ptr,
+                           recurrent_to_input_weights_ptr, cell_state_ptr,
+                           cell_to_input_weights_ptr, input_layer_norm_coefficients_ptr,
+                           input_gate_bias_ptr, n_batch, n_output, n_cell,
+                           FusedActivationFunctionType::kSigmoid, input_gate_scratch, ruy_context);
+  }
+  // Calculate the forget gate.
+  CalculateLstmGateFloat(forget_input_projection_ptr, output_state_ptr,
+                         recurrent_to_forget_weights_ptr, cell_state_ptr,
+                         cell_to_forget_weights_ptr, forget_layer_norm_coefficients_ptr,
+                         forget_gate_bias_ptr, n_batch, n_output, n_cell,
+                         FusedActivationFunctionType::kSigmoid, forget_gate_scratch, ruy_context);
+  // Calculate the cell update gate.
+  CalculateLstmGateFloat(cell_input_projection_ptr, output_state_ptr,
+                         recurrent_to_cell_weights_ptr, /*cell_state=*/nullptr,
+                         /*cell_to_gate_weights=*/nullptr, cell_layer_norm_coefficients_ptr,
+                         cell_gate_bias_ptr, n_batch, n_output, n_cell, params->activation,
+                         cell_gate_scratch, ruy_context);
+  // Update the cell state.
+  UpdateLstmCellFloat(n_batch, n_cell, cell_state_ptr, input_gate_scratch, forget_gate_scratch,
+                      cell_gate_scratch, use_cifg, params->cell_clip);
+  // Calculate output gate.
+  CalculateLstmGateFloat(output_input_projection_ptr, output_state_ptr,
+                         recurrent_to_output_weights_ptr, cell_state_ptr,
+                         cell_to_output_weights_ptr, output_layer_norm_coefficients_ptr,
+                         output_gate_bias_ptr, n_batch, n_output, n_cell,
+                         FusedActivationFunctionType::kSigmoid, output_gate_scratch, ruy_context);
+  // Update the output state.
+  CalculateLstmOutputFloat(n_batch, n_cell, n_output, cell_state_ptr, output_gate_scratch,
+                           params->activation, projection_weights_ptr, projection_bias_ptr,
+                           params->proj_clip, output_state_ptr, scratch2);
+  // Copy output state to the output. Note that the output's rows may not be
+  // contiguous (output_batch_leading_dim != n_output).
+  for (int b = 0; b < n_batch; b++)
+  {
+    std::copy_n(output_state_ptr + b * n_output, n_output,
+                output_ptr + b * output_batch_leading_dim);
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_LEKAY_RELU_H__
 #define __NNFW_CKER_LEKAY_RELU_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 
@@ -29,16 +30,19 @@ namespace cker
 {
 
 inline void LeakyReLU(const LeakyReluParams &params, const Shape &input_shape,
-                      const float *input_data, const Shape &output_shape, float *output_data)
+                      const float *input_data, const Shape &output_shape, float *output_data,
+                      ruy::Context *ruy_context = nullptr)
 {
   const int flat_size = MatchingFlatSize(input_shape, output_shape);
 
-  for (int i = 0; i < flat_size; i++)
-  {
-    const float val = input_data[i];
-    // Note that alpha might be > 1 or < 0, so we don't use std::max here.
-    output_data[i] = val > 0 ? val : val * params.alpha;
-  }
+  cpu_backend_threadpool::ParallelFor(flat_size, 1, ruy_context, [&](int begin, int end) {
+    for (int i = begin; i < end; i++)
+    {
+      const float val = input_data[i];
+      // Note that alpha might be > 1 or < 0, so we don't use std::max here.
+      output_data[i] = val > 0 ? val : val * params.alpha;
+    }
+  });
 }
 
 } // namespace cker
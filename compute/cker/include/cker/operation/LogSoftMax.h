@@ -17,6 +17,7 @@
 #ifndef __NNFW_CKER_LOGSOFTMAX_H__
 #define __NNFW_CKER_LOGSOFTMAX_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
 #include "cker/Types.h"
@@ -133,6 +134,64 @@ inline void LogSoftmax(const SoftmaxParams &params, float input_scale, const Sha
   }
 }
 
+// Splits slices before the axis over threads of ruy_context and runs slices_fn on each range
+template <typename T, typename SlicesFn>
+inline void LogSoftmaxSlices(const SoftmaxParams &params, const Shape &input_shape,
+                             const T *input_data, const Shape &output_shape, T *output_data,
+                             ruy::Context *ruy_context, const SlicesFn &slices_fn)
+{
+  const int rank = input_shape.DimensionsCount();
+  const int axis = (params.axis < 0) ? params.axis + rank : params.axis;
+  const int depth = MatchingDim(input_shape, axis, output_shape, axis);
+
+  int outer_size = 1;
+  for (int i = 0; i < axis; ++i)
+  {
+    outer_size *= input_shape.Dims(i);
+  }
+
+  int inner_size = 1;
+  for (int i = axis + 1; i < rank; ++i)
+  {
+    inner_size *= input_shape.Dims(i);
+  }
+
+  SoftmaxParams slices_params = params;
+  slices_params.axis = 1;
+  const int64_t slice_size = static_cast<int64_t>(depth) * inner_size;
+  cpu_backend_threadpool::ParallelFor(
+    outer_size, slice_size * cpu_backend_threadpool::kTranscendentalCost, ruy_context,
+    [&](int begin, int end) {
+      const Shape slices_shape{end - begin, depth, inner_size};
+      const int64_t offset = begin * slice_size;
+      slices_fn(slices_params, slices_shape, input_data + offset, output_data + offset);
+    });
+}
+
+inline void LogSoftmax(const SoftmaxParams &params, const Shape &input_shape,
+                       const float *input_data, const Shape &output_shape, float *output_data,
+                       ruy::Context *ruy_context)
+{
+  LogSoftmaxSlices(params, input_shape, input_data, output_shape, output_data, ruy_context,
+                   [](const SoftmaxParams &slices_params, const Shape &slices_shape,
+                      const float *slices_input, float *slices_output) {
+                     LogSoftmax(slices_params, slices_shape, slices_input, slices_shape,
+                                slices_output);
+                   });
+}
+
+inline void LogSoftmax(const SoftmaxParams &params, float input_scale, const Shape &input_shape,
+                       const uint8_t *input_data, const Shape &output_shape, uint8_t *output_data,
+                       ruy::Context *ruy_context)
+{
+  LogSoftmaxSlices(params, input_shape, input_data, output_shape, output_data, ruy_context,
+                   [input_scale](const SoftmaxParams &slices_params, const Shape &slices_shape,
+                                 const uint8_t *slices_input, uint8_t *slices_output) {
+                     LogSoftmax(slices_params, input_scale, slices_shape, slices_input,
+                                slices_shape, slices_output);
+                   });
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_LOGISTIC_H__
 #define __NNFW_CKER_LOGISTIC_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/eigen/Utils.h"
 
@@ -30,12 +31,20 @@ namespace cker
 {
 
 inline void Logistic(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                     float *output_data)
+                     float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  auto input_map = MapAsVector(input_data, input_shape);
-  auto output_map = MapAsVector(output_data, output_shape);
-
-  output_map.array() = input_map.array().unaryExpr(Eigen::internal::scalar_logistic_op<float>());
+  assert(input_shape.FlatSize() == output_shape.FlatSize());
+  UNUSED_RELEASE(output_shape);
+  const int flat_size = input_shape.FlatSize();
+  cpu_backend_threadpool::ParallelFor(
+    flat_size, cpu_backend_threadpool::kTranscendentalCost, ruy_context,
+    [&](int begin, int end) {
+      const Shape range_shape{end - begin};
+      auto input_map = MapAsVector(input_data + begin, range_shape);
+      auto output_map = MapAsVector(output_data + begin, range_shape);
+      output_map.array() =
+        input_map.array().unaryExpr(Eigen::internal::scalar_logistic_op<float>());
+    });
 }
 
 } // namespace cker
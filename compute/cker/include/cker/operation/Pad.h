@@ -17,6 +17,7 @@
 #ifndef __NNFW_CKER_PAD_H__
 #define __NNFW_CKER_PAD_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -219,6 +220,79 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
       break;
   }
 }
+
+// Pads rows along the last dimension of the output one by one, splitting them over threads of
+// ruy_context. Each row is either all padding or a row of the input with padding around it.
+template <typename T>
+inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &input_shape,
+                const T *input_data, const Shape &output_shape, T *output_data,
+                const T *constant_value_data, ruy::Context *ruy_context)
+{
+  const int rank = output_shape.DimensionsCount();
+  if (pad_rank < 2 || pad_rank > 4 || pad_rank != rank || input_shape.DimensionsCount() != rank)
+  {
+    Pad(padding_data, pad_rank, input_shape, input_data, output_shape, output_data,
+        constant_value_data);
+    return;
+  }
+  if (output_shape.FlatSize() == 0)
+    return;
+
+  const T constant_value = constant_value_data ? *constant_value_data : 0;
+  const int last = rank - 1;
+  const int32_t in_row_len = input_shape.Dims(last);
+  const int32_t out_row_size = output_shape.Dims(last);
+  const int32_t row_pad_before = padding_data[last * 2];
+  const int32_t row_pad_after = padding_data[last * 2 + 1];
+  assert(out_row_size == in_row_len + row_pad_before + row_pad_after);
+
+  const int rows = output_shape.FlatSize() / out_row_size;
+  cpu_backend_threadpool::ParallelFor(rows, out_row_size, ruy_context, [&](int begin, int end) {
+    // Output index of the row in dimensions except the last one
+    int32_t index[4] = {0, 0, 0, 0};
+    for (int d = last - 1, rest = begin; d >= 0; --d)
+    {
+      index[d] = rest % output_shape.Dims(d);
+      rest /= output_shape.Dims(d);
+    }
+
+    for (int row = begin; row < end; ++row)
+    {
+      T *output_row = output_data + static_cast<int64_t>(row) * out_row_size;
+      bool is_padding = false;
+      int64_t input_row = 0;
+      for (int d = 0; d < last; ++d)
+      {
+        const int32_t input_index = index[d] - padding_data[d * 2];
+        if (input_index < 0 || input_index >= input_shape.Dims(d))
+        {
+          is_padding = true;
+          break;
+        }
+        input_row = input_row * input_shape.Dims(d) + input_index;
+      }
+
+      if (is_padding)
+      {
+        std::fill_n(output_row, out_row_size, constant_value);
+      }
+      else
+      {
+        std::fill_n(output_row, row_pad_before, constant_value);
+        memcpy(output_row + row_pad_before, input_data + input_row * in_row_len,
+               in_row_len * sizeof(T));
+        std::fill_n(output_row + row_pad_before + in_row_len, row_pad_after, constant_value);
+      }
+
+      for (int d = last - 1; d >= 0; --d)
+      {
+        if (++index[d] < output_shape.Dims(d))
+          break;
+        index[d] = 0;
+      }
+    }
+  });
+}
 } // namespace cker
 } // namespace nnfw
 
@@ -19,6 +19,7 @@
 #define __NNFW_CKER_QUANTIZE_H__
 
 #include "cker/operation/Round.h"
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -448,6 +449,34 @@ inline void Requantize<int8_t, uint8_t>(const int8_t *input_data, int32_t size,
   }
 }
 
+// Splits elements over threads of ruy_context
+template <typename InputT, typename OutputT>
+inline void Quantize(const Shape &input_shape, const InputT *input_data, const Shape &output_shape,
+                     OutputT *output_data, const float output_scale, const int32_t output_offset,
+                     ruy::Context *ruy_context)
+{
+  const int flat_size = MatchingFlatSize(input_shape, output_shape);
+  cpu_backend_threadpool::ParallelFor(flat_size, 1, ruy_context, [&](int begin, int end) {
+    const Shape range_shape{end - begin};
+    Quantize(range_shape, input_data + begin, range_shape, output_data + begin, output_scale,
+             output_offset);
+  });
+}
+
+// Splits elements over threads of ruy_context
+template <typename input_type, typename output_type>
+inline void Requantize(const input_type *input_data, int32_t size,
+                       int32_t effective_scale_multiplier, int32_t effective_scale_shift,
+                       int32_t input_zeropoint, int32_t output_zeropoint, output_type *output_data,
+                       ruy::Context *ruy_context)
+{
+  cpu_backend_threadpool::ParallelFor(size, 1, ruy_context, [&](int begin, int end) {
+    Requantize<input_type, output_type>(input_data + begin, end - begin,
+                                        effective_scale_multiplier, effective_scale_shift,
+                                        input_zeropoint, output_zeropoint, output_data + begin);
+  });
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_RELU_H__
 #define __NNFW_CKER_RELU_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/eigen/Utils.h"
 
@@ -30,11 +31,17 @@ namespace cker
 {
 
 inline void ReLU(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                 float *output_data)
+                 float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  const auto input_map = MapAsVector(input_data, input_shape);
-  auto output_map = MapAsVector(output_data, output_shape);
-  output_map = input_map.cwiseMax(0.0f);
+  assert(input_shape.FlatSize() == output_shape.FlatSize());
+  UNUSED_RELEASE(output_shape);
+  const int flat_size = input_shape.FlatSize();
+  cpu_backend_threadpool::ParallelFor(flat_size, 1, ruy_context, [&](int begin, int end) {
+    const Shape range_shape{end - begin};
+    const auto input_map = MapAsVector(input_data + begin, range_shape);
+    auto output_map = MapAsVector(output_data + begin, range_shape);
+    output_map = input_map.cwiseMax(0.0f);
+  });
 }
 
 } // namespace cker
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_RELU6_H__
 #define __NNFW_CKER_RELU6_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/eigen/Utils.h"
 
@@ -30,15 +31,18 @@ namespace cker
 {
 
 inline void ReLU6(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                  float *output_data)
+                  float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  const auto input_map = MapAsVector(input_data, input_shape);
-  auto output_map = MapAsVector(output_data, output_shape);
-
   if (output_shape != input_shape)
     throw std::runtime_error{"cker::ReLU6: Do not match input and output shapes."};
 
-  output_map = input_map.cwiseMax(0.0f).cwiseMin(6.0f);
+  cpu_backend_threadpool::ParallelFor(
+    input_shape.FlatSize(), 1, ruy_context, [&](int begin, int end) {
+      const Shape range_shape{end - begin};
+      const auto input_map = MapAsVector(input_data + begin, range_shape);
+      auto output_map = MapAsVector(output_data + begin, range_shape);
+      output_map = input_map.cwiseMax(0.0f).cwiseMin(6.0f);
+    });
 }
 
 } // namespace cker
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_REDUCE_H__
 #define __NNFW_CKER_REDUCE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -117,7 +118,8 @@ inline void OptimizedReduceSum(const float *input_data, const Shape &input_shape
 template <typename In, typename Out>
 inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Shape &,
                        const int *axis, const int num_axis, int *input_iter,
-                       Out reducer(const Out current, const In in), Out *output_data)
+                       Out reducer(const Out current, const In in), Out *output_data,
+                       ruy::Context *ruy_context = nullptr)
 {
   const auto input_dims = input_shape.DimsData();
   const auto input_num_dims = input_shape.DimensionsCount();
@@ -132,20 +134,24 @@ inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Sha
       input_size *= input_dims[idx];
     }
     reduce_size = input_dims[input_num_dims - 1];
-    for (int idx = 0; idx < input_size; idx++)
-    {
-      for (int r_idx = 0; r_idx < reduce_size; r_idx++)
-      {
-        if (r_idx == 0)
-        {
-          output_data[idx] = input_data[idx * reduce_size];
-        }
-        else
+    // Rows are reduced independently, so they are split over threads
+    cpu_backend_threadpool::ParallelFor(
+      input_size, reduce_size, ruy_context, [&](int begin, int end) {
+        for (int idx = begin; idx < end; idx++)
         {
-          output_data[idx] = reducer(output_data[idx], input_data[idx * reduce_size + r_idx]);
+          for (int r_idx = 0; r_idx < reduce_size; r_idx++)
+          {
+            if (r_idx == 0)
+            {
+              output_data[idx] = input_data[idx * reduce_size];
+            }
+            else
+            {
+              output_data[idx] = reducer(output_data[idx], input_data[idx * reduce_size + r_idx]);
+            }
+          }
         }
-      }
-    }
+      });
     return true;
   }
 
@@ -250,7 +256,8 @@ public:
   template <typename T>
   inline bool ReduceGeneric(const Shape &input_shape, const T *input_data,
                             const Shape &output_shape, T *output_data, const std::vector<int> &axes,
-                            bool, T init_value, T reducer(const T current, const T in))
+                            bool, T init_value, T reducer(const T current, const T in),
+                            ruy::Context *ruy_context = nullptr)
   {
     // Reset output data.
     if (!InitTensorDataForReduce(output_shape, init_value, output_data))
@@ -266,7 +273,8 @@ public:
     }
 
     return ReduceImpl<T, T>(input_data, input_shape, output_shape, resolved_axis_data(),
-                            num_resolved_axis, temp_index_data(), reducer, output_data);
+                            num_resolved_axis, temp_index_data(), reducer, output_data,
+                            ruy_context);
   }
 
   // Computes the mean of elements across dimensions given in axis.
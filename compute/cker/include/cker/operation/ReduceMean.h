@@ -43,9 +43,10 @@ Out mean_reducer(const Out data1, const In data2, int normalizer)
   return data1 + static_cast<Out>(data2) / normalizer;
 }
 
-template <typename In> int sum_reducer(const int data1, const In data2)
+// NOTE Sums are accumulated in int64_t, as sums of many int16 values overflow int32
+template <typename In> int64_t sum_reducer(const int64_t data1, const In data2)
 {
-  return data1 + static_cast<int>(data2);
+  return data1 + static_cast<int64_t>(data2);
 }
 
 template <typename In, typename Out>
@@ -82,7 +83,8 @@ inline bool ReduceMeanImpl(const In *input_data, const Shape &input_shape, const
 template <typename In>
 inline size_t ReduceSumQuantImpl(const In *input_data, const Shape &input_shape, const int *axis,
                                  const int num_axis, int *input_iter,
-                                 int reducer(const int current, const In in), int *temp_sum)
+                                 int64_t reducer(const int64_t current, const In in),
+                                 int64_t *temp_sum)
 {
   const auto input_dims = input_shape.DimsData();
   const auto input_num_dims = input_shape.DimensionsCount();
@@ -167,7 +169,7 @@ public:
   inline bool ReduceOp(const Shape &input_shape, const In *input_data, float input_scale,
                        int32_t input_offset, const Shape &output_shape, Out *output_data,
                        float output_scale, int32_t output_offset, const std::vector<int> &axes,
-                       bool, Out init_value, int reducer(const int current, const In in))
+                       bool, Out init_value, int64_t reducer(const int64_t current, const In in))
   {
     size_t num_outputs = 1;
     auto output_dims = output_shape.DimsData();
@@ -204,7 +206,7 @@ public:
   }
 
 private:
-  std::vector<int> _temp_sum;
+  std::vector<int64_t> _temp_sum;
 };
 
 template <typename In, typename Out>
@@ -233,7 +235,7 @@ void MeanQ8Asymm(const Shape &input_shape, const In *input_data, float input_sca
 
 template <typename In, typename Out>
 void MeanAxis1And2(const Shape &input_shape, const In *input_data, const Shape &output_shape,
-                   Out *output_data)
+                   Out *output_data, ruy::Context *ruy_context = nullptr)
 {
   UNUSED_RELEASE(output_shape);
   assert(input_shape.DimensionsCount() == 4);
@@ -245,21 +247,26 @@ void MeanAxis1And2(const Shape &input_shape, const In *input_data, const Shape &
   const int input_height = input_shape.Dims(1);
   const int input_width = input_shape.Dims(2);
 
-  for (int out_b = 0; out_b < output_batch; ++out_b)
-  {
-    for (int out_d = 0; out_d < output_depth; ++out_d)
-    {
-      float value = 0;
-      for (int in_h = 0; in_h < input_height; ++in_h)
+  // Outputs are split over threads in the order of (batch, depth)
+  cpu_backend_threadpool::ParallelFor(
+    output_batch * output_depth, input_height * input_width, ruy_context,
+    [&](int begin, int end) {
+      for (int out_index = begin; out_index < end; ++out_index)
       {
-        for (int in_w = 0; in_w < input_width; ++in_w)
+        const int out_b = out_index / output_depth;
+        const int out_d = out_index % output_depth;
+        float value = 0;
+        for (int in_h = 0; in_h < input_height; ++in_h)
         {
-          value += input_data[Offset(input_shape, out_b, in_h, in_w, out_d)];
+          for (int in_w = 0; in_w < input_width; ++in_w)
+          {
+            value += input_data[Offset(input_shape, out_b, in_h, in_w, out_d)];
+          }
         }
+        output_data[Offset(output_shape, out_b, 0, 0, out_d)] =
+          value / (input_width * input_height);
       }
-      output_data[Offset(output_shape, out_b, 0, 0, out_d)] = value / (input_width * input_height);
-    }
-  }
+    });
 }
 
 } // namespace cker
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_RESIZEBILINEAR_H__
 #define __NNFW_CKER_RESIZEBILINEAR_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include <cmath>
@@ -69,21 +70,27 @@ inline void ResizeBilinearKernel2x2(int32_t x0, int32_t x1, int32_t y0, int32_t
 inline void ResizeBilinear2x2(int32_t batches, int32_t input_height, int32_t input_width,
                               int32_t depth, int32_t output_height, int32_t output_width,
                               const Shape &input_shape, const float *input_data,
-                              const Shape &output_shape, float *output_data)
+                              const Shape &output_shape, float *output_data,
+                              ruy::Context *ruy_context)
 {
-  for (int b = 0; b < batches; b++)
-  {
-    for (int y0 = 0, y = 0; y <= output_height - 2; y += 2, y0++)
-    {
-      for (int x0 = 0, x = 0; x <= output_width - 2; x += 2, x0++)
+  // Each input row makes two output rows
+  const int32_t row_pairs = output_height / 2;
+  cpu_backend_threadpool::ParallelFor(
+    batches * row_pairs, 2 * output_width * depth, ruy_context, [&](int begin, int end) {
+      for (int row_pair = begin; row_pair < end; ++row_pair)
       {
-        int32_t x1 = std::min(x0 + 1, input_width - 1);
-        int32_t y1 = std::min(y0 + 1, input_height - 1);
-        ResizeBilinearKernel2x2(x0, x1, y0, y1, x, y, depth, b, input_shape, input_data,
-                                output_shape, output_data);
+        const int b = row_pair / row_pairs;
+        const int32_t y0 = row_pair % row_pairs;
+        const int32_t y = 2 * y0;
+        for (int x0 = 0, x = 0; x <= output_width - 2; x += 2, x0++)
+        {
+          int32_t x1 = std::min(x0 + 1, input_width - 1);
+          int32_t y1 = std::min(y0 + 1, input_height - 1);
+          ResizeBilinearKernel2x2(x0, x1, y0, y1, x, y, depth, b, input_shape, input_data,
+                                  output_shape, output_data);
+        }
       }
-    }
-  }
+    });
 }
 
 inline void ResizeBilinearKernel(const float *input_ptr, int32_t depth, float scale,
@@ -119,52 +126,57 @@ inline void ResizeBilinearGeneric(int32_t batches, int32_t input_height, int32_t
                                   int32_t depth, int32_t output_height, int32_t output_width,
                                   float height_scale, float width_scale, const Shape &input_shape,
                                   const float *input_data, float *output_data,
-                                  const bool half_pixel_centers)
+                                  const bool half_pixel_centers, ruy::Context *ruy_context)
 {
-  memset(output_data, 0, batches * output_height * output_width * depth * sizeof(float));
-
-  int32_t output_offset = 0;
-  for (int b = 0; b < batches; ++b)
-  {
-    for (int y = 0; y < output_height; ++y)
-    {
-      float input_y;
-      int32_t y0, y1;
-      ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y, &y0,
-                                 &y1);
-      for (int x = 0; x < output_width; ++x)
+  const int32_t row_size = output_width * depth;
+  // Rows of the output are split over threads
+  cpu_backend_threadpool::ParallelFor(
+    batches * output_height, 4 * row_size, ruy_context, [&](int begin, int end) {
+      memset(output_data + static_cast<int64_t>(begin) * row_size, 0,
+             static_cast<int64_t>(end - begin) * row_size * sizeof(float));
+
+      int64_t output_offset = static_cast<int64_t>(begin) * row_size;
+      for (int row = begin; row < end; ++row)
       {
-        float input_x;
-        int32_t x0, x1;
-        ComputeInterpolationValues(x, width_scale, half_pixel_centers, input_width, &input_x, &x0,
-                                   &x1);
-        float *output_ptr = &output_data[output_offset];
-
-        // Run kernel on the 4 corners of the bilinear resize algorithm.
-        int32_t input_offset = Offset(input_shape, b, y0, x0, 0);
-        float scale = (1 - (input_y - y0)) * (1 - (input_x - x0));
-        const float *input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        input_offset = Offset(input_shape, b, y0, x1, 0);
-        scale = (1 - (input_y - y0)) * (input_x - x0);
-        input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        input_offset = Offset(input_shape, b, y1, x0, 0);
-        scale = (input_y - y0) * (1 - (input_x - x0));
-        input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        input_offset = Offset(input_shape, b, y1, x1, 0);
-        scale = (input_y - y0) * (input_x - x0);
-        input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        output_offset += depth;
+        const int b = row / output_height;
+        const int y = row % output_height;
+        float input_y;
+        int32_t y0, y1;
+        ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y,
+                                   &y0, &y1);
+        for (int x = 0; x < output_width; ++x)
+        {
+          float input_x;
+          int32_t x0, x1;
+          ComputeInterpolationValues(x, width_scale, half_pixel_centers, input_width, &input_x,
+                                     &x0, &x1);
+          float *output_ptr = &output_data[output_offset];
+
+          // Run kernel on the 4 corners of the bilinear resize algorithm.
+          int32_t input_offset = Offset(input_shape, b, y0, x0, 0);
+          float scale = (1 - (input_y - y0)) * (1 - (input_x - x0));
+          const float *input_ptr = &input_data[input_offset];
+          ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+
+          input_offset = Offset(input_shape, b, y0, x1, 0);
+          scale = (1 - (input_y - y0)) * (input_x - x0);
+          input_ptr = &input_data[input_offset];
+          ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+
+          input_offset = Offset(input_shape, b, y1, x0, 0);
+          scale = (input_y - y0) * (1 - (input_x - x0));
+          input_ptr = &input_data[input_offset];
+          ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+
+          input_offset = Offset(input_shape, b, y1, x1, 0);
+          scale = (input_y - y0) * (input_x - x0);
+          input_ptr = &input_data[input_offset];
+          ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+
+          output_offset += depth;
+        }
       }
-    }
-  }
+    });
 }
 
 template <typename T>
@@ -173,45 +185,52 @@ inline void ResizeBilinearGenericSmallChannel(int32_t batches, int32_t input_hei
                                               int32_t output_height, int32_t output_width,
                                               float height_scale, float width_scale,
                                               const Shape &input_shape, const T *input_data,
-                                              T *output_data, const bool half_pixel_centers)
+                                              T *output_data, const bool half_pixel_centers,
+                                              ruy::Context *ruy_context)
 {
-  T *output_ptr = &output_data[0];
-  for (int b = 0; b < batches; ++b)
-  {
-    for (int y = 0; y < output_height; ++y)
-    {
-      float input_y;
-      int32_t y0, y1;
-      ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y, &y0,
-                                 &y1);
-      for (int x = 0; x < output_width; ++x)
+  const int32_t row_size = output_width * depth;
+  // Rows of the output are split over threads
+  cpu_backend_threadpool::ParallelFor(
+    batches * output_height, 4 * row_size, ruy_context, [&](int begin, int end) {
+      T *output_ptr = &output_data[static_cast<int64_t>(begin) * row_size];
+      for (int row = begin; row < end; ++row)
       {
-        float input_x;
-        int32_t x0, x1;
-        ComputeInterpolationValues(x, width_scale, half_pixel_centers, input_width, &input_x, &x0,
-                                   &x1);
-
-        int32_t input_offset[4] = {
-          Offset(input_shape, b, y0, x0, 0), Offset(input_shape, b, y0, x1, 0),
-          Offset(input_shape, b, y1, x0, 0), Offset(input_shape, b, y1, x1, 0)};
-        float scale[4] = {(1 - (input_y - y0)) * (1 - (input_x - x0)),
-                          (1 - (input_y - y0)) * (input_x - x0),
-                          (input_y - y0) * (1 - (input_x - x0)), (input_y - y0) * (input_x - x0)};
-
-        for (int d = 0; d < depth; d++)
+        const int b = row / output_height;
+        const int y = row % output_height;
+        float input_y;
+        int32_t y0, y1;
+        ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y,
+                                   &y0, &y1);
+        for (int x = 0; x < output_width; ++x)
         {
-          const T *input_ptr = &input_data[d];
-          *output_ptr++ = static_cast<T>(
-            input_ptr[input_offset[0]] * scale[0] + input_ptr[input_offset[1]] * scale[1] +
-            input_ptr[input_offset[2]] * scale[2] + input_ptr[input_offset[3]] * scale[3]);
+          float input_x;
+          int32_t x0, x1;
+          ComputeInterpolationValues(x, width_scale, half_pixel_centers, input_width, &input_x,
+                                     &x0, &x1);
+
+          int32_t input_offset[4] = {
+            Offset(input_shape, b, y0, x0, 0), Offset(input_shape, b, y0, x1, 0),
+            Offset(input_shape, b, y1, x0, 0), Offset(input_shape, b, y1, x1, 0)};
+          float scale[4] = {(1 - (input_y - y0)) * (1 - (input_x - x0)),
+                            (1 - (input_y - y0)) * (input_x - x0),
+                            (input_y - y0) * (1 - (input_x - x0)),
+                            (input_y - y0) * (input_x - x0)};
+
+          for (int d = 0; d < depth; d++)
+          {
+            const T *input_ptr = &input_data[d];
+            *output_ptr++ = static_cast<T>(
+              input_ptr[input_offset[0]] * scale[0] + input_ptr[input_offset[1]] * scale[1] +
+              input_ptr[input_offset[2]] * scale[2] + input_ptr[input_offset[3]] * scale[3]);
+          }
         }
       }
-    }
-  }
+    });
 }
 
 void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, const float *input_data,
-                    const Shape &output_shape, float *output_data)
+                    const Shape &output_shape, float *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   int32_t batches = static_cast<int32_t>(MatchingDim(input_shape, 0, output_shape, 0));
   int32_t input_height = input_shape.Dims(1);
@@ -223,7 +242,8 @@ void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, cons
       params.output_height == 2 * input_height && params.output_width == 2 * input_width)
   {
     ResizeBilinear2x2(batches, input_height, input_width, depth, params.output_height,
-                      params.output_width, input_shape, input_data, output_shape, output_data);
+                      params.output_width, input_shape, input_data, output_shape, output_data,
+                      ruy_context);
   }
   else
   {
@@ -240,12 +260,13 @@ void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, cons
 
     ResizeBilinearGeneric(batches, input_height, input_width, depth, params.output_height,
                           params.output_width, height_scale, width_scale, input_shape, input_data,
-                          output_data, params.half_pixel_centers);
+                          output_data, params.half_pixel_centers, ruy_context);
   }
 }
 
 void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape,
-                    const uint8_t *input_data, const Shape &output_shape, uint8_t *output_data)
+                    const uint8_t *input_data, const Shape &output_shape, uint8_t *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
   int32_t input_height = input_shape.Dims(1);
@@ -262,7 +283,8 @@ void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape,
 
   ResizeBilinearGenericSmallChannel<uint8_t>(
     batches, input_height, input_width, depth, params.output_height, params.output_width,
-    height_scale, width_scale, input_shape, input_data, output_data, params.half_pixel_centers);
+    height_scale, width_scale, input_shape, input_data, output_data, params.half_pixel_centers,
+    ruy_context);
 }
 
 inline void ComputeInterpolationValues(const int32_t value, const int32_t scale_10,
@@ -284,7 +306,8 @@ inline void ComputeInterpolationValues(const int32_t value, const int32_t scale_
 
 inline void ResizeBilinear(const ResizeBilinearParams &op_params,
                            const Shape &unextended_input_shape, const int8_t *input_data,
-                           const Shape &unextended_output_shape, int8_t *output_data)
+                           const Shape &unextended_output_shape, int8_t *output_data,
+                           ruy::Context *ruy_context = nullptr)
 {
   // If half_pixel_centers is True, align_corners must be False.
   assert(!op_params.half_pixel_centers || !op_params.align_corners);
@@ -313,40 +336,44 @@ inline void ResizeBilinear(const ResizeBilinearParams &op_params,
     width_scale_10 = ((1 << 10) * (input_width - 1) + (output_width - 1) / 2) / (output_width - 1);
   }
 
-  for (int b = 0; b < batches; ++b)
-  {
-    for (int y = 0; y < output_height; ++y)
-    {
-      int32_t input_y, y0, y1;
-      ComputeInterpolationValues(y, height_scale_10, op_params.half_pixel_centers, input_height,
-                                 &input_y, &y0, &y1);
-      for (int x = 0; x < output_width; ++x)
+  // Rows of the output are split over threads
+  cpu_backend_threadpool::ParallelFor(
+    batches * output_height, 4 * output_width * depth, ruy_context, [&](int begin, int end) {
+      for (int row = begin; row < end; ++row)
       {
-        int32_t input_x, x0, x1;
-        ComputeInterpolationValues(x, width_scale_10, op_params.half_pixel_centers, input_width,
-                                   &input_x, &x0, &x1);
-        for (int c = 0; c < depth; ++c)
+        const int b = row / output_height;
+        const int y = row % output_height;
+        int32_t input_y, y0, y1;
+        ComputeInterpolationValues(y, height_scale_10, op_params.half_pixel_centers,
+                                   input_height, &input_y, &y0, &y1);
+        for (int x = 0; x < output_width; ++x)
         {
-          const int64_t output_20_ll =
-            static_cast<int64_t>(input_data[Offset(input_shape, b, y0, x0, c)]) *
-            ((1 << 10) - (input_y - (1 << 10) * y0)) * ((1 << 10) - (input_x - (1 << 10) * x0));
-          const int64_t output_20_lu =
-            static_cast<int64_t>(input_data[Offset(input_shape, b, y1, x0, c)]) *
-            (input_y - (1 << 10) * y0) * ((1 << 10) - (input_x - (1 << 10) * x0));
-          const int64_t output_20_rl =
-            static_cast<int64_t>(input_data[Offset(input_shape, b, y0, x1, c)]) *
-            ((1 << 10) - (input_y - (1 << 10) * y0)) * (input_x - (1 << 10) * x0);
-          const int64_t output_20_ru =
-            static_cast<int64_t>(input_data[Offset(input_shape, b, y1, x1, c)]) *
-            (input_y - (1 << 10) * y0) * (input_x - (1 << 10) * x0);
-          const int64_t output_20 = output_20_ll + output_20_lu + output_20_rl + output_20_ru;
-          const int64_t round = (output_20 > 0) ? (1 << 19) : -(1 << 19);
-          const int8_t interpolation = static_cast<int8_t>((output_20 + round) / (1 << 20));
-          output_data[Offset(output_shape, b, y, x, c)] = interpolation;
+          int32_t input_x, x0, x1;
+          ComputeInterpolationValues(x, width_scale_10, op_params.half_pixel_centers,
+                                     input_width, &input_x, &x0, &x1);
+          for (int c = 0; c < depth; ++c)
+          {
+            const int64_t output_20_ll =
+              static_cast<int64_t>(input_data[Offset(input_shape, b, y0, x0, c)]) *
+              ((1 << 10) - (input_y - (1 << 10) * y0)) *
+              ((1 << 10) - (input_x - (1 << 10) * x0));
+            const int64_t output_20_lu =
+              static_cast<int64_t>(input_data[Offset(input_shape, b, y1, x0, c)]) *
+              (input_y - (1 << 10) * y0) * ((1 << 10) - (input_x - (1 << 10) * x0));
+            const int64_t output_20_rl =
+              static_cast<int64_t>(input_data[Offset(input_shape, b, y0, x1, c)]) *
+              ((1 << 10) - (input_y - (1 << 10) * y0)) * (input_x - (1 << 10) * x0);
+            const int64_t output_20_ru =
+              static_cast<int64_t>(input_data[Offset(input_shape, b, y1, x1, c)]) *
+              (input_y - (1 << 10) * y0) * (input_x - (1 << 10) * x0);
+            const int64_t output_20 = output_20_ll + output_20_lu + output_20_rl + output_20_ru;
+            const int64_t round = (output_20 > 0) ? (1 << 19) : -(1 << 19);
+            const int8_t interpolation = static_cast<int8_t>((output_20 + round) / (1 << 20));
+            output_data[Offset(output_shape, b, y, x, c)] = interpolation;
+          }
         }
       }
-    }
-  }
+    });
 }
 
 } // namespace cker
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_SOFTMAX_H__
 #define __NNFW_CKER_SOFTMAX_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
 #include "cker/Types.h"
@@ -432,6 +433,66 @@ inline void SoftmaxInt8LUT(const SoftmaxParams &params, const Shape &input_shape
 }
 #endif
 
+// Splits rows along the last dimension over threads of ruy_context and runs rows_fn on each range
+template <typename In, typename Out, typename RowsFn>
+inline void SoftmaxRows(const Shape &input_shape, const In *input_data, const Shape &output_shape,
+                        Out *output_data, ruy::Context *ruy_context, const RowsFn &rows_fn)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  cpu_backend_threadpool::ParallelFor(
+    outer_size, depth * cpu_backend_threadpool::kTranscendentalCost, ruy_context,
+    [&](int begin, int end) {
+      const Shape rows_shape{end - begin, depth};
+      const int64_t offset = static_cast<int64_t>(begin) * depth;
+      rows_fn(rows_shape, input_data + offset, output_data + offset);
+    });
+}
+
+inline void Softmax(const float *in, const int input_size, const int batch_size, const float beta,
+                    float *out, ruy::Context *ruy_context)
+{
+  cpu_backend_threadpool::ParallelFor(
+    batch_size, input_size * cpu_backend_threadpool::kTranscendentalCost, ruy_context,
+    [&](int begin, int end) {
+      const int64_t offset = static_cast<int64_t>(begin) * input_size;
+      Softmax(in + offset, input_size, end - begin, beta, out + offset);
+    });
+}
+
+inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const float *input_data,
+                    const Shape &output_shape, float *output_data, ruy::Context *ruy_context)
+{
+  SoftmaxRows(input_shape, input_data, output_shape, output_data, ruy_context,
+              [&](const Shape &rows_shape, const float *rows_input, float *rows_output) {
+                Softmax(params, rows_shape, rows_input, rows_shape, rows_output);
+              });
+}
+
+template <typename In, typename Out>
+inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const In *input_data,
+                    const Shape &output_shape, Out *output_data, ruy::Context *ruy_context)
+{
+  SoftmaxRows(input_shape, input_data, output_shape, output_data, ruy_context,
+              [&](const Shape &rows_shape, const In *rows_input, Out *rows_output) {
+                Softmax<In, Out>(params, rows_shape, rows_input, rows_shape, rows_output);
+              });
+}
+
+#ifdef TFLITE_SOFTMAX_USE_UINT16_LUT
+template <typename In, typename Out>
+inline void SoftmaxInt8LUT(const SoftmaxParams &params, const Shape &input_shape,
+                           const In *input_data, const Shape &output_shape, Out *output_data,
+                           ruy::Context *ruy_context)
+{
+  SoftmaxRows(input_shape, input_data, output_shape, output_data, ruy_context,
+              [&](const Shape &rows_shape, const In *rows_input, Out *rows_output) {
+                SoftmaxInt8LUT<In, Out>(params, rows_shape, rows_input, rows_shape, rows_output);
+              });
+}
+#endif
+
 } // namespace cker
 } // namespace nnfw
 
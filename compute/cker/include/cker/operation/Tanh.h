@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_TANH_H__
 #define __NNFW_CKER_TANH_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/eigen/Utils.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
@@ -29,11 +30,19 @@ namespace cker
 {
 
 inline void Tanh(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                 float *output_data)
+                 float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  auto input_map = MapAsVector(input_data, input_shape);
-  auto output_map = MapAsVector(output_data, output_shape);
-  output_map.array() = input_map.array().tanh();
+  assert(input_shape.FlatSize() == output_shape.FlatSize());
+  UNUSED_RELEASE(output_shape);
+  const int flat_size = input_shape.FlatSize();
+  cpu_backend_threadpool::ParallelFor(
+    flat_size, cpu_backend_threadpool::kTranscendentalCost, ruy_context,
+    [&](int begin, int end) {
+      const Shape range_shape{end - begin};
+      auto input_map = MapAsVector(input_data + begin, range_shape);
+      auto output_map = MapAsVector(output_data + begin, range_shape);
+      output_map.array() = input_map.array().tanh();
+    });
 }
 
 } // namespace cker
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_TOPK_V2_H__
+#define __NNFW_CKER_TOPK_V2_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace topk_v2
+{
+
+// A heap of k candidates is used while k is at most 1/kHeapRatio of the row
+constexpr int32_t kHeapRatio = 16;
+// How many input elements are needed to make it worth using one more thread
+constexpr int64_t kMinElementsPerThread = 1 << 15;
+
+/**
+ * @brief Strict "a > b" that ranks NaN above every number and equal to other NaNs
+ *
+ * Plain operator> is not a strict weak ordering once NaN is present, which makes
+ * std::nth_element and the heap operations undefined.
+ */
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value, bool>::type Greater(T a, T b)
+{
+  if (std::isnan(a))
+    return !std::isnan(b);
+  if (std::isnan(b))
+    return false;
+  return a > b;
+}
+
+template <typename T>
+inline typename std::enable_if<!std::is_floating_point<T>::value, bool>::type Greater(T a, T b)
+{
+  return a > b;
+}
+
+/**
+ * @brief Select the k largest elements of a row in descending order
+ *
+ * Equal values are ordered by their indices and NaN ranks above every number.
+ * The whole row is never sorted:
+ * - small k : a min-heap of the best k candidates, so most elements cost one comparison
+ * - large k : introselect (std::nth_element) on indices, then sort only the first k
+ *
+ * @param scratch Index buffer reused across rows, resized as needed
+ */
+template <typename T>
+void SelectRow(const T *row, int32_t row_size, int32_t k, T *values, int32_t *indices,
+               std::vector<int32_t> &scratch)
+{
+  // true if element a should come before element b
+  auto greater = [row](int32_t a, int32_t b) {
+    return Greater(row[a], row[b]) || (!Greater(row[b], row[a]) && a < b);
+  };
+
+  if (k == 0)
+    return;
+
+  if (static_cast<int64_t>(k) * kHeapRatio <= row_size)
+  {
+    // The heap top is the worst candidate, so "greater" makes a min-heap
+    scratch.resize(k);
+    for (int32_t i = 0; i < k; ++i)
+      scratch[i] = i;
+    std::make_heap(scratch.begin(), scratch.end(), greater);
+    for (int32_t i = k; i < row_size; ++i)
+    {
+      // A later index never beats an equal value already taken
+      if (!Greater(row[i], row[scratch.front()]))
+        continue;
+      std::pop_heap(scratch.begin(), scratch.end(), greater);
+      scratch.back() = i;
+      std::push_heap(scratch.begin(), scratch.end(), greater);
+    }
+  }
+  else
+  {
+    scratch.resize(row_size);
+    for (int32_t i = 0; i < row_size; ++i)
+      scratch[i] = i;
+    if (k < row_size)
+      std::nth_element(scratch.begin(), scratch.begin() + (k - 1), scratch.end(), greater);
+    scratch.resize(k);
+  }
+
+  std::sort(scratch.begin(), scratch.end(), greater);
+  for (int32_t i = 0; i < k; ++i)
+  {
+    indices[i] = scratch[i];
+    values[i] = row[scratch[i]];
+  }
+}
+
+template <typename T> struct TopKV2WorkerTask : cpu_backend_threadpool::Task
+{
+  TopKV2WorkerTask(const T *input_data, int32_t row_size, int32_t k, T *values_data,
+                   int32_t *indices_data, int32_t row_begin, int32_t row_end)
+    : input_data_(input_data), row_size_(row_size), k_(k), values_data_(values_data),
+      indices_data_(indices_data), row_begin_(row_begin), row_end_(row_end)
+  {
+  }
+
+  void Run() override
+  {
+    std::vector<int32_t> scratch;
+    for (int32_t r = row_begin_; r < row_end_; ++r)
+    {
+      SelectRow(input_data_ + static_cast<int64_t>(r) * row_size_, row_size_, k_,
+                values_data_ + static_cast<int64_t>(r) * k_,
+                indices_data_ + static_cast<int64_t>(r) * k_, scratch);
+    }
+  }
+
+private:
+  const T *input_data_;
+  int32_t row_size_;
+  int32_t k_;
+  T *values_data_;
+  int32_t *indices_data_;
+  int32_t row_begin_;
+  int32_t row_end_;
+};
+
+} // namespace topk_v2
+
+/**
+ * @brief TopKV2 finds the k largest elements along the last dimension and their indices
+ *
+ * Output values are sorted in descending order, and equal values keep the order of indices.
+ * Rows are distributed over threads of ruy_context.
+ */
+template <typename T>
+void TopKV2(const Shape &input_shape, const T *input_data, int32_t k, const Shape &values_shape,
+            T *values_data, int32_t *indices_data, ruy::Context *ruy_context)
+{
+  const int dims_count = input_shape.DimensionsCount();
+  if (dims_count < 1)
+    throw std::runtime_error("TopKV2: input must be at least 1-D");
+
+  const int32_t row_size = input_shape.Dims(dims_count - 1);
+  if (k < 0 || k > row_size)
+    throw std::runtime_error("TopKV2: k must be in range [0, last dimension of input]");
+  if (values_shape.DimensionsCount() != dims_count || values_shape.Dims(dims_count - 1) != k)
+    throw std::runtime_error("TopKV2: output shape does not match input shape and k");
+
+  const int32_t rows = FlatSizeSkipDim(input_shape, dims_count - 1);
+  if (rows == 0 || k == 0)
+    return;
+
+  const auto max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int32_t thread_count = std::max<int32_t>(
+    1, std::min<int64_t>({static_cast<int64_t>(max_threads), static_cast<int64_t>(rows),
+                          static_cast<int64_t>(rows) * row_size /
+                            topk_v2::kMinElementsPerThread}));
+
+  std::vector<topk_v2::TopKV2WorkerTask<T>> tasks;
+  tasks.reserve(thread_count);
+  int32_t row_begin = 0;
+  for (int32_t i = 0; i < thread_count; ++i)
+  {
+    const int32_t row_end = row_begin + (rows - row_begin) / (thread_count - i);
+    tasks.emplace_back(input_data, row_size, k, values_data, indices_data, row_begin, row_end);
+    row_begin = row_end;
+  }
+
+  if (thread_count == 1)
+    tasks[0].Run();
+  else
+    cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_TOPK_V2_H__
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_TRANSPOSE_H__
 #define __NNFW_CKER_TRANSPOSE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -290,26 +291,20 @@ size_t Flatten(const Shape &input_shape, const Shape &output_shape, const Transp
 
 } // namespace
 
-// Transpose2D only deals with typical 2D matrix transpose ops.
+// Transposes rows [row_begin, row_end) of a d0 x d1 input into columns of the d1 x d0 output
 // Perform transpose by transposing 4x4 blocks of the input, proceeding from
 // left to right (down the rows) of the input, and then from top to bottom.
 template <typename T>
-inline void Transpose2D(const Shape &input_shape, const T *input_data, const Shape &output_shape,
-                        T *output_data)
+inline void Transpose2DRows(int d0, int d1, const T *input_data, T *output_data, int row_begin,
+                            int row_end)
 {
-  assert(input_shape.DimensionsCount() == 2);
-  assert(output_shape.DimensionsCount() == 2);
-  UNUSED_RELEASE(output_shape);
-
-  const int d0 = input_shape.DimsData()[0];
-  const int d1 = input_shape.DimsData()[1];
   const int kLines = 4;
   const int kSkipSize = (kLines - 1) * d1;
 
-  const T *input = input_data;
+  const T *input = input_data + static_cast<int64_t>(row_begin) * d1;
 
-  int i = 0;
-  for (; i <= d0 - kLines; i += kLines)
+  int i = row_begin;
+  for (; i <= row_end - kLines; i += kLines)
   {
     T *output = output_data + i;
 
@@ -388,7 +383,7 @@ inline void Transpose2D(const Shape &input_shape, const T *input_data, const Sha
       input += (d1 - j) + kSkipSize;
     }
   }
-  for (; i < d0; ++i)
+  for (; i < row_end; ++i)
   {
     T *output = output_data + i;
     for (int j = 0; j < d1; ++j)
@@ -400,6 +395,23 @@ inline void Transpose2D(const Shape &input_shape, const T *input_data, const Sha
   }
 }
 
+// Transpose2D only deals with typical 2D matrix transpose ops.
+// Rows of the input are split over threads of ruy_context.
+template <typename T>
+inline void Transpose2D(const Shape &input_shape, const T *input_data, const Shape &output_shape,
+                        T *output_data, ruy::Context *ruy_context = nullptr)
+{
+  assert(input_shape.DimensionsCount() == 2);
+  assert(output_shape.DimensionsCount() == 2);
+  UNUSED_RELEASE(output_shape);
+
+  const int d0 = input_shape.DimsData()[0];
+  const int d1 = input_shape.DimsData()[1];
+  cpu_backend_threadpool::ParallelFor(d0, d1, ruy_context, [&](int begin, int end) {
+    Transpose2DRows(d0, d1, input_data, output_data, begin, end);
+  });
+}
+
 // TODO(alanchiao): see if we can reduce the number
 // of lines of code in branching without affecting latency.
 template <typename T>
@@ -474,14 +486,14 @@ inline void Transpose3D(const TransposeParams &params, const Shape &input_shape,
 
 template <typename T>
 void TransposeImpl(const TransposeParams &params, const Shape &input_shape, const T *input_data,
-                   const Shape &output_shape, T *output_data)
+                   const Shape &output_shape, T *output_data, ruy::Context *ruy_context = nullptr)
 {
   const int dims_cnt = input_shape.DimensionsCount();
 
   int dim0, dim1;
   if (IsTranspose2DApplicable(params, input_shape, &dim0, &dim1))
   {
-    Transpose2D(Shape({dim0, dim1}), input_data, Shape({dim1, dim0}), output_data);
+    Transpose2D(Shape({dim0, dim1}), input_data, Shape({dim1, dim0}), output_data, ruy_context);
     return;
   }
 
@@ -508,7 +520,8 @@ void TransposeImpl(const TransposeParams &params, const Shape &input_shape, cons
 
 template <typename T>
 void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_input_shape,
-               const T *input_data, const Shape &unshrunk_output_shape, T *output_data)
+               const T *input_data, const Shape &unshrunk_output_shape, T *output_data,
+               ruy::Context *ruy_context = nullptr)
 {
   const int output_size = unshrunk_output_shape.DimensionsCount();
   assert(unshrunk_input_shape.DimensionsCount() <= 4);
@@ -560,10 +573,26 @@ void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_inp
               &non_flatten_input_shape, &non_flatten_output_shape, &non_flatten_params);
     assert(non_flatten_params.perm[0] != 0);
 
+    // Split blocks over threads if there are enough, or split each block otherwise
+    const int blocks = total_size / non_flatten_size;
+    const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+    if (blocks >= max_threads)
+    {
+      cpu_backend_threadpool::ParallelFor(
+        blocks, non_flatten_size, ruy_context, [&](int begin, int end) {
+          for (int i = begin * non_flatten_size; i < end * non_flatten_size; i += non_flatten_size)
+          {
+            TransposeImpl(non_flatten_params, non_flatten_input_shape, input_data + i,
+                          non_flatten_output_shape, output_data + i);
+          }
+        });
+      return;
+    }
+
     for (int i = 0; i < total_size; i += non_flatten_size)
     {
       TransposeImpl(non_flatten_params, non_flatten_input_shape, input_data + i,
-                    non_flatten_output_shape, output_data + i);
+                    non_flatten_output_shape, output_data + i, ruy_context);
     }
     return;
   }
@@ -571,7 +600,7 @@ void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_inp
   // Call non-flattened case.
   TransposeImpl(shrunk_params, shrunk_input_shape, input_data, shrunk_output_shape,
 
-                output_data);
+                output_data, ruy_context);
 }
 
 } // namespace cker
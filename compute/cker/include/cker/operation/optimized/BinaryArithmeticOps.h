@@ -223,7 +223,7 @@ inline void BinaryBroadcastFiveFold(const BinaryArithmeticOpParam &unswitched_pa
 }
 
 template <typename T>
-inline typename std::enable_if_t<is_quant8<T>::value, int32_t>
+inline typename std::enable_if_t<is_quant<T>::value, int32_t>
 quant8_sum(const BinaryArithmeticOpParam &params, const T input1_data, const T input2_data)
 {
   const int32_t input1_val = params.input1_offset + input1_data;
@@ -687,8 +687,18 @@ getBinaryOpWithActivationImplFloat(const BinaryArithmeticOpParam &params)
                                   BinaryOpScalarBroadcast<FUNC, BinaryOpActivationFloatMinMax>);
 }
 
+inline void AddElementwise(int size, const BinaryArithmeticOpParam &params,
+                           const int16_t *input1_data, const int16_t *input2_data,
+                           int16_t *output_data)
+{
+  for (int i = 0; i < size; ++i)
+  {
+    output_data[i] = static_cast<int16_t>(quant8_sum(params, input1_data[i], input2_data[i]));
+  }
+}
+
 template <typename T>
-inline typename std::enable_if_t<is_quant8<T>::value>
+inline typename std::enable_if_t<is_quant<T>::value>
 Add(const BinaryArithmeticOpParam &params, const Shape &input1_shape, const T *input1_data,
     const Shape &input2_shape, const T *input2_data, const Shape &output_shape, T *output_data)
 {
@@ -807,8 +817,18 @@ inline void AddScalarBroadcast(int size, const BinaryArithmeticOpParam &params,
   }
 }
 
+inline void AddScalarBroadcast(int size, const BinaryArithmeticOpParam &params,
+                               int16_t broadcast_value, const int16_t *input2_data,
+                               int16_t *output_data)
+{
+  for (int i = 0; i < size; ++i)
+  {
+    output_data[i] = static_cast<int16_t>(quant8_sum(params, broadcast_value, input2_data[i]));
+  }
+}
+
 template <typename T>
-inline typename std::enable_if_t<is_quant8<T>::value>
+inline typename std::enable_if_t<is_quant<T>::value>
 BroadcastAddDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                      const T *input1_data, const Shape &input2_shape, const T *input2_data,
                      const Shape &output_shape, T *output_data)
@@ -892,7 +912,7 @@ inline void BroadcastSubDispatch(const BinaryArithmeticOpParam &params, const Sh
 }
 
 template <typename T>
-inline typename std::enable_if_t<is_quant8<T>::value, int32_t>
+inline typename std::enable_if_t<is_quant<T>::value, int32_t>
 quant8_mul(const BinaryArithmeticOpParam &params, const T input1_data, const T input2_data)
 {
   const int32_t input1_val = params.input1_offset + input1_data;
@@ -1060,8 +1080,18 @@ inline void MulElementwise(int size, const BinaryArithmeticOpParam &params,
   }
 }
 
+inline void MulElementwise(int size, const BinaryArithmeticOpParam &params,
+                           const int16_t *input1_data, const int16_t *input2_data,
+                           int16_t *output_data)
+{
+  for (int i = 0; i < size; ++i)
+  {
+    output_data[i] = static_cast<int16_t>(quant8_mul(params, input1_data[i], input2_data[i]));
+  }
+}
+
 template <typename T>
-inline typename std::enable_if_t<is_quant8<T>::value>
+inline typename std::enable_if_t<is_quant<T>::value>
 Mul(const BinaryArithmeticOpParam &params, const Shape &input1_shape, const T *input1_data,
     const Shape &input2_shape, const T *input2_data, const Shape &output_shape, T *output_data)
 {
@@ -1172,8 +1202,18 @@ inline void MulSimpleBroadcast(int size, const BinaryArithmeticOpParam &params,
   }
 }
 
+inline void MulSimpleBroadcast(int size, const BinaryArithmeticOpParam &params,
+                               const int16_t broadcast_value, const int16_t *input2_data,
+                               int16_t *output_data)
+{
+  for (int i = 0; i < size; ++i)
+  {
+    output_data[i] = static_cast<int16_t>(quant8_mul(params, broadcast_value, input2_data[i]));
+  }
+}
+
 template <typename T>
-inline typename std::enable_if_t<is_quant8<T>::value>
+inline typename std::enable_if_t<is_quant<T>::value>
 BroadcastMulDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                      const T *input1_data, const Shape &input2_shape, const T *input2_data,
                      const Shape &output_shape, T *output_data)
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_GEMM_F16_WEIGHTS_H__
+#define __NNFW_CKER_OPTIMIZED_GEMM_F16_WEIGHTS_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Fp16.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Widened weight rows are kept within this size so that they stay in cache while used
+constexpr int kGemmF16WeightsTileBytes = 256 * 1024;
+constexpr int kGemmF16WeightsMinTileRows = 8;
+// Up to this many columns, rows are split over threads and each row is widened just once
+constexpr int kGemmF16WeightsGemvMaxCols = 4;
+
+namespace gemm_f16_weights
+{
+
+inline void GemvRows(const uint16_t *lhs_data, int depth, const float *rhs_data, int cols,
+                     const float *bias_data, float act_min, float act_max, float *dst_data,
+                     int rows, int row_start, int row_end)
+{
+  std::vector<float> row(depth);
+  for (int r = row_start; r < row_end; ++r)
+  {
+    HalfToFloat(lhs_data + static_cast<size_t>(r) * depth, row.data(), depth);
+    for (int c = 0; c < cols; ++c)
+    {
+      const float *rhs_col = rhs_data + static_cast<size_t>(c) * depth;
+      float acc = 0.f;
+      for (int d = 0; d < depth; ++d)
+        acc += row[d] * rhs_col[d];
+      if (bias_data)
+        acc += bias_data[r];
+      dst_data[static_cast<size_t>(c) * rows + r] =
+        ActivationFunctionWithMinMax(acc, act_min, act_max);
+    }
+  }
+}
+
+struct GemvRowsTask : cpu_backend_threadpool::Task
+{
+  GemvRowsTask(const uint16_t *lhs_data, int depth, const float *rhs_data, int cols,
+               const float *bias_data, float act_min, float act_max, float *dst_data, int rows,
+               int row_start, int row_end)
+    : lhs_data_(lhs_data), depth_(depth), rhs_data_(rhs_data), cols_(cols), bias_data_(bias_data),
+      act_min_(act_min), act_max_(act_max), dst_data_(dst_data), rows_(rows),
+      row_start_(row_start), row_end_(row_end)
+  {
+  }
+
+  void Run() override
+  {
+    GemvRows(lhs_data_, depth_, rhs_data_, cols_, bias_data_, act_min_, act_max_, dst_data_,
+             rows_, row_start_, row_end_);
+  }
+
+private:
+  const uint16_t *lhs_data_;
+  int depth_;
+  const float *rhs_data_;
+  int cols_;
+  const float *bias_data_;
+  float act_min_;
+  float act_max_;
+  float *dst_data_;
+  int rows_;
+  int row_start_;
+  int row_end_;
+};
+
+} // namespace gemm_f16_weights
+
+/**
+ * @brief Computes dst[rows, cols] = act(lhs[rows, depth] x rhs[depth, cols] + bias) where lhs is
+ *        fp16 weights and the others are float
+ *
+ * lhs is row-major and rhs and dst are col-major. Weights are widened to float a tile of rows at
+ * a time right before they are multiplied, so the full float weights never exist in memory.
+ * - Few columns : rows are split over ruy's thread pool and each row is widened once
+ * - Otherwise   : a tile of rows is widened and multiplied by ruy float GEMM
+ *
+ * @param lhs_tile  float buffer of widened rows, resized as needed
+ * @param dst_tile  float buffer of a tile of results, resized as needed
+ */
+inline void GemmF16Weights(const uint16_t *lhs_data, int rows, int depth, const float *rhs_data,
+                           int cols, const float *bias_data, float act_min, float act_max,
+                           float *dst_data, std::vector<float> &lhs_tile,
+                           std::vector<float> &dst_tile, ruy::Context *ruy_context)
+{
+  if (cols <= kGemmF16WeightsGemvMaxCols)
+  {
+    constexpr int kMinRowsPerThread = 16;
+    const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+    const int thread_count = std::max(1, std::min(max_threads, rows / kMinRowsPerThread));
+    if (thread_count == 1)
+    {
+      gemm_f16_weights::GemvRows(lhs_data, depth, rhs_data, cols, bias_data, act_min, act_max,
+                                 dst_data, rows, 0, rows);
+      return;
+    }
+
+    std::vector<gemm_f16_weights::GemvRowsTask> tasks;
+    tasks.reserve(thread_count);
+    int row_start = 0;
+    for (int i = 0; i < thread_count; ++i)
+    {
+      const int row_end = row_start + (rows - row_start) / (thread_count - i);
+      tasks.emplace_back(lhs_data, depth, rhs_data, cols, bias_data, act_min, act_max, dst_data,
+                         rows, row_start, row_end);
+      row_start = row_end;
+    }
+    cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+    return;
+  }
+
+  assert(ruy_context != nullptr);
+  const int tile_bytes_rows = kGemmF16WeightsTileBytes / static_cast<int>(sizeof(float) * depth);
+  const int tile_rows = std::min(rows, std::max(kGemmF16WeightsMinTileRows, tile_bytes_rows));
+  lhs_tile.resize(static_cast<size_t>(tile_rows) * depth);
+  dst_tile.resize(static_cast<size_t>(tile_rows) * cols);
+
+  MatrixParams<float> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = depth;
+  rhs_params.cols = cols;
+  ruy::Matrix<float> ruy_rhs;
+  ruy_support::MakeRuyMatrix(rhs_params, rhs_data, &ruy_rhs);
+
+  // Bias and activation are applied while results are scattered to dst
+  ruy::MulParams<float, float> ruy_mul_params;
+
+  for (int row_start = 0; row_start < rows; row_start += tile_rows)
+  {
+    const int tile = std::min(tile_rows, rows - row_start);
+    HalfToFloat(lhs_data + static_cast<size_t>(row_start) * depth, lhs_tile.data(), tile * depth);
+
+    MatrixParams<float> lhs_params;
+    lhs_params.order = Order::kRowMajor;
+    lhs_params.rows = tile;
+    lhs_params.cols = depth;
+    MatrixParams<float> dst_params;
+    dst_params.order = Order::kColMajor;
+    dst_params.rows = tile;
+    dst_params.cols = cols;
+
+    ruy::Matrix<float> ruy_lhs;
+    ruy::Matrix<float> ruy_dst;
+    ruy_support::MakeRuyMatrix(lhs_params, lhs_tile.data(), &ruy_lhs);
+    ruy_support::MakeRuyMatrix(dst_params, dst_tile.data(), &ruy_dst);
+    ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+
+    for (int c = 0; c < cols; ++c)
+    {
+      const float *src = dst_tile.data() + static_cast<size_t>(c) * tile;
+      float *dst = dst_data + static_cast<size_t>(c) * rows + row_start;
+      for (int r = 0; r < tile; ++r)
+      {
+        const float value = bias_data ? src[r] + bias_data[row_start + r] : src[r];
+        dst[r] = ActivationFunctionWithMinMax(value, act_min, act_max);
+      }
+    }
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_GEMM_F16_WEIGHTS_H__
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2020 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_CONV_HYBRID_H__
+#define __NNFW_CKER_OPTIMIZED_CONV_HYBRID_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/operation/optimized/OptimizedUtils.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/context.h>
+
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized_integer_ops
+{
+
+// Sum of each filter row, which cancels the input offset out of the int8 product
+inline void ComputeHybridConvRowSums(const Shape &filter_shape, const int8_t *filter_data,
+                                     std::vector<int32_t> &row_sums)
+{
+  const int output_depth = filter_shape.Dims(0);
+  const int row_size = filter_shape.FlatSize() / output_depth;
+  row_sums.resize(output_depth);
+  for (int o = 0; o < output_depth; ++o)
+  {
+    const int8_t *row = filter_data + o * row_size;
+    int32_t sum = 0;
+    for (int i = 0; i < row_size; ++i)
+      sum += row[i];
+    row_sums[o] = sum;
+  }
+}
+
+/**
+ * @brief Hybrid convolution of per-batch asymmetric quantized int8 input and per-channel
+ *        symmetric int8 filter into float output
+ *
+ * Input patches are laid out by im2col, padded with the input offset of each batch, and
+ * multiplied with the filter by ruy int8 GEMM on ruy's thread pool. As padded values equal the
+ * offset, sum(filter * (input - offset)) is sum(filter * input) - offset * row_sum. That and the
+ * input and filter scales are applied on the int32 accumulators afterwards.
+ *
+ * @param row_sums  Sums of each filter row from ComputeHybridConvRowSums
+ * @param im2col    int8 buffer for patches, resized as needed
+ * @param accum     int32 accumulator buffer, resized as needed
+ */
+inline void HybridConvPerChannel(const ConvParams &params, const float *scaling_factors_ptr,
+                                 const Shape &input_shape, const int8_t *input_data,
+                                 const Shape &filter_shape, const int8_t *filter_data,
+                                 const Shape &bias_shape, const float *bias_data,
+                                 const Shape &output_shape, float *output_data,
+                                 const float *per_channel_scale, const int32_t *input_offset,
+                                 const int32_t *row_sums, std::vector<int8_t> &im2col,
+                                 std::vector<int32_t> &accum, ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_pixels = output_height * output_width;
+  const int gemm_depth = filter_height * filter_width * input_depth;
+  const int gemm_cols = batches * output_pixels;
+  UNUSED_RELEASE(bias_shape);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+
+  const bool need_dilated_im2col =
+    params.dilation_width_factor != 1 || params.dilation_height_factor != 1;
+  const bool need_im2col = params.stride_width != 1 || params.stride_height != 1 ||
+                           filter_height != 1 || filter_width != 1;
+
+  const int8_t *gemm_input_data = input_data;
+  if (need_dilated_im2col)
+  {
+    im2col.resize(static_cast<size_t>(gemm_cols) * gemm_depth);
+    optimized::DilatedIm2col<int8_t>(params, input_shape, input_data, filter_shape, output_shape,
+                                     im2col.data(), input_offset, batches);
+    gemm_input_data = im2col.data();
+  }
+  else if (need_im2col)
+  {
+    im2col.resize(static_cast<size_t>(gemm_cols) * gemm_depth);
+    // Im2col takes a single padding value, so each batch is laid out separately
+    const int input_batch_size = input_shape.FlatSize() / batches;
+    const int im2col_batch_size = output_pixels * gemm_depth;
+    const Shape batch_input_shape{1, input_shape.Dims(1), input_shape.Dims(2), input_depth};
+    const Shape batch_im2col_shape{1, output_height, output_width, gemm_depth};
+    for (int b = 0; b < batches; ++b)
+    {
+      optimized::Im2col<int8_t>(params, filter_height, filter_width,
+                                static_cast<uint8_t>(input_offset[b]), batch_input_shape,
+                                input_data + b * input_batch_size, batch_im2col_shape,
+                                im2col.data() + b * im2col_batch_size);
+    }
+    gemm_input_data = im2col.data();
+  }
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = output_depth;
+  lhs_params.cols = gemm_depth;
+  lhs_params.cache_policy = CachePolicy::kAlwaysCache;
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = gemm_depth;
+  rhs_params.cols = gemm_cols;
+
+  MatrixParams<int32_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_depth;
+  dst_params.cols = gemm_cols;
+
+  accum.resize(static_cast<size_t>(output_depth) * gemm_cols);
+
+  GemmParams<int32_t, int32_t> gemm_params;
+  ruy::Matrix<int8_t> ruy_lhs;
+  ruy::Matrix<int8_t> ruy_rhs;
+  ruy::Matrix<int32_t> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, filter_data, &ruy_lhs, true);
+  ruy_support::MakeRuyMatrix(rhs_params, gemm_input_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, accum.data(), &ruy_dst);
+
+  ruy::MulParams<int32_t, int32_t> ruy_mul_params;
+  ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+
+  ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+
+  const float output_activation_min = params.float_activation_min;
+  const float output_activation_max = params.float_activation_max;
+  for (int b = 0; b < batches; ++b)
+  {
+    const int32_t offset = input_offset[b];
+    const float scaling_factor = scaling_factors_ptr[b];
+    for (int p = 0; p < output_pixels; ++p)
+    {
+      const int col = b * output_pixels + p;
+      const int32_t *acc_col = accum.data() + col * output_depth;
+      float *out = output_data + col * output_depth;
+      for (int o = 0; o < output_depth; ++o)
+      {
+        const int32_t acc = acc_col[o] - offset * row_sums[o];
+        float value = acc * per_channel_scale[o] * scaling_factor;
+        if (bias_data)
+          value += bias_data[o];
+        out[o] = ActivationFunctionWithMinMax(value, output_activation_min, output_activation_max);
+      }
+    }
+  }
+}
+
+} // namespace optimized_integer_ops
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_CONV_HYBRID_H__
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_HYBRID_H__
+#define __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_HYBRID_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized_integer_ops
+{
+namespace depthwise_conv_hybrid
+{
+
+// Computes output rows [row_start, row_end) of every batch. Accumulators of all output channels
+// of a pixel are kept in a row so that the innermost loops run over contiguous channels.
+inline void DepthwiseConvHybridImpl(const DepthwiseConvParams &params,
+                                    const float *scaling_factors_ptr, const Shape &input_shape,
+                                    const int8_t *input_data, const Shape &filter_shape,
+                                    const int8_t *filter_data, const float *bias_data,
+                                    const Shape &output_shape, float *output_data,
+                                    const float *per_channel_scale, const int32_t *input_offset,
+                                    int row_start, int row_end)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int depth_multiplier = params.depth_multiplier;
+  const float output_activation_min = params.float_activation_min;
+  const float output_activation_max = params.float_activation_max;
+
+  const int batches = input_shape.Dims(0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = output_shape.Dims(3);
+
+  std::vector<int32_t> acc(output_depth);
+  std::vector<int32_t> centered(input_depth);
+  for (int batch = 0; batch < batches; ++batch)
+  {
+    const int32_t offset = input_offset[batch];
+    const float scaling_factor = scaling_factors_ptr[batch];
+    for (int out_y = row_start; out_y < row_end; ++out_y)
+    {
+      const int in_y_origin = (out_y * stride_height) - pad_height;
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        const int in_x_origin = (out_x * stride_width) - pad_width;
+        std::fill(acc.begin(), acc.end(), 0);
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+        {
+          const int in_y = in_y_origin + dilation_height_factor * filter_y;
+          if (in_y < 0 || in_y >= input_height)
+            continue;
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+          {
+            const int in_x = in_x_origin + dilation_width_factor * filter_x;
+            // Zero padding by omitting the areas outside the image.
+            if (in_x < 0 || in_x >= input_width)
+              continue;
+            const int8_t *in = input_data + Offset(input_shape, batch, in_y, in_x, 0);
+            const int8_t *filter = filter_data + Offset(filter_shape, 0, filter_y, filter_x, 0);
+            if (depth_multiplier == 1)
+            {
+              for (int c = 0; c < input_depth; ++c)
+                acc[c] += filter[c] * (in[c] - offset);
+            }
+            else
+            {
+              for (int c = 0; c < input_depth; ++c)
+                centered[c] = in[c] - offset;
+              for (int c = 0; c < input_depth; ++c)
+                for (int m = 0; m < depth_multiplier; ++m)
+                  acc[c * depth_multiplier + m] +=
+                    filter[c * depth_multiplier + m] * centered[c];
+            }
+          }
+        }
+        float *out = output_data + Offset(output_shape, batch, out_y, out_x, 0);
+        for (int oc = 0; oc < output_depth; ++oc)
+        {
+          float value = acc[oc] * per_channel_scale[oc] * scaling_factor;
+          if (bias_data)
+            value += bias_data[oc];
+          out[oc] =
+            ActivationFunctionWithMinMax(value, output_activation_min, output_activation_max);
+        }
+      }
+    }
+  }
+}
+
+struct DepthwiseConvHybridWorkerTask : cpu_backend_threadpool::Task
+{
+  DepthwiseConvHybridWorkerTask(const DepthwiseConvParams &params,
+                                const float *scaling_factors_ptr, const Shape &input_shape,
+                                const int8_t *input_data, const Shape &filter_shape,
+                                const int8_t *filter_data, const float *bias_data,
+                                const Shape &output_shape, float *output_data,
+                                const float *per_channel_scale, const int32_t *input_offset,
+                                int row_start, int row_end)
+    : params_(params), scaling_factors_ptr_(scaling_factors_ptr), input_shape_(input_shape),
+      input_data_(input_data), filter_shape_(filter_shape), filter_data_(filter_data),
+      bias_data_(bias_data), output_shape_(output_shape), output_data_(output_data),
+      per_channel_scale_(per_channel_scale), input_offset_(input_offset), row_start_(row_start),
+      row_end_(row_end)
+  {
+  }
+
+  void Run() override
+  {
+    DepthwiseConvHybridImpl(params_, scaling_factors_ptr_, input_shape_, input_data_,
+                            filter_shape_, filter_data_, bias_data_, output_shape_, output_data_,
+                            per_channel_scale_, input_offset_, row_start_, row_end_);
+  }
+
+private:
+  const DepthwiseConvParams &params_;
+  const float *scaling_factors_ptr_;
+  const Shape &input_shape_;
+  const int8_t *input_data_;
+  const Shape &filter_shape_;
+  const int8_t *filter_data_;
+  const float *bias_data_;
+  const Shape &output_shape_;
+  float *output_data_;
+  const float *per_channel_scale_;
+  const int32_t *input_offset_;
+  int row_start_;
+  int row_end_;
+};
+
+} // namespace depthwise_conv_hybrid
+
+/**
+ * @brief Hybrid depthwise convolution of per-batch asymmetric quantized int8 input and
+ *        per-channel symmetric int8 filter into float output
+ *
+ * Output rows are split over ruy's thread pool. Results are the same as
+ * reference_integer_ops::DepthwiseConvHybridPerChannel.
+ */
+inline void DepthwiseConvHybridPerChannel(const DepthwiseConvParams &params,
+                                          const float *scaling_factors_ptr,
+                                          const Shape &input_shape, const int8_t *input_data,
+                                          const Shape &filter_shape, const int8_t *filter_data,
+                                          const Shape &bias_shape, const float *bias_data,
+                                          const Shape &output_shape, float *output_data,
+                                          const float *per_channel_scale,
+                                          const int32_t *input_offset, ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  MatchingDim(input_shape, 0, output_shape, 0);
+  UNUSED_RELEASE(output_depth);
+  UNUSED_RELEASE(bias_shape);
+  assert(output_depth == input_shape.Dims(3) * params.depth_multiplier);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+
+  // How many multiplications are needed to make it worth using one more thread
+  constexpr int kMinMulPerThread = 1 << 13;
+  const int output_rows = output_shape.Dims(1);
+  const int num_muls = output_shape.FlatSize() * filter_shape.Dims(1) * filter_shape.Dims(2);
+  int thread_count = std::max(1, num_muls / kMinMulPerThread);
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  thread_count = std::max(1, std::min({thread_count, max_threads, output_rows}));
+
+  if (thread_count == 1)
+  {
+    depthwise_conv_hybrid::DepthwiseConvHybridImpl(
+      params, scaling_factors_ptr, input_shape, input_data, filter_shape, filter_data, bias_data,
+      output_shape, output_data, per_channel_scale, input_offset, 0, output_rows);
+    return;
+  }
+
+  std::vector<depthwise_conv_hybrid::DepthwiseConvHybridWorkerTask> tasks;
+  tasks.reserve(thread_count);
+  int row_start = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    int row_end = row_start + (output_rows - row_start) / (thread_count - i);
+    tasks.emplace_back(params, scaling_factors_ptr, input_shape, input_data, filter_shape,
+                       filter_data, bias_data, output_shape, output_data, per_channel_scale,
+                       input_offset, row_start, row_end);
+    row_start = row_end;
+  }
+  cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+} // namespace optimized_integer_ops
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_HYBRID_H__
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_GEMM_16X8_H__
+#define __NNFW_CKER_OPTIMIZED_GEMM_16X8_H__
+
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized_integer_ops
+{
+
+// The deepest accumulation whose int8 x int16 products are guaranteed to fit in int32
+// : 128 * 32768 * 511 < 2^31 - 1 < 128 * 32768 * 512
+constexpr int kMaxGemm16x8Int32Depth = 511;
+
+struct Gemm16x8Params
+{
+  // Per output row(channel) requantization parameters
+  const int32_t *output_multiplier;
+  const int *output_shift;
+  int32_t quantized_activation_min;
+  int32_t quantized_activation_max;
+};
+
+/**
+ * @brief Computes dst[rows, cols] = requantize(lhs[rows, depth] x rhs[depth, cols] + bias)
+ *        for int8 weights and int16 activations whose zero points are all 0
+ *
+ * lhs is row-major and rhs and dst are col-major, so that a column of rhs/dst is a pixel or a
+ * batch of NHWC activations. The product is computed by ruy into int32 accumulators. A depth
+ * deeper than kMaxGemm16x8Int32Depth would overflow them, so it is split into chunks that are
+ * multiplied by ruy one by one and summed up in int64.
+ *
+ * @param bias    int64 bias with rows elements, can be nullptr
+ * @param scratch int32 accumulator buffer, resized as needed and reusable across calls
+ */
+inline void Gemm16x8(const Gemm16x8Params &params, const int8_t *lhs_data, int rows, int depth,
+                     const int16_t *rhs_data, int cols, const int64_t *bias_data,
+                     int16_t *dst_data, std::vector<int32_t> &scratch, ruy::Context *ruy_context)
+{
+  const int32_t act_min = params.quantized_activation_min;
+  const int32_t act_max = params.quantized_activation_max;
+  auto requantize = [&](int64_t acc, int row) {
+    if (bias_data)
+      acc += bias_data[row];
+    int32_t scaled =
+      MultiplyByQuantizedMultiplier(acc, params.output_multiplier[row], params.output_shift[row]);
+    scaled = std::max(scaled, act_min);
+    scaled = std::min(scaled, act_max);
+    return static_cast<int16_t>(scaled);
+  };
+
+  if (ruy_context == nullptr)
+  {
+    for (int c = 0; c < cols; ++c)
+    {
+      const int16_t *rhs_col = rhs_data + c * depth;
+      for (int r = 0; r < rows; ++r)
+      {
+        const int8_t *lhs_row = lhs_data + r * depth;
+        int64_t acc = 0;
+        for (int d = 0; d < depth; ++d)
+          acc += static_cast<int32_t>(lhs_row[d]) * static_cast<int32_t>(rhs_col[d]);
+        dst_data[c * rows + r] = requantize(acc, r);
+      }
+    }
+    return;
+  }
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = rows;
+  lhs_params.cache_policy = CachePolicy::kAlwaysCache;
+
+  MatrixParams<int16_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.cols = cols;
+
+  MatrixParams<int32_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = rows;
+  dst_params.cols = cols;
+
+  const size_t dst_size = static_cast<size_t>(rows) * cols;
+  scratch.resize(dst_size);
+
+  // ruy takes int32 bias only, so int64 bias is added while requantizing
+  GemmParams<int32_t, int32_t> gemm_params;
+  ruy::MulParams<int32_t, int32_t> ruy_mul_params;
+  ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+
+  ruy::Matrix<int32_t> ruy_dst;
+  ruy_support::MakeRuyMatrix(dst_params, scratch.data(), &ruy_dst);
+
+  // Sums of chunks, used only when the depth is split
+  const bool split = depth > kMaxGemm16x8Int32Depth;
+  std::vector<int64_t> acc64(split ? dst_size : 0, 0);
+
+  for (int d0 = 0; d0 < depth; d0 += kMaxGemm16x8Int32Depth)
+  {
+    const int chunk = std::min(kMaxGemm16x8Int32Depth, depth - d0);
+    lhs_params.cols = chunk;
+    rhs_params.rows = chunk;
+
+    // Chunks are views of lhs and rhs, whose rows and columns are still depth apart
+    ruy::Matrix<int8_t> ruy_lhs;
+    ruy::Matrix<int16_t> ruy_rhs;
+    ruy_support::MakeRuyMatrix(lhs_params, lhs_data + d0, &ruy_lhs, true);
+    ruy_lhs.mutable_layout()->set_stride(depth);
+    ruy_support::MakeRuyMatrix(rhs_params, rhs_data + d0, &ruy_rhs);
+    ruy_rhs.mutable_layout()->set_stride(depth);
+
+    ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+
+    if (split)
+    {
+      for (size_t i = 0; i < dst_size; ++i)
+        acc64[i] += scratch[i];
+    }
+  }
+
+  for (int c = 0; c < cols; ++c)
+  {
+    for (int r = 0; r < rows; ++r)
+    {
+      const size_t i = static_cast<size_t>(c) * rows + r;
+      dst_data[i] = requantize(split ? acc64[i] : scratch[i], r);
+    }
+  }
+}
+
+} // namespace optimized_integer_ops
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_GEMM_16X8_H__
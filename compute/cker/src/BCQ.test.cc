@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BCQFullyConnected.h>
+#include <cker/operation/BCQGather.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+// BCQ weights with random planes and their dequantized values
+struct BCQWeights
+{
+  BCQWeights(const std::vector<int32_t> &clusters_, int32_t hidden_) : clusters{clusters_}
+  {
+    hidden = hidden_;
+    row_planes = bcq::BuildRowPlanes(clusters.data(), clusters.size() / 2);
+    rows = row_planes.rows();
+
+    int32_t num_planes = 0;
+    for (int32_t r = 0; r < rows; ++r)
+      num_planes += row_planes.qbits[r];
+
+    const int32_t words = bcq::WordsPerPlane(hidden);
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> scale_dist(0.01f, 1.f);
+    std::uniform_int_distribution<int32_t> bits_dist(std::numeric_limits<int32_t>::min(),
+                                                     std::numeric_limits<int32_t>::max());
+    for (int32_t p = 0; p < num_planes; ++p)
+      scales.push_back(scale_dist(gen));
+    for (int32_t i = 0; i < num_planes * words; ++i)
+      binary.push_back(bits_dist(gen));
+
+    dequantized.resize(rows * hidden);
+    for (int32_t r = 0; r < rows; ++r)
+    {
+      for (int32_t j = 0; j < hidden; ++j)
+      {
+        float value = 0.f;
+        for (int32_t b = 0; b < row_planes.qbits[r]; ++b)
+        {
+          const int32_t p = row_planes.first_plane[r] + b * row_planes.plane_stride[r];
+          const bool bit = (static_cast<uint32_t>(binary[p * words + j / 32]) >> (j % 32)) & 1u;
+          value += bit ? scales[p] : -scales[p];
+        }
+        dequantized[r * hidden + j] = value;
+      }
+    }
+  }
+
+  std::vector<int32_t> clusters;
+  int32_t hidden;
+  int32_t rows;
+  bcq::RowPlanes row_planes;
+  std::vector<float> scales;
+  std::vector<int32_t> binary;
+  std::vector<float> dequantized;
+};
+
+void verifyFullyConnected(const BCQWeights &w, int32_t batch)
+{
+  std::vector<float> input(w.hidden * batch);
+  std::vector<float> bias(w.rows);
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  for (auto &v : input)
+    v = dist(gen);
+  for (auto &v : bias)
+    v = dist(gen);
+
+  BCQFullyConnectedParams params;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  std::vector<float> output(w.rows * batch);
+  std::vector<float> scratch;
+  BCQFullyConnected(params, Shape{w.hidden, batch}, input.data(), w.scales.data(), w.binary.data(),
+                    bias.data(), w.row_planes, Shape{w.rows, batch}, output.data(), scratch,
+                    nullptr);
+
+  for (int32_t r = 0; r < w.rows; ++r)
+  {
+    for (int32_t n = 0; n < batch; ++n)
+    {
+      float expected = bias[r];
+      for (int32_t j = 0; j < w.hidden; ++j)
+        expected += w.dequantized[r * w.hidden + j] * input[j * batch + n];
+      ASSERT_NEAR(output[r * batch + n], expected, 1e-3f * w.hidden);
+    }
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, BCQFullyConnected_direct)
+{
+  // 3 planes in total, computed without lookup tables
+  BCQWeights w({1, 1, 2, 1}, 40);
+  verifyFullyConnected(w, 3);
+}
+
+TEST(CKer_Operation, BCQFullyConnected_lookup)
+{
+  // 3 * 16 + 2 * 20 planes in total, computed with lookup tables
+  BCQWeights w({3, 16, 2, 20}, 100);
+  verifyFullyConnected(w, 2);
+}
+
+TEST(CKer_Operation, BCQFullyConnected_activation)
+{
+  BCQWeights w({2, 4}, 32);
+  std::vector<float> input(32, 1.f);
+  std::vector<float> output(4);
+  std::vector<float> scratch;
+
+  BCQFullyConnectedParams params;
+  params.float_activation_min = 0.f;
+  params.float_activation_max = 6.f;
+  BCQFullyConnected(params, Shape{32, 1}, input.data(), w.scales.data(), w.binary.data(), nullptr,
+                    w.row_planes, Shape{4, 1}, output.data(), scratch, nullptr);
+
+  for (auto v : output)
+  {
+    ASSERT_GE(v, 0.f);
+    ASSERT_LE(v, 6.f);
+  }
+}
+
+TEST(CKer_Operation, BCQGather)
+{
+  BCQWeights w({2, 3, 1, 2}, 37);
+  const std::vector<int32_t> coords{4, 0, 2};
+
+  // axis 0 : gather rows
+  {
+    BCQGatherParams params{0};
+    std::vector<float> output(coords.size() * w.hidden);
+    BCQGather(params, w.scales.data(), w.binary.data(), w.row_planes, w.hidden,
+              Shape{static_cast<int>(coords.size())}, coords.data(),
+              Shape{static_cast<int>(coords.size()), w.hidden}, output.data(), nullptr);
+    for (size_t i = 0; i < coords.size(); ++i)
+      for (int32_t j = 0; j < w.hidden; ++j)
+        ASSERT_FLOAT_EQ(output[i * w.hidden + j], w.dequantized[coords[i] * w.hidden + j]);
+  }
+
+  // axis 1 : gather columns
+  {
+    BCQGatherParams params{1};
+    std::vector<float> output(w.rows * coords.size());
+    BCQGather(params, w.scales.data(), w.binary.data(), w.row_planes, w.hidden,
+              Shape{static_cast<int>(coords.size())}, coords.data(),
+              Shape{w.rows, static_cast<int>(coords.size())}, output.data(), nullptr);
+    for (int32_t r = 0; r < w.rows; ++r)
+      for (size_t i = 0; i < coords.size(); ++i)
+        ASSERT_NEAR(output[r * coords.size() + i], w.dequantized[r * w.hidden + coords[i]], 1e-6f);
+  }
+}
+
+TEST(CKer_Operation, neg_BCQGather)
+{
+  BCQWeights w({1, 2}, 32);
+  const std::vector<int32_t> coords{2};
+  std::vector<float> output(w.hidden);
+
+  BCQGatherParams params{0};
+  EXPECT_ANY_THROW(BCQGather(params, w.scales.data(), w.binary.data(), w.row_planes, w.hidden,
+                             Shape{1}, coords.data(), Shape{1, w.hidden}, output.data(), nullptr));
+}
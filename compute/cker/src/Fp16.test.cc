@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/Fp16.h>
+#include <cker/operation/optimized/GemmF16Weights.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+std::vector<float> randomFloats(int size, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  std::vector<float> v(size);
+  for (auto &e : v)
+    e = dist(gen);
+  return v;
+}
+
+// Results with weights rounded to fp16 beforehand
+void verifyGemmF16Weights(int rows, int depth, int cols, int threads)
+{
+  const auto lhs = randomFloats(rows * depth, 1);
+  const auto rhs = randomFloats(depth * cols, 2);
+  const auto bias = randomFloats(rows, 3);
+  std::vector<uint16_t> lhs_f16(lhs.size());
+  FloatToHalf(lhs.data(), lhs_f16.data(), lhs.size());
+
+  const float act_min = -1.5f;
+  const float act_max = 1.5f;
+  std::vector<float> expected(rows * cols);
+  for (int c = 0; c < cols; ++c)
+  {
+    for (int r = 0; r < rows; ++r)
+    {
+      float acc = bias[r];
+      for (int d = 0; d < depth; ++d)
+        acc += HalfToFloat(lhs_f16[r * depth + d]) * rhs[c * depth + d];
+      expected[c * rows + r] = std::min(std::max(acc, act_min), act_max);
+    }
+  }
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(threads);
+  std::vector<float> lhs_tile;
+  std::vector<float> dst_tile;
+  std::vector<float> output(rows * cols);
+  optimized::GemmF16Weights(lhs_f16.data(), rows, depth, rhs.data(), cols, bias.data(), act_min,
+                            act_max, output.data(), lhs_tile, dst_tile, &ruy_context);
+
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-4f);
+}
+
+} // namespace
+
+TEST(CKer_Operation, Fp16_RoundTrip)
+{
+  // Exactly representable values
+  for (float f : {0.f, -0.f, 1.f, -2.5f, 65504.f, 0.000061035156f, 0.000000059604645f})
+    EXPECT_EQ(HalfToFloat(FloatToHalf(f)), f);
+
+  // Ties round to even
+  EXPECT_EQ(FloatToHalf(1.f + 1.f / 2048), FloatToHalf(1.f));
+  EXPECT_EQ(FloatToHalf(1.f + 3.f / 2048), FloatToHalf(1.f + 2.f / 1024));
+
+  EXPECT_TRUE(std::isinf(HalfToFloat(FloatToHalf(70000.f))));
+  EXPECT_TRUE(std::isnan(HalfToFloat(FloatToHalf(std::numeric_limits<float>::quiet_NaN()))));
+  EXPECT_EQ(HalfToFloat(FloatToHalf(1e-9f)), 0.f);
+
+  // Array version agrees with the scalar one
+  const auto values = randomFloats(37, 4);
+  std::vector<uint16_t> halfs(values.size());
+  std::vector<float> widened(values.size());
+  FloatToHalf(values.data(), halfs.data(), values.size());
+  HalfToFloat(halfs.data(), widened.data(), halfs.size());
+  for (size_t i = 0; i < values.size(); ++i)
+  {
+    EXPECT_EQ(widened[i], HalfToFloat(halfs[i]));
+    EXPECT_NEAR(widened[i], values[i], 1e-3f);
+  }
+}
+
+TEST(CKer_Operation, GemmF16Weights_gemv)
+{
+  verifyGemmF16Weights(67, 33, 1, 1);
+  verifyGemmF16Weights(67, 33, 3, 4);
+}
+
+TEST(CKer_Operation, GemmF16Weights_tiled)
+{
+  // Depth large enough to split rows into several tiles
+  verifyGemmF16Weights(40, 8192, 6, 2);
+  verifyGemmF16Weights(5, 17, 9, 1);
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Conv.h>
+#include <cker/operation/DepthwiseConv.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+template <typename T> std::vector<T> randomVector(int size, int min, int max, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(min, max);
+  std::vector<T> v(size);
+  for (auto &e : v)
+    e = static_cast<T>(dist(gen));
+  return v;
+}
+
+struct HybridInput
+{
+  HybridInput(const Shape &shape) : data(randomVector<int8_t>(shape.FlatSize(), -128, 127, 1))
+  {
+    const int batches = shape.Dims(0);
+    scaling_factors.resize(batches);
+    offsets.resize(batches);
+    for (int b = 0; b < batches; ++b)
+    {
+      scaling_factors[b] = 0.01f * (b + 1);
+      offsets[b] = 5 - 20 * b;
+    }
+  }
+
+  std::vector<int8_t> data;
+  std::vector<float> scaling_factors;
+  std::vector<int32_t> offsets;
+};
+
+void verifyHybridConv(const ConvParams &params, const Shape &input_shape,
+                      const Shape &filter_shape, const Shape &output_shape)
+{
+  HybridInput input(input_shape);
+  const auto filter = randomVector<int8_t>(filter_shape.FlatSize(), -127, 127, 2);
+  const int output_depth = filter_shape.Dims(0);
+  const std::vector<float> bias(output_depth, 0.5f);
+  std::vector<float> scales(output_depth);
+  for (int o = 0; o < output_depth; ++o)
+    scales[o] = 0.001f * (o + 1);
+
+  std::vector<float> expected(output_shape.FlatSize());
+  reference::HybridConvPerChannel(params, input.scaling_factors.data(), input_shape,
+                                  input.data.data(), filter_shape, filter.data(),
+                                  Shape{output_depth}, bias.data(), output_shape, expected.data(),
+                                  scales.data(), input.offsets.data());
+
+  std::vector<int32_t> row_sums;
+  std::vector<int8_t> im2col;
+  std::vector<int32_t> accum;
+  optimized_integer_ops::ComputeHybridConvRowSums(filter_shape, filter.data(), row_sums);
+
+  ruy::Context ruy_context;
+  std::vector<float> output(output_shape.FlatSize());
+  optimized_integer_ops::HybridConvPerChannel(
+    params, input.scaling_factors.data(), input_shape, input.data.data(), filter_shape,
+    filter.data(), Shape{output_depth}, bias.data(), output_shape, output.data(), scales.data(),
+    input.offsets.data(), row_sums.data(), im2col, accum, &ruy_context);
+
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-3f);
+}
+
+ConvParams makeConvParams(int stride, int dilation, int pad)
+{
+  ConvParams params;
+  params.padding_type = PaddingType::kSame;
+  params.padding_values.width = pad;
+  params.padding_values.height = pad;
+  params.stride_width = stride;
+  params.stride_height = stride;
+  params.dilation_width_factor = dilation;
+  params.dilation_height_factor = dilation;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+  return params;
+}
+
+} // namespace
+
+TEST(CKer_Operation, HybridConv_1x1)
+{
+  verifyHybridConv(makeConvParams(1, 1, 0), Shape{2, 3, 3, 8}, Shape{4, 1, 1, 8},
+                   Shape{2, 3, 3, 4});
+}
+
+TEST(CKer_Operation, HybridConv_im2col)
+{
+  // 3x3 filter, stride 2 and SAME padding filled with the input offset of each batch
+  verifyHybridConv(makeConvParams(2, 1, 1), Shape{2, 5, 5, 3}, Shape{6, 3, 3, 3},
+                   Shape{2, 3, 3, 6});
+}
+
+TEST(CKer_Operation, HybridConv_dilated)
+{
+  verifyHybridConv(makeConvParams(1, 2, 2), Shape{2, 5, 5, 3}, Shape{4, 3, 3, 3},
+                   Shape{2, 5, 5, 4});
+}
+
+TEST(CKer_Operation, HybridDepthwiseConv)
+{
+  const Shape input_shape{2, 6, 6, 4};
+  const Shape filter_shape{1, 3, 3, 8};
+  const Shape output_shape{2, 6, 6, 8};
+  HybridInput input(input_shape);
+  const auto filter = randomVector<int8_t>(filter_shape.FlatSize(), -127, 127, 3);
+  const std::vector<float> bias(8, -0.25f);
+  std::vector<float> scales(8);
+  for (int o = 0; o < 8; ++o)
+    scales[o] = 0.002f * (o + 1);
+
+  DepthwiseConvParams params;
+  params.padding_values.width = 1;
+  params.padding_values.height = 1;
+  params.depth_multiplier = 2;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.float_activation_min = 0.f;
+  params.float_activation_max = 6.f;
+
+  std::vector<float> expected(output_shape.FlatSize());
+  reference_integer_ops::DepthwiseConvHybridPerChannel(
+    params, input.scaling_factors.data(), input_shape, input.data.data(), filter_shape,
+    filter.data(), Shape{8}, bias.data(), output_shape, expected.data(), scales.data(),
+    input.offsets.data());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(2);
+  std::vector<float> output(output_shape.FlatSize());
+  optimized_integer_ops::DepthwiseConvHybridPerChannel(
+    params, input.scaling_factors.data(), input_shape, input.data.data(), filter_shape,
+    filter.data(), Shape{8}, bias.data(), output_shape, output.data(), scales.data(),
+    input.offsets.data(), &ruy_context);
+
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-4f);
+}
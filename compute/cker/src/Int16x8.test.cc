@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/optimized/integer_ops/Gemm16x8.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+// Multiplier and shift of 0.5
+constexpr int32_t kHalfMultiplier = 1 << 30;
+constexpr int kHalfShift = 0;
+
+} // namespace
+
+TEST(CKer_Operation, Gemm16x8)
+{
+  // lhs 2x3 row-major, rhs 3x2 col-major
+  const std::vector<int8_t> lhs{1, 2, 3, -1, -2, -3};
+  const std::vector<int16_t> rhs{1000, 2000, 3000, -4000, 100, 20000};
+  const std::vector<int64_t> bias{10, -10};
+  const std::vector<int32_t> multiplier(2, kHalfMultiplier);
+  const std::vector<int> shift(2, kHalfShift);
+
+  optimized_integer_ops::Gemm16x8Params params;
+  params.output_multiplier = multiplier.data();
+  params.output_shift = shift.data();
+  params.quantized_activation_min = std::numeric_limits<int16_t>::min();
+  params.quantized_activation_max = std::numeric_limits<int16_t>::max();
+
+  std::vector<int16_t> dst(4);
+  std::vector<int32_t> scratch;
+  optimized_integer_ops::Gemm16x8(params, lhs.data(), 2, 3, rhs.data(), 2, bias.data(), dst.data(),
+                                  scratch, nullptr);
+
+  // col 0 : (14000 + 10) / 2, (-14000 - 10) / 2
+  // col 1 : (56200 + 10) / 2, (-56200 - 10) / 2
+  EXPECT_EQ(dst[0], 7005);
+  EXPECT_EQ(dst[1], -7005);
+  EXPECT_EQ(dst[2], 28105);
+  EXPECT_EQ(dst[3], -28105);
+}
+
+TEST(CKer_Operation, Gemm16x8_deep)
+{
+  // Deeper than int32 accumulators can hold, so ruy runs on chunks of the depth
+  const int rows = 3;
+  const int depth = 2 * optimized_integer_ops::kMaxGemm16x8Int32Depth + 100;
+  const int cols = 2;
+
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> lhs_dist(-128, 127);
+  std::uniform_int_distribution<int> rhs_dist(-32768, 32767);
+  std::vector<int8_t> lhs(rows * depth);
+  std::vector<int16_t> rhs(depth * cols);
+  for (auto &v : lhs)
+    v = static_cast<int8_t>(lhs_dist(gen));
+  for (auto &v : rhs)
+    v = static_cast<int16_t>(rhs_dist(gen));
+  // The worst case of row 0 x col 0 overflows int32 : 1122 * 128 * 32768 > 2^31
+  std::fill(lhs.begin(), lhs.begin() + depth, -128);
+  std::fill(rhs.begin(), rhs.begin() + depth, -32768);
+
+  // Multiplier of 0.5 * 2^-20 to bring results into int16
+  const std::vector<int32_t> multiplier(rows, kHalfMultiplier);
+  const std::vector<int> shift(rows, -20);
+  const std::vector<int64_t> bias{1, -2, 3};
+
+  optimized_integer_ops::Gemm16x8Params params;
+  params.output_multiplier = multiplier.data();
+  params.output_shift = shift.data();
+  params.quantized_activation_min = std::numeric_limits<int16_t>::min();
+  params.quantized_activation_max = std::numeric_limits<int16_t>::max();
+
+  std::vector<int32_t> scratch;
+  std::vector<int16_t> expected(rows * cols);
+  optimized_integer_ops::Gemm16x8(params, lhs.data(), rows, depth, rhs.data(), cols, bias.data(),
+                                  expected.data(), scratch, nullptr);
+  // (1122 * 2^22 + 1) * 2^-21 rounds to 2244
+  EXPECT_EQ(expected[0], 2244);
+
+  ruy::Context ruy_context;
+  std::vector<int16_t> output(rows * cols);
+  optimized_integer_ops::Gemm16x8(params, lhs.data(), rows, depth, rhs.data(), cols, bias.data(),
+                                  output.data(), scratch, &ruy_context);
+  EXPECT_EQ(output, expected);
+}
+
+TEST(CKer_Operation, DepthwiseConvInt16)
+{
+  // 1x2x2x1 input, 1x2x2x2 filter with depth multiplier 2, VALID padding
+  const std::vector<int16_t> input{100, 200, 300, 400};
+  const std::vector<int8_t> filter{1, -1, 1, -1, 1, -1, 1, -1};
+  const std::vector<int64_t> bias{0, 0};
+  const std::vector<int32_t> multiplier(2, kHalfMultiplier);
+  const std::vector<int32_t> shift(2, kHalfShift);
+
+  DepthwiseConvParams params;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.padding_values.width = 0;
+  params.padding_values.height = 0;
+  params.depth_multiplier = 2;
+  params.quantized_activation_min = std::numeric_limits<int16_t>::min();
+  params.quantized_activation_max = std::numeric_limits<int16_t>::max();
+
+  std::vector<int16_t> output(2);
+  reference_integer_ops::DepthwiseConvPerChannel(
+    params, multiplier.data(), shift.data(), Shape{1, 2, 2, 1}, input.data(), Shape{1, 2, 2, 2},
+    filter.data(), Shape{2}, bias.data(), Shape{1, 1, 1, 2}, output.data());
+
+  EXPECT_EQ(output[0], 500);
+  EXPECT_EQ(output[1], -500);
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/LSTM.h>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+std::vector<float> randomFloats(std::mt19937 &gen, size_t size)
+{
+  std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+  std::vector<float> v(size);
+  for (auto &e : v)
+    e = dist(gen);
+  return v;
+}
+
+struct Gate
+{
+  std::vector<float> input_weights;
+  std::vector<float> recurrent_weights;
+  std::vector<float> peephole_weights;
+  std::vector<float> layer_norm_coefficients;
+  std::vector<float> bias;
+};
+
+const float *ptr(const std::vector<float> &v) { return v.empty() ? nullptr : v.data(); }
+
+// Runs a time-major LSTM with input projections and compares it with LstmStepFloat
+void verifyInputProjection(bool use_cifg, bool use_peephole, bool use_layer_norm)
+{
+  const int max_time = 5, n_batch = 3, n_input = 7, n_cell = 40, n_output = 40;
+  std::mt19937 gen(3);
+
+  Gate gates[4];
+  for (int g = 0; g < 4; ++g)
+  {
+    if (use_cifg && g == 0)
+      continue;
+    gates[g].input_weights = randomFloats(gen, n_cell * n_input);
+    gates[g].recurrent_weights = randomFloats(gen, n_cell * n_output);
+    // The cell gate has no peephole
+    if (use_peephole && g != 2)
+      gates[g].peephole_weights = randomFloats(gen, n_cell);
+    if (use_layer_norm)
+      gates[g].layer_norm_coefficients = randomFloats(gen, n_cell);
+    gates[g].bias = randomFloats(gen, n_cell);
+  }
+  const auto input = randomFloats(gen, max_time * n_batch * n_input);
+
+  LSTMParams params;
+  params.activation = FusedActivationFunctionType::kTanh;
+  params.cell_clip = 0.f;
+  params.proj_clip = 0.f;
+
+  const int state_size = n_batch * n_cell;
+  std::vector<float> scratch(state_size * 4);
+  auto scratch_ptr = [&](int g) { return scratch.data() + g * state_size; };
+
+  std::vector<float> expected(max_time * n_batch * n_output);
+  {
+    std::vector<float> output_state(n_batch * n_output), cell_state(state_size);
+    for (int t = 0; t < max_time; ++t)
+    {
+      LstmStepFloat(input.data() + t * n_batch * n_input, ptr(gates[0].input_weights),
+                    ptr(gates[1].input_weights), ptr(gates[2].input_weights),
+                    ptr(gates[3].input_weights), nullptr, nullptr, nullptr, nullptr, nullptr,
+                    ptr(gates[0].recurrent_weights), ptr(gates[1].recurrent_weights),
+                    ptr(gates[2].recurrent_weights), ptr(gates[3].recurrent_weights),
+                    ptr(gates[0].peephole_weights), ptr(gates[1].peephole_weights),
+                    ptr(gates[3].peephole_weights), ptr(gates[0].layer_norm_coefficients),
+                    ptr(gates[1].layer_norm_coefficients), ptr(gates[2].layer_norm_coefficients),
+                    ptr(gates[3].layer_norm_coefficients), ptr(gates[0].bias), ptr(gates[1].bias),
+                    ptr(gates[2].bias), ptr(gates[3].bias), nullptr, nullptr, &params, n_batch,
+                    n_cell, n_input, 0, n_output, n_output, output_state.data(),
+                    cell_state.data(), scratch_ptr(0), scratch_ptr(1), scratch_ptr(2),
+                    scratch_ptr(3), expected.data() + t * n_batch * n_output);
+    }
+  }
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  std::vector<float> output(expected.size());
+  {
+    const int n_rows = max_time * n_batch;
+    std::vector<float> projections[4];
+    for (int g = 0; g < 4; ++g)
+    {
+      if (use_cifg && g == 0)
+        continue;
+      projections[g].resize(n_rows * n_cell);
+      LstmInputProjectionFloat(input.data(), n_rows, n_input, gates[g].input_weights.data(),
+                               n_cell, use_layer_norm ? nullptr : gates[g].bias.data(),
+                               projections[g].data(), &ruy_context);
+    }
+    auto projection = [&](int g, int t) {
+      return projections[g].empty() ? nullptr : projections[g].data() + t * state_size;
+    };
+
+    std::vector<float> output_state(n_batch * n_output), cell_state(state_size);
+    for (int t = 0; t < max_time; ++t)
+    {
+      LstmStepFloat(projection(0, t), projection(1, t), projection(2, t), projection(3, t),
+                    ptr(gates[0].recurrent_weights), ptr(gates[1].recurrent_weights),
+                    ptr(gates[2].recurrent_weights), ptr(gates[3].recurrent_weights),
+                    ptr(gates[0].peephole_weights), ptr(gates[1].peephole_weights),
+                    ptr(gates[3].peephole_weights), ptr(gates[0].layer_norm_coefficients),
+                    ptr(gates[1].layer_norm_coefficients), ptr(gates[2].layer_norm_coefficients),
+                    ptr(gates[3].layer_norm_coefficients), ptr(gates[0].bias), ptr(gates[1].bias),
+                    ptr(gates[2].bias), ptr(gates[3].bias), nullptr, nullptr, &params, n_batch,
+                    n_cell, n_output, n_output, output_state.data(), cell_state.data(),
+                    scratch_ptr(0), scratch_ptr(1), scratch_ptr(2), scratch_ptr(3),
+                    output.data() + t * n_batch * n_output, &ruy_context);
+    }
+  }
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(output[i], expected[i], 1e-5f) << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, LSTMInputProjection)
+{
+  verifyInputProjection(/*use_cifg=*/false, /*use_peephole=*/false, /*use_layer_norm=*/false);
+  verifyInputProjection(/*use_cifg=*/true, /*use_peephole=*/false, /*use_layer_norm=*/false);
+  verifyInputProjection(/*use_cifg=*/false, /*use_peephole=*/true, /*use_layer_norm=*/false);
+  verifyInputProjection(/*use_cifg=*/false, /*use_peephole=*/false, /*use_layer_norm=*/true);
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/CpuBackendThreadpool.h>
+#include <cker/operation/Concatenation.h>
+#include <cker/operation/Gather.h>
+#include <cker/operation/Pad.h>
+#include <cker/operation/ResizeBilinear.h>
+#include <cker/operation/SoftMax.h>
+#include <cker/operation/Transpose.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <mutex>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+std::vector<float> randomFloats(size_t size)
+{
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<float> dist(-10.f, 10.f);
+  std::vector<float> v(size);
+  for (auto &e : v)
+    e = dist(gen);
+  return v;
+}
+
+std::vector<std::pair<int, int>> runRanges(int size, int64_t item_cost, ruy::Context *ruy_context)
+{
+  std::mutex mutex;
+  std::vector<std::pair<int, int>> ranges;
+  cpu_backend_threadpool::ParallelFor(size, item_cost, ruy_context, [&](int begin, int end) {
+    std::lock_guard<std::mutex> lock{mutex};
+    ranges.emplace_back(begin, end);
+  });
+  std::sort(ranges.begin(), ranges.end());
+  return ranges;
+}
+
+} // namespace
+
+TEST(CKer_Operation, ParallelFor)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  // Ranges cover all items once
+  const int size = 100000;
+  const auto ranges = runRanges(size, 1, &ruy_context);
+  ASSERT_EQ(ranges.size(), 4);
+  int next = 0;
+  for (const auto &range : ranges)
+  {
+    ASSERT_EQ(range.first, next);
+    ASSERT_LT(range.first, range.second);
+    next = range.second;
+  }
+  ASSERT_EQ(next, size);
+
+  // Small work runs at once
+  ASSERT_EQ(runRanges(100, 1, &ruy_context), (std::vector<std::pair<int, int>>{{0, 100}}));
+  // Costly items are split even if they are few
+  ASSERT_EQ(runRanges(100, 1000, &ruy_context).size(), 4);
+  // Without a context
+  ASSERT_EQ(runRanges(size, 1, nullptr), (std::vector<std::pair<int, int>>{{0, size}}));
+  // Nothing to run
+  ASSERT_TRUE(runRanges(0, 1, &ruy_context).empty());
+}
+
+TEST(CKer_Operation, ParallelFor_kernels)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  // Results must be the same as the ones on a single thread
+  {
+    const int d0 = 301, d1 = 257;
+    const auto input = randomFloats(d0 * d1);
+    std::vector<float> expected(input.size()), output(input.size());
+    TransposeParams params;
+    params.perm_count = 2;
+    params.perm[0] = 1;
+    params.perm[1] = 0;
+    Transpose(params, Shape{d0, d1}, input.data(), Shape{d1, d0}, expected.data());
+    Transpose(params, Shape{d0, d1}, input.data(), Shape{d1, d0}, output.data(), &ruy_context);
+    ASSERT_EQ(output, expected);
+  }
+
+  {
+    const Shape input_shape{2, 60, 70, 8};
+    const Shape output_shape{3, 63, 75, 9};
+    const int32_t padding[] = {1, 0, 2, 1, 3, 2, 0, 1};
+    const float constant = 0.5f;
+    const auto input = randomFloats(input_shape.FlatSize());
+    std::vector<float> expected(output_shape.FlatSize()), output(output_shape.FlatSize());
+    Pad(padding, 4, input_shape, input.data(), output_shape, expected.data(), &constant);
+    Pad(padding, 4, input_shape, input.data(), output_shape, output.data(), &constant,
+        &ruy_context);
+    ASSERT_EQ(output, expected);
+  }
+
+  {
+    const Shape shape0{4, 30, 100}, shape1{4, 50, 100};
+    const auto input0 = randomFloats(shape0.FlatSize());
+    const auto input1 = randomFloats(shape1.FlatSize());
+    const Shape *shapes[] = {&shape0, &shape1};
+    const float *inputs[] = {input0.data(), input1.data()};
+    const Shape output_shape{4, 80, 100};
+    std::vector<float> expected(output_shape.FlatSize()), output(output_shape.FlatSize());
+    ConcatenationParams params;
+    params.axis = 1;
+    params.inputs_count = 2;
+    Concatenation(params, shapes, inputs, output_shape, expected.data());
+    Concatenation(params, shapes, inputs, output_shape, output.data(), &ruy_context);
+    ASSERT_EQ(output, expected);
+  }
+
+  {
+    const Shape input_shape{6, 50, 64};
+    const std::vector<int32_t> coords{5, 0, 49, 7, 7};
+    const Shape output_shape{6, 5, 64};
+    const auto input = randomFloats(input_shape.FlatSize());
+    std::vector<float> expected(output_shape.FlatSize()), output(output_shape.FlatSize());
+    GatherParams params;
+    params.axis = 1;
+    Gather(params, input_shape, input.data(), Shape{5}, coords.data(), output_shape,
+           expected.data());
+    Gather(params, input_shape, input.data(), Shape{5}, coords.data(), output_shape, output.data(),
+           &ruy_context);
+    ASSERT_EQ(output, expected);
+  }
+
+  {
+    const Shape shape{300, 100};
+    const auto input = randomFloats(shape.FlatSize());
+    std::vector<float> expected(shape.FlatSize()), output(shape.FlatSize());
+    SoftmaxParams params;
+    params.beta = 1.f;
+    Softmax(params, shape, input.data(), shape, expected.data());
+    Softmax(params, shape, input.data(), shape, output.data(), &ruy_context);
+    ASSERT_EQ(output, expected);
+  }
+
+  {
+    const Shape input_shape{2, 20, 30, 16};
+    const Shape output_shape{2, 45, 61, 16};
+    const auto input = randomFloats(input_shape.FlatSize());
+    std::vector<float> expected(output_shape.FlatSize()), output(output_shape.FlatSize());
+    ResizeBilinearParams params;
+    params.output_height = 45;
+    params.output_width = 61;
+    params.align_corners = false;
+    params.half_pixel_centers = true;
+    ResizeBilinear(params, input_shape, input.data(), output_shape, expected.data());
+    ResizeBilinear(params, input_shape, input.data(), output_shape, output.data(), &ruy_context);
+    ASSERT_EQ(output, expected);
+  }
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/TopKV2.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+// Reference result by sorting each row fully
+template <typename T>
+void TopKV2BySort(const std::vector<T> &input, int32_t rows, int32_t row_size, int32_t k,
+                  std::vector<T> &values, std::vector<int32_t> &indices)
+{
+  values.resize(rows * k);
+  indices.resize(rows * k);
+  std::vector<int32_t> order(row_size);
+  for (int32_t r = 0; r < rows; ++r)
+  {
+    const T *row = input.data() + r * row_size;
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [row](int32_t a, int32_t b) {
+      return (std::isnan(row[a]) && !std::isnan(row[b])) || row[a] > row[b];
+    });
+    for (int32_t i = 0; i < k; ++i)
+    {
+      values[r * k + i] = row[order[i]];
+      indices[r * k + i] = order[i];
+    }
+  }
+}
+
+template <typename T>
+void verifyTopKV2(const std::vector<T> &input, int32_t rows, int32_t row_size, int32_t k)
+{
+  std::vector<T> values(rows * k);
+  std::vector<int32_t> indices(rows * k);
+  TopKV2(Shape{rows, row_size}, input.data(), k, Shape{rows, k}, values.data(), indices.data(),
+         nullptr);
+
+  std::vector<T> expected_values;
+  std::vector<int32_t> expected_indices;
+  TopKV2BySort(input, rows, row_size, k, expected_values, expected_indices);
+
+  ASSERT_EQ(values, expected_values);
+  ASSERT_EQ(indices, expected_indices);
+}
+
+std::vector<float> randomFloats(size_t size)
+{
+  std::mt19937 gen(11);
+  std::uniform_real_distribution<float> dist(-100.f, 100.f);
+  std::vector<float> v(size);
+  for (auto &e : v)
+    e = dist(gen);
+  return v;
+}
+
+} // namespace
+
+TEST(CKer_Operation, TopKV2)
+{
+  // 1-D input
+  {
+    std::vector<float> input{3, 1, 4, 1, 5, 9, 2, 6};
+    std::vector<float> values(3);
+    std::vector<int32_t> indices(3);
+    TopKV2(Shape{8}, input.data(), 3, Shape{3}, values.data(), indices.data(), nullptr);
+    ASSERT_EQ(values, (std::vector<float>{9, 6, 5}));
+    ASSERT_EQ(indices, (std::vector<int32_t>{5, 7, 4}));
+  }
+
+  // heap selection : k << row size
+  verifyTopKV2(randomFloats(4 * 1000), 4, 1000, 5);
+  // introselect : k is comparable to row size
+  verifyTopKV2(randomFloats(3 * 100), 3, 100, 40);
+  // k == row size
+  verifyTopKV2(randomFloats(2 * 10), 2, 10, 10);
+}
+
+TEST(CKer_Operation, TopKV2_ties)
+{
+  // Equal values are ordered by their indices for both selection strategies
+  std::vector<int32_t> input(2 * 256);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<int32_t>(i % 7);
+  verifyTopKV2(input, 2, 256, 4);
+  verifyTopKV2(input, 2, 256, 100);
+}
+
+TEST(CKer_Operation, TopKV2_int8)
+{
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<int> dist(-128, 127);
+  std::vector<int8_t> input(3 * 500);
+  for (auto &v : input)
+    v = static_cast<int8_t>(dist(gen));
+  verifyTopKV2(input, 3, 500, 8);
+  verifyTopKV2(input, 3, 500, 300);
+}
+
+TEST(CKer_Operation, TopKV2_vs_sort)
+{
+  // Compare against full sort for k << n, a typical vocabulary-sized case
+  const int32_t rows = 8;
+  const int32_t row_size = 32000;
+  const int32_t k = 10;
+  const auto input = randomFloats(rows * row_size);
+
+  std::vector<float> values(rows * k);
+  std::vector<int32_t> indices(rows * k);
+  TopKV2(Shape{rows, row_size}, input.data(), k, Shape{rows, k}, values.data(), indices.data(),
+         nullptr);
+
+  std::vector<float> expected_values;
+  std::vector<int32_t> expected_indices;
+  TopKV2BySort(input, rows, row_size, k, expected_values, expected_indices);
+
+  ASSERT_EQ(values, expected_values);
+  ASSERT_EQ(indices, expected_indices);
+}
+
+TEST(CKer_Operation, TopKV2_nan)
+{
+  // NaN ranks above every number, and NaNs keep the order of their indices
+  auto input = randomFloats(4 * 1000);
+  for (size_t i = 3; i < input.size(); i += 97)
+    input[i] = std::numeric_limits<float>::quiet_NaN();
+
+  // k = 5 takes the heap path, k = 200 takes the introselect path
+  for (int32_t k : {5, 200})
+  {
+    std::vector<float> values(4 * k);
+    std::vector<int32_t> indices(4 * k);
+    TopKV2(Shape{4, 1000}, input.data(), k, Shape{4, k}, values.data(), indices.data(), nullptr);
+
+    std::vector<float> expected_values;
+    std::vector<int32_t> expected_indices;
+    TopKV2BySort(input, 4, 1000, k, expected_values, expected_indices);
+
+    ASSERT_EQ(indices, expected_indices);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+      if (std::isnan(expected_values[i]))
+        ASSERT_TRUE(std::isnan(values[i]));
+      else
+        ASSERT_EQ(values[i], expected_values[i]);
+    }
+  }
+}
+
+TEST(CKer_Operation, neg_TopKV2)
+{
+  std::vector<float> input{1, 2, 3};
+  std::vector<float> values(4);
+  std::vector<int32_t> indices(4);
+
+  // k larger than the last dimension
+  EXPECT_ANY_THROW(
+    TopKV2(Shape{3}, input.data(), 4, Shape{4}, values.data(), indices.data(), nullptr));
+  // negative k
+  EXPECT_ANY_THROW(
+    TopKV2(Shape{3}, input.data(), -1, Shape{0}, values.data(), indices.data(), nullptr));
+}
@@ -552,6 +552,65 @@ NNFW_STATUS nnfw_set_codegen_model_path(nnfw_session *session, const char *path)
  */
 NNFW_STATUS nnfw_codegen(nnfw_session *session, const char *target, NNFW_CODEGEN_PREF pref);
 
+/**
+ * @brief     Set the number of runs to record minmax before auto compilation
+ *
+ * @param[in] session               nnfw_session to set the parameter
+ * @param[in] minmax_records_count  The number of runs to record minmax, 1 by default
+ * @return    @c NNFW_STATUS_NO_ERROR if successful, otherwise return @c NNFW_STATUS_ERROR
+ */
+NNFW_STATUS nnfw_set_odc_param_minmax_records_count(nnfw_session *session,
+                                                     int minmax_records_count);
+
+/**
+ * @brief     Enable auto compilation
+ *
+ * After this function, {@link nnfw_run} records minmax to workspace like
+ * {@link NNFW_RUN_CONFIG_DUMP_MINMAX}. When minmax is recorded as many times as
+ * {@link nnfw_set_odc_param_minmax_records_count}, the model is quantized and compiled on a
+ * background thread while {@link nnfw_run} keeps running the current model.
+ * When the compiled model is ready, it replaces the current model at the start of the next
+ * {@link nnfw_run} or {@link nnfw_run_async}, keeping input and output buffers, layouts and
+ * types. So callers do not need to prepare the session or set input and output again.
+ *
+ * The quantization type and the quantized model path should be set before by
+ * {@link nnfw_set_quantization_type} and {@link nnfw_set_quantized_model_path}, and the
+ * workspace should be set by {@link nnfw_set_workspace}.
+ * Other quantization and code generation APIs return @c NNFW_STATUS_INVALID_STATE while the
+ * model is compiled in background.
+ *
+ * @param[in] session nnfw_session to enable auto compilation, which should be prepared
+ * @param[in] target  Target backend to generate code as {@link nnfw_codegen},
+ *                    or NULL to run the quantized model without code generation
+ * @param[in] pref    @c NNFW_CODEGEN_PREF
+ * @return    @c NNFW_STATUS_NO_ERROR if successful, otherwise return @c NNFW_STATUS_ERROR
+ */
+NNFW_STATUS nnfw_set_auto_compilation(nnfw_session *session, const char *target,
+                                      NNFW_CODEGEN_PREF pref);
+
+/**
+ * @brief     Query whether the session runs the model compiled by auto compilation
+ *
+ * @param[in]  session nnfw_session to query
+ * @param[out] done    1 if the compiled model has replaced the original model, otherwise 0
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_auto_compilation_done(nnfw_session *session, int *done);
+
+/**
+ * @brief     Query whether the last run used executors specialized for its input shapes
+ *
+ * When @c SHAPE_SPECIALIZATION_RUNS is set by {@link nnfw_set_config} before
+ * {@link nnfw_prepare}, inputs resized after prepare and run that many times are compiled with
+ * static shapes on a background thread. Runs with those input shapes use the compiled executors
+ * from the start of a run after the compilation is done.
+ *
+ * @param[in]  session nnfw_session to query
+ * @param[out] done    1 if the last run used specialized executors, otherwise 0
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_shape_specialization_done(nnfw_session *session, int *done);
+
 //////////////////////////////////////////////
 // APIs for configuration
 //////////////////////////////////////////////
@@ -611,6 +670,12 @@ typedef enum
    * TODO: Use workspace
    */
   NNFW_RUN_CONFIG_PROFILE,
+  /**
+   * Maximum number of threads to lease from the process-wide thread budget while running
+   *
+   * Value is a positive integer, or "0" for no limit other than the budget.
+   */
+  NNFW_RUN_CONFIG_THREAD_QUOTA,
 } NNFW_RUN_CONFIG;
 
 /**
@@ -39,7 +39,7 @@ public:
     nnfw_tensorinfo api_type;
     api_type.rank = type.shape.rank();
     assert(type.shape.rank() <= 6);
-    std::copy(type.shape.dims().begin(), type.shape.dims().end(), std::begin(api_type.dims));
+    std::copy(type.shape.begin(), type.shape.end(), std::begin(api_type.dims));
 
     switch (type.dtype)
     {
@@ -508,6 +508,32 @@ NNFW_STATUS nnfw_codegen(nnfw_session *session, const char *target, NNFW_CODEGEN
   return session->codegen(target, pref);
 }
 
+NNFW_STATUS nnfw_set_odc_param_minmax_records_count(nnfw_session *session,
+                                                     int minmax_records_count)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->set_odc_param_minmax_records_count(minmax_records_count);
+}
+
+NNFW_STATUS nnfw_set_auto_compilation(nnfw_session *session, const char *target,
+                                      NNFW_CODEGEN_PREF pref)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->set_auto_compilation(target, pref);
+}
+
+NNFW_STATUS nnfw_auto_compilation_done(nnfw_session *session, int *done)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->auto_compilation_done(done);
+}
+
+NNFW_STATUS nnfw_shape_specialization_done(nnfw_session *session, int *done)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->shape_specialization_done(done);
+}
+
 // Configuration
 
 NNFW_STATUS nnfw_set_prepare_config(nnfw_session *session, const NNFW_PREPARE_CONFIG key,
@@ -29,13 +29,17 @@
 #include "exporter/CircleExporter.h"
 #include "exporter/train/CheckpointExporter.h"
 #include "json/json.h"
+#include "ir/Graph.h"
 #include "ir/NNPkg.h"
 #include "ir/OpCode.h"
 #include "ir/train/TrainingInfo.h"
+#include "util/PreparedCache.h"
 #include "util/TracingCtx.h"
 #include "odc/QuantizeManager.h"
 #include "odc/CodegenManager.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -220,6 +224,41 @@ loadTrainingInfo(const std::shared_ptr<onert::ir::Model> &model)
   return std::make_unique<onert::ir::train::TrainingInfo>();
 }
 
+bool convertCodegenPref(NNFW_CODEGEN_PREF pref, onert::odc::CodegenPreference &codegen_pref)
+{
+  switch (pref)
+  {
+    case NNFW_CODEGEN_PREF_DEFAULT:
+      codegen_pref = onert::odc::CodegenPreference::CODEGEN_PREF_DEFAULT;
+      return true;
+    case NNFW_CODEGEN_PREF_PERFORMANCE_FIRST:
+      codegen_pref = onert::odc::CodegenPreference::CODEGEN_PREF_PERFORMANCE_FIRST;
+      return true;
+    case NNFW_CODEGEN_PREF_MEMORY_FIRST:
+      codegen_pref = onert::odc::CodegenPreference::CODEGEN_PREF_MEMORY_FIRST;
+      return true;
+    case NNFW_CODEGEN_PREF_COMPILE_TIME_FIRST:
+      codegen_pref = onert::odc::CodegenPreference::CODEGEN_PREF_COMPILE_TIME_FIRST;
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief Generate a compiled model path in the same directory of the original model/package
+ *        with target backend extension
+ */
+std::string genCodegenModelPath(const std::string &model_path, const std::string &target)
+{
+  // model path always has a dot. (valid extension)
+  auto dotidx = model_path.rfind('.');
+  assert(dotidx != std::string::npos);
+  auto genidx = target.rfind("-gen");
+  assert(genidx != std::string::npos);
+  return model_path.substr(0, dotidx + 1) + target.substr(0, genidx);
+}
+
 uint64_t getBufSize(const nnfw_tensorinfo *info)
 {
   static int elmsize[] = {
@@ -241,6 +280,42 @@ uint64_t getBufSize(const nnfw_tensorinfo *info)
   }
   return elmsize[info->dtype] * n;
 }
+
+// Each input shapes compiled statically keep their own tensors, so only a few are compiled
+constexpr size_t MAX_SPECIALIZED_INPUT_SHAPES = 4;
+// Input shapes that vary on every run are forgotten instead of being counted forever
+constexpr size_t MAX_COUNTED_INPUT_SHAPES = 64;
+
+std::vector<std::vector<int32_t>> getInputShapes(const onert::exec::Execution &execution,
+                                                 uint32_t size)
+{
+  std::vector<std::vector<int32_t>> shapes(size);
+  for (uint32_t i = 0; i < size; ++i)
+    shapes[i] = execution.getInputShape(onert::ir::IOIndex{i}).dims();
+  return shapes;
+}
+
+// Compilation modifies the graphs of its model, so each compilation takes its own copy.
+// Constant data are shared with the original model because they are never written.
+// Returns nullptr if the model has a subgraph that cannot be copied.
+std::unique_ptr<onert::ir::Model> cloneModel(const onert::ir::Model &model)
+{
+  auto clone = std::make_unique<onert::ir::Model>();
+  bool copyable = true;
+  model.iterate([&](const onert::ir::SubgraphIndex &index, const onert::ir::IGraph &subg) {
+    auto graph = dynamic_cast<const onert::ir::Graph *>(&subg);
+    if (graph == nullptr)
+    {
+      copyable = false;
+      return;
+    }
+    clone->push(index, std::make_shared<onert::ir::Graph>(*graph));
+  });
+  if (!copyable)
+    return nullptr;
+  clone->bindKernelBuilder(model.getKernelBuilder());
+  return clone;
+}
 } // namespace
 
 nnfw_session::nnfw_session()
@@ -277,7 +352,12 @@ NNFW_STATUS nnfw_session::create(nnfw_session **session)
   return NNFW_STATUS_NO_ERROR;
 }
 
-nnfw_session::~nnfw_session() = default;
+nnfw_session::~nnfw_session()
+{
+  // Background compilation uses this session, so it is finished before members are destroyed
+  cancelAutoCompilation();
+  resetShapeSpecialization();
+}
 
 NNFW_STATUS nnfw_session::load_circle_from_buffer(uint8_t *buffer, size_t size)
 {
@@ -295,6 +375,7 @@ NNFW_STATUS nnfw_session::load_circle_from_buffer(uint8_t *buffer, size_t size)
     auto model = onert::loader::loadCircleModel(buffer, size);
     // TODO: Update _model_path if necessary
     _nnpkg = std::make_shared<onert::ir::NNPkg>(std::move(model));
+    _coptions->model_key = onert::util::PreparedCache::hash(buffer, size);
     _train_info = loadTrainingInfo(_nnpkg->primary_model());
     _state = State::MODEL_LOADED;
   }
@@ -403,6 +484,7 @@ NNFW_STATUS nnfw_session::load_model_from_nnpackage(const char *package_dir)
       return NNFW_STATUS_ERROR;
     }
 
+    std::vector<uint64_t> model_keys;
     for (uint16_t i = 0; i < num_models; ++i)
     {
       auto model_file_path = package_path + std::string("/") + models[i].asString();
@@ -410,11 +492,17 @@ NNFW_STATUS nnfw_session::load_model_from_nnpackage(const char *package_dir)
       auto model = loadModel(model_file_path, model_type);
       if (model == nullptr)
         return NNFW_STATUS_ERROR;
+      model_keys.emplace_back(onert::util::PreparedCache::fileKey(model_file_path));
       _model_path = std::string(model_file_path); // TODO Support multiple models
       model->bindKernelBuilder(_kernel_registry->getBuilder());
       _nnpkg->push(onert::ir::ModelIndex{i}, std::move(model));
     }
 
+    // Package is unknown to prepared cache if any of its models is
+    const auto keys_size = model_keys.size() * sizeof(uint64_t);
+    const bool known = std::find(model_keys.begin(), model_keys.end(), 0) == model_keys.end();
+    _coptions->model_key =
+      known ? onert::util::PreparedCache::hash(model_keys.data(), keys_size) : 0;
     _train_info = loadTrainingInfo(_nnpkg->primary_model());
 
     auto toIODesc = [](std::string str) {
@@ -476,10 +564,20 @@ NNFW_STATUS nnfw_session::prepare()
 
   try
   {
+    // Shape specialization compiles a copy of the model taken before it is compiled
+    if (_coptions->shape_specialization_runs > 0)
+    {
+      if (_nnpkg->model_count() == 1)
+        _specialization_model = cloneModel(*_nnpkg->primary_model());
+      if (_specialization_model == nullptr)
+        std::cerr << "Shape specialization is disabled : model cannot be copied" << std::endl;
+    }
     auto compiler = onert::compiler::CompilerFactory::get().create(_nnpkg, _coptions.get());
     _nnpkg.reset();
     _compiler_artifact = compiler->compile();
     _execution = std::make_unique<onert::exec::Execution>(_compiler_artifact->_executors);
+    if (_specialization_model != nullptr)
+      _prepared_artifact = _compiler_artifact;
   }
   catch (const std::exception &e)
   {
@@ -502,6 +600,8 @@ NNFW_STATUS nnfw_session::run()
 
   try
   {
+    swapAutoCompiledExecutors();
+    selectSpecializedExecutors();
     _execution->execute();
   }
   catch (const onert::InsufficientBufferSizeException &e)
@@ -517,6 +617,8 @@ NNFW_STATUS nnfw_session::run()
   }
 
   _state = State::FINISHED_RUN;
+  recordAutoCompilation();
+  recordShapeSpecialization();
   return NNFW_STATUS_NO_ERROR;
 }
 
@@ -529,6 +631,17 @@ NNFW_STATUS nnfw_session::run_async()
     return NNFW_STATUS_INVALID_STATE;
   }
 
+  try
+  {
+    swapAutoCompiledExecutors();
+    selectSpecializedExecutors();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::run_async : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
   _execution->startExecute();
 
   _state = State::RUNNING;
@@ -935,6 +1048,18 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     _coptions->he_profiling_mode = toBool(value);
   }
+  else if (skey == config::PREPARED_CACHE)
+  {
+    _coptions->prepared_cache = toBool(value);
+  }
+  else if (skey == config::ELEMENTWISE_FUSION)
+  {
+    _coptions->elementwise_fusion = toBool(value);
+  }
+  else if (skey == config::SHAPE_SPECIALIZATION_RUNS)
+  {
+    _coptions->shape_specialization_runs = std::max(0, toInt(value));
+  }
   else
   {
     return NNFW_STATUS_ERROR;
@@ -988,8 +1113,13 @@ NNFW_STATUS nnfw_session::loadModelFile(const std::string &model_file_path,
   if (model == nullptr)
     return NNFW_STATUS_ERROR;
 
+  // Executors compiled in background are for the previous model
+  cancelAutoCompilation();
+  resetShapeSpecialization();
+
   _nnpkg = std::make_shared<onert::ir::NNPkg>(std::move(model));
   _model_path = model_file_path;
+  _coptions->model_key = onert::util::PreparedCache::fileKey(model_file_path);
   _compiler_artifact.reset();
   _execution.reset();
   _train_info = loadTrainingInfo(_nnpkg->primary_model());
@@ -1787,12 +1917,17 @@ bool nnfw_session::isStatePreparedOrFinishedTraining()
   return isStatePreparedTraining() || isStateFinishedTraining();
 }
 
+bool nnfw_session::isAutoCompiling()
+{
+  return _auto_compilation_state == AutoCompilationState::COMPILING;
+}
+
 NNFW_STATUS nnfw_session::set_quantization_type(NNFW_QUANTIZE_TYPE qtype)
 {
   using onert::odc::QuantizeType;
   try
   {
-    if (isStateInitialized() || isStateRunning())
+    if (isStateInitialized() || isStateRunning() || isAutoCompiling())
     {
       std::cerr << "invalid state" << std::endl;
       return NNFW_STATUS_INVALID_STATE;
@@ -1831,7 +1966,7 @@ NNFW_STATUS nnfw_session::set_quantized_model_path(const char *path)
 {
   try
   {
-    if (isStateInitialized() || isStateRunning())
+    if (isStateInitialized() || isStateRunning() || isAutoCompiling())
     {
       std::cerr << "invalid state" << std::endl;
       return NNFW_STATUS_INVALID_STATE;
@@ -1852,7 +1987,7 @@ NNFW_STATUS nnfw_session::quantize()
 {
   try
   {
-    if (isStateInitialized() || isStateRunning())
+    if (isStateInitialized() || isStateRunning() || isAutoCompiling())
     {
       std::cerr << "invalid state" << std::endl;
       return NNFW_STATUS_INVALID_STATE;
@@ -1877,7 +2012,7 @@ NNFW_STATUS nnfw_session::set_codegen_model_path(const char *path)
 {
   try
   {
-    if (isStateInitialized() || isStateRunning())
+    if (isStateInitialized() || isStateRunning() || isAutoCompiling())
     {
       std::cerr << "invalid state" << std::endl;
       return NNFW_STATUS_INVALID_STATE;
@@ -1899,7 +2034,7 @@ NNFW_STATUS nnfw_session::codegen(const char *target, NNFW_CODEGEN_PREF pref)
 {
   try
   {
-    if (isStateInitialized() || isStateRunning())
+    if (isStateInitialized() || isStateRunning() || isAutoCompiling())
     {
       std::cerr << "Error during nnfw_session::codegen : Invalid state" << std::endl;
       return NNFW_STATUS_INVALID_STATE;
@@ -1913,23 +2048,10 @@ NNFW_STATUS nnfw_session::codegen(const char *target, NNFW_CODEGEN_PREF pref)
     }
 
     onert::odc::CodegenPreference codegen_pref;
-    switch (pref)
+    if (!convertCodegenPref(pref, codegen_pref))
     {
-      case NNFW_CODEGEN_PREF_DEFAULT:
-        codegen_pref = onert::odc::CodegenPreference::CODEGEN_PREF_DEFAULT;
-        break;
-      case NNFW_CODEGEN_PREF_PERFORMANCE_FIRST:
-        codegen_pref = onert::odc::CodegenPreference::CODEGEN_PREF_PERFORMANCE_FIRST;
-        break;
-      case NNFW_CODEGEN_PREF_MEMORY_FIRST:
-        codegen_pref = onert::odc::CodegenPreference::CODEGEN_PREF_MEMORY_FIRST;
-        break;
-      case NNFW_CODEGEN_PREF_COMPILE_TIME_FIRST:
-        codegen_pref = onert::odc::CodegenPreference::CODEGEN_PREF_COMPILE_TIME_FIRST;
-        break;
-      default:
-        std::cerr << "Error during nnfw_session::codegen : Invalid preference" << std::endl;
-        return NNFW_STATUS_ERROR;
+      std::cerr << "Error during nnfw_session::codegen : Invalid preference" << std::endl;
+      return NNFW_STATUS_ERROR;
     }
 
     assert(_codegen_manager != nullptr);
@@ -1938,14 +2060,7 @@ NNFW_STATUS nnfw_session::codegen(const char *target, NNFW_CODEGEN_PREF pref)
     // automatically.
     if (export_model_path.empty())
     {
-      // model path always has a dot. (valid extension)
-      auto dotidx = _model_path.rfind('.');
-      assert(dotidx != std::string::npos);
-      auto genidx = target_str.rfind("-gen");
-      assert(genidx != std::string::npos);
-      // The compiled model path is the same directory of the original model/package with
-      // target backend extension.
-      export_model_path = _model_path.substr(0, dotidx + 1) + target_str.substr(0, genidx);
+      export_model_path = genCodegenModelPath(_model_path, target_str);
       _codegen_manager->exportModelPath(export_model_path);
     }
 
@@ -1976,6 +2091,302 @@ NNFW_STATUS nnfw_session::codegen(const char *target, NNFW_CODEGEN_PREF pref)
   }
 }
 
+NNFW_STATUS nnfw_session::set_odc_param_minmax_records_count(int minmax_records_count)
+{
+  if (isStateInitialized() || isStateRunning() || isAutoCompiling())
+  {
+    std::cerr << "Error during nnfw_session::set_odc_param_minmax_records_count : Invalid state"
+              << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (minmax_records_count <= 0)
+  {
+    std::cerr << "Error during nnfw_session::set_odc_param_minmax_records_count : "
+              << "count should be positive" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  _minmax_records_count = minmax_records_count;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::set_auto_compilation(const char *target, NNFW_CODEGEN_PREF pref)
+{
+  if (!isStatePreparedOrFinishedRun() || isAutoCompiling())
+  {
+    std::cerr << "Error during nnfw_session::set_auto_compilation : Invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (_coptions->workspace_dir.empty() || _quant_manager->exportModelPath().empty())
+  {
+    std::cerr << "Error during nnfw_session::set_auto_compilation : "
+              << "workspace and quantized model path should be set" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  std::string target_str = (target == nullptr) ? "" : target;
+  if (!target_str.empty() &&
+      (target_str.size() < 4 || target_str.substr(target_str.size() - 4) != "-gen"))
+  {
+    std::cerr << "Error during nnfw_session::set_auto_compilation : Invalid target" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  onert::odc::CodegenPreference codegen_pref;
+  if (!convertCodegenPref(pref, codegen_pref))
+  {
+    std::cerr << "Error during nnfw_session::set_auto_compilation : Invalid preference"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  // Join the thread of previous compilation if it is done but not swapped
+  waitAutoCompilation();
+  _auto_compiled_artifact.reset();
+
+  // Start recording from scratch as minmax file accumulates all records
+  std::remove((_coptions->workspace_dir + "/minmax.bin").c_str());
+
+  _auto_codegen_target = target_str;
+  _auto_codegen_pref = pref;
+  _minmax_records = 0;
+  _execution->executionOptions().dump_minmax = true;
+  _auto_compilation_state = AutoCompilationState::RECORDING;
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::auto_compilation_done(int *done)
+{
+  if (done == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  *done = (_auto_compilation_state == AutoCompilationState::DONE) ? 1 : 0;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::shape_specialization_done(int *done)
+{
+  if (done == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  // Executors are chosen at the start of a run, so they are the ones used by the last run
+  *done = (_prepared_artifact != nullptr && _compiler_artifact != _prepared_artifact) ? 1 : 0;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+void nnfw_session::recordAutoCompilation()
+{
+  if (_auto_compilation_state != AutoCompilationState::RECORDING)
+    return;
+
+  if (++_minmax_records < _minmax_records_count)
+    return;
+
+  _execution->executionOptions().dump_minmax = false;
+  _auto_compilation_state = AutoCompilationState::COMPILING;
+
+  // Everything the background thread uses is copied or not touched by session until it is done
+  auto model_path = _model_path;
+  auto target = _auto_codegen_target;
+  auto pref = _auto_codegen_pref;
+  auto coptions = std::make_shared<onert::compiler::CompilerOptions>(*_coptions);
+  _auto_compilation_thread = std::thread([this, model_path, target, pref, coptions]() {
+    try
+    {
+      if (!_quant_manager->quantize(model_path))
+        throw std::runtime_error{"Failed to quantize model"};
+      if (_auto_compilation_cancelled)
+        return;
+
+      std::string compiled_path = _quant_manager->exportModelPath();
+      std::string model_type = "circle";
+      if (!target.empty())
+      {
+        onert::odc::CodegenPreference codegen_pref;
+        convertCodegenPref(pref, codegen_pref);
+        auto codegen_path = _codegen_manager->exportModelPath();
+        if (codegen_path.empty())
+          codegen_path = genCodegenModelPath(model_path, target);
+        _codegen_manager->exportModelPath(codegen_path);
+        if (!_codegen_manager->codegen(compiled_path, target.c_str(), codegen_pref))
+          throw std::runtime_error{"Failed to generate code for " + target};
+
+        if (_auto_compilation_cancelled)
+          return;
+
+        compiled_path = codegen_path;
+        auto dotidx = compiled_path.rfind('.');
+        if (dotidx == std::string::npos)
+          throw std::runtime_error{"Invalid compiled model path " + compiled_path};
+        model_type = compiled_path.substr(dotidx + 1);
+      }
+
+      auto model = loadModel(compiled_path, model_type);
+      if (model == nullptr)
+        throw std::runtime_error{"Failed to load compiled model " + compiled_path};
+
+      if (_auto_compilation_cancelled)
+        return;
+
+      auto nnpkg = std::make_shared<onert::ir::NNPkg>(std::move(model));
+      auto compiler = onert::compiler::CompilerFactory::get().create(nnpkg, coptions.get());
+      _auto_compiled_artifact = compiler->compile();
+      _auto_compiled_model_path = compiled_path;
+      _auto_compilation_state = AutoCompilationState::COMPILED;
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << "Error during auto compilation : " << e.what() << std::endl;
+      _auto_compilation_state = AutoCompilationState::FAILED;
+    }
+  });
+}
+
+void nnfw_session::swapAutoCompiledExecutors()
+{
+  if (_auto_compilation_state != AutoCompilationState::COMPILED)
+    return;
+
+  waitAutoCompilation();
+
+  auto execution = std::make_unique<onert::exec::Execution>(_auto_compiled_artifact->_executors);
+  execution->takeIODescription(*_execution);
+  execution->executionOptions().dump_minmax = false;
+
+  _compiler_artifact = std::move(_auto_compiled_artifact);
+  _execution = std::move(execution);
+  _model_path = _auto_compiled_model_path;
+  _auto_compilation_state = AutoCompilationState::DONE;
+
+  // Specialized executors are for the previous model
+  resetShapeSpecialization();
+}
+
+void nnfw_session::waitAutoCompilation()
+{
+  if (_auto_compilation_thread.joinable())
+    _auto_compilation_thread.join();
+}
+
+void nnfw_session::cancelAutoCompilation()
+{
+  // A step running in the background thread is not interrupted, but following steps are skipped
+  _auto_compilation_cancelled = true;
+  waitAutoCompilation();
+  _auto_compilation_cancelled = false;
+
+  _auto_compilation_state = AutoCompilationState::DISABLED;
+  _auto_compiled_artifact.reset();
+}
+
+void nnfw_session::recordShapeSpecialization()
+{
+  if (_prepared_artifact == nullptr || _specialization_state != SpecializationState::IDLE ||
+      _auto_compilation_state != AutoCompilationState::DISABLED)
+    return;
+
+  // Prepared executors are already static for their input shapes
+  const auto &executors = _prepared_artifact->_executors;
+  auto shapes = getInputShapes(*_execution, executors->inputSize());
+  bool resized = false;
+  for (uint32_t i = 0; i < shapes.size(); ++i)
+    resized |= shapes[i] != executors->inputInfo(onert::ir::IOIndex{i}).shape().dims();
+  if (!resized || _specialized_artifacts.count(shapes) > 0 ||
+      _unspecializable_shapes.count(shapes) > 0 ||
+      _specialized_artifacts.size() >= MAX_SPECIALIZED_INPUT_SHAPES)
+    return;
+
+  if (_input_shapes_runs.size() >= MAX_COUNTED_INPUT_SHAPES &&
+      _input_shapes_runs.count(shapes) == 0)
+    _input_shapes_runs.clear();
+  if (++_input_shapes_runs[shapes] < _coptions->shape_specialization_runs)
+    return;
+
+  _input_shapes_runs.erase(shapes);
+  _specializing_shapes = shapes;
+  _specialization_state = SpecializationState::COMPILING;
+
+  // Everything the background thread uses is copied or not touched by session until it is done
+  auto source = _specialization_model;
+  auto coptions = std::make_shared<onert::compiler::CompilerOptions>(*_coptions);
+  _specialization_thread = std::thread([this, source, shapes, coptions]() {
+    try
+    {
+      std::shared_ptr<onert::ir::Model> model = cloneModel(*source);
+      if (model == nullptr)
+        throw std::runtime_error{"Failed to copy the prepared model"};
+
+      auto nnpkg = std::make_shared<onert::ir::NNPkg>(std::move(model));
+      for (uint32_t i = 0; i < shapes.size(); ++i)
+      {
+        onert::ir::Shape shape(shapes[i].size());
+        for (size_t j = 0; j < shapes[i].size(); ++j)
+          shape.dim(j) = shapes[i][j];
+        nnpkg->changeInputShape(i, shape);
+      }
+      auto compiler = onert::compiler::CompilerFactory::get().create(nnpkg, coptions.get());
+      _specialized_artifact = compiler->compile();
+      _specialization_state = SpecializationState::COMPILED;
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << "Error during shape specialization : " << e.what() << std::endl;
+      _specialization_state = SpecializationState::FAILED;
+    }
+  });
+}
+
+void nnfw_session::selectSpecializedExecutors()
+{
+  if (_prepared_artifact == nullptr)
+    return;
+
+  if (_specialization_state == SpecializationState::COMPILED)
+  {
+    _specialization_thread.join();
+    _specialized_artifacts[_specializing_shapes] = std::move(_specialized_artifact);
+    _specialization_state = SpecializationState::IDLE;
+  }
+  else if (_specialization_state == SpecializationState::FAILED)
+  {
+    // Only the failed input shapes are given up, others are still specialized
+    _specialization_thread.join();
+    if (_unspecializable_shapes.size() >= MAX_COUNTED_INPUT_SHAPES)
+      _unspecializable_shapes.clear();
+    _unspecializable_shapes.insert(_specializing_shapes);
+    _specialization_state = SpecializationState::IDLE;
+  }
+
+  // Executors are chosen by input shapes of this run
+  const auto shapes = getInputShapes(*_execution, _prepared_artifact->_executors->inputSize());
+  auto it = _specialized_artifacts.find(shapes);
+  const auto &artifact = it != _specialized_artifacts.end() ? it->second : _prepared_artifact;
+  if (artifact == _compiler_artifact)
+    return;
+
+  auto execution = std::make_unique<onert::exec::Execution>(artifact->_executors);
+  execution->takeIODescription(*_execution);
+
+  _compiler_artifact = artifact;
+  _execution = std::move(execution);
+}
+
+void nnfw_session::resetShapeSpecialization()
+{
+  if (_specialization_thread.joinable())
+    _specialization_thread.join();
+  _specialization_state = SpecializationState::IDLE;
+  _prepared_artifact.reset();
+  _specialization_model.reset();
+  _input_shapes_runs.clear();
+  _unspecializable_shapes.clear();
+  _specialized_artifacts.clear();
+  _specialized_artifact.reset();
+}
+
 NNFW_STATUS nnfw_session::set_prepare_config(const NNFW_PREPARE_CONFIG key, const char *)
 {
   if (!isStateModelLoaded())
@@ -2009,7 +2420,7 @@ NNFW_STATUS nnfw_session::reset_prepare_config()
   return NNFW_STATUS_NO_ERROR;
 }
 
-NNFW_STATUS nnfw_session::set_execute_config(const NNFW_RUN_CONFIG key, const char *)
+NNFW_STATUS nnfw_session::set_execute_config(const NNFW_RUN_CONFIG key, const char *value)
 {
   if (!isStatePreparedOrFinishedRun())
   {
@@ -2032,6 +2443,16 @@ NNFW_STATUS nnfw_session::set_execute_config(const NNFW_RUN_CONFIG key, const ch
     case NNFW_RUN_CONFIG_PROFILE:
       _execution->executionOptions().profile = true;
       break;
+    case NNFW_RUN_CONFIG_THREAD_QUOTA:
+    {
+      if (value == nullptr)
+        return NNFW_STATUS_UNEXPECTED_NULL;
+      const int quota = onert::util::toInt(value);
+      if (quota < 0)
+        return NNFW_STATUS_ERROR;
+      _execution->executionOptions().thread_quota = static_cast<uint32_t>(quota);
+      break;
+    }
     default:
       return NNFW_STATUS_ERROR;
   }
@@ -2050,6 +2471,7 @@ NNFW_STATUS nnfw_session::reset_execute_config()
   _execution->executionOptions().dump_minmax = false;
   _execution->executionOptions().trace = false;
   _execution->executionOptions().profile = false;
+  _execution->executionOptions().thread_quota = 0;
 
   return NNFW_STATUS_NO_ERROR;
 }
@@ -22,6 +22,9 @@
 
 #include <util/TracingCtx.h>
 
+#include <atomic>
+#include <map>
+#include <set>
 #include <string>
 #include <memory>
 #include <thread>
@@ -109,6 +112,39 @@ private:
     FINISHED_TRAINING  //< Trained at least once
   };
 
+  /**
+   * @brief Enum class to express the progress of auto compilation
+   *
+   * Auto compilation records minmax on each run. After enough records, the model is quantized
+   * and compiled on a background thread, and the new executors replace the current ones at the
+   * start of the next run.
+   */
+  enum class AutoCompilationState
+  {
+    DISABLED,  //< Auto compilation is not enabled
+    RECORDING, //< Minmax is recorded on each run
+    COMPILING, //< Quantization and compilation are in progress on a background thread
+    COMPILED,  //< Compiled executors are ready to replace the current ones
+    DONE,      //< Running with compiled executors
+    FAILED     //< Compilation failed, running with the original executors
+  };
+
+  /**
+   * @brief Enum class to express the progress of shape specialization
+   *
+   * Inputs resized after prepare make the executors run dynamic shape inference and allocation
+   * on every run. When the same input shapes are run enough times, the model is compiled with
+   * them as static shapes on a background thread. The static executors are used at the start
+   * of every run with those input shapes, and the prepared ones are used for the others.
+   */
+  enum class SpecializationState
+  {
+    IDLE,      //< No compilation is in progress
+    COMPILING, //< Compilation is in progress on a background thread
+    COMPILED,  //< Compiled executors are ready to be registered
+    FAILED     //< Compilation failed, the input shapes are not specialized again
+  };
+
 public:
   /**
    * @brief Factory method. It creates and initialize nnfw_session
@@ -194,6 +230,11 @@ public:
   NNFW_STATUS set_codegen_model_path(const char *path);
   NNFW_STATUS codegen(const char *target, NNFW_CODEGEN_PREF pref);
 
+  NNFW_STATUS set_odc_param_minmax_records_count(int minmax_records_count);
+  NNFW_STATUS set_auto_compilation(const char *target, NNFW_CODEGEN_PREF pref);
+  NNFW_STATUS auto_compilation_done(int *done);
+  NNFW_STATUS shape_specialization_done(int *done);
+
   NNFW_STATUS set_prepare_config(const NNFW_PREPARE_CONFIG key, const char *value);
   NNFW_STATUS reset_prepare_config();
   NNFW_STATUS set_execute_config(const NNFW_RUN_CONFIG key, const char *value);
@@ -214,6 +255,16 @@ private:
   bool isStatePreparedTraining();
   bool isStateFinishedTraining();
   bool isStatePreparedOrFinishedTraining();
+  bool isAutoCompiling();
+
+  void recordAutoCompilation();
+  void swapAutoCompiledExecutors();
+  void waitAutoCompilation();
+  void cancelAutoCompilation();
+
+  void recordShapeSpecialization();
+  void selectSpecializedExecutors();
+  void resetShapeSpecialization();
 
 private:
   State _state{State::INITIALIZED};
@@ -236,6 +287,35 @@ private:
   //     const uint8 *buf;
   //   }
   std::string _model_path;
+
+  // Auto compilation
+  std::atomic<AutoCompilationState> _auto_compilation_state{AutoCompilationState::DISABLED};
+  uint32_t _minmax_records_count{1};
+  uint32_t _minmax_records{0};
+  std::string _auto_codegen_target;
+  NNFW_CODEGEN_PREF _auto_codegen_pref{NNFW_CODEGEN_PREF_DEFAULT};
+  std::thread _auto_compilation_thread;
+  // Set to stop the background thread between its steps, as it is for a model being replaced
+  std::atomic<bool> _auto_compilation_cancelled{false};
+  // Written by the background thread, read after COMPILED state is observed
+  std::shared_ptr<onert::compiler::CompilerArtifact> _auto_compiled_artifact;
+  std::string _auto_compiled_model_path;
+
+  // Shape specialization
+  using InputShapes = std::vector<std::vector<int32_t>>;
+  std::atomic<SpecializationState> _specialization_state{SpecializationState::IDLE};
+  // Executors compiled by prepare, nullptr if shape specialization is disabled
+  std::shared_ptr<onert::compiler::CompilerArtifact> _prepared_artifact;
+  // Copy of the model taken before prepare compiles it, nullptr if shape specialization is disabled
+  std::shared_ptr<const onert::ir::Model> _specialization_model;
+  std::map<InputShapes, uint32_t> _input_shapes_runs;
+  // Input shapes whose compilation failed, they keep running with the prepared executors
+  std::set<InputShapes> _unspecializable_shapes;
+  std::map<InputShapes, std::shared_ptr<onert::compiler::CompilerArtifact>> _specialized_artifacts;
+  std::thread _specialization_thread;
+  InputShapes _specializing_shapes;
+  // Written by the background thread, read after COMPILED state is observed
+  std::shared_ptr<onert::compiler::CompilerArtifact> _specialized_artifact;
 };
 
 #endif // __API_NNFW_API_INTERNAL_H__
@@ -19,6 +19,7 @@
 
 #include <cl_common/ParentInfo.h>
 
+#include <ir/OperandIndexMap.h>
 #include <ir/OperationVisitor.h>
 #include <ir/Graph.h>
 
@@ -99,14 +100,14 @@ public:
     }
   }
 
-  std::unordered_map<ir::OperandIndex, cl_common::ParentInfo> &&releaseParentMap()
+  ir::OperandIndexMap<cl_common::ParentInfo> &&releaseParentMap()
   {
     return std::move(_parent_map);
   }
 
 private:
   const ir::Graph &_graph;
-  std::unordered_map<ir::OperandIndex, cl_common::ParentInfo> _parent_map;
+  ir::OperandIndexMap<cl_common::ParentInfo> _parent_map;
   bool usePadding{false};
 };
 
@@ -74,7 +74,7 @@ public:
     _uses_count_map[index] = num_uses;
   }
 
-  void parent_map(std::unordered_map<ir::OperandIndex, cl_common::ParentInfo> &&parent_map)
+  void parent_map(ir::OperandIndexMap<cl_common::ParentInfo> &&parent_map)
   {
     _parent_map = std::move(parent_map);
   }
@@ -20,6 +20,7 @@
 #include "BackendContext.h"
 #include "Config.h"
 #include "KernelGenerator.h"
+#include "SharedMemoryOperands.h"
 
 #include <backend/Backend.h>
 
@@ -42,14 +43,16 @@ public:
   std::unique_ptr<onert::backend::BackendContext> newContext(ContextData &&data) const override
   {
     auto custom_kernel_builder = data.custom_kernel_builder;
+    auto prepared_cache = data.prepared_cache;
     auto &graph = *data.graph;
+    const auto shared_memory_operand_indexes = findSharedMemoryOperandIndexes(data);
     auto context = std::make_unique<BackendContext>(this, std::move(data));
     auto tr = std::make_shared<basic::TensorRegistry>();
-    auto tb = std::make_shared<TensorBuilder>(tr);
+    auto tb = std::make_shared<TensorBuilder>(tr, shared_memory_operand_indexes);
     context->tensor_registry = tr;
     context->tensor_builder = tb;
-    context->kernel_gen = std::make_shared<KernelGenerator>(graph, tb, tr, custom_kernel_builder,
-                                                            context->external_context());
+    context->kernel_gen = std::make_shared<KernelGenerator>(
+      graph, tb, tr, custom_kernel_builder, context->external_context(), prepared_cache);
     return context;
   }
 
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ExternalContext.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace onert;
+
+TEST(CPUExternalContext, ruy_context_per_session)
+{
+  // Sessions never share prepacked weights, even on the same thread
+  backend::cpu::ExternalContext context1;
+  backend::cpu::ExternalContext context2;
+  ASSERT_NE(context1.ruy_context(), context2.ruy_context());
+  ASSERT_EQ(context1.ruy_context(), context1.ruy_context());
+}
+
+TEST(CPUExternalContext, ruy_threads_capped_by_lease)
+{
+  backend::cpu::ExternalContext context;
+  context.setMaxNumThreads(4);
+
+  {
+    util::ThreadBudget::Lease lease{1};
+    ASSERT_EQ(context.ruy_context()->max_num_threads(), 1);
+  }
+  const int total = util::ThreadBudget::get().total();
+  ASSERT_EQ(context.ruy_context()->max_num_threads(), std::min(4, total));
+}
+
+TEST(CPUExternalContext, neg_ruy_threads_default)
+{
+  // Negative values take the default of a thread
+  backend::cpu::ExternalContext context;
+  context.setMaxNumThreads(-1);
+  ASSERT_EQ(context.ruy_context()->max_num_threads(), 1);
+}
@@ -19,6 +19,8 @@
 #include "ops/AddNLayer.h"
 #include "ops/ArgMinMaxLayer.h"
 #include "ops/BatchToSpaceNDLayer.h"
+#include "ops/BCQFullyConnectedLayer.h"
+#include "ops/BCQGatherLayer.h"
 #include "ops/BinaryArithmeticLayer.h"
 #include "ops/CompareLayer.h"
 #include "ops/ConcatLayer.h"
@@ -59,6 +61,7 @@
 #include "ops/SplitLayer.h"
 #include "ops/SplitVLayer.h"
 #include "ops/TileLayer.h"
+#include "ops/TopKV2Layer.h"
 #include "ops/TransposeLayer.h"
 #include "ops/UnpackLayer.h"
 #include "ops/SquaredDiffLayer.h"
@@ -67,14 +70,20 @@
 #include "ops/BatchMatMulLayer.h"
 #include "ops/BroadcastToLayer.h"
 #include "ops/FusedBatchNormLayer.h"
+#include "ops/FusedElementwiseLayer.h"
 #include "ops/LogSoftMaxLayer.h"
 #include "ops/StatelessRandomUniformLayer.h"
 
 #include <backend/Backend.h>
+#include <cker/Fp16.h>
+#include <cker/eigen/EigenSupport.h>
 #include <backend/IConfig.h>
 #include <memory>
+#include <util/ConfigSource.h>
+#include <util/ThreadBudget.h>
 #include <util/Utils.h>
 #include <util/logging.h>
+#include <misc/string_helpers.h>
 #include <exec/DynamicShapeInferer.h>
 
 #include <stdexcept>
@@ -230,12 +239,27 @@ KernelGenerator::KernelGenerator(
   const ir::Graph &graph, const std::shared_ptr<TensorBuilder> &tensor_builder,
   const std::shared_ptr<basic::TensorRegistry> &tensor_reg,
   const std::shared_ptr<backend::custom::IKernelBuilder> &kernel_builder,
-  const std::shared_ptr<ExternalContext> &external_context)
+  const std::shared_ptr<ExternalContext> &external_context,
+  const std::shared_ptr<util::PreparedCache> &prepared_cache)
   : basic::KernelGeneratorBase{graph}, _ctx(graph.operands()), _operations_ctx{graph.operations()},
     _tensor_builder(tensor_builder), _tensor_reg{tensor_reg}, _kernel_builder(kernel_builder),
-    _external_context(external_context)
+    _external_context(external_context), _prepared_cache(prepared_cache),
+    _fp16_weights_all(false), _fp16_weights(false)
 {
-  // DO NOTHING
+  // Eigen kernels share one threadpool, which is kept within the thread budget
+  nnfw::cker::eigen_support::SetMaxNumThreads(util::ThreadBudget::get().total());
+
+  // "*" for all supported operations, or operation indexes separated by ';'
+  const auto fp16_weights = util::getConfigString(util::config::CPU_FP16_WEIGHTS);
+  if (fp16_weights == "*")
+  {
+    _fp16_weights_all = true;
+  }
+  else if (!fp16_weights.empty())
+  {
+    for (const auto &index_str : nnfw::misc::split(fp16_weights, ';'))
+      _fp16_weights_ops.emplace(std::stoi(index_str));
+  }
 }
 
 std::unique_ptr<exec::FunctionSequence> KernelGenerator::generate(ir::OperationIndex ind)
@@ -253,6 +277,8 @@ std::unique_ptr<exec::FunctionSequence> KernelGenerator::generate(ir::OperationI
   }
   ret->dynamic_tensor_ctx(dyn_ctx);
 
+  _fp16_weights = _fp16_weights_all || _fp16_weights_ops.count(ind) > 0;
+
   auto &op = _graph.operations().at(ind);
   op.accept(*this);
   assert(_return_fn); // _return_fn must have been generated
@@ -269,6 +295,37 @@ std::unique_ptr<exec::FunctionSequence> KernelGenerator::generate(ir::OperationI
   return ret;
 }
 
+std::shared_ptr<ir::Data> KernelGenerator::fp16Weights(const ir::OperandIndex &input_index,
+                                                       const ir::OperandIndex &weights_index)
+{
+  const auto &input = _ctx.at(input_index);
+  const auto &weights = _ctx.at(weights_index);
+  if (!_fp16_weights || input.typeInfo().type() != ir::DataType::FLOAT32 ||
+      weights.typeInfo().type() != ir::DataType::FLOAT32 || !weights.isConstant() ||
+      weights.typeInfo().sparsity() || !weights.data())
+    return nullptr;
+
+  const auto &source = *weights.data();
+  const auto count = source.size() / sizeof(float);
+  const auto size = count * sizeof(uint16_t);
+
+  // The cache is keyed on the model, so weights are found by their operand
+  const auto name = "cpu_fp16_" + std::to_string(weights_index.value());
+  if (_prepared_cache)
+  {
+    if (auto blob = _prepared_cache->load(name, source.size(), size))
+      return blob;
+  }
+
+  std::vector<uint16_t> converted(count);
+  nnfw::cker::FloatToHalf(reinterpret_cast<const float *>(source.base()), converted.data(), count);
+  auto blob =
+    std::make_shared<ir::CachedData>(reinterpret_cast<const uint8_t *>(converted.data()), size);
+  if (_prepared_cache)
+    _prepared_cache->store(name, source.size(), *blob);
+  return blob;
+}
+
 void KernelGenerator::visit(const ir::operation::AddN &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -314,7 +371,8 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
     fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, param_padding.param.left,
                   param_padding.param.right, param_padding.param.top, param_padding.param.bottom,
                   stride.horizontal, stride.vertical, dilation.width_factor, dilation.height_factor,
-                  activation, ofm_tensor, is_cacheable_weights);
+                  activation, ofm_tensor, is_cacheable_weights, _external_context,
+                  fp16Weights(ifm_index, ker_index));
 
     _return_fn = std::move(fn);
     return;
@@ -333,7 +391,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
   fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left,
                 padding.right, padding.top, padding.bottom, stride.horizontal, stride.vertical,
                 dilation.width_factor, dilation.height_factor, activation, ofm_tensor,
-                is_cacheable_weights);
+                is_cacheable_weights, _external_context, fp16Weights(ifm_index, ker_index));
 
   _return_fn = std::move(fn);
 }
@@ -370,7 +428,8 @@ void KernelGenerator::visit(const ir::operation::DepthwiseConv2D &node)
 
   fn->configure(ifm_tensor, ker_tensor, bias_tensor, padding.left, padding.right, padding.top,
                 padding.bottom, stride.horizontal, stride.vertical, multiplier, dilation_width,
-                dilation_height, activation, ofm_tensor, _external_context);
+                dilation_height, activation, ofm_tensor, _external_context,
+                fp16Weights(ifm_index, ker_index));
 
   _return_fn = std::move(fn);
 }
@@ -390,7 +449,60 @@ void KernelGenerator::visit(const ir::operation::Concat &node)
 
   auto fn = std::make_unique<ops::ConcatLayer>();
 
-  fn->configure(input_tensors, axis, output_tensor);
+  fn->configure(input_tensors, axis, output_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::BCQFullyConnected &node)
+{
+  using ir::operation::BCQFullyConnected;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(BCQFullyConnected::Input::INPUT)};
+  const auto scales_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_SCALES)};
+  const auto binary_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_BINARY)};
+  const auto bias_index{node.getInputs().at(BCQFullyConnected::Input::BIAS)};
+  const auto clusters_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_CLUSTERS)};
+  const auto activation = node.param().activation;
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto scales_tensor = _tensor_reg->getPortableTensor(scales_index);
+  auto binary_tensor = _tensor_reg->getPortableTensor(binary_index);
+  auto bias_tensor = bias_index.undefined() ? nullptr : _tensor_reg->getPortableTensor(bias_index);
+  auto clusters_tensor = _tensor_reg->getPortableTensor(clusters_index);
+
+  auto fn = std::make_unique<ops::BCQFullyConnectedLayer>();
+
+  fn->configure(input_tensor, scales_tensor, binary_tensor, bias_tensor, clusters_tensor,
+                activation, output_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::BCQGather &node)
+{
+  using ir::operation::BCQGather;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto scales_index{node.getInputs().at(BCQGather::Input::INPUT_SCALES)};
+  const auto binary_index{node.getInputs().at(BCQGather::Input::INPUT_BINARY)};
+  const auto indices_index{node.getInputs().at(BCQGather::Input::INDICES)};
+  const auto clusters_index{node.getInputs().at(BCQGather::Input::INPUT_CLUSTERS)};
+  const auto hidden_size = static_cast<int32_t>(node.param().input_hidden_size);
+  const auto axis = static_cast<int32_t>(node.param().axis);
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto scales_tensor = _tensor_reg->getPortableTensor(scales_index);
+  auto binary_tensor = _tensor_reg->getPortableTensor(binary_index);
+  auto indices_tensor = _tensor_reg->getPortableTensor(indices_index);
+  auto clusters_tensor = _tensor_reg->getPortableTensor(clusters_index);
+
+  auto fn = std::make_unique<ops::BCQGatherLayer>();
+
+  fn->configure(scales_tensor, binary_tensor, indices_tensor, clusters_tensor, output_tensor,
+                hidden_size, axis, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -455,8 +567,12 @@ void KernelGenerator::visit(const ir::operation::FullyConnected &node)
 
   auto fn = std::make_unique<ops::FullyConnectedLayer>();
 
+  // Only weights in the default format can be kept in fp16
+  const auto fp16_weights = weights_format == ir::FullyConnectedWeightsFormat::Default
+                              ? fp16Weights(input_index, weight_index)
+                              : nullptr;
   fn->configure(input_tensor, weight_tensor, bias_tensor, activation, weights_format, output_tensor,
-                _external_context);
+                _external_context, fp16_weights);
 
   _return_fn = std::move(fn);
 }
@@ -512,7 +628,7 @@ void KernelGenerator::visit(const ir::operation::Softmax &node)
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, output_tensor);
+  fn->configure(input_tensor, beta, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -532,7 +648,7 @@ void KernelGenerator::visit(const ir::operation::BinaryArithmetic &node)
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
 
   fn->configure(lhs_tensor, rhs_tensor, ofm_tensor, activation,
-                convertArithmeticType(node.param().arithmetic_type));
+                convertArithmeticType(node.param().arithmetic_type), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -571,7 +687,7 @@ void KernelGenerator::visit(const ir::operation::Gather &node)
 
   auto fn = std::make_unique<ops::GatherLayer>();
 
-  fn->configure(input_tensor, indices_tensor, output_tensor, axis);
+  fn->configure(input_tensor, indices_tensor, output_tensor, axis, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -658,7 +774,7 @@ void KernelGenerator::visit(const ir::operation::ElementwiseActivation &node)
   auto fn = std::make_unique<ops::ElementwiseActivationLayer>();
 
   fn->configure(input_tensor, output_tensor, node.param().alpha, node.param().beta,
-                convertElementwiseActivationType(node.param().op_type));
+                convertElementwiseActivationType(node.param().op_type), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -692,7 +808,7 @@ void KernelGenerator::visit(const ir::operation::ElementwiseUnary &node)
   if (node.param().op_type == ir::operation::ElementwiseUnary::Type::QUANTIZE)
   {
     auto fn = std::make_unique<ops::QuantizeLayer>();
-    fn->configure(input_tensor, output_tensor);
+    fn->configure(input_tensor, output_tensor, _external_context);
     _return_fn = std::move(fn);
   }
   else
@@ -784,7 +900,7 @@ void KernelGenerator::visit(const ir::operation::Pad &node)
     value = _tensor_reg->getPortableTensor(value_index);
   }
 
-  fn->configure(input, pad, value, output);
+  fn->configure(input, pad, value, output, _external_context);
   _return_fn = std::move(fn);
 }
 
@@ -800,7 +916,7 @@ void KernelGenerator::visit(const ir::operation::Transpose &node)
 
   auto fn = std::make_unique<ops::TransposeLayer>();
 
-  fn->configure(input_tensor, perm_tensor, output_tensor);
+  fn->configure(input_tensor, perm_tensor, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -820,7 +936,7 @@ void KernelGenerator::visit(const ir::operation::Reduce &node)
   {
     auto fn = std::make_unique<ops::MeanLayer>();
 
-    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims, _external_context);
 
     _return_fn = std::move(fn);
   }
@@ -829,7 +945,8 @@ void KernelGenerator::visit(const ir::operation::Reduce &node)
     auto fn = std::make_unique<ops::ReduceLayer>();
 
     const auto reduce_type = convertReduceType(node.param().reduce_type);
-    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims,
+                  _external_context);
 
     _return_fn = std::move(fn);
   }
@@ -952,7 +1069,7 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
   if (node.getInputs().size() == 1)
   {
     fn->configure(input_tensor, output_tensor, node.param().height_out, node.param().width_out,
-                  align_corners, half_pixel_centers);
+                  align_corners, half_pixel_centers, _external_context);
   }
   else
   {
@@ -965,11 +1082,12 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
       const auto height_out = size_vec[0];
       const auto width_out = size_vec[1];
       fn->configure(input_tensor, output_tensor, height_out, width_out, align_corners,
-                    half_pixel_centers);
+                    half_pixel_centers, _external_context);
     }
     else
     {
-      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers);
+      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers,
+                    _external_context);
     }
   }
 
@@ -1117,6 +1235,26 @@ void KernelGenerator::visit(const ir::operation::SquaredDifference &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::TopKV2 &node)
+{
+  using ir::operation::TopKV2;
+
+  const auto values_index{node.getOutputs().at(TopKV2::Output::OUTPUT_VALUES)};
+  const auto indices_index{node.getOutputs().at(TopKV2::Output::OUTPUT_INDICES)};
+  const auto input_index{node.getInputs().at(TopKV2::Input::INPUT)};
+  const auto k = node.param().k;
+
+  auto values_tensor = _tensor_reg->getPortableTensor(values_index);
+  auto indices_tensor = _tensor_reg->getPortableTensor(indices_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+
+  auto fn = std::make_unique<ops::TopKV2Layer>();
+
+  fn->configure(input_tensor, k, values_tensor, indices_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Tile &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1211,7 +1349,8 @@ void KernelGenerator::visit(const ir::operation::BatchMatMul &node)
 
   auto fn = std::make_unique<ops::BatchMatMulLayer>();
 
-  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor);
+  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor,
+                fp16Weights(lhs_index, rhs_index));
   _return_fn = std::move(fn);
 }
 
@@ -1252,6 +1391,44 @@ void KernelGenerator::visit(const ir::operation::FusedBatchNorm &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::FusedElementwise &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+
+  std::vector<const IPortableTensor *> input_tensors;
+  for (const auto &input_idx : node.getInputs())
+    input_tensors.emplace_back(_tensor_reg->getPortableTensor(input_idx));
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+
+  std::vector<ops::FusedElementwiseStep> steps;
+  for (const auto &step_ir : node.param().steps)
+  {
+    ops::FusedElementwiseStep step{};
+    step.lhs = step_ir.lhs;
+    step.rhs = step_ir.rhs;
+    step.binary = step_ir.opcode == ir::OpCode::BinaryArithmetic;
+    if (step.binary)
+    {
+      step.arithmetic_type = convertArithmeticType(step_ir.arithmetic.arithmetic_type);
+      step.activation = step_ir.arithmetic.activation;
+    }
+    else
+    {
+      step.activation_type = convertElementwiseActivationType(step_ir.activation.op_type);
+      step.alpha = step_ir.activation.alpha;
+      step.beta = step_ir.activation.beta;
+    }
+    steps.emplace_back(step);
+  }
+
+  auto fn = std::make_unique<ops::FusedElementwiseLayer>();
+
+  fn->configure(std::move(input_tensors), output_tensor, std::move(steps), _external_context);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::LogSoftmax &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1265,7 +1442,7 @@ void KernelGenerator::visit(const ir::operation::LogSoftmax &node)
 
   auto fn = std::make_unique<ops::LogSoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, axis, output_tensor);
+  fn->configure(input_tensor, beta, axis, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -1538,7 +1715,7 @@ void KernelGenerator::visit(const ir::operation::LSTM &node)
     /*output_offset=*/0, scratch_buffer_tensor, output_state_out_tensor, cell_state_out_tensor,
     output_tensor,
     !_ctx.at(output_state_in_index).info().isVariable() /* means empty buffer on frontend now */,
-    !_ctx.at(cell_state_in_index).info().isVariable());
+    !_ctx.at(cell_state_in_index).info().isVariable(), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -26,6 +26,9 @@
 #include <backend/basic/KernelGeneratorBase.h>
 #include <ir/Operands.h>
 #include <ir/Operations.h>
+#include <util/PreparedCache.h>
+
+#include <unordered_set>
 
 namespace onert
 {
@@ -40,7 +43,8 @@ public:
   KernelGenerator(const ir::Graph &graph, const std::shared_ptr<TensorBuilder> &tensor_builder,
                   const std::shared_ptr<basic::TensorRegistry> &tensor_reg,
                   const std::shared_ptr<custom::IKernelBuilder> &kernel_builder,
-                  const std::shared_ptr<ExternalContext> &external_context);
+                  const std::shared_ptr<ExternalContext> &external_context,
+                  const std::shared_ptr<util::PreparedCache> &prepared_cache);
 
   std::unique_ptr<exec::FunctionSequence> generate(ir::OperationIndex op_ind) override;
 
@@ -48,6 +52,8 @@ public:
   void visit(const ir::operation::ArgMinMax &) override;
   void visit(const ir::operation::BatchMatMul &) override;
   void visit(const ir::operation::BatchToSpaceND &) override;
+  void visit(const ir::operation::BCQFullyConnected &) override;
+  void visit(const ir::operation::BCQGather &) override;
   void visit(const ir::operation::BinaryArithmetic &) override;
   void visit(const ir::operation::BroadcastTo &) override;
   void visit(const ir::operation::Comparison &) override;
@@ -64,6 +70,7 @@ public:
   void visit(const ir::operation::Fill &) override;
   void visit(const ir::operation::FullyConnected &) override;
   void visit(const ir::operation::FusedBatchNorm &) override;
+  void visit(const ir::operation::FusedElementwise &) override;
   void visit(const ir::operation::Gather &) override;
   void visit(const ir::operation::L2Normalization &) override;
   void visit(const ir::operation::LogSoftmax &) override;
@@ -94,9 +101,14 @@ public:
   void visit(const ir::operation::StatelessRandomUniform &) override;
   void visit(const ir::operation::StridedSlice &) override;
   void visit(const ir::operation::Tile &) override;
+  void visit(const ir::operation::TopKV2 &) override;
   void visit(const ir::operation::Transpose &) override;
   void visit(const ir::operation::Unpack &) override;
 
+private:
+  std::shared_ptr<ir::Data> fp16Weights(const ir::OperandIndex &input_index,
+                                        const ir::OperandIndex &weights_index);
+
 private:
   const ir::Operands &_ctx;
   const ir::Operations &_operations_ctx;
@@ -104,6 +116,12 @@ private:
   std::shared_ptr<basic::TensorRegistry> _tensor_reg;
   std::shared_ptr<backend::custom::IKernelBuilder> _kernel_builder;
   const std::shared_ptr<ExternalContext> _external_context;
+  const std::shared_ptr<util::PreparedCache> _prepared_cache;
+  // Operations whose constant float weights are kept in fp16, from CPU_FP16_WEIGHTS config
+  bool _fp16_weights_all;
+  std::unordered_set<ir::OperationIndex> _fp16_weights_ops;
+  // Whether the operation being generated keeps its weights in fp16
+  bool _fp16_weights;
 };
 
 } // namespace cpu
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SharedMemoryOperands.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+
+namespace
+{
+
+// Operations whose kernels only copy the input to the output
+bool isReshapeFamily(const ir::IOperation &op)
+{
+  switch (op.opcode())
+  {
+    case ir::OpCode::ExpandDims:
+    case ir::OpCode::Reshape:
+    case ir::OpCode::Squeeze:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Operations whose kernels read each element of an input before writing the same output element
+bool isInplaceElementwise(const ir::IOperation &op)
+{
+  switch (op.opcode())
+  {
+    case ir::OpCode::BinaryArithmetic:
+    case ir::OpCode::ElementwiseActivation:
+    case ir::OpCode::ElementwiseBinary:
+    case ir::OpCode::ElementwiseUnary:
+    case ir::OpCode::FusedElementwise:
+      return true;
+    default:
+      return false;
+  }
+}
+
+} // namespace
+
+ir::OperandIndexMap<ir::OperandIndex> findSharedMemoryOperandIndexes(const ContextData &data)
+{
+  const auto &graph = *data.graph;
+  const auto &operands = graph.operands();
+
+  // Only static memory planned by this backend can be shared
+  auto shareable = [&](const ir::OperandIndex &ind) {
+    if (ind.undefined())
+      return false;
+    const auto &obj = operands.at(ind);
+    return !data.external_operands.contains(ind) &&
+           !graph.getInputs().contains(ind) && !graph.getOutputs().contains(ind) &&
+           !obj.isConstant() && !obj.info().isVariable() && !obj.info().isDynamic();
+  };
+
+  std::unordered_map<ir::OperationIndex, size_t> positions;
+  for (size_t pos = 0; pos < data.op_order.size(); ++pos)
+    positions[data.op_order[pos]] = pos;
+  auto lastUse = [&](const ir::OperandIndex &ind) {
+    size_t last = 0;
+    for (const auto &use : operands.at(ind).getUses())
+      last = std::max(last, positions.at(use));
+    return last;
+  };
+
+  ir::OperandIndexMap<ir::OperandIndex> shared;
+  // Position of the last operation reading each shared memory, by its source operand
+  ir::OperandIndexMap<size_t> last_reads;
+  auto sourceOf = [&](const ir::OperandIndex &ind) {
+    auto it = shared.find(ind);
+    return it == shared.end() ? ind : it->second;
+  };
+  auto lastRead = [&](const ir::OperandIndex &source) {
+    auto it = last_reads.find(source);
+    return it == last_reads.end() ? lastUse(source) : it->second;
+  };
+
+  for (size_t pos = 0; pos < data.op_order.size(); ++pos)
+  {
+    const auto &op = graph.operations().at(data.op_order[pos]);
+    if (op.getOutputs().size() != 1 || !shareable(op.getOutputs().at(0)))
+      continue;
+    const auto output = op.getOutputs().at(0);
+    const auto &output_info = operands.at(output).info();
+
+    if (isReshapeFamily(op))
+    {
+      const auto input = op.getInputs().at(0);
+      if (!shareable(input) || operands.at(input).info().total_size() != output_info.total_size())
+        continue;
+
+      const auto source = sourceOf(input);
+      last_reads[source] = std::max(lastRead(source), lastUse(output));
+      shared[output] = source;
+    }
+    else if (data.is_linear_executor && isInplaceElementwise(op))
+    {
+      // Other executors may run the readers of an input after the operation
+      for (const auto &input : op.getInputs() | ir::Remove::DUPLICATED)
+      {
+        const auto &input_info = operands.at(input).info();
+        if (!shareable(input) || input_info.shape() != output_info.shape() ||
+            input_info.typeInfo().type() != output_info.typeInfo().type())
+          continue;
+
+        // The memory must not be read after this operation, nor through another input
+        const auto source = sourceOf(input);
+        const auto &inputs = op.getInputs();
+        if (lastRead(source) != pos ||
+            std::any_of(inputs.begin(), inputs.end(), [&](const ir::OperandIndex &other) {
+              return other != input && !other.undefined() && sourceOf(other) == source;
+            }))
+          continue;
+
+        last_reads[source] = std::max(pos, lastUse(output));
+        shared[output] = source;
+        break;
+      }
+    }
+  }
+
+  return shared;
+}
+
+} // namespace cpu
+} // namespace backend
+} // namespace onert
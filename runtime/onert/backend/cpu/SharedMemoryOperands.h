@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_SHARED_MEMORY_OPERANDS_H__
+#define __ONERT_BACKEND_CPU_SHARED_MEMORY_OPERANDS_H__
+
+#include <backend/BackendContext.h>
+#include <ir/OperandIndexMap.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+
+/**
+ * @brief Find operands which can use the memory of another operand instead of their own
+ *
+ * Outputs of Reshape, Squeeze and ExpandDims share the memory of their inputs so that the
+ * operations only change shapes. With a linear executor, outputs of elementwise operations also
+ * share the memory of an input of the same shape and type, when it is not read afterwards.
+ *
+ * @param[in] data Context data of the backend
+ * @return Map from an operand to the operand which owns the memory
+ */
+ir::OperandIndexMap<ir::OperandIndex> findSharedMemoryOperandIndexes(const ContextData &data);
+
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_SHARED_MEMORY_OPERANDS_H__
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SharedMemoryOperands.h"
+
+#include <ir/Graph.h>
+#include <ir/operation/BinaryArithmetic.h>
+#include <ir/operation/ElementwiseActivation.h>
+#include <ir/operation/Reshape.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+using namespace onert::ir;
+using onert::backend::ContextData;
+using onert::backend::cpu::findSharedMemoryOperandIndexes;
+
+// Ordered copy of the result to compare
+using SharedMap = std::map<OperandIndex, OperandIndex>;
+
+/**
+ * @brief Partial graph of cpu backend, whose operations run in the order they are added
+ */
+class SharedMemoryOperandsTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { _graph = std::make_unique<Graph>(); }
+
+  OperandIndex addTensor(const Shape &shape, DataType type = DataType::FLOAT32)
+  {
+    return _graph->addOperand(shape, TypeInfo{type});
+  }
+
+  template <typename T>
+  OperandIndex addConstant(const Shape &shape, DataType type, const std::vector<T> &values)
+  {
+    auto ind = addTensor(shape, type);
+    auto data = reinterpret_cast<const uint8_t *>(values.data());
+    _constants.emplace_back(data, data + values.size() * sizeof(T));
+    _graph->setOperandValue(ind, std::make_shared<ExternalData>(_constants.back().data(),
+                                                                _constants.back().size()));
+    return ind;
+  }
+
+  OperandIndex relu(const OperandIndex &input)
+  {
+    operation::ElementwiseActivation::Param param;
+    param.op_type = operation::ElementwiseActivation::Type::RELU;
+    param.alpha = std::numeric_limits<float>::infinity();
+    param.beta = 0.f;
+    auto output = addTensor(_graph->operands().at(input).shape());
+    add(std::make_unique<operation::ElementwiseActivation>(OperandIndexSequence{input},
+                                                           OperandIndexSequence{output}, param));
+    return output;
+  }
+
+  OperandIndex binary(const OperandIndex &lhs, const OperandIndex &rhs)
+  {
+    operation::BinaryArithmetic::Param param;
+    param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+    param.activation = Activation::NONE;
+    auto output = addTensor(_graph->operands().at(lhs).shape());
+    add(std::make_unique<operation::BinaryArithmetic>(OperandIndexSequence{lhs, rhs},
+                                                      OperandIndexSequence{output}, param));
+    return output;
+  }
+
+  OperandIndex reshape(const OperandIndex &input, const Shape &shape)
+  {
+    operation::Reshape::Param param;
+    param.new_shape = shape.dims();
+    auto new_shape = addConstant(Shape{shape.rank()}, DataType::INT32, param.new_shape);
+    auto output = addTensor(shape);
+    add(std::make_unique<operation::Reshape>(OperandIndexSequence{input, new_shape},
+                                             OperandIndexSequence{output}, param));
+    return output;
+  }
+
+  SharedMap find(bool linear_executor = true)
+  {
+    _graph->verify();
+    ContextData data;
+    data.op_order = _op_order;
+    data.external_operands = _external_operands;
+    data.is_linear_executor = linear_executor;
+    data.graph = std::make_unique<Graph>(*_graph);
+    const auto shared = findSharedMemoryOperandIndexes(data);
+    return SharedMap(shared.begin(), shared.end());
+  }
+
+  std::unique_ptr<Graph> _graph;
+  util::Set<OperandIndex> _external_operands;
+
+private:
+  void add(std::unique_ptr<IOperation> &&op)
+  {
+    _op_order.emplace_back(_graph->addOperation(std::move(op)));
+  }
+
+  std::vector<OperationIndex> _op_order;
+  std::vector<std::vector<uint8_t>> _constants;
+};
+
+} // namespace
+
+TEST_F(SharedMemoryOperandsTest, reshape_elementwise_chain)
+{
+  auto in = addTensor(Shape{2, 3});
+  auto a = relu(in);
+  auto b = reshape(a, Shape{3, 2});
+  auto c = relu(b);
+  auto d = reshape(c, Shape{6});
+  auto out = relu(d);
+  _graph->addInput(in);
+  _graph->addOutput(out);
+
+  // Every intermediate result uses the memory of the first one
+  ASSERT_EQ(find(), (SharedMap{{b, a}, {c, a}, {d, a}}));
+}
+
+TEST_F(SharedMemoryOperandsTest, last_read_ordering)
+{
+  auto in = addTensor(Shape{4});
+  auto a = relu(in);
+  auto b = reshape(a, Shape{2, 2});
+  auto c = relu(a);
+  auto d = relu(b);
+  auto out = binary(c, reshape(d, Shape{4}));
+  _graph->addInput(in);
+  _graph->addOutput(out);
+
+  // a is still read through b after c, so only d, the last reader of a, writes over it
+  const auto shared = find();
+  ASSERT_EQ(shared.count(c), 0);
+  ASSERT_EQ(shared.at(b), a);
+  ASSERT_EQ(shared.at(d), a);
+}
+
+TEST_F(SharedMemoryOperandsTest, duplicate_input)
+{
+  auto in = addTensor(Shape{4});
+  auto a = relu(in);
+  auto b = binary(a, a);
+  auto c = reshape(b, Shape{2, 2});
+  auto d = binary(b, reshape(c, Shape{4}));
+  auto out = relu(d);
+  _graph->addInput(in);
+  _graph->addOutput(out);
+
+  // An operand read twice is still read element by element, but the memory is not shared again
+  // when it is read through two operands
+  const auto shared = find();
+  ASSERT_EQ(shared.at(b), a);
+  ASSERT_EQ(shared.count(d), 0);
+}
+
+TEST_F(SharedMemoryOperandsTest, neg_graph_output)
+{
+  auto in = addTensor(Shape{4});
+  auto a = relu(in);
+  auto b = relu(a);
+  auto c = reshape(b, Shape{2, 2});
+  _graph->addInput(in);
+  _graph->addOutput(a);
+  _graph->addOutput(c);
+
+  // Outputs of the partial graph are read by others, and their memory is given by others
+  ASSERT_EQ(find(), (SharedMap{}));
+}
+
+TEST_F(SharedMemoryOperandsTest, neg_external_and_constant)
+{
+  // Operands defined by other backends are inputs of the partial graph
+  auto external = addTensor(Shape{4});
+  auto constant = addConstant(Shape{4}, DataType::FLOAT32, std::vector<float>{1, 2, 3, 4});
+  auto a = binary(external, constant);
+  auto b = reshape(constant, Shape{2, 2});
+  auto out = binary(a, reshape(b, Shape{4}));
+  _external_operands.add(external);
+  _graph->addInput(external);
+  _graph->addOutput(out);
+
+  const auto shared = find();
+  ASSERT_EQ(shared.count(a), 0);
+  ASSERT_EQ(shared.count(b), 0);
+}
+
+TEST_F(SharedMemoryOperandsTest, neg_not_linear_executor)
+{
+  auto in = addTensor(Shape{4});
+  auto a = relu(in);
+  auto b = relu(a);
+  auto c = reshape(b, Shape{2, 2});
+  auto out = relu(c);
+  _graph->addInput(in);
+  _graph->addOutput(out);
+
+  // Other executors may run readers of an input after the operation, but reshapes are safe
+  ASSERT_EQ(find(false), (SharedMap{{c, b}}));
+}
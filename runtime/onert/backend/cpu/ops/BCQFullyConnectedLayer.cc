@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BCQFullyConnectedLayer.h"
+
+#include <cker/operation/BCQFullyConnected.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+BCQFullyConnectedLayer::BCQFullyConnectedLayer()
+  : _input(nullptr), _weights_scales(nullptr), _weights_binary(nullptr), _bias(nullptr),
+    _weights_clusters(nullptr), _output(nullptr), _activation(ir::Activation::NONE),
+    _external_context(nullptr), _row_planes(), _scratch()
+{
+  // DO NOTHING
+}
+
+void BCQFullyConnectedLayer::configure(const IPortableTensor *input,
+                                       const IPortableTensor *weights_scales,
+                                       const IPortableTensor *weights_binary,
+                                       const IPortableTensor *bias,
+                                       const IPortableTensor *weights_clusters,
+                                       ir::Activation activation, IPortableTensor *output,
+                                       const std::shared_ptr<ExternalContext> &external_context)
+{
+  _input = input;
+  _weights_scales = weights_scales;
+  _weights_binary = weights_binary;
+  _bias = bias;
+  _weights_clusters = weights_clusters;
+  _activation = activation;
+  _output = output;
+  _external_context = external_context;
+}
+
+void BCQFullyConnectedLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"BCQFullyConnected: unsupported data type"};
+
+  // Clusters are not constant, so plane information could not be built in prepare()
+  if (!_weights_clusters->is_constant())
+  {
+    _row_planes = nnfw::cker::bcq::BuildRowPlanes(getBuffer<int32_t>(_weights_clusters),
+                                                  getShape(_weights_clusters).Dims(0));
+  }
+
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::BCQFullyConnectedParams op_params;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  nnfw::cker::BCQFullyConnected(
+    op_params, getShape(_input), getBuffer<float>(_input), getBuffer<float>(_weights_scales),
+    getBuffer<int32_t>(_weights_binary), _bias ? getBuffer<float>(_bias) : nullptr, _row_planes,
+    getShape(_output), getBuffer<float>(_output), _scratch, _external_context->ruy_context());
+}
+
+void BCQFullyConnectedLayer::prepare()
+{
+  if (_weights_clusters->is_constant())
+  {
+    _row_planes = nnfw::cker::bcq::BuildRowPlanes(getBuffer<int32_t>(_weights_clusters),
+                                                  getShape(_weights_clusters).Dims(0));
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BCQGatherLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/BCQGather.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+BCQGatherLayer::BCQGatherLayer()
+  : _input_scales(nullptr), _input_binary(nullptr), _indices(nullptr), _input_clusters(nullptr),
+    _output(nullptr), _hidden_size(0), _axis(0), _external_context(nullptr), _row_planes()
+{
+  // DO NOTHING
+}
+
+void BCQGatherLayer::configure(const IPortableTensor *input_scales,
+                               const IPortableTensor *input_binary, const IPortableTensor *indices,
+                               const IPortableTensor *input_clusters, IPortableTensor *output,
+                               int32_t hidden_size, int32_t axis,
+                               const std::shared_ptr<ExternalContext> &external_context)
+{
+  _input_scales = input_scales;
+  _input_binary = input_binary;
+  _indices = indices;
+  _input_clusters = input_clusters;
+  _output = output;
+  _hidden_size = hidden_size;
+  _axis = axis;
+  _external_context = external_context;
+}
+
+template <typename IndicesType> void BCQGatherLayer::gather()
+{
+  nnfw::cker::BCQGatherParams op_params;
+  op_params.axis = _axis;
+
+  nnfw::cker::BCQGather<IndicesType>(
+    op_params, getBuffer<float>(_input_scales), getBuffer<int32_t>(_input_binary), _row_planes,
+    _hidden_size, getShape(_indices), getBuffer<IndicesType>(_indices), getShape(_output),
+    getBuffer<float>(_output), _external_context->ruy_context());
+}
+
+void BCQGatherLayer::run()
+{
+  if (_output->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"BCQGather: unsupported data type"};
+
+  // Clusters are not constant, so plane information could not be built in prepare()
+  if (!_input_clusters->is_constant())
+  {
+    _row_planes = nnfw::cker::bcq::BuildRowPlanes(getBuffer<int32_t>(_input_clusters),
+                                                  getShape(_input_clusters).Dims(0));
+  }
+
+  switch (_indices->data_type())
+  {
+    case OperandType::INT32:
+      gather<int32_t>();
+      break;
+    case OperandType::INT64:
+      gather<int64_t>();
+      break;
+    default:
+      throw std::runtime_error{"BCQGather: unsupported indices data type"};
+  }
+}
+
+void BCQGatherLayer::prepare()
+{
+  if (_input_clusters->is_constant())
+  {
+    _row_planes = nnfw::cker::bcq::BuildRowPlanes(getBuffer<int32_t>(_input_clusters),
+                                                  getShape(_input_clusters).Dims(0));
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -16,6 +16,7 @@
 
 #include "BatchMatMulLayer.h"
 
+#include <cker/Fp16.h>
 #include <cker/operation/BatchMatMul.h>
 
 namespace onert
@@ -29,7 +30,7 @@ namespace ops
 
 BatchMatMulLayer::BatchMatMulLayer()
   : _lhs(nullptr), _rhs(nullptr), _output(nullptr), _adj_x(false), _adj_y(false),
-    _kernel(new nnfw::cker::BatchMatMul())
+    _kernel(new nnfw::cker::BatchMatMul()), _is_f16_rhs(false)
 {
   // DO NOTHING
 }
@@ -45,13 +46,24 @@ void BatchMatMulLayer::batchMatMulFloat32()
 
   // TODO implement for constant input
 
+  const float *rhs_data = getBuffer<float>(_rhs);
+  if (_is_f16_rhs)
+  {
+    const auto count = _f16_rhs->size() / sizeof(uint16_t);
+    _f16_widened_rhs.resize(count);
+    nnfw::cker::HalfToFloat(reinterpret_cast<const uint16_t *>(_f16_rhs->base()),
+                            _f16_widened_rhs.data(), count);
+    rhs_data = _f16_widened_rhs.data();
+  }
+
   batchmatmul_kernel.prepare(lhs_shape, rhs_shape, _adj_x, _adj_y);
-  batchmatmul_kernel(lhs_shape, getBuffer<float>(_lhs), rhs_shape, getBuffer<float>(_rhs), _adj_x,
-                     _adj_y, output_shape, getBuffer<float>(_output));
+  batchmatmul_kernel(lhs_shape, getBuffer<float>(_lhs), rhs_shape, rhs_data, _adj_x, _adj_y,
+                     output_shape, getBuffer<float>(_output));
 }
 
 void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x,
-                                 bool adj_y, IPortableTensor *output)
+                                 bool adj_y, IPortableTensor *output,
+                                 const std::shared_ptr<ir::Data> &fp16_weights)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -62,6 +74,17 @@ void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTens
   _adj_x = adj_x;
   _adj_y = adj_y;
   _output = output;
+  _is_f16_rhs = fp16_weights != nullptr && lhs->data_type() == OperandType::FLOAT32 &&
+                rhs->data_type() == OperandType::FLOAT32 && rhs->is_constant();
+  if (_is_f16_rhs)
+    _f16_rhs = fp16_weights;
+}
+
+void BatchMatMulLayer::prepare()
+{
+  // Float rhs is not used any more
+  if (_is_f16_rhs)
+    releaseConstantTensor(_rhs);
 }
 
 void BatchMatMulLayer::run()
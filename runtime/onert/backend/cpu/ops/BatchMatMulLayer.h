@@ -49,8 +49,9 @@ public:
   void batchMatMulFloat32();
 
   void configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x, bool adj_y,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ir::Data> &fp16_weights);
 
+  void prepare() override;
   void run() override;
 
 private:
@@ -62,6 +63,11 @@ private:
   bool _adj_y;
 
   std::unique_ptr<nnfw::cker::BatchMatMul> _kernel;
+
+  // For constant rhs kept in fp16, which is widened into a float buffer on each run
+  bool _is_f16_rhs;
+  std::shared_ptr<ir::Data> _f16_rhs;
+  std::vector<float> _f16_widened_rhs;
 };
 
 } // namespace ops
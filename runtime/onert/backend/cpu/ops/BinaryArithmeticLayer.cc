@@ -37,10 +37,13 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
   nnfw::cker::Shape _output_shape;
   nnfw::cker::BinaryArithmeticOpParam _op_params;
   bool _need_broadcast;
+  std::shared_ptr<ExternalContext> _external_context;
 
   Eval(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
-       nnfw::cker::BinaryArithmeticOpParam op_params)
-    : _op_params(std::move(op_params)), _need_broadcast(false)
+       nnfw::cker::BinaryArithmeticOpParam op_params,
+       const std::shared_ptr<ExternalContext> &external_context)
+    : _op_params(std::move(op_params)), _need_broadcast(false),
+      _external_context(external_context)
   {
     if (!output->is_dynamic())
       updateCache(lhs, rhs, output);
@@ -73,8 +76,10 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
     }
     else
     {
-      nnfw::cker::BinaryArithmeticOp<arithmetic_type>(
-        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer);
+      nnfw::cker::BinaryArithmeticOp<arithmetic_type>(_op_params, _lhs_shape, lhs_buffer,
+                                                      _rhs_shape, rhs_buffer, _output_shape,
+                                                      output_buffer,
+                                                      _external_context->ruy_context());
     }
   }
 };
@@ -83,7 +88,8 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type>
 std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *)>
 generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
                       IPortableTensor *output, const ir::Activation activation,
-                      nnfw::cker::BinaryArithmeticOpParam &op_params)
+                      nnfw::cker::BinaryArithmeticOpParam &op_params,
+                      const std::shared_ptr<ExternalContext> &external_context)
 {
   switch (lhs->data_type())
   {
@@ -93,7 +99,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.float_activation_max = output_activation_max;
       op_params.float_activation_min = output_activation_min;
-      return Eval<arithmetic_type, float>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, float>(lhs, rhs, output, op_params, external_context);
       break;
     }
     case OperandType::INT32:
@@ -102,7 +108,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.quantized_activation_max = output_activation_max;
       op_params.quantized_activation_min = output_activation_min;
-      return Eval<arithmetic_type, int32_t>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, int32_t>(lhs, rhs, output, op_params, external_context);
       break;
     }
     case OperandType::INT64:
@@ -111,7 +117,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.int64_activation_max = output_activation_max;
       op_params.int64_activation_min = output_activation_min;
-      return Eval<arithmetic_type, int64_t>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, int64_t>(lhs, rhs, output, op_params, external_context);
       break;
     }
     case OperandType::BOOL8:
@@ -122,7 +128,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       int32_t output_activation_min = 0, output_activation_max = 0;
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       static_assert(sizeof(bool) == 1, "cpu backend supports bool type which is 1 byte");
-      return Eval<arithmetic_type, bool>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, bool>(lhs, rhs, output, op_params, external_context);
       break;
     }
     default:
@@ -141,7 +147,8 @@ void setAddOrSubQuant8Params(const IPortableTensor *lhs, const IPortableTensor *
   op_params.quantized_activation_max = output_activation_max;
   op_params.quantized_activation_min = output_activation_min;
   // Parameters for scaled quantized computation
-  op_params.left_shift = 20;
+  // int16 values are shifted less to keep the shifted values within int32
+  op_params.left_shift = isQuantInt16(output->data_type()) ? 15 : 20;
   // Zero-points of input and output tensors
   op_params.input1_offset = -lhs->data_zero_point();
   op_params.input2_offset = -rhs->data_zero_point();
@@ -185,7 +192,8 @@ void setMulQuant8Params(const IPortableTensor *lhs, const IPortableTensor *rhs,
 
 void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
                                       IPortableTensor *output, const ir::Activation activation,
-                                      const ArithmeticType arithmetic_type)
+                                      const ArithmeticType arithmetic_type,
+                                      const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -194,6 +202,7 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
   _lhs = lhs;
   _rhs = rhs;
   _output = output;
+  _external_context = external_context;
 
   nnfw::cker::BinaryArithmeticOpParam op_params;
   switch (arithmetic_type)
@@ -202,20 +211,25 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       if (_lhs->data_type() == OperandType::QUANT_UINT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::ADD, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, uint8_t>(
+          _lhs, _rhs, _output, op_params, _external_context);
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int8_t>(
+          _lhs, _rhs, _output, op_params, _external_context);
+      }
+      else if (isQuantInt16(_lhs->data_type()))
+      {
+        setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int16_t>(
+          _lhs, _rhs, _output, op_params, _external_context);
       }
-
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::ADD>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, _external_context);
       }
       break;
     case ArithmeticType::kSub:
@@ -223,21 +237,27 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
         op_params.input2_multiplier *= -1;
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::SUB, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, uint8_t>(
+          _lhs, _rhs, _output, op_params, _external_context);
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
         op_params.input2_multiplier *= -1;
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int8_t>(
+          _lhs, _rhs, _output, op_params, _external_context);
+      }
+      else if (isQuantInt16(_lhs->data_type()))
+      {
+        setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
+        op_params.input2_multiplier *= -1;
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int16_t>(
+          _lhs, _rhs, _output, op_params, _external_context);
       }
-
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::SUB>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, _external_context);
       }
       break;
     case ArithmeticType::kMul:
@@ -245,27 +265,34 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       {
         nnfw::cker::BinaryArithmeticOpParam op_params;
         setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::MUL, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, uint8_t>(
+          _lhs, _rhs, _output, op_params, _external_context);
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         nnfw::cker::BinaryArithmeticOpParam op_params;
         setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int8_t>(
+          _lhs, _rhs, _output, op_params, _external_context);
+      }
+      else if (isQuantInt16(_lhs->data_type()))
+      {
+        nnfw::cker::BinaryArithmeticOpParam op_params;
+        setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int16_t>(
+          _lhs, _rhs, _output, op_params, _external_context);
       }
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::MUL>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, _external_context);
       }
       break;
     case ArithmeticType::kDiv:
       if (_lhs->data_type() == OperandType::FLOAT32)
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::DIV>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, _external_context);
       }
       else
       {
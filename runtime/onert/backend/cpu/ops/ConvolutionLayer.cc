@@ -35,8 +35,8 @@ ConvolutionLayer::ConvolutionLayer()
     _paddingType(ir::PaddingType::EXPLICIT), _paddingLeft(0), _paddingTop(0), _paddingRight(0),
     _paddingBottom(0), _strideWidth(0), _strideHeight(0), _dilationWidthFactor(1),
     _dilationHeightFactor(1), _activation(ir::Activation::NONE),
-    _conv_kernel(new nnfw::cker::Conv()), _prepare(false), _is_cachable_weights(false),
-    _is_hybrid(false)
+    _conv_kernel(new nnfw::cker::Conv()), _external_context(nullptr), _prepare(false),
+    _is_cachable_weights(false), _is_hybrid(false), _is_f16_weights(false)
 {
   // DO NOTHING
 }
@@ -65,6 +65,29 @@ void ConvolutionLayer::convFloat32()
          getBuffer<float>(_output));
 }
 
+void ConvolutionLayer::convF16Weights()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = _dilationWidthFactor;
+  op_params.dilation_height_factor = _dilationHeightFactor;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  kernel(op_params, getShape(_input), getBuffer<float>(_input), getShape(_kernel),
+         reinterpret_cast<const uint16_t *>(_f16_weights->base()), getShape(_bias),
+         getBuffer<float>(_bias), getShape(_output), getBuffer<float>(_output),
+         _external_context->ruy_context());
+}
+
 void ConvolutionLayer::convQ8uPerTensor()
 {
   int32_t output_activation_min = 0;
@@ -153,6 +176,32 @@ void ConvolutionLayer::convQ8i()
          reinterpret_cast<int8_t *>(_output->buffer()));
 }
 
+void ConvolutionLayer::convQ16x8()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.stride_height = _strideHeight;
+  op_params.stride_width = _strideWidth;
+  op_params.dilation_height_factor = _dilationHeightFactor;
+  op_params.dilation_width_factor = _dilationWidthFactor;
+  op_params.padding_values.height = _paddingTop;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+  // NOTE: Zero points of int16 activations and int8 weights are 0, so offsets are not used
+
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  kernel(op_params, getShape(_input), getBuffer<int16_t>(_input), getShape(_kernel),
+         getBuffer<int8_t>(_kernel), getShape(_bias),
+         _bias ? getBuffer<int64_t>(_bias) : nullptr, getShape(_output),
+         getBuffer<int16_t>(_output),
+         _external_context ? _external_context->ruy_context() : nullptr);
+}
+
 void ConvolutionLayer::convQ8iHybridPerChannel()
 {
   float output_activation_min = 0;
@@ -187,11 +236,24 @@ void ConvolutionLayer::convQ8iHybridPerChannel()
   op_params.float_activation_max = output_activation_max;
 
   const auto *filter_per_channel_scales = _kernel->data_scales().data();
-  nnfw::cker::reference::HybridConvPerChannel(
+  // Grouped convolution is not a single GEMM
+  const bool is_grouped = getShape(_input).Dims(3) != getShape(_kernel).Dims(3);
+  if (is_grouped || !_external_context)
+  {
+    nnfw::cker::reference::HybridConvPerChannel(
+      op_params, input_scaling_factors_ptr, getShape(_input), input_quantized_ptr,
+      getShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()), getShape(_bias),
+      reinterpret_cast<const float *>(_bias->buffer()), getShape(_output),
+      reinterpret_cast<float *>(_output->buffer()), filter_per_channel_scales, input_offsets_ptr);
+    return;
+  }
+
+  nnfw::cker::optimized_integer_ops::HybridConvPerChannel(
     op_params, input_scaling_factors_ptr, getShape(_input), input_quantized_ptr, getShape(_kernel),
-    reinterpret_cast<const int8_t *>(_kernel->buffer()), getShape(_bias),
-    reinterpret_cast<const float *>(_bias->buffer()), getShape(_output),
-    reinterpret_cast<float *>(_output->buffer()), filter_per_channel_scales, input_offsets_ptr);
+    getBuffer<int8_t>(_kernel), getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr,
+    getShape(_output), getBuffer<float>(_output), filter_per_channel_scales, input_offsets_ptr,
+    _hybrid_arena->filter_row_sums.data(), _hybrid_arena->im2col, _hybrid_arena->accum,
+    _external_context->ruy_context());
 }
 
 void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
@@ -202,7 +264,9 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
                                  const uint32_t dilationWidthFactor,
                                  const uint32_t dilationHeightFactor,
                                  const ir::Activation activation, IPortableTensor *output,
-                                 bool is_cachable_weights)
+                                 bool is_cachable_weights,
+                                 const std::shared_ptr<ExternalContext> &external_context,
+                                 const std::shared_ptr<ir::Data> &fp16_weights)
 {
   _input = input;
   _kernel = kernel;
@@ -219,8 +283,20 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
   _activation = activation;
   _output = output;
   _is_cachable_weights = is_cachable_weights;
+  _external_context = external_context;
   _is_hybrid = _input->data_type() == OperandType::FLOAT32 &&
                _kernel->data_type() == OperandType::QUANT_INT8_SYMM;
+  _is_f16_weights = fp16_weights != nullptr && _input->data_type() == OperandType::FLOAT32 &&
+                    _kernel->data_type() == OperandType::FLOAT32 && _kernel->is_constant();
+  if (_is_f16_weights)
+    _f16_weights = fp16_weights;
+
+  if (isQuantInt16(_input->data_type()))
+  {
+    if (_input->data_zero_point() != 0 || _output->data_zero_point() != 0 ||
+        (_bias && _bias->data_type() != OperandType::INT64))
+      throw std::runtime_error{"Conv2D: int16 needs symmetric activations and int64 bias"};
+  }
 }
 
 void ConvolutionLayer::run()
@@ -259,6 +335,10 @@ void ConvolutionLayer::run()
   {
     convQ8iHybridPerChannel();
   }
+  else if (_is_f16_weights)
+  {
+    convF16Weights();
+  }
   else if (_input->data_type() == OperandType::FLOAT32)
   {
     convFloat32();
@@ -275,6 +355,10 @@ void ConvolutionLayer::run()
   {
     convQ8i();
   }
+  else if (isQuantInt16(_input->data_type()))
+  {
+    convQ16x8();
+  }
   else
   {
     throw std::runtime_error{"Conv: unsupported data type"};
@@ -303,6 +387,16 @@ void ConvolutionLayer::prepare()
     const int batch_size = input_shape.Dims(0);
     const int input_size = input_shape.FlatSize() / batch_size;
     _hybrid_arena = std::make_unique<nnfw::cker::ConvHybridTempArena>(batch_size, input_size);
+    nnfw::cker::optimized_integer_ops::ComputeHybridConvRowSums(
+      getShape(_kernel), getBuffer<int8_t>(_kernel), _hybrid_arena->filter_row_sums);
+    _prepare = true;
+    return;
+  }
+
+  if (_is_f16_weights)
+  {
+    // Float weights are not used any more
+    releaseConstantTensor(_kernel);
     _prepare = true;
     return;
   }
@@ -355,6 +449,20 @@ void ConvolutionLayer::prepare()
       throw std::runtime_error{"Conv2D: Int8 dynamic weight is not supported"};
     }
   }
+  else if (isQuantInt16(_input->data_type()))
+  {
+    if (_is_cachable_weights && !_input->is_dynamic() && !_output->is_dynamic())
+    {
+      GetQuantizedConvolutionMultipliersAndShifts(
+        _input->data_scale(), _output->data_scale(), _kernel->data_scales().data(),
+        _kernel->data_scales().size(), getShape(_kernel).Dims(0),
+        kernel.per_channel_output_multiplier(), kernel.per_channel_output_shift());
+    }
+    else
+    {
+      throw std::runtime_error{"Conv2D: Int16 dynamic weight is not supported"};
+    }
+  }
   _prepare = true;
 }
 
@@ -19,6 +19,7 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 #include <functional>
@@ -56,16 +57,20 @@ public:
                  const uint32_t paddingBottom, const uint32_t strideWidth,
                  const uint32_t strideHeight, const uint32_t dilationWidthFactor,
                  const uint32_t dilationHeightFactor, const ir::Activation activation,
-                 IPortableTensor *output, bool is_cachable_weights);
+                 IPortableTensor *output, bool is_cachable_weights,
+                 const std::shared_ptr<ExternalContext> &external_context,
+                 const std::shared_ptr<ir::Data> &fp16_weights);
   void prepare() override;
   void run() override;
 
 private:
   void convFloat32();
+  void convF16Weights();
   void convQ8uPerTensor();
   void convQ8uPerChannel();
   void convQ8i();
   void convQ8iHybridPerChannel();
+  void convQ16x8();
 
 protected:
   const IPortableTensor *_input;
@@ -88,10 +93,14 @@ protected:
 
   std::unique_ptr<nnfw::cker::Conv> _conv_kernel;
   std::unique_ptr<nnfw::cker::ConvHybridTempArena> _hybrid_arena;
+  std::shared_ptr<ir::Data> _f16_weights;
+
+  std::shared_ptr<ExternalContext> _external_context;
 
   bool _prepare;
   bool _is_cachable_weights;
   bool _is_hybrid;
+  bool _is_f16_weights;
 };
 
 } // namespace ops
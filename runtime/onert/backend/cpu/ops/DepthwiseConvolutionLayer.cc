@@ -18,6 +18,7 @@
 
 #include "cker/PortableTensorUtils.h"
 #include <cker/operation/DepthwiseConv.h>
+#include <cker/Fp16.h>
 
 namespace onert
 {
@@ -81,12 +82,23 @@ void DepthwiseConvolutionLayer::convFloat32()
   op_params.float_activation_min = output_activation_min;
   op_params.float_activation_max = output_activation_max;
 
+  const float *kernel_data = getBuffer<float>(_kernel);
+  if (_is_f16_weights)
+  {
+    // Depthwise filters are small, so widening the whole filter costs little
+    const auto count = _f16_weights->size() / sizeof(uint16_t);
+    _f16_widened_weights.resize(count);
+    nnfw::cker::HalfToFloat(reinterpret_cast<const uint16_t *>(_f16_weights->base()),
+                            _f16_widened_weights.data(), count);
+    kernel_data = _f16_widened_weights.data();
+  }
+
   // Since DepthwiseConvOp does not support dilation and different W/H stride yet,
   // it uses the existing kernel in this case.
   if (_dilationWidth == 1 && _dilationHeight == 1 && _strideWidth == _strideHeight)
   {
     nnfw::cker::DepthwiseConvOp(op_params, getShape(_input), getBuffer<float>(_input),
-                                getShape(_kernel), getBuffer<float>(_kernel), getShape(_bias),
+                                getShape(_kernel), kernel_data, getShape(_bias),
                                 getBuffer<float>(_bias), getBuffer<float>(_padded_filter.get()),
                                 _use_padded_filter, getBuffer<float>(_filter_buffers.get()),
                                 getShape(_output), getBuffer<float>(_output));
@@ -94,9 +106,9 @@ void DepthwiseConvolutionLayer::convFloat32()
   else
   {
     nnfw::cker::DepthwiseConv<float, float>(
-      op_params, getShape(_input), getBuffer<float>(_input), getShape(_kernel),
-      getBuffer<float>(_kernel), getShape(_bias), getBuffer<float>(_bias), getShape(_output),
-      getBuffer<float>(_output), _external_context->ruy_context());
+      op_params, getShape(_input), getBuffer<float>(_input), getShape(_kernel), kernel_data,
+      getShape(_bias), getBuffer<float>(_bias), getShape(_output), getBuffer<float>(_output),
+      _external_context->ruy_context());
   }
 }
 
@@ -235,11 +247,44 @@ void DepthwiseConvolutionLayer::convQ8iHybridPerChannel()
   op_params.float_activation_min = output_activation_min;
   op_params.float_activation_max = output_activation_max;
 
-  nnfw::cker::reference_integer_ops::DepthwiseConvHybridPerChannel(
+  nnfw::cker::optimized_integer_ops::DepthwiseConvHybridPerChannel(
     op_params, _input_scaling_factors.data(), getShape(_input), _input_quantized.data(),
-    getShape(_kernel), getBuffer<int8_t>(_kernel), getShape(_bias), getBuffer<float>(_bias),
-    getShape(_output), getBuffer<float>(_output), _kernel->data_scales().data(),
-    _input_offsets.data());
+    getShape(_kernel), getBuffer<int8_t>(_kernel), getShape(_bias),
+    _bias ? getBuffer<float>(_bias) : nullptr, getShape(_output), getBuffer<float>(_output),
+    _kernel->data_scales().data(), _input_offsets.data(), _external_context->ruy_context());
+}
+
+void DepthwiseConvolutionLayer::convQ16x8()
+{
+  if (!_prepared)
+  {
+    // Multipliers are computed in the same way as int8
+    prepareQ8i();
+    _prepared = true;
+  }
+
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.padding_type = nnfw::cker::PaddingType::kSame;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = _dilationWidth;
+  op_params.dilation_height_factor = _dilationHeight;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::reference_integer_ops::DepthwiseConvPerChannel(
+    op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+    getShape(_input), getBuffer<int16_t>(_input), getShape(_kernel), getBuffer<int8_t>(_kernel),
+    getShape(_bias), _bias ? getBuffer<int64_t>(_bias) : nullptr, getShape(_output),
+    getBuffer<int16_t>(_output));
 }
 
 void DepthwiseConvolutionLayer::prepareQ8i()
@@ -266,7 +311,7 @@ void DepthwiseConvolutionLayer::prepareQ8iHybridPerChannel()
   auto input_shape = getShape(_input);
   const int batch_size = input_shape.Dims(0);
   const int input_size = input_shape.FlatSize() / batch_size;
-  _input_quantized.resize(input_size);
+  _input_quantized.resize(batch_size * input_size);
   // TODO: Optimize the case of batch_size = 1
   _input_scaling_factors.resize(batch_size);
   _input_offsets.resize(batch_size);
@@ -289,7 +334,8 @@ void DepthwiseConvolutionLayer::configure(
   const uint32_t paddingBottom, const uint32_t strideWidth, const uint32_t strideHeight,
   const uint32_t multiplier, const uint32_t dilationWidth, const uint32_t dilationHeight,
   const ir::Activation activation, IPortableTensor *output,
-  const std::shared_ptr<ExternalContext> &external_context)
+  const std::shared_ptr<ExternalContext> &external_context,
+  const std::shared_ptr<ir::Data> &fp16_weights)
 {
   _input = input;
   _kernel = kernel;
@@ -308,6 +354,10 @@ void DepthwiseConvolutionLayer::configure(
   _external_context = external_context;
   _is_hybrid = _input->data_type() == OperandType::FLOAT32 &&
                _kernel->data_type() == OperandType::QUANT_INT8_SYMM;
+  _is_f16_weights = fp16_weights != nullptr && _input->data_type() == OperandType::FLOAT32 &&
+                    _kernel->data_type() == OperandType::FLOAT32 && _kernel->is_constant();
+  if (_is_f16_weights)
+    _f16_weights = fp16_weights;
 
   if (_is_hybrid)
   {
@@ -327,6 +377,17 @@ void DepthwiseConvolutionLayer::configure(
       _prepared = true;
     }
   }
+  else if (isQuantInt16(_input->data_type()))
+  {
+    if (_input->data_zero_point() != 0 || _output->data_zero_point() != 0 ||
+        (_bias && _bias->data_type() != OperandType::INT64))
+      throw std::runtime_error{"DepthwiseConv: int16 needs symmetric activations and int64 bias"};
+    if (_kernel->is_constant() && !_input->is_dynamic() && !_output->is_dynamic())
+    {
+      prepareQ8i();
+      _prepared = true;
+    }
+  }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM && _kernel->is_constant() &&
            !_input->is_dynamic() && !_output->is_dynamic())
   {
@@ -339,6 +400,13 @@ void DepthwiseConvolutionLayer::configure(
   }
 }
 
+void DepthwiseConvolutionLayer::prepare()
+{
+  // Float weights are not used any more
+  if (_is_f16_weights)
+    releaseConstantTensor(_kernel);
+}
+
 void DepthwiseConvolutionLayer::run()
 {
   if (_is_hybrid)
@@ -361,6 +429,10 @@ void DepthwiseConvolutionLayer::run()
   {
     convQ8i();
   }
+  else if (isQuantInt16(_input->data_type()))
+  {
+    convQ16x8();
+  }
   else
   {
     throw std::runtime_error{"DepthwiseConv: unsupported data type"};
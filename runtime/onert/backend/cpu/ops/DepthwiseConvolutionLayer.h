@@ -47,14 +47,18 @@ public:
   void convQ8i();
   void convQ8iHybridPerChannel();
 
+  void convQ16x8();
+
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, const uint32_t paddingLeft,
                  const uint32_t paddingRight, const uint32_t paddingTop,
                  const uint32_t paddingBottom, const uint32_t strideW, const uint32_t strideH,
                  const uint32_t multiplier, const uint32_t dilationWidth,
                  const uint32_t dilationHeight, const ir::Activation activation,
-                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context,
+                 const std::shared_ptr<ir::Data> &fp16_weights);
 
+  void prepare() override;
   void run() override;
 
 private:
@@ -103,6 +107,11 @@ private:
   std::vector<int8_t> _input_quantized;
   std::vector<float> _input_scaling_factors;
   std::vector<int32_t> _input_offsets;
+
+  // For fp16 weights, which are widened into a float buffer on each run
+  bool _is_f16_weights{false};
+  std::shared_ptr<ir::Data> _f16_weights;
+  std::vector<float> _f16_widened_weights;
 };
 
 } // namespace ops
@@ -18,6 +18,7 @@
 
 #include "OperationUtils.h"
 
+#include <cker/CpuBackendThreadpool.h>
 #include <cker/operation/ELU.h>
 #include <cker/operation/LeakyReLU.h>
 #include <cker/operation/Logistic.h>
@@ -35,7 +36,7 @@ namespace ops
 {
 
 ElementwiseActivationLayer::ElementwiseActivationLayer()
-  : _input(nullptr), _output(nullptr), _kernel()
+  : _input(nullptr), _output(nullptr), _kernel(), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -78,27 +79,85 @@ void ElementwiseActivationLayer::EvalUsingLookupTable(const IPortableTensor *inp
   const uint8_t *input_data = getBuffer<uint8_t>(input);
   uint8_t *output_data = getBuffer<uint8_t>(output);
 
-  for (int i = 0; i < size; ++i)
+  nnfw::cker::cpu_backend_threadpool::ParallelFor(
+    size, 1, _external_context->ruy_context(), [&](int begin, int end) {
+      for (int i = begin; i < end; ++i)
+      {
+        output_data[i] = _table[input_data[i]];
+      }
+    });
+}
+
+void ElementwiseActivationLayer::PopulateLookupTable16(const ElementwiseActivationType op_type)
+{
+  constexpr int32_t kStep = 128;
+  constexpr int32_t kTableSize = (1 << 16) / kStep + 1;
+  const auto input_scale = static_cast<double>(_input->data_scale());
+  const auto output_scale = static_cast<double>(_output->data_scale());
+  const int32_t maxval = std::numeric_limits<int16_t>::max();
+  const int32_t minval = std::numeric_limits<int16_t>::min();
+
+  _table16.resize(kTableSize);
+  for (int32_t i = 0; i < kTableSize; ++i)
   {
-    output_data[i] = _table[input_data[i]];
+    // The last sample is out of int16 range but it is only used for interpolation
+    const double dequantized = input_scale * (minval + i * kStep);
+    double transformed = 0.;
+    if (op_type == ElementwiseActivationType::kTanh)
+    {
+      transformed = std::tanh(dequantized);
+    }
+    else if (op_type == ElementwiseActivationType::kLogistic)
+    {
+      transformed = 1.0 / (1.0 + std::exp(-dequantized));
+    }
+    else
+    {
+      throw std::runtime_error("ElementwiseActivationLayer : unsupported activation type");
+    }
+    const int32_t quantized = static_cast<int32_t>(std::round(transformed / output_scale));
+    _table16[i] = static_cast<int16_t>(std::max(std::min(maxval, quantized), minval));
   }
 }
 
+void ElementwiseActivationLayer::EvalUsingLookupTable16(const IPortableTensor *input,
+                                                        IPortableTensor *output)
+{
+  const int size = MatchingFlatSize(getShape(input), getShape(output));
+  const int16_t *input_data = getBuffer<int16_t>(input);
+  int16_t *output_data = getBuffer<int16_t>(output);
+  const int16_t *table = _table16.data();
+
+  nnfw::cker::cpu_backend_threadpool::ParallelFor(
+    size, 1, _external_context->ruy_context(), [&](int begin, int end) {
+      for (int i = begin; i < end; ++i)
+      {
+        const int32_t index = static_cast<int32_t>(input_data[i]) + 32768;
+        const int32_t base = table[index >> 7];
+        const int32_t slope = table[(index >> 7) + 1] - base;
+        const int32_t delta = (slope * (index & 127) + 64) >> 7;
+        output_data[i] = static_cast<int16_t>(base + delta);
+      }
+    });
+}
+
 void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                            float alpha, float beta,
-                                           ElementwiseActivationType op_type)
+                                           ElementwiseActivationType op_type,
+                                           const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
+  _external_context = external_context;
 
   switch (op_type)
   {
     case ElementwiseActivationType::kElu:
       if (input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
+        _kernel = [external_context](const IPortableTensor *input, IPortableTensor *output) {
           nnfw::cker::ELU(getShape(input), getBuffer<float>(input), getShape(output),
-                          getBuffer<float>(output));
+                          getBuffer<float>(output), external_context->ruy_context());
         };
       }
       else
@@ -113,11 +172,17 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
         _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTable, this,
                             std::placeholders::_1, std::placeholders::_2);
       }
+      else if (isQuantInt16(_input->data_type()))
+      {
+        PopulateLookupTable16(op_type);
+        _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTable16, this,
+                            std::placeholders::_1, std::placeholders::_2);
+      }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
+        _kernel = [external_context](const IPortableTensor *input, IPortableTensor *output) {
           nnfw::cker::Logistic(getShape(input), getBuffer<float>(input), getShape(output),
-                               getBuffer<float>(output));
+                               getBuffer<float>(output), external_context->ruy_context());
         };
       }
       else
@@ -130,16 +195,16 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
       {
         if (alpha == std::numeric_limits<float>::infinity() && beta == 0.f)
         {
-          _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
+          _kernel = [external_context](const IPortableTensor *input, IPortableTensor *output) {
             nnfw::cker::ReLU(getShape(input), getBuffer<float>(input), getShape(output),
-                             getBuffer<float>(output));
+                             getBuffer<float>(output), external_context->ruy_context());
           };
         }
         else if (alpha == 6.f && beta == 0.f)
         {
-          _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
+          _kernel = [external_context](const IPortableTensor *input, IPortableTensor *output) {
             nnfw::cker::ReLU6(getShape(input), getBuffer<float>(input), getShape(output),
-                              getBuffer<float>(output));
+                              getBuffer<float>(output), external_context->ruy_context());
           };
         }
         else
@@ -160,11 +225,17 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
         _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTable, this,
                             std::placeholders::_1, std::placeholders::_2);
       }
+      else if (isQuantInt16(_input->data_type()))
+      {
+        PopulateLookupTable16(op_type);
+        _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTable16, this,
+                            std::placeholders::_1, std::placeholders::_2);
+      }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
+        _kernel = [external_context](const IPortableTensor *input, IPortableTensor *output) {
           nnfw::cker::Tanh(getShape(input), getBuffer<float>(input), getShape(output),
-                           getBuffer<float>(output));
+                           getBuffer<float>(output), external_context->ruy_context());
         };
       }
       else
@@ -175,10 +246,11 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
     case ElementwiseActivationType::kLeakyReLU:
       if (_input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [alpha](const IPortableTensor *input, IPortableTensor *output) {
+        _kernel = [alpha, external_context](const IPortableTensor *input,
+                                            IPortableTensor *output) {
           nnfw::cker::LeakyReLU(nnfw::cker::LeakyReluParams{alpha}, getShape(input),
                                 getBuffer<float>(input), getShape(output),
-                                getBuffer<float>(output));
+                                getBuffer<float>(output), external_context->ruy_context());
         };
       }
       else
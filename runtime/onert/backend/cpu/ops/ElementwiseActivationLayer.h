@@ -18,9 +18,12 @@
 #define __ONERT_BACKEND_CPU_OPS_ElementwiseActivationLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -46,7 +49,8 @@ public:
 
 public:
   void configure(const IPortableTensor *input, IPortableTensor *output, float alpha, float beta,
-                 const ElementwiseActivationType op_type);
+                 const ElementwiseActivationType op_type,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -54,11 +58,18 @@ public:
 
   void EvalUsingLookupTable(const IPortableTensor *input, IPortableTensor *output);
 
+  void PopulateLookupTable16(const ElementwiseActivationType op_type);
+
+  void EvalUsingLookupTable16(const IPortableTensor *input, IPortableTensor *output);
+
 protected:
   const IPortableTensor *_input;
   IPortableTensor *_output;
   uint8_t _table[256];
+  // Samples of every 128 int16 inputs and the end point, interpolated linearly in between
+  std::vector<int16_t> _table16;
   std::function<void(const IPortableTensor *input, IPortableTensor *output)> _kernel;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
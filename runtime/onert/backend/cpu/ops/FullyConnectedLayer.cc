@@ -33,7 +33,8 @@ namespace ops
 FullyConnectedLayer::FullyConnectedLayer()
   : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr),
     _activation(ir::Activation::NONE), _temp_arena(new nnfw::cker::FCTempArena()),
-    _external_context(nullptr), _is_hybrid(false), _is_shuffled16x1float32(false)
+    _external_context(nullptr), _is_hybrid(false), _is_shuffled16x1float32(false),
+    _is_f16_weights(false)
 {
   // DO NOTHING
 }
@@ -89,6 +90,33 @@ void FullyConnectedLayer::fullyConnectedQuant8()
                              getBuffer<uint8_t>(_output));
 }
 
+void FullyConnectedLayer::fullyConnected16x8()
+{
+  if (_per_channel_output_multiplier.empty())
+  {
+    const int output_depth = getShape(_weights).Dims(0);
+    GetQuantizedConvolutionMultipliersAndShifts(
+      _input->data_scale(), _output->data_scale(), _weights->data_scales().data(),
+      _weights->data_scales().size(), output_depth, _per_channel_output_multiplier,
+      _per_channel_output_shift);
+  }
+
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::FullyConnected16x8(
+    op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+    getShape(_input), getBuffer<int16_t>(_input), getShape(_weights), getBuffer<int8_t>(_weights),
+    getShape(_bias), _bias ? getBuffer<int64_t>(_bias) : nullptr, getShape(_output),
+    getBuffer<int16_t>(_output), _temp_arena->accum_scratch, _external_context->ruy_context());
+}
+
 void FullyConnectedLayer::fullyConnectedHybrid()
 {
   nnfw::cker::FCTempArena &temp_arena = *_temp_arena;
@@ -195,11 +223,29 @@ void FullyConnectedLayer::fullyConnected16x1Float32()
 #endif
 }
 
+void FullyConnectedLayer::fullyConnectedF16Weights()
+{
+  float output_activation_min = 0;
+  float output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  nnfw::cker::FullyConnectedF16Weights(
+    op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
+    reinterpret_cast<const uint16_t *>(_f16_weights->base()), getShape(_bias),
+    _bias ? getBuffer<float>(_bias) : nullptr, getShape(_output), getBuffer<float>(_output),
+    *_temp_arena, _external_context->ruy_context());
+}
+
 void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
                                     const IPortableTensor *bias, ir::Activation activation,
                                     ir::FullyConnectedWeightsFormat weights_format,
                                     IPortableTensor *output,
-                                    const std::shared_ptr<ExternalContext> &external_context)
+                                    const std::shared_ptr<ExternalContext> &external_context,
+                                    const std::shared_ptr<ir::Data> &fp16_weights)
 {
   _input = input;
   _weights = weights;
@@ -217,6 +263,21 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
   }
 #endif
   _external_context = external_context;
+  // Only constant float weights in the default format can be kept in fp16
+  _is_f16_weights = fp16_weights != nullptr && input->data_type() == OperandType::FLOAT32 &&
+                    weights->data_type() == OperandType::FLOAT32 && weights->is_constant() &&
+                    !weights->sparsity() && !_is_shuffled16x1float32;
+  if (_is_f16_weights)
+    _f16_weights = fp16_weights;
+
+  if (isQuantInt16(input->data_type()))
+  {
+    if (input->data_zero_point() != 0 || output->data_zero_point() != 0 ||
+        weights->data_zero_point() != 0)
+      throw std::runtime_error{"FullyConnected: int16 needs symmetric activations and weights"};
+    if (bias && bias->data_type() != OperandType::INT64)
+      throw std::runtime_error{"FullyConnected: int16 needs int64 bias"};
+  }
 }
 
 void FullyConnectedLayer::run()
@@ -229,6 +290,10 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedSparseWeight();
   }
+  else if (_is_f16_weights)
+  {
+    fullyConnectedF16Weights();
+  }
   else if (_input->data_type() == OperandType::FLOAT32)
   {
     _is_shuffled16x1float32 ? fullyConnected16x1Float32() : fullyConnectedFloat32();
@@ -237,6 +302,10 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedQuant8();
   }
+  else if (isQuantInt16(_input->data_type()))
+  {
+    fullyConnected16x8();
+  }
   else
   {
     throw std::runtime_error{"FullyConnected: unsupported data type"};
@@ -245,7 +314,11 @@ void FullyConnectedLayer::run()
 
 void FullyConnectedLayer::prepare()
 {
-  if (_bias && _bias->is_constant())
+  // Float weights are not used any more
+  if (_is_f16_weights)
+    releaseConstantTensor(_weights);
+
+  if (_bias && _bias->is_constant() && _bias->data_type() == OperandType::FLOAT32)
   {
     const int bias_size = getShape(_bias).FlatSize();
     if (nnfw::cker::IsZeroVector(getBuffer<float>(_bias), bias_size))
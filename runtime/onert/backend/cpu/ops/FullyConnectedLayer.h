@@ -51,16 +51,21 @@ public:
 
   void fullyConnectedQuant8();
 
+  void fullyConnected16x8();
+
   void fullyConnectedHybrid();
 
   void fullyConnectedSparseWeight();
 
   void fullyConnected16x1Float32();
 
+  void fullyConnectedF16Weights();
+
   void configure(const IPortableTensor *input, const IPortableTensor *weights,
                  const IPortableTensor *bias, ir::Activation activation,
                  ir::FullyConnectedWeightsFormat weights_format, IPortableTensor *output,
-                 const std::shared_ptr<ExternalContext> &external_context);
+                 const std::shared_ptr<ExternalContext> &external_context,
+                 const std::shared_ptr<ir::Data> &fp16_weights);
 
   void run() override;
 
@@ -77,8 +82,16 @@ protected:
 
   std::shared_ptr<ExternalContext> _external_context;
 
+  // Per channel output multiplier and shift for int16 activations
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
+
   bool _is_hybrid : 1;
   bool _is_shuffled16x1float32 : 1;
+  bool _is_f16_weights : 1;
+
+  // Constant float weights kept in fp16
+  std::shared_ptr<ir::Data> _f16_weights;
 
 #ifdef USE_RUY_GEMV
   uint8_t *_cached_weights = nullptr; // weights to be cached and a key
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FusedElementwiseLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/CpuBackendThreadpool.h>
+#include <cker/operation/ELU.h>
+#include <cker/operation/Logistic.h>
+#include <cker/operation/Tanh.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+namespace
+{
+
+// Elements evaluated at once. Tiles of all values of a tile stay in L1 cache.
+constexpr int TILE_SIZE = 256;
+constexpr size_t MAX_STEPS = 8;
+constexpr size_t MAX_INPUTS = MAX_STEPS + 1;
+constexpr int MAX_RANK = 6;
+
+// Reads elements of an input at positions of output elements
+struct InputReader
+{
+  enum class Kind
+  {
+    kFull,      //< Same shape as the output
+    kScalar,    //< Single element
+    kInner,     //< Trailing dimensions of the output, repeated over leading ones
+    kBroadcast, //< Others, read by strides which are 0 on broadcast dimensions
+  };
+
+  Kind kind = Kind::kFull;
+  const float *data = nullptr;
+  int size = 0;
+  int rank = 0;
+  int dims[MAX_RANK] = {};
+  int strides[MAX_RANK] = {};
+
+  // Returns elements [begin, begin + count) of the output position, copied to buf if necessary
+  const float *read(int begin, int count, float *buf) const
+  {
+    switch (kind)
+    {
+      case Kind::kFull:
+        return data + begin;
+      case Kind::kScalar:
+        std::fill(buf, buf + count, data[0]);
+        return buf;
+      case Kind::kInner:
+      {
+        int index = begin % size;
+        for (int i = 0; i < count; ++i)
+        {
+          buf[i] = data[index];
+          if (++index == size)
+            index = 0;
+        }
+        return buf;
+      }
+      case Kind::kBroadcast:
+      {
+        int coords[MAX_RANK];
+        int offset = 0;
+        int rest = begin;
+        for (int d = rank - 1; d >= 0; --d)
+        {
+          coords[d] = rest % dims[d];
+          rest /= dims[d];
+          offset += coords[d] * strides[d];
+        }
+        for (int i = 0; i < count; ++i)
+        {
+          buf[i] = data[offset];
+          for (int d = rank - 1; d >= 0; --d)
+          {
+            offset += strides[d];
+            if (++coords[d] < dims[d])
+              break;
+            offset -= strides[d] * dims[d];
+            coords[d] = 0;
+          }
+        }
+        return buf;
+      }
+    }
+    return buf;
+  }
+};
+
+InputReader makeReader(const IPortableTensor *input, const nnfw::cker::Shape &output_shape)
+{
+  InputReader reader;
+  reader.data = getBuffer<float>(input);
+
+  const auto input_shape = getShape(input);
+  const int input_size = input_shape.FlatSize();
+  if (input_size == output_shape.FlatSize())
+  {
+    // Broadcasting only grows dimensions, so the shape is the same
+    reader.kind = InputReader::Kind::kFull;
+    return reader;
+  }
+  if (input_size == 1)
+  {
+    reader.kind = InputReader::Kind::kScalar;
+    return reader;
+  }
+
+  const int rank = output_shape.DimensionsCount();
+  if (rank > MAX_RANK || input_shape.DimensionsCount() > rank)
+    throw std::runtime_error{"FusedElementwiseLayer: unsupported broadcast"};
+  const auto extended = nnfw::cker::Shape::ExtendedShape(rank, input_shape);
+
+  int leading = 0;
+  while (leading < rank && extended.Dims(leading) == 1)
+    ++leading;
+  bool inner = true;
+  for (int d = leading; d < rank; ++d)
+    inner = inner && extended.Dims(d) == output_shape.Dims(d);
+  if (inner)
+  {
+    reader.kind = InputReader::Kind::kInner;
+    reader.size = input_size;
+    return reader;
+  }
+
+  reader.kind = InputReader::Kind::kBroadcast;
+  reader.rank = rank;
+  int stride = 1;
+  for (int d = rank - 1; d >= 0; --d)
+  {
+    if (extended.Dims(d) != 1 && extended.Dims(d) != output_shape.Dims(d))
+      throw std::runtime_error{"FusedElementwiseLayer: input is not broadcastable"};
+    reader.dims[d] = output_shape.Dims(d);
+    reader.strides[d] = extended.Dims(d) == 1 ? 0 : stride;
+    stride *= extended.Dims(d);
+  }
+  return reader;
+}
+
+void evalBinary(ArithmeticType type, const float *lhs, const float *rhs, float *out, int count)
+{
+  switch (type)
+  {
+    case ArithmeticType::kAdd:
+      for (int i = 0; i < count; ++i)
+        out[i] = lhs[i] + rhs[i];
+      break;
+    case ArithmeticType::kSub:
+      for (int i = 0; i < count; ++i)
+        out[i] = lhs[i] - rhs[i];
+      break;
+    case ArithmeticType::kMul:
+      for (int i = 0; i < count; ++i)
+        out[i] = lhs[i] * rhs[i];
+      break;
+    case ArithmeticType::kDiv:
+      for (int i = 0; i < count; ++i)
+        out[i] = lhs[i] / rhs[i];
+      break;
+  }
+}
+
+// Tiles are already split over threads, so cker kernels run on the caller thread
+void evalActivation(ElementwiseActivationType type, float alpha, const float *in, float *out,
+                    int count)
+{
+  const nnfw::cker::Shape shape{count};
+  switch (type)
+  {
+    case ElementwiseActivationType::kElu:
+      nnfw::cker::ELU(shape, in, shape, out);
+      break;
+    case ElementwiseActivationType::kLogistic:
+      nnfw::cker::Logistic(shape, in, shape, out);
+      break;
+    case ElementwiseActivationType::kReLU:
+      // Clamped after this. Input is the output itself when they share memory.
+      if (in != out)
+        std::copy(in, in + count, out);
+      break;
+    case ElementwiseActivationType::kTanh:
+      nnfw::cker::Tanh(shape, in, shape, out);
+      break;
+    case ElementwiseActivationType::kLeakyReLU:
+      for (int i = 0; i < count; ++i)
+        out[i] = in[i] < 0.f ? alpha * in[i] : in[i];
+      break;
+  }
+}
+
+} // namespace
+
+void FusedElementwiseLayer::configure(std::vector<const IPortableTensor *> &&inputs,
+                                      IPortableTensor *output,
+                                      std::vector<FusedElementwiseStep> &&steps,
+                                      const std::shared_ptr<ExternalContext> &external_context)
+{
+  if (steps.empty() || steps.size() > MAX_STEPS || inputs.size() > MAX_INPUTS)
+    throw std::runtime_error{"FusedElementwiseLayer: too many operations to fuse"};
+  if (output->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"FusedElementwiseLayer: unsupported data type"};
+
+  _clamps.clear();
+  for (size_t i = 0; i < steps.size(); ++i)
+  {
+    const auto &step = steps[i];
+    if (step.lhs >= inputs.size() + i || step.rhs >= inputs.size() + i)
+      throw std::runtime_error{"FusedElementwiseLayer: invalid step operand"};
+
+    Clamp clamp{std::numeric_limits<float>::lowest(), std::numeric_limits<float>::max()};
+    if (step.binary)
+      CalculateActivationRange(step.activation, &clamp.min, &clamp.max);
+    else if (step.activation_type == ElementwiseActivationType::kReLU)
+      clamp = Clamp{step.beta, step.alpha};
+    _clamps.emplace_back(clamp);
+  }
+
+  _inputs = std::move(inputs);
+  _output = output;
+  _steps = std::move(steps);
+  _external_context = external_context;
+}
+
+void FusedElementwiseLayer::run()
+{
+  const auto output_shape = getShape(_output);
+  const int size = output_shape.FlatSize();
+  float *output_data = getBuffer<float>(_output);
+
+  // Inputs may be resized on every run
+  const int num_inputs = _inputs.size();
+  InputReader readers[MAX_INPUTS];
+  for (int i = 0; i < num_inputs; ++i)
+    readers[i] = makeReader(_inputs[i], output_shape);
+
+  // Each tile runs all steps, so intermediate results never leave the cache
+  const int num_steps = _steps.size();
+  const int num_tiles = (size + TILE_SIZE - 1) / TILE_SIZE;
+  nnfw::cker::cpu_backend_threadpool::ParallelFor(
+    num_tiles, TILE_SIZE * num_steps, _external_context->ruy_context(),
+    [&](int tile_begin, int tile_end) {
+      float input_tiles[MAX_INPUTS][TILE_SIZE];
+      float step_tiles[MAX_STEPS][TILE_SIZE];
+      const float *values[MAX_INPUTS + MAX_STEPS];
+      for (int t = tile_begin; t < tile_end; ++t)
+      {
+        const int begin = t * TILE_SIZE;
+        const int count = std::min(TILE_SIZE, size - begin);
+        for (int i = 0; i < num_inputs; ++i)
+          values[i] = readers[i].read(begin, count, input_tiles[i]);
+
+        for (int s = 0; s < num_steps; ++s)
+        {
+          const auto &step = _steps[s];
+          // The last step writes to the output directly
+          float *result = (s + 1 == num_steps) ? output_data + begin : step_tiles[s];
+          if (step.binary)
+            evalBinary(step.arithmetic_type, values[step.lhs], values[step.rhs], result, count);
+          else
+            evalActivation(step.activation_type, step.alpha, values[step.lhs], result, count);
+
+          const auto &clamp = _clamps[s];
+          if (clamp.min != std::numeric_limits<float>::lowest() ||
+              clamp.max != std::numeric_limits<float>::max())
+          {
+            for (int i = 0; i < count; ++i)
+              result[i] = std::min(std::max(result[i], clamp.min), clamp.max);
+          }
+          values[num_inputs + s] = result;
+        }
+      }
+    });
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_FUSED_ELEMENTWISE_LAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_FUSED_ELEMENTWISE_LAYER_H__
+
+#include "BinaryArithmeticLayer.h"
+#include "ElementwiseActivationLayer.h"
+
+#include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
+
+#include <exec/IFunction.h>
+
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+/**
+ * @brief A pointwise operation of FusedElementwiseLayer
+ *
+ * Operands are values, inputs of the layer first and then results of the steps.
+ */
+struct FusedElementwiseStep
+{
+  bool binary;
+  // Binary arithmetic and its fused activation
+  ArithmeticType arithmetic_type;
+  ir::Activation activation;
+  // Elementwise activation and its parameters
+  ElementwiseActivationType activation_type;
+  float alpha;
+  float beta;
+  uint32_t lhs;
+  uint32_t rhs;
+};
+
+class FusedElementwiseLayer : public ::onert::exec::IFunction
+{
+public:
+  FusedElementwiseLayer() : _inputs(), _output(nullptr), _steps(), _external_context(nullptr) {}
+
+public:
+  void configure(std::vector<const IPortableTensor *> &&inputs, IPortableTensor *output,
+                 std::vector<FusedElementwiseStep> &&steps,
+                 const std::shared_ptr<ExternalContext> &external_context);
+
+  void run() override;
+
+private:
+  struct Clamp
+  {
+    float min;
+    float max;
+  };
+
+  std::vector<const IPortableTensor *> _inputs;
+  IPortableTensor *_output;
+  std::vector<FusedElementwiseStep> _steps;
+  std::vector<Clamp> _clamps;
+  std::shared_ptr<ExternalContext> _external_context;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_FUSED_ELEMENTWISE_LAYER_H__
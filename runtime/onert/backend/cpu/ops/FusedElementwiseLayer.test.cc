@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FusedElementwiseLayer.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+using namespace onert::backend;
+using namespace onert::backend::cpu::ops;
+
+class MockUpTensor : public IPortableTensor
+{
+public:
+  MockUpTensor(const ir::Shape &shape)
+    : IPortableTensor{ir::OperandInfo{shape, ir::TypeInfo{ir::DataType::FLOAT32},
+                                      ir::MemAllocType::STATIC}},
+      _data(shape.num_elements()), _buffer{_data.data()}
+  {
+  }
+  // Tensor which uses the memory of another tensor
+  MockUpTensor(const ir::Shape &shape, MockUpTensor &other) : MockUpTensor{shape}
+  {
+    _buffer = other._buffer;
+  }
+
+  uint8_t *buffer() const override { return reinterpret_cast<uint8_t *>(_buffer); }
+
+  float *data() { return _buffer; }
+  std::vector<float> values() const { return std::vector<float>(_buffer, _buffer + size()); }
+  size_t size() const { return _data.size(); }
+
+  // Values around zero by scale, shifted not to be zero for division
+  void fill(float scale)
+  {
+    for (size_t i = 0; i < size(); ++i)
+      _buffer[i] = (static_cast<float>(i) - size() / 2.f + 0.25f) * scale;
+  }
+
+private:
+  std::vector<float> _data;
+  float *_buffer;
+};
+
+FusedElementwiseStep binary(ArithmeticType type, uint32_t lhs, uint32_t rhs,
+                            ir::Activation activation = ir::Activation::NONE)
+{
+  FusedElementwiseStep step{};
+  step.binary = true;
+  step.arithmetic_type = type;
+  step.activation = activation;
+  step.lhs = lhs;
+  step.rhs = rhs;
+  return step;
+}
+
+FusedElementwiseStep activation(ElementwiseActivationType type, uint32_t input, float alpha = 0.f,
+                                float beta = 0.f)
+{
+  FusedElementwiseStep step{};
+  step.binary = false;
+  step.activation_type = type;
+  step.alpha = alpha;
+  step.beta = beta;
+  step.lhs = input;
+  step.rhs = input;
+  return step;
+}
+
+/**
+ * @brief Runs steps with fused and unfused layers, and compares their outputs
+ */
+class FusedElementwiseLayerTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { _context = std::make_shared<cpu::ExternalContext>(); }
+
+  MockUpTensor *addInput(const ir::Shape &shape, float scale)
+  {
+    _inputs.emplace_back(std::make_unique<MockUpTensor>(shape));
+    _inputs.back()->fill(scale);
+    return _inputs.back().get();
+  }
+
+  // Evaluates steps one by one with the layers of each operation
+  std::vector<float> runUnfused(const std::vector<FusedElementwiseStep> &steps,
+                                const ir::Shape &output_shape)
+  {
+    std::vector<MockUpTensor *> values;
+    for (const auto &input : _inputs)
+      values.emplace_back(input.get());
+    std::vector<std::unique_ptr<MockUpTensor>> results;
+    for (const auto &step : steps)
+    {
+      results.emplace_back(std::make_unique<MockUpTensor>(output_shape));
+      auto result = results.back().get();
+      if (step.binary)
+      {
+        BinaryArithmeticLayer layer;
+        layer.configure(values[step.lhs], values[step.rhs], result, step.activation,
+                        step.arithmetic_type, _context);
+        layer.run();
+      }
+      else
+      {
+        ElementwiseActivationLayer layer;
+        layer.configure(values[step.lhs], result, step.alpha, step.beta, step.activation_type,
+                        _context);
+        layer.run();
+      }
+      values.emplace_back(result);
+    }
+    return values.back()->values();
+  }
+
+  std::vector<float> runFused(std::vector<FusedElementwiseStep> steps, MockUpTensor *output)
+  {
+    std::vector<const IPortableTensor *> inputs;
+    for (const auto &input : _inputs)
+      inputs.emplace_back(input.get());
+    FusedElementwiseLayer layer;
+    layer.configure(std::move(inputs), output, std::move(steps), _context);
+    layer.run();
+    return output->values();
+  }
+
+  void expectSame(const std::vector<FusedElementwiseStep> &steps, const ir::Shape &output_shape)
+  {
+    const auto expected = runUnfused(steps, output_shape);
+    MockUpTensor output{output_shape};
+    const auto actual = runFused(steps, &output);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+      EXPECT_NEAR(actual[i], expected[i], 1e-5f) << "at " << i;
+  }
+
+  std::shared_ptr<cpu::ExternalContext> _context;
+  std::vector<std::unique_ptr<MockUpTensor>> _inputs;
+};
+
+} // namespace
+
+TEST_F(FusedElementwiseLayerTest, binary_chain)
+{
+  // Several tiles and a partial one
+  const ir::Shape shape{3, 7, 41};
+  addInput(shape, 0.01f);
+  addInput(shape, -0.02f);
+  addInput(shape, 0.03f);
+
+  expectSame({binary(ArithmeticType::kAdd, 0, 1), binary(ArithmeticType::kMul, 3, 2),
+              binary(ArithmeticType::kSub, 4, 0, ir::Activation::RELU6),
+              binary(ArithmeticType::kDiv, 5, 2, ir::Activation::RELU1)},
+             shape);
+}
+
+TEST_F(FusedElementwiseLayerTest, activations)
+{
+  const ir::Shape shape{2, 300};
+  addInput(shape, 0.02f);
+  addInput(shape, -0.01f);
+
+  const float inf = std::numeric_limits<float>::infinity();
+  expectSame({activation(ElementwiseActivationType::kLogistic, 0),
+              activation(ElementwiseActivationType::kTanh, 1),
+              binary(ArithmeticType::kAdd, 2, 3),
+              activation(ElementwiseActivationType::kElu, 4),
+              activation(ElementwiseActivationType::kLeakyReLU, 5, 0.2f),
+              activation(ElementwiseActivationType::kReLU, 6, inf, 0.f),
+              activation(ElementwiseActivationType::kReLU, 1, 6.f, 0.f),
+              binary(ArithmeticType::kMul, 7, 8)},
+             shape);
+}
+
+TEST_F(FusedElementwiseLayerTest, broadcast)
+{
+  const ir::Shape shape{2, 5, 3, 40};
+  addInput(shape, 0.01f);
+  addInput(ir::Shape{1}, 2.f);           // Scalar
+  addInput(ir::Shape{3, 40}, 0.05f);     // Inner dimensions
+  addInput(ir::Shape{2, 1, 3, 1}, -1.f); // Strided
+
+  expectSame({binary(ArithmeticType::kMul, 0, 1), binary(ArithmeticType::kAdd, 4, 2),
+              binary(ArithmeticType::kSub, 3, 5), activation(ElementwiseActivationType::kTanh, 6)},
+             shape);
+}
+
+TEST_F(FusedElementwiseLayerTest, in_place)
+{
+  const ir::Shape shape{1000};
+  auto input = addInput(shape, 0.01f);
+  addInput(shape, 0.02f);
+  const std::vector<FusedElementwiseStep> steps{
+    activation(ElementwiseActivationType::kReLU, 0, std::numeric_limits<float>::infinity(), 0.f),
+    binary(ArithmeticType::kAdd, 2, 1), activation(ElementwiseActivationType::kReLU, 3, 6.f, 0.f)};
+  const auto expected = runUnfused(steps, shape);
+
+  // Output uses the memory of the first input
+  MockUpTensor output{shape, *input};
+  const auto actual = runFused(steps, &output);
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_NEAR(actual[i], expected[i], 1e-5f) << "at " << i;
+
+  // A single ReLU step reads and writes the same memory
+  MockUpTensor single{shape, *input};
+  input->fill(-0.01f);
+  _inputs.resize(1);
+  const auto relu = runFused(
+    {activation(ElementwiseActivationType::kReLU, 0, std::numeric_limits<float>::infinity(), 0.f)},
+    &single);
+  for (size_t i = 0; i < relu.size(); ++i)
+    EXPECT_FLOAT_EQ(relu[i], std::max(0.f, (static_cast<float>(i) - 500.f + 0.25f) * -0.01f));
+}
+
+TEST_F(FusedElementwiseLayerTest, neg_invalid_step)
+{
+  const ir::Shape shape{4};
+  addInput(shape, 1.f);
+  MockUpTensor output{shape};
+
+  // Step 0 cannot read its own result
+  EXPECT_ANY_THROW(runFused({activation(ElementwiseActivationType::kTanh, 1)}, &output));
+  EXPECT_ANY_THROW(runFused({}, &output));
+}
+
+TEST_F(FusedElementwiseLayerTest, neg_not_broadcastable)
+{
+  const ir::Shape shape{2, 4};
+  addInput(shape, 1.f);
+  addInput(ir::Shape{3, 1}, 1.f);
+  MockUpTensor output{shape};
+
+  EXPECT_ANY_THROW(runFused({binary(ArithmeticType::kAdd, 0, 1)}, &output));
+}
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BinaryArithmeticLayer.h"
+#include "ConcatLayer.h"
+#include "ElementwiseActivationLayer.h"
+#include "MeanLayer.h"
+#include "PoolLayer.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+using namespace onert::backend;
+using namespace onert::backend::cpu::ops;
+
+template <typename T> class MockUpTensor : public IPortableTensor
+{
+public:
+  MockUpTensor(const ir::Shape &shape, const ir::TypeInfo &type)
+    : IPortableTensor{ir::OperandInfo{shape, type, ir::MemAllocType::STATIC}},
+      _data(shape.num_elements())
+  {
+  }
+
+  uint8_t *buffer() const override
+  {
+    return reinterpret_cast<uint8_t *>(const_cast<T *>(_data.data()));
+  }
+
+  std::vector<T> &data() { return _data; }
+
+private:
+  std::vector<T> _data;
+};
+
+using Int16Tensor = MockUpTensor<int16_t>;
+
+std::unique_ptr<Int16Tensor> int16Tensor(const ir::Shape &shape, float scale)
+{
+  // Zero points of int16 tensors are always 0
+  return std::make_unique<Int16Tensor>(shape,
+                                       ir::TypeInfo{ir::DataType::QUANT_INT16_SYMM, scale, 0});
+}
+
+int16_t quantize(float value, float scale)
+{
+  const float q = std::round(value / scale);
+  return static_cast<int16_t>(std::max<float>(std::min<float>(q, 32767.f), -32768.f));
+}
+
+float dequantize(int16_t value, float scale) { return value * scale; }
+
+// Fills values of tensor from real values in [min, max]
+void fill(Int16Tensor &tensor, float min, float max)
+{
+  auto &data = tensor.data();
+  const auto step = (max - min) / std::max<size_t>(data.size() - 1, 1);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = quantize(min + step * i, tensor.data_scale());
+}
+
+// Checks output is the real result of func within tolerance quanta of output
+void expectNear(Int16Tensor &output, const std::function<float(size_t)> &func,
+                int32_t tolerance = 1)
+{
+  const auto &data = output.data();
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    const int32_t expected = quantize(func(i), output.data_scale());
+    EXPECT_NEAR(data[i], expected, tolerance) << "at " << i;
+  }
+}
+
+class Int16x8LayersTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { _context = std::make_shared<cpu::ExternalContext>(); }
+
+  std::shared_ptr<cpu::ExternalContext> _context;
+};
+
+} // namespace
+
+TEST_F(Int16x8LayersTest, Logistic_Tanh)
+{
+  const float input_scale = 8.f / 32768;
+  const float output_scale = 1.f / 32768;
+  auto input = int16Tensor({1, 4096}, input_scale);
+  auto &in = input->data();
+  // Covers every int16 value in steps, and both ends of int16
+  for (size_t i = 0; i < in.size(); ++i)
+    in[i] = static_cast<int16_t>(-32768 + static_cast<int32_t>(i) * 16);
+  in.back() = std::numeric_limits<int16_t>::max();
+
+  for (auto op_type : {ElementwiseActivationType::kLogistic, ElementwiseActivationType::kTanh})
+  {
+    auto output = int16Tensor({1, 4096}, output_scale);
+    ElementwiseActivationLayer layer;
+    layer.configure(input.get(), output.get(), 0.f, 0.f, op_type, _context);
+    layer.run();
+
+    // Interpolation between table samples of every 128 inputs may be off by a few quanta
+    expectNear(
+      *output,
+      [&](size_t i) {
+        const float x = dequantize(in[i], input_scale);
+        return op_type == ElementwiseActivationType::kTanh ? std::tanh(x)
+                                                           : 1.f / (1.f + std::exp(-x));
+      },
+      4);
+  }
+}
+
+TEST_F(Int16x8LayersTest, BinaryArithmetic)
+{
+  const ir::Shape shape{1, 2, 3, 8};
+  auto lhs = int16Tensor(shape, 0.001f);
+  auto rhs = int16Tensor(shape, 0.002f);
+  fill(*lhs, -30.f, 30.f);
+  fill(*rhs, 60.f, -60.f);
+  const auto x = [&](size_t i) { return dequantize(lhs->data()[i], lhs->data_scale()); };
+  const auto y = [&](size_t i) { return dequantize(rhs->data()[i], rhs->data_scale()); };
+
+  {
+    auto output = int16Tensor(shape, 0.004f);
+    BinaryArithmeticLayer layer;
+    layer.configure(lhs.get(), rhs.get(), output.get(), ir::Activation::NONE, ArithmeticType::kAdd,
+                    _context);
+    layer.run();
+    expectNear(*output, [&](size_t i) { return x(i) + y(i); });
+  }
+  {
+    auto output = int16Tensor(shape, 0.004f);
+    BinaryArithmeticLayer layer;
+    layer.configure(lhs.get(), rhs.get(), output.get(), ir::Activation::NONE, ArithmeticType::kSub,
+                    _context);
+    layer.run();
+    expectNear(*output, [&](size_t i) { return x(i) - y(i); });
+  }
+  {
+    auto output = int16Tensor(shape, 0.06f);
+    BinaryArithmeticLayer layer;
+    layer.configure(lhs.get(), rhs.get(), output.get(), ir::Activation::NONE, ArithmeticType::kMul,
+                    _context);
+    layer.run();
+    expectNear(*output, [&](size_t i) { return x(i) * y(i); });
+  }
+  {
+    // Activation clamps quantized values
+    auto output = int16Tensor(shape, 0.004f);
+    BinaryArithmeticLayer layer;
+    layer.configure(lhs.get(), rhs.get(), output.get(), ir::Activation::RELU, ArithmeticType::kAdd,
+                    _context);
+    layer.run();
+    expectNear(*output, [&](size_t i) { return std::max(x(i) + y(i), 0.f); });
+  }
+}
+
+TEST_F(Int16x8LayersTest, BinaryArithmetic_broadcast)
+{
+  auto lhs = int16Tensor({1, 2, 3, 8}, 0.001f);
+  auto rhs = int16Tensor({1, 1, 1, 8}, 0.002f);
+  fill(*lhs, -30.f, 30.f);
+  fill(*rhs, 60.f, -60.f);
+  auto output = int16Tensor({1, 2, 3, 8}, 0.004f);
+
+  BinaryArithmeticLayer layer;
+  layer.configure(lhs.get(), rhs.get(), output.get(), ir::Activation::NONE, ArithmeticType::kAdd,
+                  _context);
+  layer.run();
+  expectNear(*output, [&](size_t i) {
+    return dequantize(lhs->data()[i], lhs->data_scale()) +
+           dequantize(rhs->data()[i % 8], rhs->data_scale());
+  });
+}
+
+TEST_F(Int16x8LayersTest, Pool)
+{
+  // 4x4 input of 2 channels into 2x2 output by 2x2 filter of stride 2
+  const float scale = 0.01f;
+  auto input = int16Tensor({1, 4, 4, 2}, scale);
+  fill(*input, -100.f, 100.f);
+  const auto in = [&](int h, int w, int c) {
+    return dequantize(input->data()[(h * 4 + w) * 2 + c], scale);
+  };
+  // Real value of output i whose filter values are reduced by reducer
+  const auto pooled = [&](size_t i, const std::function<float(float, float)> &reducer) {
+    const int c = i % 2;
+    const int w = (i / 2) % 2;
+    const int h = i / 4;
+    float result = in(h * 2, w * 2, c);
+    result = reducer(result, in(h * 2, w * 2 + 1, c));
+    result = reducer(result, in(h * 2 + 1, w * 2, c));
+    return reducer(result, in(h * 2 + 1, w * 2 + 1, c));
+  };
+
+  {
+    auto output = int16Tensor({1, 2, 2, 2}, scale);
+    PoolLayer layer;
+    layer.configure(input.get(), 0, 0, 0, 0, 2, 2, 2, 2, ir::Activation::NONE, output.get(),
+                    PoolType::kMax);
+    layer.run();
+    expectNear(
+      *output,
+      [&](size_t i) { return pooled(i, [](float a, float b) { return std::max(a, b); }); }, 0);
+  }
+  {
+    auto output = int16Tensor({1, 2, 2, 2}, scale);
+    PoolLayer layer;
+    layer.configure(input.get(), 0, 0, 0, 0, 2, 2, 2, 2, ir::Activation::NONE, output.get(),
+                    PoolType::kAvg);
+    layer.run();
+    expectNear(*output, [&](size_t i) {
+      return pooled(i, [](float a, float b) { return a + b; }) / 4;
+    });
+  }
+}
+
+TEST_F(Int16x8LayersTest, Mean)
+{
+  auto input = int16Tensor({1, 3, 4, 2}, 0.01f);
+  fill(*input, -200.f, 300.f);
+  auto axes = std::make_unique<MockUpTensor<int32_t>>(ir::Shape{2},
+                                                      ir::TypeInfo{ir::DataType::INT32});
+  axes->data() = {1, 2};
+  auto output = int16Tensor({1, 1, 1, 2}, 0.02f);
+
+  MeanLayer layer;
+  layer.configure(input.get(), axes.get(), output.get(), true, _context);
+  layer.run();
+  expectNear(*output, [&](size_t c) {
+    float sum = 0.f;
+    for (size_t i = c; i < input->data().size(); i += 2)
+      sum += dequantize(input->data()[i], input->data_scale());
+    return sum / 12;
+  });
+}
+
+TEST_F(Int16x8LayersTest, Mean_large_sum)
+{
+  // Sum of inputs overflows int32
+  auto input = int16Tensor({1, 256, 512, 1}, 0.001f);
+  std::fill(input->data().begin(), input->data().end(), 32000);
+  auto axes = std::make_unique<MockUpTensor<int32_t>>(ir::Shape{2},
+                                                      ir::TypeInfo{ir::DataType::INT32});
+  axes->data() = {1, 2};
+  auto output = int16Tensor({1, 1, 1, 1}, 0.001f);
+
+  MeanLayer layer;
+  layer.configure(input.get(), axes.get(), output.get(), true, _context);
+  layer.run();
+  EXPECT_EQ(output->data()[0], 32000);
+}
+
+TEST_F(Int16x8LayersTest, Concat)
+{
+  const float scale = 0.01f;
+  auto input0 = int16Tensor({1, 2, 3}, scale);
+  auto input1 = int16Tensor({1, 1, 3}, scale);
+  fill(*input0, -300.f, 300.f);
+  fill(*input1, 100.f, -100.f);
+  auto output = int16Tensor({1, 3, 3}, scale);
+
+  ConcatLayer layer;
+  layer.configure({input0.get(), input1.get()}, 1, output.get(), _context);
+  layer.run();
+
+  std::vector<int16_t> expected = input0->data();
+  expected.insert(expected.end(), input1->data().begin(), input1->data().end());
+  EXPECT_EQ(output->data(), expected);
+}
@@ -76,7 +76,9 @@ void LSTMLayer::LSTMFloat()
     n_batch = in_shape.dim(0);
   }
   const int n_input = in_shape.dim(_input->getShape().rank() - 1);
-  const int aux_input_size = 0;
+  // Auxiliary input weights are not given yet
+  if (_aux_input != nullptr)
+    throw std::runtime_error{"LSTMLayer: auxiliary input is not supported"};
 
   // n_cell and n_output will be the same size when there is no projection.
   const int n_cell = _input_to_output_weights->getShape().dim(0);
@@ -144,34 +146,58 @@ void LSTMLayer::LSTMFloat()
   lstm_params.cell_clip = _params.cell_threshold;
   lstm_params.proj_clip = _params.projection_threshold;
 
+  auto *ruy_context = _external_context->ruy_context();
+
+  // Input-to-gate products do not depend on the recurrence, so those of all timesteps are
+  // computed at once before the loop. Rows of the input are in the same order as the input.
+  const int n_rows = max_time * n_batch;
+  const int gate_size = n_rows * n_cell;
+  // Weights of size 0 are also considered as CIFG as in LstmStepFloat
+  const bool use_input_gate = (input_to_input_weights_ptr != nullptr);
+  _input_projection_vec.resize(static_cast<size_t>(gate_size) * (use_input_gate ? 4 : 3));
+  float *forget_input_projection = _input_projection_vec.data();
+  float *cell_input_projection = forget_input_projection + gate_size;
+  float *output_input_projection = cell_input_projection + gate_size;
+  float *input_input_projection = use_input_gate ? output_input_projection + gate_size : nullptr;
+
+  // Layer norm LSTM adds biases after normalization
+  auto input_projection = [&](const float *weights, const float *bias,
+                              const float *layer_norm_coefficients, float *projection) {
+    nnfw::cker::LstmInputProjectionFloat(getBuffer<float>(_input), n_rows, n_input, weights, n_cell,
+                                         layer_norm_coefficients ? nullptr : bias, projection,
+                                         ruy_context);
+  };
+  if (use_input_gate)
+  {
+    input_projection(input_to_input_weights_ptr, input_gate_bias_ptr,
+                     input_layer_norm_coefficients_ptr, input_input_projection);
+  }
+  input_projection(getBuffer<float>(_input_to_forget_weights), getBuffer<float>(_forget_gate_bias),
+                   forget_layer_norm_coefficients_ptr, forget_input_projection);
+  input_projection(getBuffer<float>(_input_to_cell_weights), getBuffer<float>(_cell_gate_bias),
+                   cell_layer_norm_coefficients_ptr, cell_input_projection);
+  input_projection(getBuffer<float>(_input_to_output_weights), getBuffer<float>(_output_gate_bias),
+                   output_layer_norm_coefficients_ptr, output_input_projection);
+
   auto out_shape = _output->getShape();
   const int output_batch_leading_dim = out_shape.dim(out_shape.rank() - 1);
   if (_time_major)
   {
     // Loop through the sequence.
-    const int input_step = n_batch * n_input;
+    const int projection_step = n_batch * n_cell;
     const int output_step = n_batch * output_batch_leading_dim;
     for (int t = 0; t < max_time; t++)
     {
       // If this is the forward_sequence, step forward, otherwise step
       // backwards.
       const int t_rel = _forward_sequence ? t : max_time - t - 1;
-      const float *input_ptr = getBuffer<float>(_input) + t_rel * input_step;
-      const float *aux_input_ptr = nullptr;
-      if (_aux_input)
-      {
-        aux_input_ptr = getBuffer<float>(_aux_input) + t_rel * input_step;
-      }
+      const int projection_offset = t_rel * projection_step;
       float *output_ptr = getBuffer<float>(_output) + t_rel * output_step + _output_offset;
 
       LstmStepFloat(
-        input_ptr, input_to_input_weights_ptr, getBuffer<float>(_input_to_forget_weights),
-        getBuffer<float>(_input_to_cell_weights), getBuffer<float>(_input_to_output_weights),
-        aux_input_ptr,
-        /*aux_input_to_input_weights=*/nullptr,
-        /*aux_input_to_forget_weights=*/nullptr,
-        /*aux_input_to_cell_weights=*/nullptr,
-        /*aux_input_to_output_weights=*/nullptr, recurrent_to_input_weights_ptr,
+        use_input_gate ? input_input_projection + projection_offset : nullptr,
+        forget_input_projection + projection_offset, cell_input_projection + projection_offset,
+        output_input_projection + projection_offset, recurrent_to_input_weights_ptr,
         getBuffer<float>(_recurrent_to_forget_weights),
         getBuffer<float>(_recurrent_to_cell_weights),
         getBuffer<float>(_recurrent_to_output_weights), cell_to_input_weights_ptr,
@@ -180,16 +206,15 @@ void LSTMLayer::LSTMFloat()
         output_layer_norm_coefficients_ptr, input_gate_bias_ptr,
         getBuffer<float>(_forget_gate_bias), getBuffer<float>(_cell_gate_bias),
         getBuffer<float>(_output_gate_bias), projection_weights_ptr, projection_bias_ptr,
-        &lstm_params, n_batch, n_cell, n_input, aux_input_size, n_output, output_batch_leading_dim,
-        output_state_buf, cell_state_buf, input_gate_scratch, forget_gate_scratch,
-        cell_gate_scratch, output_gate_scratch, output_ptr);
+        &lstm_params, n_batch, n_cell, n_output, output_batch_leading_dim, output_state_buf,
+        cell_state_buf, input_gate_scratch, forget_gate_scratch, cell_gate_scratch,
+        output_gate_scratch, output_ptr, ruy_context);
     }
   }
   else
   {
     for (int b = 0; b < n_batch; b++)
     {
-      const int input_step = n_input;
       const int output_step = output_batch_leading_dim;
       for (int t = 0; t < max_time; t++)
       {
@@ -197,12 +222,7 @@ void LSTMLayer::LSTMFloat()
         // backwards.
         const int t_rel = _forward_sequence ? t : max_time - t - 1;
         const int time_offset = b * max_time + t_rel;
-        const float *input_ptr = getBuffer<float>(_input) + time_offset * input_step;
-        const float *aux_input_ptr = nullptr;
-        if (_aux_input)
-        {
-          aux_input_ptr = getBuffer<float>(_aux_input) + time_offset * input_step;
-        }
+        const int projection_offset = time_offset * n_cell;
         float *output_ptr = getBuffer<float>(_output) + time_offset * output_step + _output_offset;
 
         // Offset the {output,cell}_state pointers to the right batch.
@@ -216,13 +236,9 @@ void LSTMLayer::LSTMFloat()
         float *output_gate_scratch_ptr = output_gate_scratch + b * n_cell;
 
         LstmStepFloat(
-          input_ptr, input_to_input_weights_ptr, getBuffer<float>(_input_to_forget_weights),
-          getBuffer<float>(_input_to_cell_weights), getBuffer<float>(_input_to_output_weights),
-          aux_input_ptr,
-          /*aux_input_to_input_weights=*/nullptr,
-          /*aux_input_to_forget_weights=*/nullptr,
-          /*aux_input_to_cell_weights=*/nullptr,
-          /*aux_input_to_output_weights=*/nullptr, recurrent_to_input_weights_ptr,
+          use_input_gate ? input_input_projection + projection_offset : nullptr,
+          forget_input_projection + projection_offset, cell_input_projection + projection_offset,
+          output_input_projection + projection_offset, recurrent_to_input_weights_ptr,
           getBuffer<float>(_recurrent_to_forget_weights),
           getBuffer<float>(_recurrent_to_cell_weights),
           getBuffer<float>(_recurrent_to_output_weights), cell_to_input_weights_ptr,
@@ -231,9 +247,9 @@ void LSTMLayer::LSTMFloat()
           output_layer_norm_coefficients_ptr, input_gate_bias_ptr,
           getBuffer<float>(_forget_gate_bias), getBuffer<float>(_cell_gate_bias),
           getBuffer<float>(_output_gate_bias), projection_weights_ptr, projection_bias_ptr,
-          &lstm_params, /*n_batch=*/1, n_cell, n_input, aux_input_size, n_output,
-          output_batch_leading_dim, output_state_ptr, cell_state_ptr, input_gate_scratch_ptr,
-          forget_gate_scratch_ptr, cell_gate_scratch_ptr, output_gate_scratch_ptr, output_ptr);
+          &lstm_params, /*n_batch=*/1, n_cell, n_output, output_batch_leading_dim,
+          output_state_ptr, cell_state_ptr, input_gate_scratch_ptr, forget_gate_scratch_ptr,
+          cell_gate_scratch_ptr, output_gate_scratch_ptr, output_ptr, ruy_context);
       }
     }
   }
@@ -259,7 +275,8 @@ void LSTMLayer::configure(
   const IPortableTensor *cell_state_in, const ir::operation::LSTM::Param &params,
   bool forward_sequence, bool time_major, int output_offset, IPortableTensor *scratch_buffer,
   IPortableTensor *output_state, IPortableTensor *cell_state, IPortableTensor *output,
-  bool has_output_state_data, bool has_cell_state_data)
+  bool has_output_state_data, bool has_cell_state_data,
+  const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _input_to_input_weights = input_to_input_weights;
@@ -298,6 +315,7 @@ void LSTMLayer::configure(
   _output = output;
   _has_output_state_data = has_output_state_data;
   _has_cell_state_data = has_cell_state_data;
+  _external_context = external_context;
 }
 
 void LSTMLayer::run()
@@ -19,6 +19,7 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 #include <ir/InternalType.h>
 #include <ir/operation/LSTM.h>
 #include <exec/IFunction.h>
@@ -72,7 +73,8 @@ public:
     const IPortableTensor *cell_state_in, const ir::operation::LSTM::Param &params,
     bool forward_sequence, bool time_major, int32_t output_offset, IPortableTensor *scratch_buffer,
     IPortableTensor *output_state, IPortableTensor *cell_state, IPortableTensor *output,
-    bool has_output_state_data, bool has_cell_state_data);
+    bool has_output_state_data, bool has_cell_state_data,
+    const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -113,12 +115,14 @@ private:
   std::vector<uint8_t> _scratch_vec{};
   std::vector<uint8_t> _output_state_vec{};
   std::vector<uint8_t> _cell_state_vec{};
+  std::vector<float> _input_projection_vec{};
   ir::operation::LSTM::Param _params{};
   bool _forward_sequence{true};
   bool _time_major{true};
   int32_t _output_offset{0};
   bool _has_output_state_data{false};
   bool _has_cell_state_data{false};
+  std::shared_ptr<ExternalContext> _external_context{nullptr};
 };
 
 } // namespace ops
@@ -29,7 +29,8 @@ namespace cpu
 namespace ops
 {
 
-LogSoftMaxLayer::LogSoftMaxLayer() : _input(nullptr), _output(nullptr), _beta(0.0), _axis(0)
+LogSoftMaxLayer::LogSoftMaxLayer()
+  : _input(nullptr), _output(nullptr), _beta(0.0), _axis(0), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -50,7 +51,7 @@ void LogSoftMaxLayer::logsoftmaxFloat32()
   op_params.beta = _beta;
   op_params.axis = _axis;
   nnfw::cker::LogSoftmax(op_params, getShape(_input), getBuffer<float>(_input), getShape(_output),
-                         getBuffer<float>(_output));
+                         getBuffer<float>(_output), _external_context->ruy_context());
 }
 
 void LogSoftMaxLayer::logsoftmaxQuant8()
@@ -63,16 +64,18 @@ void LogSoftMaxLayer::logsoftmaxQuant8()
   op_params.scale = _output->data_scale();
   nnfw::cker::LogSoftmax(op_params, _input->data_scale(), getShape(_input),
                          getBuffer<uint8_t>(_input), getShape(_output),
-                         getBuffer<uint8_t>(_output));
+                         getBuffer<uint8_t>(_output), _external_context->ruy_context());
 }
 
 void LogSoftMaxLayer::configure(const IPortableTensor *input, const float beta, const int axis,
-                                IPortableTensor *output)
+                                IPortableTensor *output,
+                                const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
   _beta = beta;
   _axis = axis;
+  _external_context = external_context;
   if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
     PopulateLookupTable(_beta);
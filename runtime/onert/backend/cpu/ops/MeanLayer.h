@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_MEANLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -40,8 +41,10 @@ public:
 
   void MeanQuant8();
 
+  void MeanQuant16();
+
   void configure(const IPortableTensor *input, const IPortableTensor *axes, IPortableTensor *output,
-                 bool keep_dims);
+                 bool keep_dims, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -50,6 +53,7 @@ protected:
   const IPortableTensor *_axes;
   IPortableTensor *_output;
   bool _keep_dims;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
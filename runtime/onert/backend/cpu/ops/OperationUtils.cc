@@ -16,6 +16,8 @@
 
 #include "OperationUtils.h"
 
+#include "../Tensor.h"
+
 #include <algorithm>
 #include <cassert>
 #include <cmath>
@@ -158,6 +160,11 @@ void CalculateActivationRangeQuantized(ir::Activation activation, const IPortabl
       qmin = std::numeric_limits<int8_t>::min();
       qmax = std::numeric_limits<int8_t>::max();
       break;
+    case OperandType::QUANT_INT16_ASYMM:
+    case OperandType::QUANT_INT16_SYMM:
+      qmin = std::numeric_limits<int16_t>::min();
+      qmax = std::numeric_limits<int16_t>::max();
+      break;
     default:
       throw std::runtime_error("CalculateActivationRangeQuantized: Not supported operand type.");
   }
@@ -308,6 +315,15 @@ std::vector<int32_t> getReducerAxes(const IPortableTensor *axes)
   return ret;
 }
 
+void releaseConstantTensor(const IPortableTensor *tensor)
+{
+  assert(tensor->is_constant());
+  auto cpu_tensor = dynamic_cast<const Tensor *>(tensor);
+  if (cpu_tensor)
+    // TODO Remove const_cast
+    const_cast<Tensor *>(cpu_tensor)->decrease_ref();
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
@@ -141,6 +141,13 @@ inline int32_t getAxis(uint32_t rank, int32_t axis)
   return ret;
 }
 
+// The circle loader reads int16 tensors as QUANT_INT16_ASYMM and others use QUANT_INT16_SYMM,
+// but both are symmetric int16 activations whose zero point is 0
+inline bool isQuantInt16(OperandType type)
+{
+  return type == OperandType::QUANT_INT16_ASYMM || type == OperandType::QUANT_INT16_SYMM;
+}
+
 void QuantizeMultiplier(double double_multiplier, int32_t *quantized_multiplier, int *shift);
 
 void GetQuantizedConvolutionMultiplier(const IPortableTensor *inputDescr,
@@ -169,6 +176,11 @@ nnfw::cker::PaddingType getPaddingType(ir::PaddingType ir_padding_type);
 
 std::vector<int32_t> getReducerAxes(const IPortableTensor *axes);
 
+/**
+ * @brief Releases constant data of a tensor unless other operations still use it
+ */
+void releaseConstantTensor(const IPortableTensor *tensor);
+
 template <typename T> const T *getBuffer(const IPortableTensor *tensor)
 {
   return reinterpret_cast<const T *>(tensor->buffer());
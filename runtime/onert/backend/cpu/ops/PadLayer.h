@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_PADLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -42,7 +43,8 @@ public:
   template <typename T> void padImpl(const T *constant_value_data);
 
   void configure(const IPortableTensor *input, const IPortableTensor *pad,
-                 const IPortableTensor *value, IPortableTensor *output);
+                 const IPortableTensor *value, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -52,6 +54,7 @@ protected:
   const IPortableTensor *_value;
   IPortableTensor *_output;
   ConstDataPtr _constantValueData;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -33,19 +33,23 @@ namespace cpu
 namespace ops
 {
 template <typename InputT, typename OutputT>
-void affineQuantize(const IPortableTensor *input, IPortableTensor *output)
+void affineQuantize(const IPortableTensor *input, IPortableTensor *output,
+                    ruy::Context *ruy_context)
 {
   nnfw::cker::Quantize(getShape(input), getBuffer<InputT>(input), getShape(output),
-                       getBuffer<OutputT>(output), output->data_scale(), output->data_zero_point());
+                       getBuffer<OutputT>(output), output->data_scale(), output->data_zero_point(),
+                       ruy_context);
 }
 
-void QuantizeLayer::configure(const IPortableTensor *input, IPortableTensor *output)
+void QuantizeLayer::configure(const IPortableTensor *input, IPortableTensor *output,
+                              const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(input != nullptr);
   assert(output != nullptr);
 
   _input = input;
   _output = output;
+  _external_context = external_context;
 
   if ((_input->data_type() == OperandType::FLOAT32))
   {
@@ -70,7 +74,7 @@ void QuantizeLayer::run()
 {
   if ((_input->data_type() == OperandType::FLOAT32))
   {
-    affineQuantize<float, uint8_t>(_input, _output);
+    affineQuantize<float, uint8_t>(_input, _output, _external_context->ruy_context());
   }
   else if ((_input->data_type() == OperandType::QUANT_UINT8_ASYMM) &&
            (_output->data_type() == OperandType::QUANT_INT8_ASYMM))
@@ -78,7 +82,7 @@ void QuantizeLayer::run()
     nnfw::cker::Requantize<uint8_t, int8_t>(
       getBuffer<uint8_t>(_input), MatchingFlatSize(getShape(_input), getShape(_output)),
       _output_multiplier, _output_shift, _input->data_zero_point(), _output->data_zero_point(),
-      getBuffer<int8_t>(_output));
+      getBuffer<int8_t>(_output), _external_context->ruy_context());
   }
   else if ((_input->data_type() == OperandType::QUANT_INT8_ASYMM) &&
            (_output->data_type() == OperandType::QUANT_UINT8_ASYMM))
@@ -86,7 +90,7 @@ void QuantizeLayer::run()
     nnfw::cker::Requantize<int8_t, uint8_t>(
       getBuffer<int8_t>(_input), MatchingFlatSize(getShape(_input), getShape(_output)),
       _output_multiplier, _output_shift, _input->data_zero_point(), _output->data_zero_point(),
-      getBuffer<uint8_t>(_output));
+      getBuffer<uint8_t>(_output), _external_context->ruy_context());
   }
   else
   {
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_QUANTIZELAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -32,13 +33,16 @@ namespace ops
 class QuantizeLayer : public ::onert::exec::IFunction
 {
 public:
-  QuantizeLayer() : _input(nullptr), _output(nullptr), _output_multiplier(0), _output_shift(0)
+  QuantizeLayer()
+    : _input(nullptr), _output(nullptr), _output_multiplier(0), _output_shift(0),
+      _external_context(nullptr)
   {
     // DO NOTHING
   }
 
 public:
-  void configure(const IPortableTensor *input, IPortableTensor *output);
+  void configure(const IPortableTensor *input, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
   void run() override;
 
 private:
@@ -46,6 +50,7 @@ private:
   IPortableTensor *_output;
   int32_t _output_multiplier;
   int _output_shift;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 } // namespace ops
 } // namespace cpu
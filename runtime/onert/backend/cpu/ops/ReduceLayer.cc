@@ -36,12 +36,14 @@ namespace
 template <typename T>
 void evalLogic(const IPortableTensor *input, IPortableTensor *output, const std::vector<int> &axes,
                bool keep_dims, T init_value, nnfw::cker::Reduce &reduce_kernel,
+               const std::shared_ptr<ExternalContext> &external_context,
                T reducer(const T current, const T in))
 {
   reduce_kernel.prepare(input->getShape().rank(), axes.size());
-  bool result =
-    reduce_kernel.ReduceGeneric<T>(getShape(input), getBuffer<T>(input), getShape(output),
-                                   getBuffer<T>(output), axes, keep_dims, init_value, reducer);
+  bool result = reduce_kernel.ReduceGeneric<T>(getShape(input), getBuffer<T>(input),
+                                               getShape(output), getBuffer<T>(output), axes,
+                                               keep_dims, init_value, reducer,
+                                               external_context->ruy_context());
 
   if (!result)
   {
@@ -51,30 +53,33 @@ void evalLogic(const IPortableTensor *input, IPortableTensor *output, const std:
 
 template <typename T>
 std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &)>
-evalType(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type)
+evalType(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type,
+         const std::shared_ptr<ExternalContext> &external_context)
 {
   switch (reduce_type)
   {
     case ReduceType::kSum:
       return std::bind(&evalLogic<T>, std::placeholders::_1, std::placeholders::_2,
                        std::placeholders::_3, keep_dims, static_cast<T>(0), reduce_kernel,
+                       external_context,
                        [](const T current, const T in) -> T { return in + current; });
       break;
     case ReduceType::kProd:
       return std::bind(&evalLogic<T>, std::placeholders::_1, std::placeholders::_2,
                        std::placeholders::_3, keep_dims, static_cast<T>(1), reduce_kernel,
+                       external_context,
                        [](const T current, const T in) -> T { return in * current; });
       break;
     case ReduceType::kMax:
       return std::bind(
         &evalLogic<T>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
-        keep_dims, std::numeric_limits<T>::lowest(), reduce_kernel,
+        keep_dims, std::numeric_limits<T>::lowest(), reduce_kernel, external_context,
         [](const T current, const T in) -> T { return (in > current) ? in : current; });
       break;
     case ReduceType::kMin:
       return std::bind(
         &evalLogic<T>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
-        keep_dims, std::numeric_limits<T>::max(), reduce_kernel,
+        keep_dims, std::numeric_limits<T>::max(), reduce_kernel, external_context,
         [](const T current, const T in) -> T { return (in < current) ? in : current; });
       break;
     default:
@@ -85,19 +90,20 @@ evalType(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_ty
 // Template specialization for bool type
 template <>
 std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &)>
-evalType<bool>(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type)
+evalType<bool>(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type,
+               const std::shared_ptr<ExternalContext> &external_context)
 {
   static_assert(sizeof(bool) == 1, "cpu backend supports bool type which is 1 byte");
   switch (reduce_type)
   {
     case ReduceType::kAny:
       return std::bind(&evalLogic<bool>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, false, reduce_kernel,
+                       std::placeholders::_3, keep_dims, false, reduce_kernel, external_context,
                        [](const bool current, const bool in) -> bool { return in || current; });
       break;
     case ReduceType::kAll:
       return std::bind(&evalLogic<bool>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, true, reduce_kernel,
+                       std::placeholders::_3, keep_dims, true, reduce_kernel, external_context,
                        [](const bool current, const bool in) -> bool { return in && current; });
       break;
     default:
@@ -107,16 +113,17 @@ evalType<bool>(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType red
 
 std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &)>
 generateKernelGeneric(const IPortableTensor *input, bool keep_dims,
-                      nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type)
+                      nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type,
+                      const std::shared_ptr<ExternalContext> &external_context)
 {
   switch (input->data_type())
   {
     case OperandType::FLOAT32:
-      return evalType<float>(keep_dims, reduce_kernel, reduce_type);
+      return evalType<float>(keep_dims, reduce_kernel, reduce_type, external_context);
     case OperandType::INT32:
-      return evalType<int32_t>(keep_dims, reduce_kernel, reduce_type);
+      return evalType<int32_t>(keep_dims, reduce_kernel, reduce_type, external_context);
     case OperandType::BOOL8:
-      return evalType<bool>(keep_dims, reduce_kernel, reduce_type);
+      return evalType<bool>(keep_dims, reduce_kernel, reduce_type, external_context);
     default:
       throw std::runtime_error{"Reduce(generic): unsupported data type"};
   }
@@ -125,7 +132,8 @@ generateKernelGeneric(const IPortableTensor *input, bool keep_dims,
 // TODO Refine this function
 void evalSumQuantized(const IPortableTensor *input, IPortableTensor *output,
                       const std::vector<int> &axes, bool keep_dims,
-                      nnfw::cker::Reduce &reduce_kernel)
+                      nnfw::cker::Reduce &reduce_kernel,
+                      const std::shared_ptr<ExternalContext> &external_context)
 {
   const bool same_scale = (input->data_scale() == output->data_scale() &&
                            input->data_zero_point() == output->data_zero_point());
@@ -152,7 +160,8 @@ void evalSumQuantized(const IPortableTensor *input, IPortableTensor *output,
     return;
   }
 
-  const auto kernel = generateKernelGeneric(input, keep_dims, reduce_kernel, ReduceType::kSum);
+  const auto kernel =
+    generateKernelGeneric(input, keep_dims, reduce_kernel, ReduceType::kSum, external_context);
   kernel(input, output, axes);
 }
 
@@ -160,7 +169,7 @@ void evalSumQuantized(const IPortableTensor *input, IPortableTensor *output,
 
 ReduceLayer::ReduceLayer()
   : _input(nullptr), _axes(nullptr), _output(nullptr), _reduce_kernel(new nnfw::cker::Reduce()),
-    _kernel(), _reduceType(ReduceType::kInvalid)
+    _kernel(), _reduceType(ReduceType::kInvalid), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -168,12 +177,14 @@ ReduceLayer::ReduceLayer()
 ReduceLayer::~ReduceLayer() = default;
 
 void ReduceLayer::configure(const IPortableTensor *input, const IPortableTensor *axes,
-                            IPortableTensor *output, ReduceType reduceType, bool keep_dims)
+                            IPortableTensor *output, ReduceType reduceType, bool keep_dims,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _axes = axes;
   _output = output;
   _reduceType = reduceType;
+  _external_context = external_context;
 
   switch (_reduceType)
   {
@@ -181,25 +192,31 @@ void ReduceLayer::configure(const IPortableTensor *input, const IPortableTensor
       if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
       {
         _kernel = std::bind(&evalSumQuantized, std::placeholders::_1, std::placeholders::_2,
-                            std::placeholders::_3, keep_dims, *_reduce_kernel);
+                            std::placeholders::_3, keep_dims, *_reduce_kernel, _external_context);
         return;
       }
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kSum);
+      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kSum,
+                                      _external_context);
       break;
     case ReduceType::kProd:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kProd);
+      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kProd,
+                                      _external_context);
       break;
     case ReduceType::kMax:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kMax);
+      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kMax,
+                                      _external_context);
       break;
     case ReduceType::kMin:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kMin);
+      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kMin,
+                                      _external_context);
       break;
     case ReduceType::kAny:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kAny);
+      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kAny,
+                                      _external_context);
       break;
     case ReduceType::kAll:
-      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kAll);
+      _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kAll,
+                                      _external_context);
       break;
     default:
       throw std::runtime_error{"Reduce: Unsupported reduce type"};
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_SOFTMAXLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -40,7 +41,8 @@ public:
 
   template <typename T> void softmaxQuant8();
 
-  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output);
+  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -54,6 +56,8 @@ private:
   float _table[256];
   uint8_t _uint8_table1[256];
   uint8_t _uint8_table2[256];
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -173,7 +173,7 @@ void KernelGenerator::visit(const ir::train::operation::BinaryArithmetic &node)
 
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
   fn->configure(lhs_tensor, rhs_tensor, output_tensor, activation,
-                static_cast<cpu::ops::ArithmeticType>(arithmetic_type));
+                static_cast<cpu::ops::ArithmeticType>(arithmetic_type), _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -224,7 +224,7 @@ void KernelGenerator::visit(const ir::train::operation::Conv2D &node)
   fn->configure(in_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left, padding.right,
                 padding.top, padding.bottom, stride.horizontal, stride.vertical,
                 dilation.width_factor, dilation.height_factor, activation, out_tensor,
-                is_cacheable_weights);
+                is_cacheable_weights, _external_context, nullptr /* fp16_weights */);
 
   auto ker_grad_tensor = _tensor_reg->getGradientTensor(ker_index);
   auto bias_grad_tensor = _tensor_reg->getGradientTensor(bias_index);
@@ -281,7 +281,8 @@ void KernelGenerator::visit(const ir::train::operation::DepthwiseConv2D &node)
 
   fn->configure(ifm_tensor, ker_tensor, bias_tensor, padding.left, padding.right, padding.top,
                 padding.bottom, stride.horizontal, stride.vertical, multiplier, dilation_width,
-                dilation_height, activation, ofm_tensor, _external_context);
+                dilation_height, activation, ofm_tensor, _external_context,
+                nullptr /* fp16_weights */);
 
   if (node.isRequiredForBackward())
   {
@@ -327,7 +328,7 @@ void KernelGenerator::visit(const ir::train::operation::ElementwiseActivation &n
   };
 
   fn->configure(input_tensor, output_tensor, node.param().alpha, node.param().beta,
-                convertToInferActivationType(node.param().op_type));
+                convertToInferActivationType(node.param().op_type), _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -363,7 +364,7 @@ void KernelGenerator::visit(const ir::train::operation::FullyConnected &node)
   auto fn = std::make_unique<ops::FullyConnectedLayer>();
 
   fn->configure(in_tensor, weights_tensor, bias_tensor, activation, weights_format, out_tensor,
-                _external_context);
+                _external_context, nullptr /* fp16_weights */);
 
   if (node.isRequiredForBackward())
   {
@@ -448,7 +449,7 @@ void KernelGenerator::visit(const ir::train::operation::Pad &node)
     value = _tensor_reg->getPortableTensor(value_index);
   }
 
-  fn->configure(input, pad, value, output);
+  fn->configure(input, pad, value, output, _external_context);
   if (node.isRequiredForBackward())
   {
     auto out_back_prop_tensor = getBackPropOut(output_index);
@@ -532,7 +533,7 @@ void KernelGenerator::visit(const ir::train::operation::Reduce &node)
   if (node.param().reduce_type == ir::operation::Reduce::ReduceType::MEAN)
   {
     auto fn = std::make_unique<ops::MeanLayer>();
-    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims, _external_context);
     if (node.isRequiredForBackward())
     {
       auto back_prop_output_tensor = getBackPropOut(output_index);
@@ -592,7 +593,7 @@ void KernelGenerator::visit(const ir::train::operation::Softmax &node)
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, output_tensor);
+  fn->configure(input_tensor, beta, output_tensor, _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -16,7 +16,33 @@
 
 #include "ExternalContext.h"
 
+#include <util/ThreadBudget.h>
+
 #include <cassert>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+
+// pthreadpool serializes parallel calls from several threads, so a pool can be shared
+std::shared_ptr<pthreadpool> sharedThreadPool(size_t num_threads)
+{
+  static std::mutex mutex;
+  static std::unordered_map<size_t, std::weak_ptr<pthreadpool>> pools;
+
+  std::lock_guard<std::mutex> lock{mutex};
+  auto &weak_pool = pools[num_threads];
+  auto pool = weak_pool.lock();
+  if (!pool)
+  {
+    pool = std::shared_ptr<pthreadpool>(pthreadpool_create(num_threads), pthreadpool_destroy);
+    weak_pool = pool;
+  }
+  return pool;
+}
+
+} // namespace
 
 namespace onert
 {
@@ -25,10 +51,21 @@ namespace backend
 namespace xnnpack
 {
 
-ExternalContext::ExternalContext(size_t num_threads)
-  : _threadpool(pthreadpool_create(num_threads), pthreadpool_destroy)
+ExternalContext::ExternalContext(size_t num_threads) : _num_threads(num_threads)
+{
+  // DO NOTHING
+}
+
+pthreadpool *ExternalContext::getThreadPool()
 {
-  assert(_threadpool);
+  // Sized at run time, when the lease of the execution is known
+  const size_t num_threads = onert::util::ThreadBudget::get().cap(_num_threads);
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto &threadpool = _threadpools[num_threads];
+  if (!threadpool)
+    threadpool = sharedThreadPool(num_threads);
+  assert(threadpool);
+  return threadpool.get();
 }
 
 } // namespace xnnpack
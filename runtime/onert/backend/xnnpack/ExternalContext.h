@@ -18,6 +18,8 @@
 #define __ONERT_BACKEND_XNNPACK_EXTERNAL_CONTEXT_H__
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <xnnpack.h>
 
 namespace onert
@@ -33,10 +35,20 @@ public:
   ExternalContext(size_t num_threads);
 
 public:
-  pthreadpool *getThreadPool() { return _threadpool.get(); }
+  /**
+   * @brief Return a thread pool of num_threads capped by the lease of the calling thread
+   *
+   * Call this when running kernels, as it is capped by the whole thread budget outside of any
+   * execution, e.g. while preparing kernels.
+   */
+  pthreadpool *getThreadPool();
 
 private:
-  std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> _threadpool;
+  size_t _num_threads;
+  std::mutex _mutex;
+  // By number of threads, kept while this context lives as kernels may keep using them. Pools are
+  // shared by contexts of the same number of threads.
+  std::unordered_map<size_t, std::shared_ptr<pthreadpool>> _threadpools;
 };
 
 } // namespace xnnpack
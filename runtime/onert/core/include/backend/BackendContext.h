@@ -22,6 +22,7 @@
 #include "ir/OperationIndexMap.h"
 #include "ir/OperandIndexMap.h"
 #include "exec/FunctionSequence.h"
+#include "util/PreparedCache.h"
 #include "util/Set.h"
 
 namespace onert
@@ -46,6 +47,8 @@ struct ContextData
   std::shared_ptr<custom::IKernelBuilder> custom_kernel_builder;
   /* Is linear executor or not */
   bool is_linear_executor;
+  /* Cache of prepared constant data, nullptr if disabled */
+  std::shared_ptr<util::PreparedCache> prepared_cache;
 };
 
 class BackendContext
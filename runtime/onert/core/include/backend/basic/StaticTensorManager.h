@@ -36,10 +36,18 @@ class DynamicTensorManager;
 class StaticTensorManager
 {
 public:
+  /**
+   * @param[in] shared_memory_operand_indexes Map from an operand to the operand whose memory it
+   *                                          uses instead of its own
+   */
   StaticTensorManager(const std::shared_ptr<TensorRegistry> &reg,
-                      DynamicTensorManager *dynamic_tensor_manager);
+                      DynamicTensorManager *dynamic_tensor_manager,
+                      const ir::OperandIndexMap<ir::OperandIndex> &shared_memory_operand_indexes =
+                        ir::OperandIndexMap<ir::OperandIndex>{});
   StaticTensorManager(const std::shared_ptr<TensorRegistry> &reg, const std::string planner_id,
-                      DynamicTensorManager *dynamic_tensor_manager);
+                      DynamicTensorManager *dynamic_tensor_manager,
+                      const ir::OperandIndexMap<ir::OperandIndex> &shared_memory_operand_indexes =
+                        ir::OperandIndexMap<ir::OperandIndex>{});
   virtual ~StaticTensorManager() = default;
 
   void allocateNonconsts(void);
@@ -52,11 +60,17 @@ public:
 
   void iterate(const std::function<void(const ir::OperandIndex &)> &fn);
 
+private:
+  ir::OperandIndex sourceOperandIndex(const ir::OperandIndex &ind) const;
+
 private:
   std::unique_ptr<MemoryManager> _nonconst_mgr;
   const std::shared_ptr<TensorRegistry> _tensors;
   ir::OperandIndexMap<bool> _as_constants;
   DynamicTensorManager *_dynamic_tensor_manager;
+  const ir::OperandIndexMap<ir::OperandIndex> _shared_memory_operand_indexes;
+  // Number of releases to skip for each source operand, one for each operand sharing its memory
+  ir::OperandIndexMap<uint32_t> _pending_shared_releases;
 };
 
 } // namespace basic
@@ -37,8 +37,17 @@ namespace basic
 class TensorBuilder
 {
 public:
-  TensorBuilder(const std::shared_ptr<TensorRegistry> &tensor_reg);
-  TensorBuilder(const std::shared_ptr<TensorRegistry> &tensor_reg, const std::string planner_id);
+  /**
+   * @param[in] tensor_reg                    Registry of the tensors to build
+   * @param[in] shared_memory_operand_indexes Map from an operand to the operand whose memory it
+   *                                          uses instead of its own
+   */
+  TensorBuilder(const std::shared_ptr<TensorRegistry> &tensor_reg,
+                const ir::OperandIndexMap<ir::OperandIndex> &shared_memory_operand_indexes =
+                  ir::OperandIndexMap<ir::OperandIndex>{});
+  TensorBuilder(const std::shared_ptr<TensorRegistry> &tensor_reg, const std::string planner_id,
+                const ir::OperandIndexMap<ir::OperandIndex> &shared_memory_operand_indexes =
+                  ir::OperandIndexMap<ir::OperandIndex>{});
 
   /**
    * @brief     Register tensor information to allocate on CPU backend
@@ -21,8 +21,7 @@
 #include "exec/FunctionSequence.h"
 #include "ir/Index.h"
 #include "ir/IOperation.h"
-
-#include <unordered_map>
+#include "ir/OperationIndexMap.h"
 
 namespace onert
 {
@@ -43,7 +42,7 @@ struct CodeAndInfo
   }
 };
 
-using CodeMap = std::unordered_map<ir::OperationIndex, CodeAndInfo>;
+using CodeMap = ir::OperationIndexMap<CodeAndInfo>;
 
 } // namespace compiler
 } // namespace onert
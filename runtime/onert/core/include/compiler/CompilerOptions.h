@@ -70,10 +70,15 @@ struct CompilerOptions
   int graph_dump_level; //< Graph dump level, values between 0 and 2 are valid
   std::string executor; //< Executor name to use
   ManualSchedulerOptions manual_scheduler_options; //< Options for ManualScheduler
-  bool he_scheduler;         //< HEScheduler if true, ManualScheduler otherwise
-  bool he_profiling_mode;    //< Whether HEScheduler profiling mode ON/OFF
-  bool fp16_enable;          //< Whether fp16 mode ON/OFF
-  std::string workspace_dir; //< Workspace directory path
+  bool he_scheduler;               //< HEScheduler if true, ManualScheduler otherwise
+  bool he_profiling_mode;          //< Whether HEScheduler profiling mode ON/OFF
+  bool fp16_enable;                //< Whether fp16 mode ON/OFF
+  std::string workspace_dir;       //< Workspace directory path
+  bool prepared_cache;             //< Whether to cache prepared constants in workspace_dir
+  uint64_t model_key;              //< Key of loaded models for prepared_cache, 0 if unknown
+  uint32_t weight_paging_distance; //< Operations to prefetch mapped weights ahead, 0 to disable
+  uint32_t shape_specialization_runs; //< Runs of new input shapes to compile them, 0 to disable
+  bool elementwise_fusion;            //< Whether to fuse elementwise operations of cpu backend
 };
 
 } // namespace compiler
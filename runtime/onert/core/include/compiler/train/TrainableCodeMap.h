@@ -19,10 +19,9 @@
 
 #include "backend/Backend.h"
 #include "exec/train/TrainableFnSequence.h"
+#include "ir/OperationIndexMap.h"
 #include "ir/train/ITrainableOperation.h"
 
-#include <unordered_map>
-
 namespace onert
 {
 namespace compiler
@@ -46,7 +45,7 @@ struct TrainableCodeAndInfo
   }
 };
 
-using TrainableCodeMap = std::unordered_map<ir::OperationIndex, TrainableCodeAndInfo>;
+using TrainableCodeMap = ir::OperationIndexMap<TrainableCodeAndInfo>;
 
 } // namespace train
 } // namespace compiler
@@ -20,9 +20,12 @@
 #include "ir/Operands.h"
 #include "ir/OperationVisitor.h"
 #include "ir/Index.h"
+#include "ir/OperandIndexSequence.h"
 #include "backend/ITensorRegistry.h"
 
-#include <map>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 namespace onert
 {
@@ -44,6 +47,14 @@ public:
     UNUSED_RELEASE(_tensor_registry);
   }
 
+public:
+  /**
+   * @brief Infer shapes of output tensors of @c op and apply them
+   * @note  If inputs and outputs are in the same state as the last inference for @c op,
+   *        shapes inferred then are applied again without inference
+   */
+  void infer(const ir::IOperation &op);
+
 public:
   // TODO Define visitors for operations. List them in alphabetic order.
   // Remove TODO when any op starting from the alphabet is added
@@ -63,6 +74,7 @@ public:
   void visit(const ir::operation::Fill &op) override;
   void visit(const ir::operation::FullyConnected &op) override;
   void visit(const ir::operation::FusedBatchNorm &op) override;
+  void visit(const ir::operation::FusedElementwise &op) override;
   void visit(const ir::operation::Gather &op) override;
   void visit(const ir::operation::L2Normalization &op) override;
   void visit(const ir::operation::LSTM &op) override;
@@ -90,11 +102,46 @@ public:
   void visit(const ir::operation::StridedSlice &op) override;
   void visit(const ir::operation::SquaredDifference &op) override;
   void visit(const ir::operation::Tile &op) override;
+  void visit(const ir::operation::TopKV2 &op) override;
   void visit(const ir::operation::Transpose &op) override;
   void visit(const ir::operation::Unpack &op) override;
   // TODO write op starting from V
 
 private:
+  /**
+   * @brief Shapes applied by the last inference of an operation and the state it started from
+   */
+  struct ShapeMemo
+  {
+    struct TensorState
+    {
+      ir::Shape shape;
+      bool dynamic;
+      bool allocated;
+    };
+
+    bool valid = false;
+    // Inputs whose values decide output shapes, e.g. shape of Reshape
+    ir::OperandIndexSequence deciding;
+    // States of inputs and outputs before inference
+    std::vector<TensorState> states;
+    // Values of deciding inputs before inference
+    std::vector<uint8_t> values;
+    // Shapes applied to tensors in order
+    std::vector<std::pair<backend::ITensor *, ir::Shape>> applied;
+  };
+
+  /**
+   * @brief Apply @c shape to @c tensor, and record it if the inference is being memoized
+   */
+  void applyShape(backend::ITensor *tensor, const ir::Shape &shape);
+  /**
+   * @brief Save the state of inputs and outputs of @c op to @c memo, or compare it with @c memo
+   * @return @c false if the state cannot be saved or differs from @c memo
+   */
+  bool saveState(const ir::IOperation &op, ShapeMemo &memo) const;
+  bool matchState(const ir::IOperation &op, const ShapeMemo &memo) const;
+
   /**
    * @brief Performs shape inference and memory allocation for arithmetic operation
    */
@@ -128,6 +175,9 @@ private:
    * @brief To get tensor object and access tensor-level info, e.g., ITensor::buffer()
    */
   std::shared_ptr<backend::ITensorRegistry> _tensor_registry;
+  std::unordered_map<const ir::IOperation *, ShapeMemo> _memos;
+  // Memo of the operation being inferred
+  ShapeMemo *_recording = nullptr;
 };
 
 } // namespace exec
@@ -178,6 +178,16 @@ public:
 
   ExecutionOptions &executionOptions() { return _ctx.options; }
 
+  /**
+   * @brief     Take I/O buffers, layouts and types set on another execution
+   * @param[in] other Execution whose I/O settings are taken
+   * @note      It is used to replace executors between runs without setting I/O again.
+   *            I/O types of the other execution are kept as user types, so I/O are converted
+   *            if the models use different types (e.g. float model and its quantized model).
+   *            Both executions should have the same number of inputs and outputs.
+   */
+  void takeIODescription(const Execution &other);
+
 private:
   const IExecutor *entryExecutor() const { return _executors->entryExecutor(); };
   IExecutor *entryExecutor() { return _executors->entryExecutor(); };
@@ -67,7 +67,11 @@ struct ExecutionOptions
 {
   bool dump_minmax = false;
   bool trace = false;
+  // Trace 1 in every trace_sample_rate runs
+  uint32_t trace_sample_rate = 1;
   bool profile = false;
+  // Maximum number of threads leased for a run, 0 for no limit other than the thread budget
+  uint32_t thread_quota = 0;
 
   static void fromGlobalConfig(ExecutionOptions &options);
 };
@@ -20,6 +20,8 @@
 #include "ir/Index.h"
 #include "util/MinMaxMap.h"
 
+#include <tuple>
+
 namespace onert
 {
 namespace exec
@@ -32,19 +34,22 @@ namespace exec
  * because onert could try optimization (reusing allocation, removing redundant tensors,
  * code optimization, ...)
  * For Linear Executor and CPU backcend, onert keep track of op index in generated Code.
- * MinMaxMap uses operation index instead.
+ * MinMaxMap uses operation index instead, with output index for operations with multiple outputs.
  *
  * TODO: Stop recording in case of onert internal optimization (e.g. code fusion) occcurs.
  *       It rarely happens since most fusioning is done by compiler frontend, not by onert.
  */
+using OpMinMaxKey = std::tuple<ir::SubgraphIndex, ir::OperationIndex, ir::IOIndex>;
 struct OpMinMaxHash
 {
-  size_t operator()(const std::pair<ir::SubgraphIndex, ir::OperationIndex> &k) const noexcept
+  size_t operator()(const OpMinMaxKey &k) const noexcept
   {
-    return std::hash<ir::SubgraphIndex>()(k.first) ^ std::hash<ir::OperationIndex>()(k.second);
+    return std::hash<ir::SubgraphIndex>()(std::get<0>(k)) ^
+           std::hash<ir::OperationIndex>()(std::get<1>(k)) ^
+           (std::hash<ir::IOIndex>()(std::get<2>(k)) << 16);
   }
 };
-using OpMinMaxMap = util::MinMaxMap<std::pair<ir::SubgraphIndex, ir::OperationIndex>, OpMinMaxHash>;
+using OpMinMaxMap = util::MinMaxMap<OpMinMaxKey, OpMinMaxHash>;
 
 struct IOMinMaxHash
 {
@@ -18,6 +18,7 @@
 #define __ONERT_IR_DATA_H__
 
 #include <algorithm>
+#include <cstdint>
 #include <sys/mman.h>
 
 namespace onert
@@ -95,6 +96,19 @@ public:
 public:
   const uint8_t *base(void) const override { return _mmap_base + _offset; }
 
+public:
+  /**
+   * @brief Ask the kernel to read the mapped pages in advance
+   */
+  void prefetch(void) const
+  {
+    madvise(const_cast<uint8_t *>(_mmap_base), _mmap_size, MADV_WILLNEED);
+  }
+  /**
+   * @brief Drop the mapped pages from memory. They are read from the file again on access.
+   */
+  void evict(void) const { madvise(const_cast<uint8_t *>(_mmap_base), _mmap_size, MADV_DONTNEED); }
+
 private:
   const uint8_t *_mmap_base;
   size_t _mmap_size;
@@ -17,16 +17,15 @@
 #ifndef __ONERT_IR_OPERAND_INDEX_MAP_H__
 #define __ONERT_IR_OPERAND_INDEX_MAP_H__
 
-#include <unordered_map>
-
 #include "ir/Index.h"
+#include "util/IndexMap.h"
 
 namespace onert
 {
 namespace ir
 {
 
-template <typename T> using OperandIndexMap = std::unordered_map<OperandIndex, T>;
+template <typename T> using OperandIndexMap = util::IndexMap<OperandIndex, T>;
 
 } // namespace ir
 } // namespace onert
@@ -17,16 +17,15 @@
 #ifndef __ONERT_IR_OPERATION_INDEX_MAP_H__
 #define __ONERT_IR_OPERATION_INDEX_MAP_H__
 
-#include <unordered_map>
-
 #include "ir/Index.h"
+#include "util/IndexMap.h"
 
 namespace onert
 {
 namespace ir
 {
 
-template <typename T> using OperationIndexMap = std::unordered_map<OperationIndex, T>;
+template <typename T> using OperationIndexMap = util::IndexMap<OperationIndex, T>;
 
 } // namespace ir
 } // namespace onert
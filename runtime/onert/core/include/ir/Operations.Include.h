@@ -42,6 +42,7 @@
 #include "ir/operation/Fill.h"
 #include "ir/operation/FullyConnected.h"
 #include "ir/operation/FusedBatchNorm.h"
+#include "ir/operation/FusedElementwise.h"
 #include "ir/operation/Gather.h"
 #include "ir/operation/HashtableLookup.h"
 #include "ir/operation/If.h"
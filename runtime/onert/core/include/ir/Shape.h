@@ -21,6 +21,8 @@
 
 #include <cassert>
 #include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
 #include <vector>
 #include <algorithm>
 
@@ -75,22 +77,33 @@ public:
 
   Shape() = default;
 
-  explicit Shape(int rank) : _dimensions(rank) {}
+  explicit Shape(int rank) { resize(rank); }
 
-  Shape(std::initializer_list<int32_t> dimensions) : _dimensions(dimensions) {}
+  Shape(std::initializer_list<int32_t> dimensions)
+  {
+    resize(dimensions.size());
+    std::copy(dimensions.begin(), dimensions.end(), dimsData());
+  }
+
+  int rank() const { return _rank; }
 
-  int rank() const { return _dimensions.size(); }
+  /**
+   * @brief Returns a copy of dimensions
+   * @note  Use begin() and end() to access dimensions without allocation
+   */
+  std::vector<int32_t> dims() const { return std::vector<int32_t>(begin(), end()); }
 
-  const std::vector<int32_t> &dims() const { return _dimensions; }
+  const int32_t *begin() const { return _rank > kInlineRank ? _heap_dims.data() : _inline_dims; }
+  const int32_t *end() const { return begin() + _rank; }
 
   int32_t dim(int i) const
   {
     assert(rank() != 0 || i == 0);
-    return rank() == 0 ? 1 : _dimensions.at(i);
+    return rank() == 0 ? 1 : begin()[checkIndex(i)];
   }
 
   // TODO Fix different behavior with const version
-  int32_t &dim(int i) { return _dimensions.at(i); }
+  int32_t &dim(int i) { return dimsData()[checkIndex(i)]; }
 
   /**
    * @brief Returns number of elements when rank or dim is specified
@@ -104,13 +117,22 @@ public:
    * @brief Add dimension to the beginning
    * @param[in] d dimension to add to the beginning
    */
-  void prepend(int32_t d) { _dimensions.insert(_dimensions.cbegin(), d); }
+  void prepend(int32_t d)
+  {
+    resize(_rank + 1);
+    std::copy_backward(dimsData(), dimsData() + _rank - 1, dimsData() + _rank);
+    dimsData()[0] = d;
+  }
 
   /**
    * @brief Add dimension to the end
    * @param[in] d dimension to add to the end
    */
-  void append(int32_t d) { _dimensions.emplace_back(d); }
+  void append(int32_t d)
+  {
+    resize(_rank + 1);
+    dimsData()[_rank - 1] = d;
+  }
 
   /**
    * @brief Extend rank of Shape object for operand with param.
@@ -126,16 +148,36 @@ public:
    */
   bool hasUnspecifiedDims() const
   {
-    return (std::find(_dimensions.begin(), _dimensions.end(), kUnspecifiedDim) !=
-            _dimensions.end());
+    return (std::find(begin(), end(), kUnspecifiedDim) != end());
   }
 
 private:
-  std::vector<int32_t> _dimensions;
+  // Shapes up to this rank are kept inline so that copying them does not allocate
+  static constexpr int kInlineRank = 6;
+
+  int32_t *dimsData() { return _rank > kInlineRank ? _heap_dims.data() : _inline_dims; }
+
+  int checkIndex(int i) const
+  {
+    if (i < 0 || i >= _rank)
+      throw std::out_of_range{"Shape: dimension index out of range"};
+    return i;
+  }
+
+  // Keeps existing dimensions and fills new ones with 0
+  void resize(int rank);
+
+private:
+  int _rank = 0;
+  int32_t _inline_dims[kInlineRank] = {};
+  std::vector<int32_t> _heap_dims;
 };
 
-inline bool operator==(const Shape &lhs, const Shape &rhs) { return lhs.dims() == rhs.dims(); }
-inline bool operator!=(const Shape &lhs, const Shape &rhs) { return lhs.dims() != rhs.dims(); }
+inline bool operator==(const Shape &lhs, const Shape &rhs)
+{
+  return lhs.rank() == rhs.rank() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+inline bool operator!=(const Shape &lhs, const Shape &rhs) { return !(lhs == rhs); }
 
 /**
  * @brief   Converts shape when its rank is 4
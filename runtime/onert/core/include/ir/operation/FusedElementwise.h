@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_IR_OPERATION_FUSED_ELEMENTWISE_H__
+#define __ONERT_IR_OPERATION_FUSED_ELEMENTWISE_H__
+
+#include "ir/Operation.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/ElementwiseActivation.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace ir
+{
+namespace operation
+{
+
+/**
+ * @brief Chain of pointwise operations evaluated at once
+ *
+ * It is not given by models but made by compiler from BinaryArithmetic and ElementwiseActivation
+ * operations whose intermediate results are used only in the chain.
+ */
+class FusedElementwise : public Operation
+{
+public:
+  /**
+   * @brief An operation of the chain
+   *
+   * Operands of a step are values. Value v is the input v of FusedElementwise if v is less than
+   * the number of inputs, otherwise the result of the step (v - the number of inputs).
+   */
+  struct Step
+  {
+    OpCode opcode; //< BinaryArithmetic or ElementwiseActivation
+    BinaryArithmetic::Param arithmetic;
+    ElementwiseActivation::Param activation;
+    uint32_t lhs;
+    uint32_t rhs; //< Not used by ElementwiseActivation
+  };
+
+  struct Param
+  {
+    // Steps in evaluation order, the result of the last step is the output
+    std::vector<Step> steps;
+  };
+
+public:
+  FusedElementwise(const OperandIndexSequence &inputs, const OperandIndexSequence &outputs,
+                   const Param &param);
+
+public:
+  void accept(OperationVisitor &v) const override;
+  OpCode opcode() const final { return OpCode::FusedElementwise; }
+
+public:
+  const Param &param() const { return _param; }
+
+private:
+  Param _param;
+};
+
+} // namespace operation
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_IR_OPERATION_FUSED_ELEMENTWISE_H__
@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file     IndexMap.h
+ * @brief    This file contains onert::util::IndexMap class
+ */
+
+#ifndef __ONERT_UTIL_INDEX_MAP_H__
+#define __ONERT_UTIL_INDEX_MAP_H__
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Associative container keyed by @c util::Index that stores entries in dense slots
+ *
+ * Indices in onert are small integers assigned in increasing order, so the value of an index is
+ * used directly as a slot position instead of being hashed. It provides the subset of
+ * @c std::unordered_map interface used in onert, so it can replace one without other changes.
+ *
+ * An index far beyond the dense slots (e.g. @c Index::max()) is kept in an ordered side table
+ * instead, so that a few sparse keys do not blow up memory.
+ *
+ * NOTE Unlike @c std::unordered_map, iteration order is deterministic: dense entries in ascending
+ *      order of indices, then sparse entries in ascending order of indices.
+ *      References to entries are stable until the entry is erased (dense storage is a
+ *      @c std::deque that only grows at the end) and iterators stay valid when other entries are
+ *      inserted.
+ *
+ * @tparam Index  Index type, @c util::Index
+ * @tparam T      Mapped type
+ */
+template <typename Index, typename T> class IndexMap
+{
+public:
+  using key_type = Index;
+  using mapped_type = T;
+  using value_type = std::pair<const Index, T>;
+  using size_type = std::size_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+private:
+  using Slot = std::optional<value_type>;
+  using Slots = std::deque<Slot>;
+  using Sparse = std::map<Index, T>;
+
+  // Slots can grow by this many entries at least, regardless of the current number of slots
+  static constexpr size_type kMinDenseGrowth = 1024;
+
+  template <bool IsConst> class Iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename IndexMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const value_type *, value_type *>;
+    using reference = std::conditional_t<IsConst, const value_type &, value_type &>;
+
+  private:
+    using MapPtr = std::conditional_t<IsConst, const IndexMap *, IndexMap *>;
+    using SparseIter =
+      std::conditional_t<IsConst, typename Sparse::const_iterator, typename Sparse::iterator>;
+    // Position value of iterators pointing to sparse entries
+    static constexpr size_type kSparsePos = std::numeric_limits<size_type>::max();
+
+  public:
+    Iterator() = default;
+    Iterator(MapPtr map, size_type pos) : _map{map}, _pos{pos} { skipEmpty(); }
+    Iterator(MapPtr map, SparseIter sparse_it) : _map{map}, _pos{kSparsePos}, _sparse_it{sparse_it}
+    {
+    }
+    // Allow conversion from iterator to const_iterator
+    template <bool C = IsConst, typename = std::enable_if_t<C>>
+    Iterator(const Iterator<false> &o) : _map{o._map}, _pos{o._pos}, _sparse_it{o._sparse_it}
+    {
+    }
+
+  public:
+    reference operator*() const
+    {
+      if (_pos == kSparsePos)
+        return *_sparse_it;
+      return *_map->_slots[_pos];
+    }
+    pointer operator->() const { return &**this; }
+    Iterator &operator++()
+    {
+      if (_pos == kSparsePos)
+      {
+        ++_sparse_it;
+      }
+      else
+      {
+        ++_pos;
+        skipEmpty();
+      }
+      return *this;
+    }
+    Iterator operator++(int)
+    {
+      Iterator temp = *this;
+      ++(*this);
+      return temp;
+    }
+    bool operator==(const Iterator &o) const
+    {
+      return _pos == o._pos && (_pos != kSparsePos || _sparse_it == o._sparse_it);
+    }
+    bool operator!=(const Iterator &o) const { return !(*this == o); }
+
+  private:
+    void skipEmpty()
+    {
+      if (_pos == kSparsePos)
+        return;
+      while (_pos < _map->_slots.size() && !_map->_slots[_pos].has_value())
+        ++_pos;
+      if (_pos >= _map->_slots.size())
+      {
+        // Continue to sparse entries
+        _pos = kSparsePos;
+        _sparse_it = _map->_sparse.begin();
+      }
+    }
+
+  private:
+    friend class IndexMap;
+    friend class Iterator<true>;
+    MapPtr _map = nullptr;
+    size_type _pos = 0;
+    SparseIter _sparse_it{};
+  };
+
+public:
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+public:
+  IndexMap() = default;
+  IndexMap(const IndexMap &) = default;
+  IndexMap(IndexMap &&o) noexcept
+    : _slots{std::move(o._slots)}, _sparse{std::move(o._sparse)}, _size{o._size}
+  {
+    o.clear();
+  }
+  IndexMap(std::initializer_list<value_type> list)
+  {
+    for (const auto &e : list)
+      insert(e);
+  }
+  // NOTE value_type has a const key so slots cannot be copy-assigned one by one
+  IndexMap &operator=(const IndexMap &o)
+  {
+    if (this != &o)
+    {
+      IndexMap temp{o};
+      swap(temp);
+    }
+    return *this;
+  }
+  IndexMap &operator=(IndexMap &&o) noexcept
+  {
+    if (this != &o)
+    {
+      _slots = std::move(o._slots);
+      _sparse = std::move(o._sparse);
+      _size = o._size;
+      o.clear();
+    }
+    return *this;
+  }
+  ~IndexMap() = default;
+
+public:
+  iterator begin() { return iterator{this, 0}; }
+  iterator end() { return iterator{this, _sparse.end()}; }
+  const_iterator begin() const { return const_iterator{this, 0}; }
+  const_iterator end() const { return const_iterator{this, _sparse.end()}; }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+public:
+  size_type size() const { return _size; }
+  bool empty() const { return _size == 0; }
+  void clear()
+  {
+    _slots.clear();
+    _sparse.clear();
+    _size = 0;
+  }
+  /**
+   * @brief Prepare slots for indices in [0, n) so that inserting them does not grow storage
+   */
+  void reserve(size_type n)
+  {
+    if (_slots.size() < n)
+      _slots.resize(n);
+  }
+  void swap(IndexMap &o) noexcept
+  {
+    _slots.swap(o._slots);
+    _sparse.swap(o._sparse);
+    std::swap(_size, o._size);
+  }
+
+public:
+  iterator find(const Index &index)
+  {
+    if (inDense(index))
+      return iterator{this, index.value()};
+    auto it = _sparse.find(index);
+    return it == _sparse.end() ? end() : iterator{this, it};
+  }
+  const_iterator find(const Index &index) const
+  {
+    if (inDense(index))
+      return const_iterator{this, index.value()};
+    auto it = _sparse.find(index);
+    return it == _sparse.end() ? end() : const_iterator{this, it};
+  }
+  size_type count(const Index &index) const { return contains(index) ? 1 : 0; }
+  bool contains(const Index &index) const
+  {
+    return inDense(index) || (!_sparse.empty() && _sparse.count(index) > 0);
+  }
+
+  T &at(const Index &index)
+  {
+    return const_cast<T &>(static_cast<const IndexMap *>(this)->at(index));
+  }
+  const T &at(const Index &index) const
+  {
+    if (inDense(index))
+      return _slots[index.value()]->second;
+    auto it = _sparse.find(index);
+    if (it == _sparse.end())
+      throw std::out_of_range{"IndexMap: no entry for the given index"};
+    return it->second;
+  }
+  T &operator[](const Index &index) { return try_emplace(index).first->second; }
+
+public:
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Index &index, Args &&...args)
+  {
+    if (!index.valid())
+      throw std::out_of_range{"IndexMap: undefined index cannot be a key"};
+
+    auto found = find(index);
+    if (found != end())
+      return {found, false};
+
+    ++_size;
+    const size_type pos = index.value();
+    if (pos < _slots.size() + std::max(_slots.size(), kMinDenseGrowth))
+    {
+      if (pos >= _slots.size())
+        _slots.resize(pos + 1);
+      _slots[pos].emplace(std::piecewise_construct, std::forward_as_tuple(index),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+      return {iterator{this, pos}, true};
+    }
+    auto it = _sparse.emplace_hint(_sparse.end(), std::piecewise_construct,
+                                   std::forward_as_tuple(index),
+                                   std::forward_as_tuple(std::forward<Args>(args)...));
+    return {iterator{this, it}, true};
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(const Index &index, Args &&...args)
+  {
+    return try_emplace(index, std::forward<Args>(args)...);
+  }
+  std::pair<iterator, bool> insert(const value_type &value)
+  {
+    return try_emplace(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(value_type &&value)
+  {
+    return try_emplace(value.first, std::forward<T>(value.second));
+  }
+  template <typename M> std::pair<iterator, bool> insert_or_assign(const Index &index, M &&obj)
+  {
+    auto res = try_emplace(index, std::forward<M>(obj));
+    if (!res.second)
+      res.first->second = std::forward<M>(obj);
+    return res;
+  }
+
+  size_type erase(const Index &index)
+  {
+    auto it = find(index);
+    if (it == end())
+      return 0;
+    erase(it);
+    return 1;
+  }
+  iterator erase(const_iterator pos)
+  {
+    assert(pos != end());
+    --_size;
+    if (pos._pos == const_iterator::kSparsePos)
+      return iterator{this, _sparse.erase(pos._sparse_it)};
+
+    _slots[pos._pos].reset();
+    return iterator{this, pos._pos + 1};
+  }
+  iterator erase(iterator pos) { return erase(const_iterator{pos}); }
+
+private:
+  bool inDense(const Index &index) const
+  {
+    return index.valid() && index.value() < _slots.size() && _slots[index.value()].has_value();
+  }
+
+private:
+  Slots _slots;
+  Sparse _sparse;
+  size_type _size = 0;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_INDEX_MAP_H__
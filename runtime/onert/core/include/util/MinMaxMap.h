@@ -17,6 +17,7 @@
 #ifndef __ONERT_UTIL_MINMAX_MAP_H_
 #define __ONERT_UTIL_MINMAX_MAP_H_
 
+#include <algorithm>
 #include <unordered_map>
 #include <utility>
 
@@ -34,6 +35,22 @@ template <typename N, typename Hash = std::hash<N>> class MinMaxMap
 
 public:
   void append(N node, float min, float max) { _minmax_map[node] = {min, max}; }
+  /**
+   * @brief Merge other map into this map, widening the range of a node recorded in both maps
+   */
+  void merge(const MinMaxMap &other)
+  {
+    for (const auto &[node, minmax] : other._minmax_map)
+    {
+      auto [it, inserted] = _minmax_map.emplace(node, minmax);
+      if (!inserted)
+      {
+        it->second.data[0] = std::min(it->second.data[0], minmax.data[0]);
+        it->second.data[1] = std::max(it->second.data[1], minmax.data[1]);
+      }
+    }
+  }
+  void clear() { _minmax_map.clear(); }
   auto begin() const { return _minmax_map.begin(); }
   auto end() const { return _minmax_map.end(); }
   auto size() const { return _minmax_map.size(); }
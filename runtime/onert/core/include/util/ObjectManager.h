@@ -17,13 +17,13 @@
 #ifndef __ONERT_UTIL_OBJECT_MANAGER_H__
 #define __ONERT_UTIL_OBJECT_MANAGER_H__
 
+#include "util/IndexMap.h"
 #include "util/logging.h"
 
 #include <cassert>
 #include <functional>
-#include <list>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 namespace onert
 {
@@ -200,7 +200,8 @@ public:
   {
     // TODO Remove this workaround
     // This implementation is a workaround in case of adding operands while iteration
-    std::list<Index> l;
+    std::vector<Index> l;
+    l.reserve(_objects.size());
 
     for (const auto &e : _objects)
     {
@@ -209,7 +210,7 @@ public:
 
     for (const auto &index : l)
     {
-      fn(index, *_objects[index]);
+      fn(index, *_objects.at(index));
     }
   }
 
@@ -245,7 +246,7 @@ private:
   }
 
 protected:
-  std::unordered_map<Index, std::unique_ptr<Object>> _objects;
+  IndexMap<Index, std::unique_ptr<Object>> _objects;
   uint32_t _next_index;
 };
 
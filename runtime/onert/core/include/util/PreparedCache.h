@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_PREPARED_CACHE_H__
+#define __ONERT_UTIL_PREPARED_CACHE_H__
+
+#include "ir/Data.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief On-disk cache of data that backends prepare from constant operands, such as converted
+ *        weights
+ *
+ * Blobs of a cache belong to a key of what they are prepared from, i.e. the model, the subgraph
+ * and compile options, which is computed once per compile. Within a key, a blob is named by its
+ * kind and operand, e.g. "cpu_fp16_<operand index>". Blobs are mapped read-only from files in the
+ * directory, so that their pages are loaded on demand and can be shared between processes.
+ *
+ * Each file starts with a header of the format version, the key and the sizes of the source and
+ * the blob. A blob is loaded if the header matches, without reading the source or the blob. Files
+ * are written to temporary files and renamed, so a partially written blob is never loaded.
+ */
+class PreparedCache
+{
+public:
+  /**
+   * @param dir Directory to keep blobs in, which is created if it does not exist
+   * @param key Key of the model, the subgraph and options that blobs are prepared for
+   */
+  PreparedCache(const std::string &dir, uint64_t key);
+
+public:
+  /**
+   * @brief Return a hash of data to build keys from
+   *
+   * @param seed Seed to get a hash independent of the ones of other seeds
+   */
+  static uint64_t hash(const void *data, size_t size, uint64_t seed = 0);
+
+  /**
+   * @brief Return a key of a file from its path, size and modification time, without reading it
+   *
+   * @return Key of the file, or 0 if the file does not exist
+   */
+  static uint64_t fileKey(const std::string &path);
+
+public:
+  /**
+   * @brief Map a blob
+   *
+   * @param source_size Size of data that the blob is prepared from
+   * @return Mapped blob, or nullptr if there is no blob of the name and sizes for the key
+   */
+  std::shared_ptr<ir::Data> load(const std::string &name, size_t source_size, size_t size) const;
+
+  /**
+   * @brief Store a blob. Failures are ignored as the cache is just a shortcut.
+   *
+   * @param source_size Size of data that the blob is prepared from
+   */
+  void store(const std::string &name, size_t source_size, const ir::Data &blob) const;
+
+private:
+  std::string path(const std::string &name) const;
+
+private:
+  std::string _dir;
+  uint64_t _key;
+  bool _valid;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_PREPARED_CACHE_H__
@@ -137,6 +137,8 @@ ir::Shape inferStridedSliceShape(const ir::Shape &input_shape, const StridedSlic
 ir::Shape inferTileShape(const ir::Shape &in_shape, const int32_t *multiplier_buf,
                          const int32_t multiplier_size);
 
+ir::Shape inferTopKV2Shape(const ir::Shape &in_shape, const int32_t k);
+
 ir::Shape inferTransposeShape(const ir::Shape &in_shape, const int32_t *perm_buf,
                               const int32_t rank);
 
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_THREAD_BUDGET_H__
+#define __ONERT_UTIL_THREAD_BUDGET_H__
+
+#include <cstdint>
+#include <mutex>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Process-wide budget of threads that kernels run on
+ *
+ * Each execution leases threads from the budget while it runs, up to its quota, so that
+ * executions running at once in several sessions do not oversubscribe cores together. Backends
+ * cap the thread counts of their own thread pools with cap(). Only the budget is shared, as
+ * thread pools keep per-session state such as prepacked weights of ruy. Executors that run jobs
+ * on worker threads pass a part of the lease to each worker with SubLease.
+ */
+class ThreadBudget
+{
+public:
+  /**
+   * @brief Lease of threads for an execution on the calling thread
+   */
+  class Lease
+  {
+  public:
+    /**
+     * @param quota Maximum number of threads to lease, 0 for no limit other than the budget
+     */
+    explicit Lease(uint32_t quota);
+    ~Lease();
+
+    Lease(const Lease &) = delete;
+    Lease &operator=(const Lease &) = delete;
+
+    uint32_t granted() const { return _granted; }
+
+  private:
+    uint32_t _granted;
+    uint32_t _outer;
+  };
+
+  /**
+   * @brief Part of a lease taken on another thread, for a worker thread running jobs of that
+   *        execution. It does not take threads from the budget again.
+   */
+  class SubLease
+  {
+  public:
+    /**
+     * @param threads Threads of the lease for this worker, 0 if the execution has no lease
+     */
+    explicit SubLease(uint32_t threads);
+    ~SubLease();
+
+    SubLease(const SubLease &) = delete;
+    SubLease &operator=(const SubLease &) = delete;
+
+  private:
+    uint32_t _outer;
+  };
+
+public:
+  static ThreadBudget &get();
+
+public:
+  /**
+   * @brief Return the number of threads in the budget, from THREAD_BUDGET config or the number of
+   *        cores by default
+   */
+  uint32_t total() const { return _total; }
+
+  /**
+   * @brief Return the number of threads leased on the calling thread, 0 if there is no lease
+   */
+  static uint32_t leased();
+
+  /**
+   * @brief Cap the number of threads a backend wants by the lease of the calling thread, or by the
+   *        whole budget if there is no lease
+   */
+  uint32_t cap(uint32_t requested) const;
+
+private:
+  ThreadBudget();
+
+private:
+  uint32_t _total;
+  std::mutex _mutex;
+  // Threads not leased yet, which can be negative as every lease gets the calling thread at least
+  int64_t _available;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_THREAD_BUDGET_H__
@@ -27,21 +27,27 @@ namespace backend
 namespace basic
 {
 
-StaticTensorManager::StaticTensorManager(const std::shared_ptr<TensorRegistry> &reg,
-                                         DynamicTensorManager *dynamic_tensor_manager)
+StaticTensorManager::StaticTensorManager(
+  const std::shared_ptr<TensorRegistry> &reg, DynamicTensorManager *dynamic_tensor_manager,
+  const ir::OperandIndexMap<ir::OperandIndex> &shared_memory_operand_indexes)
   : _nonconst_mgr{new MemoryManager()}, _tensors{reg},
-    _dynamic_tensor_manager{dynamic_tensor_manager}
+    _dynamic_tensor_manager{dynamic_tensor_manager},
+    _shared_memory_operand_indexes{shared_memory_operand_indexes}
 {
-  // DO NOTHING
+  for (const auto &[ind, source] : _shared_memory_operand_indexes)
+    _pending_shared_releases[source]++;
 }
 
-StaticTensorManager::StaticTensorManager(const std::shared_ptr<TensorRegistry> &reg,
-                                         const std::string planner_id,
-                                         DynamicTensorManager *dynamic_tensor_manager)
+StaticTensorManager::StaticTensorManager(
+  const std::shared_ptr<TensorRegistry> &reg, const std::string planner_id,
+  DynamicTensorManager *dynamic_tensor_manager,
+  const ir::OperandIndexMap<ir::OperandIndex> &shared_memory_operand_indexes)
   : _nonconst_mgr{new MemoryManager(planner_id)}, _tensors{reg},
-    _dynamic_tensor_manager{dynamic_tensor_manager}
+    _dynamic_tensor_manager{dynamic_tensor_manager},
+    _shared_memory_operand_indexes{shared_memory_operand_indexes}
 {
-  // DO NOTHING
+  for (const auto &[ind, source] : _shared_memory_operand_indexes)
+    _pending_shared_releases[source]++;
 }
 
 void StaticTensorManager::allocateNonconsts(void)
@@ -52,7 +58,7 @@ void StaticTensorManager::allocateNonconsts(void)
   {
     if (!_as_constants[ind] && !tensor->is_dynamic())
     {
-      auto *buffer = _nonconst_mgr->getBuffer(ind);
+      auto *buffer = _nonconst_mgr->getBuffer(sourceOperandIndex(ind));
       tensor->setBuffer(buffer);
 
       VERBOSE(CPU_StaticTensorManager)
@@ -88,6 +94,10 @@ void StaticTensorManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
   // This method is called only when a tensor has proper shape
   assert(!_tensors->getNativeTensor(ind)->is_dynamic());
 
+  // An operand sharing memory of another one lives in the plan of the source
+  if (_shared_memory_operand_indexes.count(ind) > 0)
+    return;
+
   if (!_as_constants[ind])
     _nonconst_mgr->claimPlan(ind, size);
 }
@@ -99,8 +109,17 @@ void StaticTensorManager::releasePlan(const ir::OperandIndex &ind)
   // This method is called only when a tensor has proper shape
   assert(!_tensors->getNativeTensor(ind)->is_dynamic());
 
-  if (!_as_constants[ind])
-    _nonconst_mgr->releasePlan(ind);
+  // Shared memory is released with the last of the operands using it
+  const auto source = sourceOperandIndex(ind);
+  auto pending = _pending_shared_releases.find(source);
+  if (pending != _pending_shared_releases.end() && pending->second > 0)
+  {
+    pending->second--;
+    return;
+  }
+
+  if (!_as_constants[source])
+    _nonconst_mgr->releasePlan(source);
 }
 
 void StaticTensorManager::iterate(const std::function<void(const ir::OperandIndex &)> &fn)
@@ -109,6 +128,12 @@ void StaticTensorManager::iterate(const std::function<void(const ir::OperandInde
     fn(it.first);
 }
 
+ir::OperandIndex StaticTensorManager::sourceOperandIndex(const ir::OperandIndex &ind) const
+{
+  auto it = _shared_memory_operand_indexes.find(ind);
+  return it == _shared_memory_operand_indexes.end() ? ind : it->second;
+}
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
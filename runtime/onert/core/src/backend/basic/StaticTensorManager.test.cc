@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/TensorBuilder.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::basic;
+
+TEST(StaticTensorManager, shared_memory)
+{
+  auto reg = std::make_shared<TensorRegistry>();
+
+  // in -> [Reshape] -> reshaped -> [Relu] -> out, where outputs use the memory of in
+  const ir::OperandIndex in{0}, reshaped{1}, out{2}, other{3}, later{4};
+  TensorBuilder builder{reg, "FirstFit", {{reshaped, in}, {out, in}}};
+  const auto info =
+    ir::OperandInfo::createStaticInfo(ir::Shape{2, 3}, ir::TypeInfo{ir::DataType::FLOAT32});
+  for (const auto &ind : {in, reshaped, out, other, later})
+    builder.registerTensorInfo(ind, info);
+
+  builder.notifyFirstUse(in);
+  builder.notifyFirstUse(reshaped);
+  builder.notifyLastUse(in);
+  builder.notifyFirstUse(out);
+  builder.notifyLastUse(reshaped);
+  // The memory is kept while out is alive
+  builder.notifyFirstUse(other);
+  builder.notifyLastUse(out);
+  builder.notifyLastUse(other);
+  // The memory is reused after all of them
+  builder.notifyFirstUse(later);
+  builder.notifyLastUse(later);
+  builder.allocate();
+
+  auto buffer = [&](const ir::OperandIndex &ind) { return reg->getNativeTensor(ind)->buffer(); };
+  ASSERT_NE(buffer(in), nullptr);
+  ASSERT_EQ(buffer(reshaped), buffer(in));
+  ASSERT_EQ(buffer(out), buffer(in));
+  ASSERT_NE(buffer(other), buffer(in));
+  ASSERT_EQ(buffer(later), buffer(in));
+}
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_BUILTIN_EXTERNAL_CONTEXT_H__
 
 #include <util/ConfigSource.h>
+#include <util/ThreadBudget.h>
 
 #include <ruy/context.h>
 #include <ruy/context_get_ctx.h>
@@ -40,7 +41,8 @@ private:
   static const int kDefaultNumThreadpoolThreads = 1;
 
 public:
-  ExternalContext() : _ruy_context(std::make_unique<ruy::Context>())
+  ExternalContext()
+    : _ruy_context(std::make_unique<ruy::Context>()), _max_num_threads(kDefaultNumThreadpoolThreads)
   {
     setMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
     initPerThreadState();
@@ -48,18 +50,21 @@ public:
 
   void setMaxNumThreads(int max_num_threads)
   {
-    const int target_num_threads =
-      max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
-    _ruy_context->set_max_num_threads(target_num_threads);
+    _max_num_threads = max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
   }
 
-  ruy::Context *ruy_context() const { return _ruy_context.get(); }
+  // Threads of the context are capped by the lease of the calling thread
+  ruy::Context *ruy_context() const
+  {
+    _ruy_context->set_max_num_threads(onert::util::ThreadBudget::get().cap(_max_num_threads));
+    return _ruy_context.get();
+  }
 
 private:
   void initPerThreadState()
   {
     // Initialize per-thread state.
-    const int thread_count = _ruy_context->max_num_threads();
+    const int thread_count = _max_num_threads;
     auto ctx = ruy::get_ctx(_ruy_context.get());
     ctx->EnsureThreadSpecificResources(thread_count);
     for (int i = 0; i < thread_count; i++)
@@ -70,6 +75,7 @@ private:
 
 private:
   const std::unique_ptr<ruy::Context> _ruy_context;
+  uint32_t _max_num_threads;
 };
 
 } // namespace builtin
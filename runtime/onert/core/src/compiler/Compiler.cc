@@ -22,6 +22,7 @@
 #include "pass/ConstantOutputPass.h"
 #include "pass/OddOutputPass.h"
 #include "pass/PassRunner.h"
+#include "pass/TransposeEliminationPass.h"
 #include "pass/UnusedOperandEliminationPass.h"
 #include "../dumper/dot/DotDumper.h"
 #include "../exec/SingleModelExecutors.h"
@@ -90,7 +91,10 @@ std::shared_ptr<CompilerArtifact> Compiler::compile(void)
       .run();
 
     // Optimizations
-    pass::PassRunner{}.append(std::make_unique<pass::UnusedOperandEliminationPass>(subg)).run();
+    pass::PassRunner{}
+      .append(std::make_unique<pass::TransposeEliminationPass>(subg))
+      .append(std::make_unique<pass::UnusedOperandEliminationPass>(subg))
+      .run();
   });
 
   /***************************************************
@@ -171,6 +175,7 @@ std::shared_ptr<CompilerArtifact> Compiler::compile(void)
     args.tracing_ctx = tracing_ctx.get();
     args.options = _options;
     args.model_index = model_index;
+    args.subg_index = subg_index;
     args.custom_kernel_builder = custom_kernel_builder;
     auto executor = std::unique_ptr<exec::IExecutor>{
       ExecutorFactory::get().create(std::move(lowered_subg), executors, args)};
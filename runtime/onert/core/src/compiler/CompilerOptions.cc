@@ -23,6 +23,8 @@
 
 #include <misc/string_helpers.h>
 
+#include <algorithm>
+
 namespace
 {
 
@@ -84,6 +86,13 @@ std::unique_ptr<CompilerOptions> CompilerOptions::fromGlobalConfig()
   o->he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
   o->fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
   o->workspace_dir = util::getConfigString(util::config::WORKSPACE_DIR);
+  o->prepared_cache = util::getConfigBool(util::config::PREPARED_CACHE);
+  o->model_key = 0;
+  o->weight_paging_distance =
+    std::max(0, util::getConfigInt(util::config::WEIGHT_PAGING_DISTANCE));
+  o->shape_specialization_runs =
+    std::max(0, util::getConfigInt(util::config::SHAPE_SPECIALIZATION_RUNS));
+  o->elementwise_fusion = util::getConfigBool(util::config::ELEMENTWISE_FUSION);
   {
     // Backend for all
     auto &ms_options = o->manual_scheduler_options;
@@ -118,10 +127,6 @@ void CompilerOptions::forceInternalOptions()
   manual_scheduler_options.opcode_to_backend[ir::OpCode::While] = builtin_id;
   manual_scheduler_options.opcode_to_backend[ir::OpCode::Permute] = builtin_id;
 
-  // FIXME This is a workaround for bcq operations, should remove it
-  manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQFullyConnected] = "bcq";
-  manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQGather] = "bcq";
-
   // FIXME This is a workaround for bulk operations, should remove it
   manual_scheduler_options.opcode_to_backend[ir::OpCode::Bulk] = "trix";
 }
@@ -139,7 +144,12 @@ void CompilerOptions::verboseOptions()
                     << getOpBackends(manual_scheduler_options.opcode_to_backend) << std::endl;
   VERBOSE(Compiler) << "he_scheduler             : " << he_scheduler << std::endl;
   VERBOSE(Compiler) << "he_profiling_mode        : " << he_profiling_mode << std::endl;
-  VERBOSE(Compiler) << "fp16_enable              : " << fp16_enable << std::endl
+  VERBOSE(Compiler) << "fp16_enable              : " << fp16_enable << std::endl;
+  VERBOSE(Compiler) << "prepared_cache           : " << prepared_cache << std::endl;
+  VERBOSE(Compiler) << "model_key                : " << model_key << std::endl;
+  VERBOSE(Compiler) << "weight_paging_distance   : " << weight_paging_distance << std::endl;
+  VERBOSE(Compiler) << "shape_specialization_runs: " << shape_specialization_runs << std::endl;
+  VERBOSE(Compiler) << "elementwise_fusion       : " << elementwise_fusion << std::endl
                     << std::noboolalpha;
 }
 
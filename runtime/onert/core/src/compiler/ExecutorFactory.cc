@@ -28,6 +28,7 @@
 #include "../exec/LinearExecutor.h"
 #include "../exec/MinMaxRecorder.h"
 #include "../exec/ParallelExecutor.h"
+#include "../exec/WeightPager.h"
 #include "../exec/train/TrainableExecutor.h"
 #include "../ir/OperationCloner.h"
 
@@ -36,10 +37,12 @@
 #include <backend/train/ITrainableBackend.h>
 #include <compiler/BackendManager.h>
 #include <compiler/ExecutionBuilder.h>
+#include <util/PreparedCache.h>
 #include <util/TracingCtx.h>
 
 #include <functional>
 #include <memory>
+#include <sstream>
 
 namespace onert
 {
@@ -145,7 +148,8 @@ void initializeSubgraphIOTensors(compiler::ILoweredGraph &lowered_graph,
 
 backend::BackendContexts
 createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
-                      std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder)
+                      std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder,
+                      std::shared_ptr<util::PreparedCache> prepared_cache)
 {
   backend::BackendContexts contexts;
   std::unordered_map<const backend::Backend *, backend::ContextData> context_data_map;
@@ -215,6 +219,11 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
       }
     });
 
+  // Operands that are read by other backends than the one defining them
+  util::Set<ir::OperandIndex> cross_backend_operands;
+  for (auto &&[backend, data] : context_data_map)
+    cross_backend_operands = cross_backend_operands | data.external_operands;
+
   // Create contexts
   auto whole_op_order = lgraph.graph().topolSortOperations();
   for (auto &&[backend, data] : context_data_map)
@@ -228,9 +237,10 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
       // Inputs are either "graph input" or "no def op and non-constant"
       if (whole_graph.getInputs().contains(ind) ||
           (!operand.getDef().valid() && !operand.isConstant()))
-        // Outputs are either "graph output" or "no uses"
+        // Outputs are either "graph output", "no uses" or "used by other backends"
         graph->addInput(ind);
-      if (whole_graph.getOutputs().contains(ind) || operand.getUses().size() == 0)
+      if (whole_graph.getOutputs().contains(ind) || operand.getUses().size() == 0 ||
+          (cross_backend_operands.contains(ind) && !external_operands.contains(ind)))
         graph->addOutput(ind);
     });
     VERBOSE(ExecutorFactory) << "createBackendContexts: partial graph for backend="
@@ -242,11 +252,33 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
                  [&](const auto &ind) { return graph->operations().exist(ind); });
     data.is_linear_executor = linear_executor;
     data.custom_kernel_builder = custom_kernel_builder;
+    data.prepared_cache = prepared_cache;
     contexts.emplace(backend, backend->newContext(std::move(data)));
   }
   return contexts;
 }
 
+std::shared_ptr<util::PreparedCache> createPreparedCache(const compiler::CompilerOptions &options,
+                                                         const ir::ModelIndex &model_index,
+                                                         const ir::SubgraphIndex &subg_index)
+{
+  // Without a key of loaded models, a blob could not be told from the one of other models
+  if (!options.prepared_cache || options.workspace_dir.empty() || options.model_key == 0)
+    return nullptr;
+
+  // Prepared constants depend on the subgraph and on options to lower it
+  std::ostringstream key;
+  key << options.model_key << ";" << model_index.value() << ";" << subg_index.value() << ";";
+  for (const auto &backend : options.backend_list)
+    key << backend << ",";
+  key << ";" << options.executor << ";" << options.he_scheduler << ";" << options.fp16_enable
+      << ";" << options.elementwise_fusion << ";"
+      << options.manual_scheduler_options.backend_for_all;
+  const auto str = key.str();
+  return std::make_shared<util::PreparedCache>(options.workspace_dir + "/prepared_cache",
+                                               util::PreparedCache::hash(str.data(), str.size()));
+}
+
 template <typename Context>
 std::deque<std::pair<const backend::Backend *, Context *>> orderBackendContext(
   const std::unordered_map<const backend::Backend *, std::unique_ptr<Context>> &tbackend_contexts)
@@ -389,7 +421,8 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   auto &graph = lowered_graph->graph();
 
   backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
+    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder,
+                          createPreparedCache(*options, model_index, args.subg_index));
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -470,6 +503,30 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
                   [](std::pair<const ir::OperandIndex, uint32_t> it) { return it.second == 0; }));
   }
 
+  // Collect weights along the order before backends take over their data
+  std::unique_ptr<exec::WeightPager> weight_pager;
+  if (options->weight_paging_distance > 0)
+  {
+    std::vector<std::vector<std::shared_ptr<ir::Data>>> op_weights;
+    for (const auto &op_ind : order)
+    {
+      auto &weights = op_weights.emplace_back();
+      const auto &op = graph.operations().at(op_ind);
+      for (const auto &ind : op.getInputs() | ir::Remove::UNDEFINED)
+      {
+        if (!graph.operands().at(ind).isConstant())
+          continue;
+        const auto &def_backends = lowered_graph->lower_info().operand.at(ind).def_backends();
+        const auto &operands =
+          backend_contexts.at(def_backends.getOnlyElement())->graph()->operands();
+        if (auto data = operands.at(ind).shareData())
+          weights.emplace_back(std::move(data));
+      }
+    }
+    weight_pager =
+      std::make_unique<exec::WeightPager>(options->weight_paging_distance, op_weights);
+  }
+
   // Generate kernels
   for (auto &&pair : ordered_contexts)
   {
@@ -493,7 +550,8 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
                                        tensor_regs,
                                        std::move(code_map),
                                        order,
-                                       tracing_ctx};
+                                       tracing_ctx,
+                                       std::move(weight_pager)};
 
   if (!options->workspace_dir.empty())
   {
@@ -517,7 +575,8 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   auto custom_kernel_builder = args.custom_kernel_builder;
 
   backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
+    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder,
+                          createPreparedCache(*options, model_index, args.subg_index));
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -587,6 +646,8 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   {
     exec->addObserver(
       std::make_unique<exec::TracingObserver>(options->workspace_dir, exec->graph(), tracing_ctx));
+    exec->addObserver(std::make_unique<exec::MinMaxRecorder>(options->workspace_dir, exec->graph(),
+                                                             exec->getBackendContexts()));
   }
 
   return exec;
@@ -660,7 +721,7 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
   // TODO Create context only once instead of replacing
   backend::train::TrainableBackendContexts tbackend_contexts;
   backend::BackendContexts base_backend_contexts =
-    createBackendContexts(*lowered_graph, true, custom_kernel_builder);
+    createBackendContexts(*lowered_graph, true, custom_kernel_builder, nullptr);
 
   // Replace BackendContext with TrainbleBackendContext
   for (auto &&pair : base_backend_contexts)
@@ -40,6 +40,7 @@ struct ExecutorFactoryArgs
   const util::TracingCtx *tracing_ctx;
   const compiler::CompilerOptions *options;
   ir::ModelIndex model_index;
+  ir::SubgraphIndex subg_index;
   std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder;
 };
 
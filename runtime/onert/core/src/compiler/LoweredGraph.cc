@@ -20,6 +20,7 @@
 #include "ManualScheduler.h"
 #include "pass/ConstantInsertionPass.h"
 #include "pass/ConstantLoweringPass.h"
+#include "pass/ElementwiseFusionPass.h"
 #include "pass/PassRunner.h"
 #include "pass/PermutationEliminationPass.h"
 #include "pass/PermutationInsertionPass.h"
@@ -96,6 +97,9 @@ void LoweredGraph::lowerGraph(const CompilerOptions &options)
 
   // Optimization passes (optional)
   pass::PassRunner{}.append(std::make_unique<pass::PermutationEliminationPass>(*this)).run();
+  // HEScheduler ranks and profiles the operations of the model
+  if (options.elementwise_fusion && !options.he_scheduler)
+    pass::PassRunner{}.append(std::make_unique<pass::ElementwiseFusionPass>(*this)).run();
 
   VERBOSE(LoweredGraph) << "Dump after all the passes" << std::endl;
   for (auto &&operand : _graph.getInputs())
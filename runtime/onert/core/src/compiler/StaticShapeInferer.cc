@@ -586,6 +586,20 @@ void StaticShapeInferer::visit(const ir::operation::FusedBatchNorm &op)
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::FusedBatchNorm::Input::INPUT));
 }
 
+void StaticShapeInferer::visit(const ir::operation::FusedElementwise &op)
+{
+  auto &operands = _lowered_subg->graph().operands();
+
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = operands.at(output_idx);
+
+  // Every input reaches the output through broadcasting steps
+  ir::Shape new_shape = operands.at(op.getInputs().at(0)).info().shape();
+  for (const auto &input_idx : op.getInputs())
+    new_shape = shape_inference::inferEltwiseShape(new_shape, operands.at(input_idx).shape());
+  output.info().shape(new_shape);
+}
+
 void StaticShapeInferer::visit(const ir::operation::Gather &op)
 {
   auto &operands = _lowered_subg->graph().operands();
@@ -1299,6 +1313,21 @@ void StaticShapeInferer::visit(const ir::operation::Tile &op)
   output.info().shape(new_shape);
 }
 
+void StaticShapeInferer::visit(const ir::operation::TopKV2 &op)
+{
+  auto &operands = _lowered_subg->graph().operands();
+
+  const auto input_idx{op.getInputs().at(ir::operation::TopKV2::Input::INPUT)};
+  const auto &input = operands.at(input_idx);
+
+  const auto new_shape = shape_inference::inferTopKV2Shape(input.info().shape(), op.param().k);
+  for (const auto &output_idx : op.getOutputs())
+  {
+    ir::Operand &output = operands.at(output_idx);
+    output.info().shape(new_shape);
+  }
+}
+
 void StaticShapeInferer::visit(const ir::operation::Transpose &op)
 {
   auto &operands = _lowered_subg->graph().operands();
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ElementwiseFusionPass.h"
+
+#include "backend/Backend.h"
+#include "ir/operation/FusedElementwise.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+namespace
+{
+
+// The fused kernel keeps a tile for each step on its stack
+constexpr size_t MAX_FUSED_STEPS = 8;
+
+} // namespace
+
+void ElementwiseFusionPass::run()
+{
+  const auto order = _graph.topolSortOperations();
+  std::unordered_map<ir::OperationIndex, size_t> position;
+  for (size_t i = 0; i < order.size(); ++i)
+    position[order[i]] = i;
+
+  // A chain is grouped from its last operation
+  for (auto it = order.rbegin(); it != order.rend(); ++it)
+  {
+    if (_fused.count(*it) > 0 || !fusible(*it))
+      continue;
+
+    auto group = collect(*it);
+    if (group.size() < 2)
+      continue;
+
+    std::sort(group.begin(), group.end(),
+              [&](const ir::OperationIndex &a, const ir::OperationIndex &b) {
+                return position.at(a) < position.at(b);
+              });
+    _fused.insert(group.begin(), group.end());
+    fuse(group);
+  }
+}
+
+bool ElementwiseFusionPass::fusible(const ir::OperationIndex &ind) const
+{
+  // Only cpu backend has the fused kernel
+  const auto backend = _lowered_graph.lower_info().operation.at(ind);
+  if (backend->config()->id() != "cpu")
+    return false;
+
+  const auto &op = _graph.operations().at(ind);
+  if (op.opcode() == ir::OpCode::BinaryArithmetic)
+  {
+    // Fused activations are evaluated only by clamping
+    const auto activation =
+      dynamic_cast<const ir::operation::BinaryArithmetic &>(op).param().activation;
+    if (activation != ir::Activation::NONE && activation != ir::Activation::RELU &&
+        activation != ir::Activation::RELU1 && activation != ir::Activation::RELU6)
+      return false;
+  }
+  else if (op.opcode() != ir::OpCode::ElementwiseActivation)
+  {
+    return false;
+  }
+
+  if (op.getOutputs().size() != 1)
+    return false;
+  for (const auto &operand : {&op.getInputs(), &op.getOutputs()})
+  {
+    for (const auto &index : *operand)
+    {
+      if (index.undefined() ||
+          _graph.operands().at(index).typeInfo().type() != ir::DataType::FLOAT32)
+        return false;
+    }
+  }
+  return true;
+}
+
+std::vector<ir::OperationIndex> ElementwiseFusionPass::collect(const ir::OperationIndex &last) const
+{
+  std::vector<ir::OperationIndex> group{last};
+  std::unordered_set<ir::OperationIndex> members{last};
+
+  // Producers are taken when all uses of their results are in the group. A result used by
+  // several members is checked again when its last user joins, as every member is visited.
+  for (size_t i = 0; i < group.size() && group.size() < MAX_FUSED_STEPS; ++i)
+  {
+    for (const auto &input : _graph.operations().at(group[i]).getInputs())
+    {
+      const auto &operand = _graph.operands().at(input);
+      const auto def = operand.getDef();
+      if (!def.valid() || members.count(def) > 0 || _fused.count(def) > 0 || !fusible(def))
+        continue;
+      if (_graph.getOutputs().contains(input))
+        continue;
+
+      const auto &uses = operand.getUses();
+      if (!std::all_of(uses.begin(), uses.end(),
+                       [&](const ir::OperationIndex &use) { return members.count(use) > 0; }))
+        continue;
+
+      group.push_back(def);
+      members.insert(def);
+      if (group.size() == MAX_FUSED_STEPS)
+        break;
+    }
+  }
+  return group;
+}
+
+void ElementwiseFusionPass::fuse(const std::vector<ir::OperationIndex> &group)
+{
+  using ir::operation::FusedElementwise;
+
+  const auto backend = _lowered_graph.lower_info().operation.at(group.back());
+  const auto output = _graph.operations().at(group.back()).getOutputs().at(0);
+
+  // Operands given from outside of the group, and results of the steps
+  ir::OperandIndexSequence inputs;
+  std::unordered_map<ir::OperandIndex, uint32_t> input_values;
+  std::unordered_map<ir::OperandIndex, uint32_t> step_values;
+  for (uint32_t i = 0; i < group.size(); ++i)
+  {
+    const auto &op = _graph.operations().at(group[i]);
+    for (const auto &input : op.getInputs())
+    {
+      if (step_values.count(input) == 0 && input_values.count(input) == 0)
+      {
+        input_values[input] = inputs.size();
+        inputs.append(input);
+      }
+    }
+    step_values[op.getOutputs().at(0)] = i;
+  }
+  auto value = [&](const ir::OperandIndex &index) -> uint32_t {
+    auto it = step_values.find(index);
+    if (it != step_values.end())
+      return inputs.size() + it->second;
+    return input_values.at(index);
+  };
+
+  FusedElementwise::Param param;
+  for (const auto &ind : group)
+  {
+    const auto &op = _graph.operations().at(ind);
+    FusedElementwise::Step step{};
+    step.opcode = op.opcode();
+    step.lhs = value(op.getInputs().at(0));
+    step.rhs = step.lhs;
+    if (op.opcode() == ir::OpCode::BinaryArithmetic)
+    {
+      step.arithmetic = dynamic_cast<const ir::operation::BinaryArithmetic &>(op).param();
+      step.rhs = value(op.getInputs().at(ir::operation::BinaryArithmetic::Input::RHS));
+    }
+    else
+    {
+      step.activation = dynamic_cast<const ir::operation::ElementwiseActivation &>(op).param();
+    }
+    param.steps.emplace_back(step);
+  }
+
+  // Remove the chain and its intermediate operands
+  for (const auto &ind : group)
+  {
+    const auto &op = _graph.operations().at(ind);
+    for (const auto &input : op.getInputs() | ir::Remove::DUPLICATED)
+    {
+      if (input_values.count(input) > 0)
+        _graph.operands().at(input).removeUse(ind);
+    }
+    _graph.operations().remove(ind);
+    _lowered_graph.lower_info().operation.erase(ind);
+  }
+  for (const auto &pair : step_values)
+  {
+    if (pair.first == output)
+      continue;
+    _graph.removeOperand(pair.first);
+    _lowered_graph.lower_info().operand.remove(pair.first);
+  }
+  _graph.operands().at(output).unsetDef();
+
+  auto fused_op =
+    std::make_unique<FusedElementwise>(inputs, ir::OperandIndexSequence{output}, param);
+  const auto fused_ind = _graph.addOperation(std::move(fused_op));
+  _lowered_graph.lower_info().operation.emplace(fused_ind, backend);
+
+  VERBOSE(ElementwiseFusionPass) << "Fused " << group.size() << " operations into "
+                                 << fused_ind << std::endl;
+}
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_PASS_ELEMENTWISE_FUSION_PASS_H__
+#define __ONERT_COMPILER_PASS_ELEMENTWISE_FUSION_PASS_H__
+
+#include "Pass.h"
+#include "compiler/ILoweredGraph.h"
+
+#include <unordered_set>
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+/**
+ * @brief An optimization pass that fuses chains of pointwise operations of cpu backend
+ *
+ * BinaryArithmetic and ElementwiseActivation operations on float tensors are grouped backward
+ * from the last operation of a chain, while the intermediate results are used only in the group.
+ * Each group is replaced with a FusedElementwise operation, and the intermediate operands are
+ * removed so that they are not allocated. It is disabled by ELEMENTWISE_FUSION config.
+ *
+ * @note This is an optimization pass which means that everything should work fine even if this pass
+ *       was skipped.
+ */
+class ElementwiseFusionPass : public Pass
+{
+public:
+  ElementwiseFusionPass(ILoweredGraph &lowered_graph)
+    : Pass{lowered_graph.graph()}, _lowered_graph{lowered_graph}
+  {
+  }
+
+public:
+  std::string id() final { return "ElementwiseFusionPass"; }
+  void run() final;
+
+private:
+  bool fusible(const ir::OperationIndex &ind) const;
+  std::vector<ir::OperationIndex> collect(const ir::OperationIndex &last) const;
+  void fuse(const std::vector<ir::OperationIndex> &group);
+
+private:
+  ILoweredGraph &_lowered_graph;
+  std::unordered_set<ir::OperationIndex> _fused;
+};
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_PASS_ELEMENTWISE_FUSION_PASS_H__
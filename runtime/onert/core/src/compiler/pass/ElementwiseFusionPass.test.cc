@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ElementwiseFusionPass.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/ElementwiseActivation.h"
+#include "ir/operation/FusedElementwise.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+using namespace onert;
+using namespace onert::ir;
+using namespace onert::compiler::pass;
+
+namespace
+{
+
+template <const char *ID> struct MockConfig : public backend::IConfig
+{
+  std::string id() override { return ID; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+};
+
+template <const char *ID> struct MockBackend : public backend::Backend
+{
+  std::shared_ptr<backend::IConfig> config() const override
+  {
+    return std::make_shared<MockConfig<ID>>();
+  }
+  std::unique_ptr<backend::BackendContext> newContext(backend::ContextData &&) const override
+  {
+    return nullptr;
+  }
+};
+
+constexpr char CPU[] = "cpu";
+constexpr char GPU[] = "gpu";
+
+/**
+ * @brief Graph lowered by assigning backends to operations by hand
+ */
+class MockLoweredGraph : public onert::compiler::ILoweredGraph
+{
+public:
+  Graph &graph() override { return _graph; }
+  const Graph &graph() const override { return _graph; }
+  const onert::compiler::GraphLowerInfo &lower_info() const override { return _lower_info; }
+  onert::compiler::GraphLowerInfo &lower_info() override { return _lower_info; }
+  void setHasDynamicTensor(OperationIndex, bool) override {}
+  bool getHasDynamicTensor(OperationIndex) const override { return false; }
+
+  // Operations not assigned explicitly run on cpu
+  void lower(const std::unordered_map<OperationIndex, const backend::Backend *> &backends = {})
+  {
+    _graph.operations().iterate([&](const OperationIndex &ind, const IOperation &) {
+      auto it = backends.find(ind);
+      _lower_info.operation[ind] = it != backends.end() ? it->second : &_cpu;
+    });
+  }
+
+  OperandIndex addBinary(const OperandIndex &lhs, const OperandIndex &rhs, const Shape &shape,
+                         operation::BinaryArithmetic::ArithmeticType type,
+                         OperationIndex *ind = nullptr)
+  {
+    operation::BinaryArithmetic::Param param;
+    param.arithmetic_type = type;
+    param.activation = Activation::NONE;
+    auto output = _graph.addOperand(shape, _graph.operands().at(lhs).typeInfo());
+    auto op_ind = _graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{lhs, rhs}, OperandIndexSequence{output}, param));
+    if (ind != nullptr)
+      *ind = op_ind;
+    return output;
+  }
+
+  OperandIndex addActivation(const OperandIndex &input,
+                             operation::ElementwiseActivation::Type type,
+                             OperationIndex *ind = nullptr)
+  {
+    operation::ElementwiseActivation::Param param;
+    param.op_type = type;
+    // RELU without upper bound, and Tanh which supports only alpha = beta = 1
+    const bool relu = type == operation::ElementwiseActivation::Type::RELU;
+    param.alpha = relu ? std::numeric_limits<float>::infinity() : 1.f;
+    param.beta = relu ? 0.f : 1.f;
+    const auto &operand = _graph.operands().at(input);
+    auto output = _graph.addOperand(operand.shape(), operand.typeInfo());
+    auto op_ind = _graph.addOperation(std::make_unique<operation::ElementwiseActivation>(
+      OperandIndexSequence{input}, OperandIndexSequence{output}, param));
+    if (ind != nullptr)
+      *ind = op_ind;
+    return output;
+  }
+
+  std::vector<OpCode> opcodes() const
+  {
+    std::vector<OpCode> result;
+    for (const auto &ind : _graph.topolSortOperations())
+      result.emplace_back(_graph.operations().at(ind).opcode());
+    return result;
+  }
+
+  const operation::FusedElementwise &fused(size_t position = 0) const
+  {
+    const auto &op = _graph.operations().at(_graph.topolSortOperations().at(position));
+    return dynamic_cast<const operation::FusedElementwise &>(op);
+  }
+
+  MockBackend<GPU> gpu;
+
+private:
+  Graph _graph;
+  onert::compiler::GraphLowerInfo _lower_info;
+  MockBackend<CPU> _cpu;
+};
+
+using ArithmeticType = operation::BinaryArithmetic::ArithmeticType;
+using ActivationType = operation::ElementwiseActivation::Type;
+
+} // namespace
+
+TEST(ElementwiseFusionPass, fuse_chain)
+{
+  MockLoweredGraph lgraph;
+  auto &graph = lgraph.graph();
+
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(Shape{2, 3}, type);
+  auto bias = graph.addOperand(Shape{2, 3}, type);
+  auto scale = graph.addOperand(Shape{2, 3}, type);
+  auto sum = lgraph.addBinary(in, bias, Shape{2, 3}, ArithmeticType::ADD);
+  auto relu = lgraph.addActivation(sum, ActivationType::RELU);
+  auto out = lgraph.addBinary(relu, scale, Shape{2, 3}, ArithmeticType::MUL);
+  graph.addInput(in);
+  graph.addInput(bias);
+  graph.addInput(scale);
+  graph.addOutput(out);
+  lgraph.lower();
+
+  ElementwiseFusionPass{lgraph}.run();
+  ASSERT_NO_THROW(graph.verify());
+
+  ASSERT_EQ(lgraph.opcodes(), std::vector<OpCode>{OpCode::FusedElementwise});
+  const auto &op = lgraph.fused();
+  ASSERT_EQ(op.getInputs(), (OperandIndexSequence{in, bias, scale}));
+  ASSERT_EQ(op.getOutputs(), OperandIndexSequence{out});
+  ASSERT_EQ(graph.operands().at(out).getDef(), graph.topolSortOperations().at(0));
+  ASSERT_FALSE(graph.operands().exist(sum));
+  ASSERT_FALSE(graph.operands().exist(relu));
+
+  // Values are inputs first and then results of the steps in evaluation order
+  const auto &steps = op.param().steps;
+  ASSERT_EQ(steps.size(), 3);
+  ASSERT_EQ(steps[0].opcode, OpCode::BinaryArithmetic);
+  ASSERT_EQ(steps[0].arithmetic.arithmetic_type, ArithmeticType::ADD);
+  ASSERT_EQ(steps[0].lhs, 0);
+  ASSERT_EQ(steps[0].rhs, 1);
+  ASSERT_EQ(steps[1].opcode, OpCode::ElementwiseActivation);
+  ASSERT_EQ(steps[1].activation.op_type, ActivationType::RELU);
+  ASSERT_EQ(steps[1].lhs, 3);
+  ASSERT_EQ(steps[2].arithmetic.arithmetic_type, ArithmeticType::MUL);
+  ASSERT_EQ(steps[2].lhs, 4);
+  ASSERT_EQ(steps[2].rhs, 2);
+}
+
+TEST(ElementwiseFusionPass, fuse_broadcast)
+{
+  MockLoweredGraph lgraph;
+  auto &graph = lgraph.graph();
+
+  // Broadcast inputs are given to the fused operation as they are
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(Shape{2, 3}, type);
+  auto bias = graph.addOperand(Shape{3}, type);
+  auto sum = lgraph.addBinary(in, bias, Shape{2, 3}, ArithmeticType::ADD);
+  auto out = lgraph.addActivation(sum, ActivationType::TANH);
+  graph.addInput(in);
+  graph.addInput(bias);
+  graph.addOutput(out);
+  lgraph.lower();
+
+  ElementwiseFusionPass{lgraph}.run();
+  ASSERT_NO_THROW(graph.verify());
+
+  ASSERT_EQ(lgraph.opcodes(), std::vector<OpCode>{OpCode::FusedElementwise});
+  ASSERT_EQ(lgraph.fused().getInputs(), (OperandIndexSequence{in, bias}));
+  ASSERT_EQ(graph.operands().at(bias).shape(), Shape{3});
+}
+
+TEST(ElementwiseFusionPass, fuse_multiple_consumers_in_group)
+{
+  MockLoweredGraph lgraph;
+  auto &graph = lgraph.graph();
+
+  // sum is used twice, but both uses join the group
+  TypeInfo type{DataType::FLOAT32};
+  auto lhs = graph.addOperand(Shape{4}, type);
+  auto rhs = graph.addOperand(Shape{4}, type);
+  auto sum = lgraph.addBinary(lhs, rhs, Shape{4}, ArithmeticType::ADD);
+  auto relu = lgraph.addActivation(sum, ActivationType::RELU);
+  auto tanh = lgraph.addActivation(sum, ActivationType::TANH);
+  auto out = lgraph.addBinary(relu, tanh, Shape{4}, ArithmeticType::MUL);
+  graph.addInput(lhs);
+  graph.addInput(rhs);
+  graph.addOutput(out);
+  lgraph.lower();
+
+  ElementwiseFusionPass{lgraph}.run();
+  ASSERT_NO_THROW(graph.verify());
+
+  ASSERT_EQ(lgraph.opcodes(), std::vector<OpCode>{OpCode::FusedElementwise});
+  const auto &op = lgraph.fused();
+  ASSERT_EQ(op.getInputs(), (OperandIndexSequence{lhs, rhs}));
+  const auto &steps = op.param().steps;
+  ASSERT_EQ(steps.size(), 4);
+  ASSERT_EQ(steps[0].opcode, OpCode::BinaryArithmetic);
+  ASSERT_EQ(steps[3].opcode, OpCode::BinaryArithmetic);
+  // Both activations read the result of the first step
+  ASSERT_EQ(steps[1].lhs, 2);
+  ASSERT_EQ(steps[2].lhs, 2);
+}
+
+TEST(ElementwiseFusionPass, neg_consumer_out_of_group)
+{
+  MockLoweredGraph lgraph;
+  auto &graph = lgraph.graph();
+
+  // sum is also a graph output, so only relu and out are fused
+  TypeInfo type{DataType::FLOAT32};
+  auto lhs = graph.addOperand(Shape{4}, type);
+  auto rhs = graph.addOperand(Shape{4}, type);
+  auto sum = lgraph.addBinary(lhs, rhs, Shape{4}, ArithmeticType::ADD);
+  auto relu = lgraph.addActivation(sum, ActivationType::RELU);
+  auto out = lgraph.addActivation(relu, ActivationType::TANH);
+  graph.addInput(lhs);
+  graph.addInput(rhs);
+  graph.addOutput(sum);
+  graph.addOutput(out);
+  lgraph.lower();
+
+  ElementwiseFusionPass{lgraph}.run();
+  ASSERT_NO_THROW(graph.verify());
+
+  ASSERT_EQ(lgraph.opcodes(),
+            (std::vector<OpCode>{OpCode::BinaryArithmetic, OpCode::FusedElementwise}));
+  ASSERT_TRUE(graph.operands().exist(sum));
+  ASSERT_EQ(lgraph.fused(1).getInputs(), OperandIndexSequence{sum});
+  ASSERT_EQ(lgraph.fused(1).param().steps.size(), 2);
+}
+
+TEST(ElementwiseFusionPass, neg_keep_convex)
+{
+  MockLoweredGraph lgraph;
+  auto &graph = lgraph.graph();
+
+  // relu -> tanh(gpu) -> out and relu -> out cannot be fused without tanh
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(Shape{4}, type);
+  OperationIndex tanh_ind;
+  auto relu = lgraph.addActivation(in, ActivationType::RELU);
+  auto tanh = lgraph.addActivation(relu, ActivationType::TANH, &tanh_ind);
+  auto out = lgraph.addBinary(relu, tanh, Shape{4}, ArithmeticType::ADD);
+  graph.addInput(in);
+  graph.addOutput(out);
+  lgraph.lower({{tanh_ind, &lgraph.gpu}});
+
+  ElementwiseFusionPass{lgraph}.run();
+  ASSERT_NO_THROW(graph.verify());
+
+  ASSERT_EQ(lgraph.opcodes(),
+            (std::vector<OpCode>{OpCode::ElementwiseActivation, OpCode::ElementwiseActivation,
+                                 OpCode::BinaryArithmetic}));
+  ASSERT_TRUE(graph.operands().exist(relu));
+}
+
+TEST(ElementwiseFusionPass, neg_other_backend)
+{
+  MockLoweredGraph lgraph;
+  auto &graph = lgraph.graph();
+
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(Shape{4}, type);
+  OperationIndex relu_ind, tanh_ind;
+  auto relu = lgraph.addActivation(in, ActivationType::RELU, &relu_ind);
+  auto out = lgraph.addActivation(relu, ActivationType::TANH, &tanh_ind);
+  graph.addInput(in);
+  graph.addOutput(out);
+  lgraph.lower({{relu_ind, &lgraph.gpu}, {tanh_ind, &lgraph.gpu}});
+
+  ElementwiseFusionPass{lgraph}.run();
+  ASSERT_NO_THROW(graph.verify());
+
+  ASSERT_EQ(lgraph.opcodes(), (std::vector<OpCode>{OpCode::ElementwiseActivation,
+                                                   OpCode::ElementwiseActivation}));
+}
+
+TEST(ElementwiseFusionPass, neg_not_float)
+{
+  MockLoweredGraph lgraph;
+  auto &graph = lgraph.graph();
+
+  TypeInfo type{DataType::INT32};
+  auto lhs = graph.addOperand(Shape{4}, type);
+  auto rhs = graph.addOperand(Shape{4}, type);
+  auto sum = lgraph.addBinary(lhs, rhs, Shape{4}, ArithmeticType::ADD);
+  auto out = lgraph.addBinary(sum, rhs, Shape{4}, ArithmeticType::MUL);
+  graph.addInput(lhs);
+  graph.addInput(rhs);
+  graph.addOutput(out);
+  lgraph.lower();
+
+  ElementwiseFusionPass{lgraph}.run();
+  ASSERT_NO_THROW(graph.verify());
+
+  ASSERT_EQ(lgraph.opcodes(),
+            (std::vector<OpCode>{OpCode::BinaryArithmetic, OpCode::BinaryArithmetic}));
+}
@@ -23,6 +23,7 @@
 #include "util/logging.h"
 
 #include <cassert>
+#include <list>
 #include <memory>
 #include <unordered_map>
 #include <utility>
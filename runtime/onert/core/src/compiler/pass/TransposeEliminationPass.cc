@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransposeEliminationPass.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/Transpose.h"
+#include "util/logging.h"
+
+#include <algorithm>
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+namespace
+{
+
+// Operations whose results do not depend on the order of dimensions
+bool isLayoutAgnostic(const ir::IOperation &op)
+{
+  switch (op.opcode())
+  {
+    case ir::OpCode::BinaryArithmetic:
+    case ir::OpCode::Comparison:
+    case ir::OpCode::ElementwiseActivation:
+    case ir::OpCode::ElementwiseBinary:
+    case ir::OpCode::ElementwiseUnary:
+    case ir::OpCode::Pow:
+    case ir::OpCode::SquaredDifference:
+      return op.getOutputs().size() == 1;
+    default:
+      return false;
+  }
+}
+
+bool isIdentity(const std::vector<int32_t> &perm)
+{
+  for (size_t i = 0; i < perm.size(); ++i)
+  {
+    if (perm[i] != static_cast<int32_t>(i))
+      return false;
+  }
+  return true;
+}
+
+// Returns the shape which becomes the given one when it is transposed by perm
+ir::Shape inverse(const ir::Shape &shape, const std::vector<int32_t> &perm)
+{
+  ir::Shape result(shape.rank());
+  for (size_t i = 0; i < perm.size(); ++i)
+    result.dim(perm[i]) = shape.dim(i);
+  return result;
+}
+
+} // namespace
+
+void TransposeEliminationPass::run()
+{
+  // Every change removes a Transpose or moves one forward, so this ends
+  bool changed = true;
+  while (changed)
+  {
+    changed = false;
+    for (const auto &ind : _graph.topolSortOperations())
+    {
+      if (!_graph.operations().exist(ind))
+        continue;
+      if (cancel(ind) || sink(ind))
+        changed = true;
+    }
+  }
+}
+
+std::vector<int32_t> TransposeEliminationPass::permutation(const ir::OperationIndex &ind) const
+{
+  using ir::operation::Transpose;
+
+  const auto &op = _graph.operations().at(ind);
+  if (op.opcode() != ir::OpCode::Transpose)
+    return {};
+
+  const auto &input = _graph.operands().at(op.getInputs().at(Transpose::Input::INPUT));
+  const auto &perm = _graph.operands().at(op.getInputs().at(Transpose::Input::PERMUTATION));
+  const auto rank = input.shape().rank();
+  if (rank == 0 || !perm.isConstant() || perm.typeInfo().type() != ir::DataType::INT32)
+    return {};
+
+  std::vector<int32_t> result(rank);
+  if (perm.shape().num_elements() == 0)
+  {
+    // This means perm is (n-1...0)
+    for (int i = 0; i < rank; ++i)
+      result[i] = rank - 1 - i;
+    return result;
+  }
+  if (perm.shape().num_elements() != static_cast<uint64_t>(rank))
+    return {};
+
+  const auto values = reinterpret_cast<const int32_t *>(perm.data()->base());
+  std::copy(values, values + rank, result.begin());
+
+  // Invalid permutations are left to be reported by the kernel
+  std::vector<bool> seen(rank, false);
+  for (const auto axis : result)
+  {
+    if (axis < 0 || axis >= rank || seen[axis])
+      return {};
+    seen[axis] = true;
+  }
+  return result;
+}
+
+bool TransposeEliminationPass::cancel(const ir::OperationIndex &ind)
+{
+  using ir::operation::Transpose;
+
+  const auto first_perm = permutation(ind);
+  if (first_perm.empty())
+    return false;
+
+  const auto input = _graph.operations().at(ind).getInputs().at(Transpose::Input::INPUT);
+  const auto middle = _graph.operations().at(ind).getOutputs().at(0);
+  const auto &middle_obj = _graph.operands().at(middle);
+  if (middle_obj.getUses().size() != 1 || _graph.getOutputs().contains(middle))
+    return false;
+
+  const auto second = *middle_obj.getUses().begin();
+  const auto second_perm = permutation(second);
+  if (second_perm.size() != first_perm.size())
+    return false;
+  const auto output = _graph.operations().at(second).getOutputs().at(0);
+
+  // Transposing twice picks dimension first_perm[second_perm[i]] of the input
+  std::vector<int32_t> perm(first_perm.size());
+  for (size_t i = 0; i < perm.size(); ++i)
+    perm[i] = first_perm[second_perm[i]];
+
+  if (!isIdentity(perm))
+  {
+    const auto perm_ind = addPermutation(perm);
+    removeTranspose(second);
+    removeTranspose(ind);
+    _graph.removeOperand(middle);
+    _graph.operands().at(output).unsetDef();
+    _graph.addOperation(std::make_unique<Transpose>(ir::OperandIndexSequence{input, perm_ind},
+                                                    ir::OperandIndexSequence{output}));
+
+    VERBOSE(TransposeEliminationPass) << "Merged Transpose " << ind << " and " << second
+                                      << std::endl;
+    return true;
+  }
+
+  if (!_graph.getOutputs().contains(output))
+  {
+    // Users of the result read the input directly
+    for (const auto &use : _graph.operands().at(output).getUses())
+    {
+      _graph.operations().at(use).replaceInputs(output, input);
+      _graph.operands().at(input).insertUse(use);
+    }
+    removeTranspose(second);
+    removeTranspose(ind);
+    _graph.removeOperand(middle);
+    _graph.removeOperand(output);
+
+    VERBOSE(TransposeEliminationPass) << "Removed Transpose " << ind << " and " << second
+                                      << std::endl;
+    return true;
+  }
+
+  // A model output is written by the producer of the input instead
+  const auto &input_obj = _graph.operands().at(input);
+  const auto def = input_obj.getDef();
+  if (!def.valid() || input_obj.getUses().size() != 1 || _graph.getInputs().contains(input) ||
+      _graph.getOutputs().contains(input))
+    return false;
+
+  removeTranspose(second);
+  removeTranspose(ind);
+  _graph.operations().at(def).replaceOutputs(input, output);
+  auto &output_obj = _graph.operands().at(output);
+  output_obj.unsetDef();
+  output_obj.setDef(def);
+  _graph.removeOperand(middle);
+  _graph.removeOperand(input);
+
+  VERBOSE(TransposeEliminationPass) << "Removed Transpose " << ind << " and " << second
+                                    << " before a model output" << std::endl;
+  return true;
+}
+
+bool TransposeEliminationPass::sink(const ir::OperationIndex &ind)
+{
+  using ir::operation::Transpose;
+
+  const auto perm = permutation(ind);
+  if (perm.empty())
+    return false;
+
+  const auto input = _graph.operations().at(ind).getInputs().at(Transpose::Input::INPUT);
+  const auto perm_ind = _graph.operations().at(ind).getInputs().at(Transpose::Input::PERMUTATION);
+  const auto middle = _graph.operations().at(ind).getOutputs().at(0);
+  const auto &middle_obj = _graph.operands().at(middle);
+  if (middle_obj.getUses().size() != 1 || _graph.getOutputs().contains(middle))
+    return false;
+
+  const auto next_ind = *middle_obj.getUses().begin();
+  auto &next = _graph.operations().at(next_ind);
+  if (!isLayoutAgnostic(next))
+    return false;
+
+  // Moving is worth only when it meets another Transpose
+  const auto output = next.getOutputs().at(0);
+  if (_graph.operands().at(output).shape().rank() != static_cast<int>(perm.size()) ||
+      !reachesTranspose(output))
+    return false;
+
+  // Per channel quantization depends on the layout
+  for (const auto &operands : {&next.getInputs(), &next.getOutputs()})
+  {
+    for (const auto &index : *operands)
+    {
+      if (index.undefined() || _graph.operands().at(index).typeInfo().scales().size() > 1)
+        return false;
+    }
+  }
+
+  // Other inputs are taken in the layout of the input. An undefined replacement means a constant
+  // which has to be transposed inversely.
+  std::vector<std::pair<ir::OperandIndex, ir::OperandIndex>> replaces;
+  for (const auto &other : next.getInputs() | ir::Remove::DUPLICATED)
+  {
+    if (other == middle)
+      continue;
+
+    const auto &other_obj = _graph.operands().at(other);
+    const auto def = other_obj.getDef();
+    if (other_obj.shape().rank() > static_cast<int>(perm.size()))
+      return false;
+    if (def.valid() && permutation(def) == perm)
+      replaces.emplace_back(other, _graph.operations().at(def).getInputs().at(Transpose::INPUT));
+    else if (other_obj.isConstant() && other_obj.shape().num_elements() == 1)
+      continue;
+    else if (other_obj.isConstant() && other_obj.shape().rank() == static_cast<int>(perm.size()) &&
+             other_obj.data()->size() == other_obj.info().total_size())
+      replaces.emplace_back(other, ir::OperandIndex{});
+    else
+      return false;
+  }
+  for (auto &replace : replaces)
+  {
+    if (replace.second.undefined())
+      replace.second = addInverseTransposed(replace.first, perm);
+  }
+
+  const auto &output_obj = _graph.operands().at(output);
+  const auto sunk_output =
+    _graph.addOperand(inverse(output_obj.shape(), perm), output_obj.typeInfo());
+
+  next.replaceInputs(middle, input);
+  _graph.operands().at(input).insertUse(next_ind);
+  for (const auto &replace : replaces)
+  {
+    next.replaceInputs(replace.first, replace.second);
+    _graph.operands().at(replace.first).removeUse(next_ind);
+    _graph.operands().at(replace.second).insertUse(next_ind);
+  }
+  next.replaceOutputs(output, sunk_output);
+  _graph.operands().at(sunk_output).setDef(next_ind);
+  _graph.operands().at(output).unsetDef();
+
+  removeTranspose(ind);
+  _graph.removeOperand(middle);
+
+  // Transposes of other inputs may have no use now
+  for (const auto &replace : replaces)
+  {
+    const auto &other_obj = _graph.operands().at(replace.first);
+    const auto def = other_obj.getDef();
+    if (def.valid() && other_obj.getUses().size() == 0 &&
+        !_graph.getOutputs().contains(replace.first))
+    {
+      removeTranspose(def);
+      _graph.removeOperand(replace.first);
+    }
+  }
+
+  _graph.addOperation(std::make_unique<Transpose>(ir::OperandIndexSequence{sunk_output, perm_ind},
+                                                  ir::OperandIndexSequence{output}));
+
+  VERBOSE(TransposeEliminationPass) << "Moved Transpose " << ind << " after " << next.name()
+                                    << " " << next_ind << std::endl;
+  return true;
+}
+
+bool TransposeEliminationPass::reachesTranspose(const ir::OperandIndex &ind) const
+{
+  auto current = ind;
+  while (true)
+  {
+    const auto &obj = _graph.operands().at(current);
+    if (obj.getUses().size() != 1 || _graph.getOutputs().contains(current))
+      return false;
+
+    const auto &use = _graph.operations().at(*obj.getUses().begin());
+    if (use.opcode() == ir::OpCode::Transpose)
+      return true;
+    if (!isLayoutAgnostic(use))
+      return false;
+    current = use.getOutputs().at(0);
+  }
+}
+
+ir::OperandIndex TransposeEliminationPass::addPermutation(const std::vector<int32_t> &perm)
+{
+  const auto ind = _graph.addOperand(ir::Shape{static_cast<int32_t>(perm.size())},
+                                     ir::TypeInfo{ir::DataType::INT32});
+  _graph.setOperandValue(ind, std::make_shared<ir::CachedData>(
+                                reinterpret_cast<const uint8_t *>(perm.data()),
+                                perm.size() * sizeof(int32_t)));
+  return ind;
+}
+
+ir::OperandIndex
+TransposeEliminationPass::addInverseTransposed(const ir::OperandIndex &ind,
+                                               const std::vector<int32_t> &perm)
+{
+  const auto &obj = _graph.operands().at(ind);
+  const auto &shape = obj.shape();
+  const auto new_shape = inverse(shape, perm);
+  const auto rank = shape.rank();
+  const auto element_size = ir::sizeOfDataType(obj.typeInfo().type());
+
+  // Element at index of the constant goes to the index permuted by perm in the new one
+  std::vector<size_t> strides(rank);
+  size_t stride = 1;
+  for (int i = rank - 1; i >= 0; --i)
+  {
+    strides[i] = stride;
+    stride *= new_shape.dim(i);
+  }
+
+  const auto src = obj.data()->base();
+  std::vector<uint8_t> dst(obj.data()->size());
+  std::vector<int32_t> index(rank, 0);
+  for (uint64_t n = 0; n < shape.num_elements(); ++n)
+  {
+    size_t offset = 0;
+    for (int i = 0; i < rank; ++i)
+      offset += index[i] * strides[perm[i]];
+    std::copy(src + n * element_size, src + (n + 1) * element_size,
+              dst.begin() + offset * element_size);
+
+    for (int i = rank - 1; i >= 0 && ++index[i] == shape.dim(i); --i)
+      index[i] = 0;
+  }
+
+  const auto new_ind = _graph.addOperand(new_shape, obj.typeInfo());
+  _graph.setOperandValue(new_ind, std::make_shared<ir::CachedData>(dst.data(), dst.size()));
+  return new_ind;
+}
+
+void TransposeEliminationPass::removeTranspose(const ir::OperationIndex &ind)
+{
+  for (const auto &input : _graph.operations().at(ind).getInputs() | ir::Remove::DUPLICATED)
+    _graph.operands().at(input).removeUse(ind);
+  _graph.operations().remove(ind);
+}
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_PASS_TRANSPOSE_ELIMINATION_PASS_H__
+#define __ONERT_COMPILER_PASS_TRANSPOSE_ELIMINATION_PASS_H__
+
+#include "Pass.h"
+#include "ir/Index.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+/**
+ * @brief An optimization pass that removes Transpose operations which cancel each other
+ *
+ * Models converted from other frameworks often wrap layout agnostic operations with a pair of
+ * Transpose operations. This pass moves a Transpose forward through elementwise operations while
+ * it reaches another Transpose, and then merges the two. Merged transposes with an identity
+ * permutation are removed.
+ *
+ * e.g.)
+ *
+ * ```
+ * ((#0)) -> [Transpose {0,2,3,1}] -> ((#1)) -> [Relu] -> ((#2)) -> [Transpose {0,3,1,2}] -> ((#3))
+ * becomes
+ * ((#0)) -> [Relu] -> ((#3))
+ * ```
+ *
+ * @note This is an optimization pass which means that everything should work fine even if this pass
+ *       was skipped.
+ */
+class TransposeEliminationPass : public Pass
+{
+public:
+  using Pass::Pass;
+
+public:
+  std::string id() final { return "TransposeEliminationPass"; }
+  void run() final;
+
+private:
+  std::vector<int32_t> permutation(const ir::OperationIndex &ind) const;
+  bool cancel(const ir::OperationIndex &ind);
+  bool sink(const ir::OperationIndex &ind);
+  bool reachesTranspose(const ir::OperandIndex &ind) const;
+  ir::OperandIndex addPermutation(const std::vector<int32_t> &perm);
+  ir::OperandIndex addInverseTransposed(const ir::OperandIndex &ind,
+                                        const std::vector<int32_t> &perm);
+  void removeTranspose(const ir::OperationIndex &ind);
+};
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_PASS_TRANSPOSE_ELIMINATION_PASS_H__
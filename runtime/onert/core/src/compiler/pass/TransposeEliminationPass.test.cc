@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransposeEliminationPass.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/ElementwiseActivation.h"
+#include "ir/operation/Transpose.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+using namespace onert::ir;
+using namespace onert::compiler::pass;
+
+namespace
+{
+
+OperandIndex addConstant(Graph &graph, const Shape &shape, const std::vector<int32_t> &values)
+{
+  auto ind = graph.addOperand(shape, TypeInfo{DataType::INT32});
+  graph.setOperandValue(ind, std::make_shared<CachedData>(
+                               reinterpret_cast<const uint8_t *>(values.data()),
+                               values.size() * sizeof(int32_t)));
+  return ind;
+}
+
+OperandIndex addTranspose(Graph &graph, const OperandIndex &input, const Shape &shape,
+                          const std::vector<int32_t> &perm)
+{
+  auto perm_ind = addConstant(graph, Shape{static_cast<int32_t>(perm.size())}, perm);
+  auto output = graph.addOperand(shape, graph.operands().at(input).typeInfo());
+  graph.addOperation(std::make_unique<operation::Transpose>(OperandIndexSequence{input, perm_ind},
+                                                            OperandIndexSequence{output}));
+  return output;
+}
+
+std::vector<OpCode> opcodes(const Graph &graph)
+{
+  std::vector<OpCode> result;
+  for (const auto &ind : graph.topolSortOperations())
+    result.emplace_back(graph.operations().at(ind).opcode());
+  return result;
+}
+
+} // namespace
+
+TEST(TransposeEliminationPass, cancel_around_activation)
+{
+  Graph graph;
+
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(Shape{1, 3, 4, 5}, type);
+  auto nhwc = addTranspose(graph, in, Shape{1, 4, 5, 3}, {0, 2, 3, 1});
+  auto relu = graph.addOperand(Shape{1, 4, 5, 3}, type);
+  operation::ElementwiseActivation::Param param;
+  param.op_type = operation::ElementwiseActivation::Type::RELU;
+  param.alpha = std::numeric_limits<float>::infinity();
+  graph.addOperation(std::make_unique<operation::ElementwiseActivation>(
+    OperandIndexSequence{nhwc}, OperandIndexSequence{relu}, param));
+  auto out = addTranspose(graph, relu, Shape{1, 3, 4, 5}, {0, 3, 1, 2});
+
+  graph.addInput(in);
+  graph.addOutput(out);
+
+  TransposeEliminationPass{graph}.run();
+  ASSERT_NO_THROW(graph.verify());
+
+  ASSERT_EQ(opcodes(graph), std::vector<OpCode>{OpCode::ElementwiseActivation});
+  const auto &op = graph.operations().at(graph.topolSortOperations().at(0));
+  ASSERT_EQ(op.getInputs().at(0), in);
+  ASSERT_EQ(op.getOutputs().at(0), out);
+  ASSERT_EQ(graph.operands().at(out).getDef(), graph.topolSortOperations().at(0));
+}
+
+TEST(TransposeEliminationPass, merge)
+{
+  Graph graph;
+
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(Shape{2, 3, 4}, type);
+  auto middle = addTranspose(graph, in, Shape{3, 2, 4}, {1, 0, 2});
+  auto out = addTranspose(graph, middle, Shape{3, 4, 2}, {0, 2, 1});
+
+  graph.addInput(in);
+  graph.addOutput(out);
+
+  TransposeEliminationPass{graph}.run();
+  ASSERT_NO_THROW(graph.verify());
+
+  ASSERT_EQ(opcodes(graph), std::vector<OpCode>{OpCode::Transpose});
+  const auto &op = graph.operations().at(graph.topolSortOperations().at(0));
+  ASSERT_EQ(op.getInputs().at(operation::Transpose::Input::INPUT), in);
+  ASSERT_EQ(op.getOutputs().at(0), out);
+  const auto &perm = graph.operands().at(op.getInputs().at(operation::Transpose::PERMUTATION));
+  const auto perm_buf = reinterpret_cast<const int32_t *>(perm.data()->base());
+  ASSERT_EQ(std::vector<int32_t>(perm_buf, perm_buf + 3), (std::vector<int32_t>{1, 2, 0}));
+}
+
+TEST(TransposeEliminationPass, constant_operand)
+{
+  Graph graph;
+
+  TypeInfo type{DataType::INT32};
+  auto in = graph.addOperand(Shape{2, 3}, type);
+  auto transposed = addTranspose(graph, in, Shape{3, 2}, {1, 0});
+  auto rhs = addConstant(graph, Shape{3, 2}, {0, 1, 2, 3, 4, 5});
+  auto sum = graph.addOperand(Shape{3, 2}, type);
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = Activation::NONE;
+  graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{transposed, rhs}, OperandIndexSequence{sum}, param));
+  auto back = addTranspose(graph, sum, Shape{2, 3}, {1, 0});
+  auto out = graph.addOperand(Shape{2, 3}, type);
+  graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{back, back}, OperandIndexSequence{out}, param));
+
+  graph.addInput(in);
+  graph.addOutput(out);
+
+  TransposeEliminationPass{graph}.run();
+  ASSERT_NO_THROW(graph.verify());
+
+  ASSERT_EQ(opcodes(graph),
+            (std::vector<OpCode>{OpCode::BinaryArithmetic, OpCode::BinaryArithmetic}));
+  const auto &op = graph.operations().at(graph.topolSortOperations().at(0));
+  ASSERT_EQ(op.getInputs().at(0), in);
+  const auto &constant = graph.operands().at(op.getInputs().at(1));
+  ASSERT_EQ(constant.shape(), (Shape{2, 3}));
+  const auto buf = reinterpret_cast<const int32_t *>(constant.data()->base());
+  ASSERT_EQ(std::vector<int32_t>(buf, buf + 6), (std::vector<int32_t>{0, 2, 4, 1, 3, 5}));
+  ASSERT_EQ(graph.operations().at(graph.topolSortOperations().at(1)).getInputs().at(0),
+            op.getOutputs().at(0));
+}
+
+TEST(TransposeEliminationPass, neg_keep_single)
+{
+  Graph graph;
+
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(Shape{1, 3, 4, 5}, type);
+  auto out = addTranspose(graph, in, Shape{1, 4, 5, 3}, {0, 2, 3, 1});
+
+  graph.addInput(in);
+  graph.addOutput(out);
+
+  TransposeEliminationPass{graph}.run();
+  ASSERT_NO_THROW(graph.verify());
+
+  ASSERT_EQ(opcodes(graph), std::vector<OpCode>{OpCode::Transpose});
+}
@@ -57,10 +57,10 @@ std::string backend_to_fillcolor(const backend::Backend *backend)
   }
 }
 
-std::unordered_map<ir::OperandIndex, std::unique_ptr<Operand>>
+ir::OperandIndexMap<std::unique_ptr<Operand>>
 generate_dot_operands(const ir::Graph &graph, const DotDumper::Level level)
 {
-  std::unordered_map<ir::OperandIndex, std::unique_ptr<Operand>> dot_operands;
+  ir::OperandIndexMap<std::unique_ptr<Operand>> dot_operands;
 
   const auto &operands = graph.operands();
   operands.iterate([&](const ir::OperandIndex &index, const ir::Operand &object) {
@@ -88,7 +88,7 @@ DataflowExecutor::DataflowExecutor(std::unique_ptr<compiler::LoweredGraph> lower
 
   // Assign jobs convert OperationIndex to job index(uint32_t)
   uint32_t next_job_index = 0;
-  std::unordered_map<ir::OperationIndex, uint32_t> op_to_job;
+  ir::OperationIndexMap<uint32_t> op_to_job;
   const auto &operations = _lowered_graph->graph().operations();
   operations.iterate([&](const ir::OperationIndex &op_ind, const ir::IOperation &) {
     VERBOSE(DataflowExecutor) << "Create a job " << next_job_index << " with Operation " << op_ind
@@ -102,23 +102,24 @@ DataflowExecutor::DataflowExecutor(std::unique_ptr<compiler::LoweredGraph> lower
   _output_info.resize(next_job_index);
   _initial_input_info.resize(next_job_index, 0);
 
+  const auto &operands = _lowered_graph->graph().operands();
   operations.iterate([&](const ir::OperationIndex &op_ind, const ir::IOperation &op) {
     auto job_index = op_to_job[op_ind];
-    for (auto &&output : op.getOutputs())
+    for (auto &&output : op.getOutputs() | ir::Remove::UNDEFINED)
     {
       // Update output and input info
-      operations.iterate([&](const ir::OperationIndex &op_cur_ind, const ir::IOperation &op_cur) {
-        if (op_cur.getInputs().contains(output))
-        {
-          auto dep_index = op_to_job[op_cur_ind];
-          ++_initial_input_info[dep_index];
-          _output_info[job_index].push_back(dep_index);
-        }
-      });
+      // NOTE Use def-use info of operands instead of scanning all operations for each output
+      for (auto &&op_cur_ind : operands.at(output).getUses())
+      {
+        auto dep_index = op_to_job.at(op_cur_ind);
+        ++_initial_input_info[dep_index];
+        _output_info[job_index].push_back(dep_index);
+      }
     }
   });
+  _job_to_op.resize(next_job_index);
   for (const auto &[op_ind, job_ind] : op_to_job)
-    _job_to_op.emplace(job_ind, op_ind);
+    _job_to_op[job_ind] = op_ind;
 
   _input_info = _initial_input_info;
 }
@@ -22,12 +22,12 @@
 
 #include "compiler/CodeMap.h"
 #include "ir/OperandIndexSequence.h"
+#include "ir/OperationIndexMap.h"
 #include "util/TracingCtx.h"
 
 #include <list>
 #include <map>
 #include <memory>
-#include <unordered_map>
 
 namespace onert
 {
@@ -86,8 +86,8 @@ protected:
    */
   std::multimap<int64_t, std::unique_ptr<Job>, std::greater<int64_t>> _ready_jobs;
 
-  /// @brief Which job runs which op and function.
-  std::unordered_map<uint32_t, ir::OperationIndex> _job_to_op;
+  /// @brief Which job runs which op and function. Job indices are dense, so it is indexed by them.
+  std::vector<ir::OperationIndex> _job_to_op;
 };
 
 } // namespace exec
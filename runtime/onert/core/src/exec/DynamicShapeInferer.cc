@@ -17,12 +17,231 @@
 #include "exec/DynamicShapeInferer.h"
 #include "util/ShapeInference.h"
 #include <assert.h>
+#include <cstring>
+
+namespace
+{
+
+using namespace onert;
+
+/**
+ * @brief Collects inputs whose values decide output shapes, e.g. shape of Reshape or start of
+ *        Range. The list follows the visitors of DynamicShapeInferer that read input buffers.
+ */
+class ShapeDecidingInputs : public ir::OperationVisitor
+{
+public:
+  static ir::OperandIndexSequence of(const ir::IOperation &op)
+  {
+    ShapeDecidingInputs collector;
+    op.accept(collector);
+    return collector._inputs;
+  }
+
+public:
+  void visit(const ir::operation::ArgMinMax &op) override
+  {
+    add(op, ir::operation::ArgMinMax::Input::AXIS);
+  }
+  void visit(const ir::operation::BCQFullyConnected &op) override
+  {
+    add(op, ir::operation::BCQFullyConnected::Input::WEIGHTS_CLUSTERS);
+  }
+  void visit(const ir::operation::BCQGather &op) override
+  {
+    add(op, ir::operation::BCQGather::Input::INPUT_CLUSTERS);
+  }
+  void visit(const ir::operation::BroadcastTo &op) override
+  {
+    add(op, ir::operation::BroadcastTo::Input::SHAPE);
+  }
+  void visit(const ir::operation::ExpandDims &op) override
+  {
+    add(op, ir::operation::ExpandDims::Input::AXIS);
+  }
+  void visit(const ir::operation::Fill &op) override { add(op, ir::operation::Fill::Input::SHAPE); }
+  void visit(const ir::operation::OneHot &op) override
+  {
+    add(op, ir::operation::OneHot::Input::DEPTH);
+  }
+  void visit(const ir::operation::Pad &op) override { add(op, ir::operation::Pad::Input::PAD); }
+  void visit(const ir::operation::Range &op) override
+  {
+    add(op, ir::operation::Range::Input::START);
+    add(op, ir::operation::Range::Input::LIMIT);
+    add(op, ir::operation::Range::Input::DELTA);
+  }
+  void visit(const ir::operation::Reduce &op) override
+  {
+    add(op, ir::operation::Reduce::Input::AXES);
+  }
+  void visit(const ir::operation::Reshape &op) override
+  {
+    // New shape may be given by the option only
+    if (op.getInputs().size() == 2)
+      add(op, ir::operation::Reshape::Input::SHAPE);
+  }
+  void visit(const ir::operation::ResizeBilinear &op) override
+  {
+    // Size may be given by the option only
+    if (op.getInputs().size() == 2)
+      add(op, ir::operation::ResizeBilinear::Input::SIZE);
+  }
+  void visit(const ir::operation::Slice &op) override
+  {
+    add(op, ir::operation::Slice::Input::BEGINS);
+    add(op, ir::operation::Slice::Input::SIZES);
+  }
+  void visit(const ir::operation::SpaceToBatchND &op) override
+  {
+    add(op, ir::operation::SpaceToBatchND::Input::BLOCK_SIZE);
+    add(op, ir::operation::SpaceToBatchND::Input::PADDINGS);
+  }
+  void visit(const ir::operation::Split &op) override
+  {
+    add(op, ir::operation::Split::Input::AXIS);
+  }
+  void visit(const ir::operation::StridedSlice &op) override
+  {
+    add(op, ir::operation::StridedSlice::Input::STARTS);
+    add(op, ir::operation::StridedSlice::Input::ENDS);
+    add(op, ir::operation::StridedSlice::Input::STRIDES);
+  }
+  void visit(const ir::operation::Tile &op) override
+  {
+    add(op, ir::operation::Tile::Input::MULTIPLES);
+  }
+  void visit(const ir::operation::Transpose &op) override
+  {
+    add(op, ir::operation::Transpose::Input::PERMUTATION);
+  }
+
+private:
+  void add(const ir::Operation &op, uint32_t input)
+  {
+    const auto &ind = op.getInputs().at(input);
+    if (!ind.undefined())
+      _inputs.append(ind);
+  }
+
+private:
+  ir::OperandIndexSequence _inputs;
+};
+
+} // namespace
 
 namespace onert
 {
 namespace exec
 {
 
+void DynamicShapeInferer::infer(const ir::IOperation &op)
+{
+  auto [it, inserted] = _memos.try_emplace(&op);
+  auto &memo = it->second;
+  if (inserted)
+    memo.deciding = ShapeDecidingInputs::of(op);
+  else if (memo.valid && matchState(op, memo))
+  {
+    for (const auto &[tensor, shape] : memo.applied)
+      tensor->applyShape(shape);
+    return;
+  }
+
+  memo.valid = false;
+  memo.applied.clear();
+  const bool memoizable = saveState(op, memo);
+
+  _recording = &memo;
+  try
+  {
+    op.accept(*this);
+  }
+  catch (...)
+  {
+    _recording = nullptr;
+    throw;
+  }
+  _recording = nullptr;
+
+  memo.valid = memoizable;
+}
+
+void DynamicShapeInferer::applyShape(backend::ITensor *tensor, const ir::Shape &shape)
+{
+  tensor->applyShape(shape);
+  if (_recording)
+    _recording->applied.emplace_back(tensor, shape);
+}
+
+bool DynamicShapeInferer::saveState(const ir::IOperation &op, ShapeMemo &memo) const
+{
+  memo.states.clear();
+  memo.values.clear();
+  // Sequences are walked in place as combining them would allocate on every run
+  for (const auto *seq : {&op.getInputs(), &op.getOutputs()})
+  {
+    for (const auto &ind : *seq)
+    {
+      if (ind.undefined())
+        continue;
+      const auto tensor = _tensor_registry->getITensor(ind);
+      if (tensor == nullptr)
+        return false;
+      memo.states.push_back(
+        {tensor->getShape(), tensor->is_dynamic(), tensor->buffer() != nullptr});
+    }
+  }
+
+  for (const auto &ind : memo.deciding)
+  {
+    // Constants never change
+    const auto tensor = _tensor_registry->getITensor(ind);
+    if (tensor->is_constant())
+      continue;
+    if (tensor->buffer() == nullptr)
+      return false;
+    memo.values.insert(memo.values.end(), tensor->buffer(),
+                       tensor->buffer() + tensor->total_size());
+  }
+  return true;
+}
+
+bool DynamicShapeInferer::matchState(const ir::IOperation &op, const ShapeMemo &memo) const
+{
+  size_t n = 0;
+  for (const auto *seq : {&op.getInputs(), &op.getOutputs()})
+  {
+    for (const auto &ind : *seq)
+    {
+      if (ind.undefined())
+        continue;
+      const auto tensor = _tensor_registry->getITensor(ind);
+      if (tensor == nullptr || n >= memo.states.size())
+        return false;
+      const auto &state = memo.states[n++];
+      if (tensor->is_dynamic() != state.dynamic ||
+          (tensor->buffer() != nullptr) != state.allocated || tensor->getShape() != state.shape)
+        return false;
+    }
+  }
+
+  size_t offset = 0;
+  for (const auto &ind : memo.deciding)
+  {
+    const auto tensor = _tensor_registry->getITensor(ind);
+    if (tensor->is_constant())
+      continue;
+    // Sizes are the same as shapes are
+    const auto size = tensor->total_size();
+    if (tensor->buffer() == nullptr || offset + size > memo.values.size() ||
+        std::memcmp(tensor->buffer(), memo.values.data() + offset, size) != 0)
+      return false;
+    offset += size;
+  }
+  return true;
+}
+
 void DynamicShapeInferer::handleBinaryArithmeticOp(const ir::Operation &op,
                                                    const ir::OperandIndex lhs_idx,
                                                    const ir::OperandIndex rhs_idx)
@@ -56,7 +275,7 @@ void DynamicShapeInferer::handleBinaryArithmeticOp(const ir::Operation &op,
 
   ir::Shape new_shape = shape_inference::inferEltwiseShape(lhs_shape, rhs_shape);
 
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -88,7 +307,7 @@ void DynamicShapeInferer::handleSimpleUnaryOp(const ir::Operation &op,
   auto output_ind = op.getOutputs().at(0);
   auto output = _tensor_registry->getITensor(output_ind);
 
-  output->applyShape(output_shape);
+  applyShape(output, output_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -113,7 +332,7 @@ void DynamicShapeInferer::visit(const ir::operation::ArgMinMax &op)
 
   ir::Shape new_shape = shape_inference::inferArgMinMaxShape(input_shape, axis_value, rank);
 
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -135,7 +354,7 @@ void DynamicShapeInferer::visit(const ir::operation::BatchMatMul &op)
   // TODO
 
   auto new_shape = shape_inference::inferBatchMatMulShape(lhs_shape, rhs_shape, op.param());
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
 }
 
 void DynamicShapeInferer::visit(const ir::operation::BCQFullyConnected &op)
@@ -163,7 +382,7 @@ void DynamicShapeInferer::visit(const ir::operation::BCQFullyConnected &op)
   auto output_ind = op.getOutputs().at(0);
   auto output = _tensor_registry->getITensor(output_ind);
 
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -195,7 +414,7 @@ void DynamicShapeInferer::visit(const ir::operation::BCQGather &op)
   auto output_ind = op.getOutputs().at(0);
   auto output = _tensor_registry->getITensor(output_ind);
 
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -225,7 +444,7 @@ void DynamicShapeInferer::visit(const ir::operation::BroadcastTo &op)
     shape->getShape(), reinterpret_cast<const int32_t *>(shape->buffer()));
 
   // set output shape and output buffer
-  output->applyShape(output_shape);
+  applyShape(output, output_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -312,7 +531,7 @@ void DynamicShapeInferer::visit(const ir::operation::Concat &op)
   auto output = _tensor_registry->getITensor(output_ind);
   auto output_shape = shape_inference::inferConcatShape(in_shapes, op.param());
 
-  output->applyShape(output_shape);
+  applyShape(output, output_shape);
 }
 
 void DynamicShapeInferer::visit(const ir::operation::Conv2D &op)
@@ -335,7 +554,7 @@ void DynamicShapeInferer::visit(const ir::operation::Conv2D &op)
 
   ir::Shape output_shape = shape_inference::inferConv2DShape(input_shape, ker_shape, op.param());
 
-  output->applyShape(output_shape);
+  applyShape(output, output_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -401,7 +620,7 @@ void DynamicShapeInferer::visit(const ir::operation::ExpandDims &op)
 
   auto output_shape = shape_inference::inferExpandDimsShape(input_shape, axis_value);
 
-  output->applyShape(output_shape);
+  applyShape(output, output_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -429,7 +648,7 @@ void DynamicShapeInferer::visit(const ir::operation::Fill &op)
                                 : shape_inference::inferFillShape<int64_t>(
                                     dims_shape, reinterpret_cast<const int64_t *>(dims_buf)));
 
-  output->applyShape(output_shape);
+  applyShape(output, output_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -452,7 +671,7 @@ void DynamicShapeInferer::visit(const ir::operation::FullyConnected &op)
   auto output_ind = op.getOutputs().at(0);
   auto output = _tensor_registry->getITensor(output_ind);
 
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -461,6 +680,28 @@ void DynamicShapeInferer::visit(const ir::operation::FusedBatchNorm &op)
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::FusedBatchNorm::Input::INPUT));
 }
 
+void DynamicShapeInferer::visit(const ir::operation::FusedElementwise &op)
+{
+  // Same as BinaryArithmetic, only when all inputs are static, we can skip shape inference
+  auto output = _tensor_registry->getITensor(op.getOutputs().at(0));
+
+  bool all_static = true;
+  for (const auto &input_idx : op.getInputs())
+    all_static = all_static && currently_static(_tensor_registry->getITensor(input_idx));
+  if (all_static && previously_static(output))
+    return;
+
+  ir::Shape new_shape = _tensor_registry->getITensor(op.getInputs().at(0))->getShape();
+  for (const auto &input_idx : op.getInputs())
+  {
+    const auto input = _tensor_registry->getITensor(input_idx);
+    new_shape = shape_inference::inferEltwiseShape(new_shape, input->getShape());
+  }
+
+  applyShape(output, new_shape);
+  assert(output->buffer() != nullptr);
+}
+
 void DynamicShapeInferer::visit(const ir::operation::Gather &op)
 {
   const auto input_idx{op.getInputs().at(ir::operation::Gather::Input::INPUT)};
@@ -484,7 +725,7 @@ void DynamicShapeInferer::visit(const ir::operation::Gather &op)
   auto output_ind = op.getOutputs().at(0);
   auto output = _tensor_registry->getITensor(output_ind);
 
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -537,28 +778,28 @@ void DynamicShapeInferer::visit(const ir::operation::LSTM &op)
   if (input_shape.rank() == 3)
   {
     if (op.param().time_major)
-      output->applyShape(ir::Shape{input_shape.dim(0), n_batch, n_output});
+      applyShape(output, ir::Shape{input_shape.dim(0), n_batch, n_output});
     else
-      output->applyShape(ir::Shape{n_batch, input_shape.dim(1), n_output});
+      applyShape(output, ir::Shape{n_batch, input_shape.dim(1), n_output});
   }
   else
   {
     assert(input_shape.rank() == 2);
-    output->applyShape(ir::Shape{n_batch, n_output});
+    applyShape(output, ir::Shape{n_batch, n_output});
   }
   assert(output->buffer() != nullptr);
 
   auto output_state_out = _tensor_registry->getITensor(output_state_out_index);
   if (output_state_out != nullptr)
   {
-    output_state_out->applyShape(ir::Shape{n_batch, n_output});
+    applyShape(output_state_out, ir::Shape{n_batch, n_output});
     assert(output_state_out->buffer() != nullptr);
   }
 
   auto cell_state_out = _tensor_registry->getITensor(cell_state_out_index);
   if (cell_state_out != nullptr)
   {
-    cell_state_out->applyShape(ir::Shape{n_batch, n_cell});
+    applyShape(cell_state_out, ir::Shape{n_batch, n_cell});
     assert(cell_state_out->buffer() != nullptr);
   }
 
@@ -586,11 +827,11 @@ void DynamicShapeInferer::visit(const ir::operation::LSTM &op)
     bool has_cifg_param = has_input_to_input_weights && has_recurrent_to_input_weights;
     if (has_cifg_param)
     {
-      scratch_buffer->applyShape(ir::Shape{n_batch, n_cell * 4});
+      applyShape(scratch_buffer, ir::Shape{n_batch, n_cell * 4});
     }
     else
     {
-      scratch_buffer->applyShape(ir::Shape{n_batch, n_cell * 3});
+      applyShape(scratch_buffer, ir::Shape{n_batch, n_cell * 3});
     }
     assert(scratch_buffer->buffer() != nullptr);
   }
@@ -631,7 +872,7 @@ void DynamicShapeInferer::visit(const ir::operation::OneHot &op)
   const auto axis_val = op.param().axis;
 
   ir::Shape new_shape = shape_inference::inferOnehotShape(indices_shape, *depth_buf, axis_val);
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -667,7 +908,7 @@ void DynamicShapeInferer::visit(const ir::operation::Pack &op)
 
   ir::Shape new_shape = shape_inference::inferPackShape(input_shape, axis, rank, num);
 
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -694,7 +935,7 @@ void DynamicShapeInferer::visit(const ir::operation::Pad &op)
     shape_inference::inferPadShape(input->getShape(), pad_buf, pad->getShape().num_elements());
 
   // change output shape and reallocate output tensor memory
-  output->applyShape(output_shape);
+  applyShape(output, output_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -721,7 +962,7 @@ void DynamicShapeInferer::visit(const ir::operation::Pool2D &op)
 
   ir::Shape output_shape = shape_inference::inferPoolShape(input_shape, op.param());
 
-  output->applyShape(output_shape);
+  applyShape(output, output_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -766,7 +1007,7 @@ void DynamicShapeInferer::visit(const ir::operation::Range &op)
       *reinterpret_cast<int32_t *>(limit_tensor->buffer()),
       *reinterpret_cast<int32_t *>(delta_tensor->buffer()));
   }
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -810,7 +1051,7 @@ void DynamicShapeInferer::visit(const ir::operation::Reduce &op)
 
   ir::Shape new_shape = shape_inference::inferReduceShape(input_shape, axes_vec, keep_dims);
 
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -864,7 +1105,7 @@ void DynamicShapeInferer::visit(const ir::operation::Reshape &op)
     if (output_shape != output->getShape() || output->buffer() == nullptr)
     {
       // change on output shape
-      output->applyShape(output_shape);
+      applyShape(output, output_shape);
     }
     assert(output->buffer() != nullptr);
   }
@@ -880,7 +1121,7 @@ void DynamicShapeInferer::visit(const ir::operation::Reshape &op)
     if (output_shape != output->getShape() || output->buffer() == nullptr)
     {
       // change on output shape
-      output->applyShape(output_shape);
+      applyShape(output, output_shape);
     }
     assert(output->buffer() != nullptr);
   }
@@ -932,7 +1173,7 @@ void DynamicShapeInferer::visit(const ir::operation::ResizeBilinear &op)
   if (output_shape != output->getShape() || output->buffer() == nullptr)
   {
     // change on output shape
-    output->applyShape(output_shape);
+    applyShape(output, output_shape);
   }
   assert(output->buffer() != nullptr);
 }
@@ -969,7 +1210,7 @@ void DynamicShapeInferer::visit(const ir::operation::Select &op)
   auto output_ind = op.getOutputs().at(0);
   auto output = _tensor_registry->getITensor(output_ind);
 
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -988,7 +1229,7 @@ void DynamicShapeInferer::visit(const ir::operation::Shape &op)
   ir::Shape output_shape;
   output_shape.append(input_shape.rank());
 
-  output->applyShape(output_shape);
+  applyShape(output, output_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -1014,7 +1255,7 @@ void DynamicShapeInferer::visit(const ir::operation::Slice &op)
 
   ir::Shape new_shape = shape_inference::inferSliceShape(input_shape, begins_buf, sizes_buf);
 
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -1051,7 +1292,7 @@ void DynamicShapeInferer::visit(const ir::operation::SpaceToBatchND &op)
   ir::Shape new_shape = shape_inference::inferSpaceToBatchNDShape(
     input_shape, block_shape_shape, padding_shape, block_shape_data, padding_data);
 
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -1090,7 +1331,7 @@ void DynamicShapeInferer::visit(const ir::operation::Split &op)
     auto output_ind = op.getOutputs().at(out_tensor_idx);
     auto output = _tensor_registry->getITensor(output_ind);
 
-    output->applyShape(new_shape);
+    applyShape(output, new_shape);
     assert(output->buffer() != nullptr);
   }
 }
@@ -1119,7 +1360,7 @@ void DynamicShapeInferer::visit(const ir::operation::Squeeze &op)
   auto output_ind = op.getOutputs().at(0);
   auto output = _tensor_registry->getITensor(output_ind);
 
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -1159,7 +1400,7 @@ void DynamicShapeInferer::visit(const ir::operation::StridedSlice &op)
   ir::Shape output_shape =
     onert::shape_inference::inferStridedSliceShape(input_shape, op_params, rank);
 
-  output->applyShape(output_shape);
+  applyShape(output, output_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -1186,10 +1427,32 @@ void DynamicShapeInferer::visit(const ir::operation::Tile &op)
     input_shape, multiplier_buffer, mult_shape.rank() == 0 ? 1 : mult_shape.dim(0));
 
   // set output shape and output buffer
-  output->applyShape(output_shape);
+  applyShape(output, output_shape);
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::TopKV2 &op)
+{
+  auto input_idx = op.getInputs().at(ir::operation::TopKV2::Input::INPUT);
+  auto input = _tensor_registry->getITensor(input_idx);
+
+  auto values_ind = op.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_VALUES);
+  auto values = _tensor_registry->getITensor(values_ind);
+
+  if ((!input->is_dynamic()) && (!values->is_dynamic()))
+    return;
+
+  auto output_shape = shape_inference::inferTopKV2Shape(input->getShape(), op.param().k);
+
+  // values and indices always share the same shape
+  for (const auto &output_ind : op.getOutputs())
+  {
+    auto output = _tensor_registry->getITensor(output_ind);
+    applyShape(output, output_shape);
+    assert(output->buffer() != nullptr);
+  }
+}
+
 void DynamicShapeInferer::visit(const ir::operation::Transpose &op)
 {
   // check if output is not dynamic
@@ -1240,7 +1503,7 @@ void DynamicShapeInferer::visit(const ir::operation::Transpose &op)
     new_shape =
       shape_inference::inferTransposeShape(input_shape, perm_buffer, perm->getShape().dim(0));
   }
-  output->applyShape(new_shape);
+  applyShape(output, new_shape);
   assert(output->buffer() != nullptr);
 }
 
@@ -1268,7 +1531,7 @@ void DynamicShapeInferer::visit(const ir::operation::Unpack &op)
     auto output_ind = op.getOutputs().at(out_tensor_idx);
     auto output = _tensor_registry->getITensor(output_ind);
 
-    output->applyShape(new_shape);
+    applyShape(output, new_shape);
 
     assert(output->buffer() != nullptr);
   }
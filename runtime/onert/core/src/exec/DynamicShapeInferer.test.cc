@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/DynamicShapeInferer.h"
+
+#include "backend/basic/MemoryManager.h"
+#include "backend/basic/TensorRegistry.h"
+#include "ir/Graph.h"
+#include "ir/operation/Reshape.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+using namespace backend;
+
+// Counts inferences that are not skipped by memos
+class CountingInferer : public exec::DynamicShapeInferer
+{
+public:
+  using exec::DynamicShapeInferer::DynamicShapeInferer;
+
+  void visit(const ir::operation::Reshape &op) override
+  {
+    ++inferences;
+    exec::DynamicShapeInferer::visit(op);
+  }
+
+  int inferences = 0;
+};
+
+/**
+ * @brief Reshape of an int32 tensor into the shape given by another int32 tensor
+ *
+ *   (( input )), (( shape )) -> [ Reshape ] -> (( output ))
+ */
+class DynamicShapeInfererTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    const ir::TypeInfo int32{ir::DataType::INT32};
+    _registry = std::make_shared<basic::TensorRegistry>();
+
+    _input = addTensor(ir::Shape{2, 3}, int32);
+    _shape = addTensor(ir::Shape{2}, int32);
+    _output = addTensor(ir::Shape{3, 2}, int32);
+    setValues(_input, {1, 2, 3, 4, 5, 6});
+    setValues(_shape, {3, 2});
+    // Output shape is not known until the shape tensor is read
+    tensor(_output)->set_dynamic();
+
+    _op = std::make_unique<ir::operation::Reshape>(ir::OperandIndexSequence{_input, _shape},
+                                                   ir::OperandIndexSequence{_output},
+                                                   ir::operation::Reshape::Param{});
+    _inferer = std::make_unique<CountingInferer>(_graph.operands(), _registry);
+  }
+
+  ir::OperandIndex addTensor(const ir::Shape &shape, const ir::TypeInfo &type)
+  {
+    auto index = _graph.addOperand(shape, type);
+    _registry->setNativeTensor(index, std::make_unique<basic::Tensor>(
+                                        ir::OperandInfo::createStaticInfo(shape, type), &_mem_mgr));
+    return index;
+  }
+
+  // Infers like executors, which free dynamic outputs after their last use
+  void run()
+  {
+    _inferer->infer(*_op);
+    tensor(_output)->deallocBuffer();
+  }
+
+  basic::Tensor *tensor(const ir::OperandIndex &index)
+  {
+    return _registry->getNativeTensor(index);
+  }
+
+  void setValues(const ir::OperandIndex &index, const std::vector<int32_t> &values)
+  {
+    _buffers[index] = values;
+    tensor(index)->setBuffer(reinterpret_cast<uint8_t *>(_buffers[index].data()));
+  }
+
+  basic::DynamicMemoryManager _mem_mgr;
+  ir::Graph _graph;
+  std::shared_ptr<basic::TensorRegistry> _registry;
+  std::map<ir::OperandIndex, std::vector<int32_t>> _buffers;
+  ir::OperandIndex _input;
+  ir::OperandIndex _shape;
+  ir::OperandIndex _output;
+  std::unique_ptr<ir::operation::Reshape> _op;
+  std::unique_ptr<CountingInferer> _inferer;
+};
+
+} // namespace
+
+TEST_F(DynamicShapeInfererTest, memo_hit)
+{
+  run();
+  ASSERT_EQ(_inferer->inferences, 1);
+  ASSERT_EQ(tensor(_output)->getShape(), (ir::Shape{3, 2}));
+
+  // Values of the data input do not decide the output shape, even if they are integers
+  setValues(_input, {6, 5, 4, 3, 2, 1});
+  run();
+  run();
+  ASSERT_EQ(_inferer->inferences, 1);
+  ASSERT_EQ(tensor(_output)->getShape(), (ir::Shape{3, 2}));
+}
+
+TEST_F(DynamicShapeInfererTest, memo_miss_shape_value)
+{
+  run();
+
+  setValues(_shape, {6, 1});
+  run();
+  ASSERT_EQ(_inferer->inferences, 2);
+  ASSERT_EQ(tensor(_output)->getShape(), (ir::Shape{6, 1}));
+
+  // Output starts from the new shape from now on, which is memoized by the next run
+  run();
+  run();
+  ASSERT_EQ(_inferer->inferences, 3);
+
+  // and is missed again for the old values
+  setValues(_shape, {3, 2});
+  run();
+  ASSERT_EQ(_inferer->inferences, 4);
+  ASSERT_EQ(tensor(_output)->getShape(), (ir::Shape{3, 2}));
+}
+
+TEST_F(DynamicShapeInfererTest, memo_miss_input_shape)
+{
+  run();
+
+  tensor(_input)->applyShape(ir::Shape{6});
+  run();
+  ASSERT_EQ(_inferer->inferences, 2);
+  ASSERT_EQ(tensor(_output)->getShape(), (ir::Shape{3, 2}));
+}
+
+TEST_F(DynamicShapeInfererTest, neg_memo_invalidated_by_output)
+{
+  run();
+
+  // Output reshaped by others, e.g. nnfw_set_output_tensorinfo, is inferred again
+  tensor(_output)->applyShape(ir::Shape{1, 6});
+  run();
+  ASSERT_EQ(_inferer->inferences, 2);
+  ASSERT_EQ(tensor(_output)->getShape(), (ir::Shape{3, 2}));
+}
+
+TEST_F(DynamicShapeInfererTest, neg_memo_invalidated_by_failure)
+{
+  run();
+
+  // Shape of 5 elements cannot be inferred from 6 elements
+  setValues(_shape, {5, 1});
+  EXPECT_ANY_THROW(_inferer->infer(*_op));
+
+  setValues(_shape, {3, 2});
+  run();
+  ASSERT_EQ(_inferer->inferences, 3);
+  ASSERT_EQ(tensor(_output)->getShape(), (ir::Shape{3, 2}));
+}
@@ -18,8 +18,21 @@
 
 #include "ir/DataType.h"
 #include "train/TrainableExecutors.h"
+#include "util/ThreadBudget.h"
 #include "util/logging.h"
 
+namespace
+{
+
+// ir::TypeInfo's operator== expects per-tensor quantization, so compare all the parameters here
+bool isSameType(const onert::ir::TypeInfo &lhs, const onert::ir::TypeInfo &rhs)
+{
+  return lhs.type() == rhs.type() && lhs.scales() == rhs.scales() &&
+         lhs.zero_points() == rhs.zero_points();
+}
+
+} // namespace
+
 namespace onert
 {
 namespace exec
@@ -117,6 +130,39 @@ void Execution::setOutputType(const ir::IOIndex &index, const ir::TypeInfo &type
   _ctx.shape_updated = true;
 }
 
+void Execution::takeIODescription(const Execution &other)
+{
+  const auto &other_desc = other._ctx.desc;
+  if (other_desc.inputs.size() != _ctx.desc.inputs.size() ||
+      other_desc.outputs.size() != _ctx.desc.outputs.size())
+    throw std::runtime_error{"Execution: I/O count mismatch"};
+
+  for (uint32_t i = 0; i < _ctx.desc.inputs.size(); ++i)
+  {
+    const auto index = ir::IOIndex{i};
+    const auto &from = other_desc.inputs.at(i);
+    const auto &to = _ctx.desc.inputs.at(i);
+    if (!isSameType(from->info.typeInfo(), to->info.typeInfo()))
+      setInputType(index, from->info.typeInfo());
+    changeInputShape(index, from->info.shape());
+    setInput(index, from->buffer, from->size);
+    setInputLayout(index, from->layout);
+  }
+
+  for (uint32_t i = 0; i < _ctx.desc.outputs.size(); ++i)
+  {
+    const auto index = ir::IOIndex{i};
+    const auto &from = other_desc.outputs.at(i);
+    const auto &to = _ctx.desc.outputs.at(i);
+    if (!isSameType(from->info.typeInfo(), to->info.typeInfo()))
+      setOutputType(index, from->info.typeInfo());
+    setOutput(index, from->buffer, from->size);
+    setOutputLayout(index, from->layout);
+  }
+
+  _ctx.options = other._ctx.options;
+}
+
 void Execution::execute()
 {
   VERBOSE(Execution) << "Start execution" << std::endl;
@@ -138,6 +184,7 @@ void Execution::execute()
     }
   }
 
+  util::ThreadBudget::Lease lease{_ctx.options.thread_quota};
   _executors->execute(_ctx);
   finished = true;
 
@@ -169,6 +216,7 @@ void Execution::train(uint32_t training_step)
     throw std::runtime_error{"Supported only TrainableExecutors"};
   }
 
+  util::ThreadBudget::Lease lease{_ctx.options.thread_quota};
   execs->train(_ctx, training_step);
   finished = true;
 }
@@ -506,6 +506,66 @@ TEST(ExecInstance, quantModel_floatIO)
   EXPECT_EQ(output_buffer[3], output_expected[3]);
 }
 
+// Replace float model executors with quantized model executors keeping I/O
+TEST(ExecInstance, takeIODescription_quantModel)
+{
+  auto float_mockup = CompiledMockUpModel();
+  auto quant_mockup = CompiledMockUpQuantModel();
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  onert::exec::Execution float_execution{float_mockup.artifact->_executors};
+  float_execution.setInput(input1, reinterpret_cast<const void *>(input1_buffer), 16);
+  float_execution.setInput(input2, reinterpret_cast<const void *>(input2_buffer), 16);
+  float_execution.setOutput(output, reinterpret_cast<void *>(output_buffer), 16);
+
+  onert::exec::Execution quant_execution{quant_mockup.artifact->_executors};
+  quant_execution.takeIODescription(float_execution);
+  quant_execution.execute();
+
+  for (auto i = 0; i < 4; i++)
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+}
+
+// Take quantized user types with their scale and zero point
+TEST(ExecInstance, takeIODescription_quantIO)
+{
+  auto mockup = CompiledMockUpModel();
+  auto other_mockup = CompiledMockUpModel();
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const uint8_t input1_buffer[4] = {138, 128, 118, 108}; // {1, 0, -1, -2}
+  const uint8_t input2_buffer[4] = {138, 98, 148, 88};   // {1, -3, 2, -4}
+  uint8_t output_buffer[4] = {};
+  const uint8_t output_expected[4] = {178, 108, 128, 118}; // {5, -2, 0, -1}
+  onert::ir::TypeInfo type_info{onert::ir::DataType::QUANT_UINT8_ASYMM, 0.1f, 128};
+
+  onert::exec::Execution other_execution{other_mockup.artifact->_executors};
+  other_execution.setInputType(input1, type_info);
+  other_execution.setInput(input1, reinterpret_cast<const void *>(input1_buffer), 4);
+  other_execution.setInputType(input2, type_info);
+  other_execution.setInput(input2, reinterpret_cast<const void *>(input2_buffer), 4);
+  other_execution.setOutputType(output, type_info);
+  other_execution.setOutput(output, reinterpret_cast<void *>(output_buffer), 4);
+
+  onert::exec::Execution execution{mockup.artifact->_executors};
+  execution.takeIODescription(other_execution);
+  execution.execute();
+
+  for (auto i = 0; i < 4; i++)
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+}
+
 class Inference
 {
 public:
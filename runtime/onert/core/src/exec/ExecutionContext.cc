@@ -18,6 +18,8 @@
 
 #include "util/ConfigSource.h"
 
+#include <algorithm>
+
 namespace onert
 {
 namespace exec
@@ -27,7 +29,9 @@ void ExecutionOptions::fromGlobalConfig(ExecutionOptions &options)
 {
   options.dump_minmax = util::getConfigBool(util::config::MINMAX_DUMP);
   options.trace = util::getConfigBool(util::config::TRACING_MODE);
+  options.trace_sample_rate = std::max(1, util::getConfigInt(util::config::TRACING_SAMPLE_RATE));
   options.profile = util::getConfigBool(util::config::PROFILING_MODE);
+  options.thread_quota = std::max(0, util::getConfigInt(util::config::THREAD_QUOTA));
 }
 
 } // namespace exec
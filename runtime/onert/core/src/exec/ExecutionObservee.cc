@@ -16,6 +16,8 @@
 
 #include "ExecutionObservee.h"
 
+#include <misc/polymorphic_downcast.h>
+
 namespace onert
 {
 namespace exec
@@ -29,7 +31,7 @@ ExecutionObservee::ExecutionObservee(const ExecObservers &observers,
   {
     auto observer = observers.get(ObserverType::MINMAX_DUMP);
     if (!observer)
-      throw std::runtime_error{"MinMaxRecorder is only supported on LinearExecutor, single model"};
+      throw std::runtime_error{"MinMaxRecorder is not supported on this executor"};
 
     _observers.emplace_back(observer);
   }
@@ -40,7 +42,10 @@ ExecutionObservee::ExecutionObservee(const ExecObservers &observers,
     if (!observer)
       throw std::runtime_error{"Cannot find TracingObserver"};
 
-    _observers.emplace_back(observer);
+    auto tracing_observer = nnfw::misc::polymorphic_downcast<TracingObserver *>(observer);
+    // Runs out of the sample are not observed at all
+    if (tracing_observer->sampleRun(options.trace_sample_rate))
+      _observers.emplace_back(observer);
   }
 
   if (options.profile)
@@ -16,53 +16,37 @@
 
 #include "ExecutionObservers.h"
 
-#include "../util/EventWriter.h"
+#include "../util/TraceWriter.h"
 
 #include "util/logging.h"
 
-#include <misc/polymorphic_downcast.h>
+#include <chrono>
 
-#include <string>
-#include <sstream>
+#ifdef DEBUG
+#include <sys/resource.h>
+#include <sys/time.h>
+#endif
 
 namespace
 {
 
-void setUserData(const onert::ir::Graph &g, const onert::ir::IOperation *op,
-                 decltype(EventCollector::Event::userData) &data)
+uint64_t nowMicros()
 {
-  // From a tensor of shape [a, b, c], this will return a string "shape(a b c)".
-  // String like "[1, 2, 3]" looks better but this will be considered as a list in Json
-  // so text search (e.g., Ctrl-F in Chrome Tracing) could be difficult
-  auto build_shape_str = [&](onert::ir::OperandIndex operand_idx) {
-    std::string shape_str;
-    auto &shape = g.operands().at(operand_idx).info().shape();
-    for (int i = 0; i < shape.rank(); i++)
-    {
-      if (i == 0)
-        shape_str = "shape(" + std::to_string(shape.dim(i));
-      else
-        shape_str += " " + std::to_string(shape.dim(i));
-    }
-    shape_str += ")";
-
-    return shape_str;
-  };
-
-  auto &inputs = op->getInputs();
-  auto size = inputs.size();
-  for (size_t i = 0; i < size; i++)
-  {
-    auto operand_idx = inputs.at(i);
-    if (operand_idx.undefined())
-      continue;
-
-    std::string key("input_shape_" + std::to_string(i));
-    std::string value = build_shape_str(operand_idx);
-    data.emplace_back(std::make_pair(key, value));
-  }
+  const auto now = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
+}
 
-  // add other userData as needed
+// TODO Sample resource usage in release build when it is cheap enough
+onert::util::TraceUsage usage()
+{
+  onert::util::TraceUsage usage;
+#ifdef DEBUG
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  usage.maxrss_kb = static_cast<uint32_t>(ru.ru_maxrss);
+  usage.minflt = static_cast<uint32_t>(ru.ru_minflt);
+#endif
+  return usage;
 }
 
 } // namespace
@@ -115,64 +99,80 @@ void ProfileObserver::handleJobEnd(IExecutor *exec, ir::SubgraphIndex,
 
 TracingObserver::TracingObserver(const std::string &workspace_dir, const ir::Graph &graph,
                                  const util::TracingCtx *tracing_ctx)
-  : _recorder{std::make_unique<EventRecorder>()}, _collector{_recorder.get()}, _graph{graph},
-    _workspace_dir{workspace_dir}, _tracing_ctx{tracing_ctx}, _triggered{false}
+  : _graph{graph}, _workspace_dir{workspace_dir}, _tracing_ctx{tracing_ctx}, _run_count{0},
+    _triggered{false}, _graph_id{0}
 {
   // DO NOTHING
 }
 
 TracingObserver::~TracingObserver()
 {
-  try
-  {
-    // Write file if this observer is triggered at least once
-    if (_triggered)
-    {
-      auto event_writer = EventWriter::get(_workspace_dir);
-      event_writer->startToUse();
-      event_writer->readyToFlush(std::move(_recorder));
-    }
-  }
-  catch (const std::exception &e)
-  {
-    std::cerr << "E: Fail to record event in TracingObserver: " << e.what() << std::endl;
-  }
+  // Write files if this observer is triggered at least once
+  if (_triggered)
+    util::TraceWriter::get().finishToUse();
 }
 
-void TracingObserver::handleSubgraphBegin(ir::SubgraphIndex subg_ind)
+bool TracingObserver::sampleRun(uint32_t sample_rate)
 {
-  _triggered = true;
+  return sample_rate <= 1 || _run_count.fetch_add(1, std::memory_order_relaxed) % sample_rate == 0;
+}
+
+void TracingObserver::handleSubgraphBegin(ir::SubgraphIndex)
+{
+  if (!_triggered)
+  {
+    // Prepare what events refer to only when traced, as most sessions are not
+    std::vector<std::string> op_names;
+    _graph.operations().iterate([&](const ir::OperationIndex &ind, const ir::IOperation &op) {
+      if (ind.value() >= op_names.size())
+      {
+        op_names.resize(ind.value() + 1);
+        _op_bytes.resize(ind.value() + 1);
+      }
+      op_names[ind.value()] = op.name();
+      uint64_t bytes = 0;
+      for (const auto &operand : (op.getInputs() + op.getOutputs()) | ir::Remove::UNDEFINED)
+        bytes += _graph.operands().at(operand).info().total_size();
+      _op_bytes[ind.value()] = bytes;
+    });
+
+    auto &writer = util::TraceWriter::get();
+    _graph_id = writer.registerGraph(std::move(op_names));
+    writer.startToUse(_workspace_dir);
+    _triggered = true;
+  }
 
-  _collector.onEvent(
-    EventCollector::SubgEvent{_tracing_ctx, EventCollector::Edge::BEGIN, subg_ind.value()});
+  util::TraceWriter::get().threadBuffer().beginScope(nowMicros(), usage());
 }
 
-void TracingObserver::handleJobBegin(IExecutor *, ir::SubgraphIndex subg_ind,
-                                     ir::OperationIndex op_ind, const backend::Backend *backend)
+void TracingObserver::handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                                     const backend::Backend *)
 {
-  std::string backend_id = backend->config()->id();
-  const auto &op = _graph.operations().at(op_ind);
-  auto ev = EventCollector::OpSeqEvent{_tracing_ctx,     EventCollector::Edge::BEGIN,
-                                       subg_ind.value(), backend_id,
-                                       op_ind.value(),   op.name()};
-  // add shape of inputs
-  setUserData(_graph, &op, ev.userData);
-  _collector.onEvent(ev);
+  util::TraceWriter::get().threadBuffer().beginScope(nowMicros(), usage());
 }
 
 void TracingObserver::handleJobEnd(IExecutor *, ir::SubgraphIndex subg_ind,
                                    ir::OperationIndex op_ind, const backend::Backend *backend)
 {
-  std::string backend_id = backend->config()->id();
-  _collector.onEvent(EventCollector::OpSeqEvent{_tracing_ctx, EventCollector::Edge::END,
-                                                subg_ind.value(), backend_id, op_ind.value(),
-                                                _graph.operations().at(op_ind).name()});
+  const auto end_us = nowMicros();
+  auto &buffer = util::TraceWriter::get().threadBuffer();
+  util::TraceUsage begin_usage;
+  const auto begin_us = buffer.endScope(&begin_usage);
+  const auto bytes = op_ind.value() < _op_bytes.size() ? _op_bytes[op_ind.value()] : 0;
+  buffer.push(util::TraceEvent{begin_us, end_us, bytes, backend, _graph_id,
+                               _tracing_ctx->getSessionId(), subg_ind.value(), op_ind.value(),
+                               begin_usage, usage()});
 }
 
 void TracingObserver::handleSubgraphEnd(ir::SubgraphIndex subg_ind)
 {
-  _collector.onEvent(
-    EventCollector::SubgEvent{_tracing_ctx, EventCollector::Edge::END, subg_ind.value()});
+  const auto end_us = nowMicros();
+  auto &buffer = util::TraceWriter::get().threadBuffer();
+  util::TraceUsage begin_usage;
+  const auto begin_us = buffer.endScope(&begin_usage);
+  buffer.push(util::TraceEvent{begin_us, end_us, 0, nullptr, _graph_id,
+                               _tracing_ctx->getSessionId(), subg_ind.value(),
+                               util::TraceEvent::kSubgraph, begin_usage, usage()});
 }
 
 } // namespace exec
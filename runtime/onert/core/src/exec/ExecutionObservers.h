@@ -18,9 +18,6 @@
 #define __ONERT_EXEC_OBSREVERS_H__
 
 #include "ExecTime.h"
-#include "../util/EventCollector.h"
-#include "../util/EventRecorder.h"
-#include "../util/EventWriter.h"
 
 #include "exec/IExecutor.h"
 #include "ir/Index.h"
@@ -28,6 +25,9 @@
 #include "util/ITimer.h"
 #include "util/TracingCtx.h"
 
+#include <atomic>
+#include <vector>
+
 namespace onert
 {
 namespace exec
@@ -100,12 +100,24 @@ private:
   const ir::Graph &_graph;
 };
 
+/**
+ * @brief Observer which records operations into the per-thread trace buffer of the calling thread
+ *
+ * Recording is a few stores into a ring buffer. Events are written into files in the workspace
+ * by util::TraceWriter on its own thread.
+ */
 class TracingObserver : public IExecutionObserver
 {
 public:
   TracingObserver(const std::string &workspace_dir, const ir::Graph &graph,
                   const util::TracingCtx *tracing_ctx);
   ~TracingObserver();
+
+  /**
+   * @brief Return whether this run should be traced, which is 1 in every sample_rate runs
+   */
+  bool sampleRun(uint32_t sample_rate);
+
   void handleSubgraphBegin(ir::SubgraphIndex) override;
   void handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
                       const backend::Backend *) override;
@@ -115,12 +127,14 @@ public:
   ObserverType type() const override { return ObserverType::TRACING; }
 
 private:
-  std::unique_ptr<EventRecorder> _recorder;
-  EventCollector _collector;
   const ir::Graph &_graph;
   std::string _workspace_dir;
   const util::TracingCtx *_tracing_ctx;
+  std::atomic<uint32_t> _run_count;
   bool _triggered;
+  uint32_t _graph_id;
+  // Bytes of inputs and outputs of each operation
+  std::vector<uint64_t> _op_bytes;
 };
 
 } // namespace exec
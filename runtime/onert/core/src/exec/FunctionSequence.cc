@@ -33,7 +33,7 @@ void FunctionSequence::run()
     // Thus, those two bakends cannot reach here.
 
     // Do dynamic shape inference
-    _dynamic_tensor_ctx->op->accept(*_dynamic_tensor_ctx->dynamic_shape_inferer);
+    _dynamic_tensor_ctx->dynamic_shape_inferer->infer(*_dynamic_tensor_ctx->op);
 
     for (const auto &function : _functions)
     {
@@ -26,13 +26,17 @@ namespace exec
 
 void LinearExecutor::executeImpl(const ExecutionObservee &subject)
 {
+  if (_weight_pager)
+    _weight_pager->begin();
+
   if (!subject.isEmpty() && _tracing_ctx)
   {
     auto profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
 
     subject.notifySubgraphBegin(profiling_subg_index);
-    for (auto &&code : _code)
+    for (size_t pos = 0; pos < _code.size(); ++pos)
     {
+      auto &code = _code[pos];
       const auto backend = code.op_backend;
 // TODO : Move ruy profiler into ExecutionObserver
 #ifdef RUY_PROFILER
@@ -47,7 +51,11 @@ void LinearExecutor::executeImpl(const ExecutionObservee &subject)
       bool handle_dynamic_tensor =
         _lowered_graph->getHasDynamicTensor(code.op_ind) || hasDynamicInput();
       fn_seq->enableDynamicShapeInferer(handle_dynamic_tensor);
+      if (_weight_pager)
+        _weight_pager->beforeRun(pos);
       fn_seq->run();
+      if (_weight_pager)
+        _weight_pager->afterRun(pos);
 
       subject.notifyJobEnd(this, profiling_subg_index, code.op_ind, backend);
     }
@@ -55,8 +63,9 @@ void LinearExecutor::executeImpl(const ExecutionObservee &subject)
   }
   else
   {
-    for (auto &&code : _code)
+    for (size_t pos = 0; pos < _code.size(); ++pos)
     {
+      auto &code = _code[pos];
 // TODO : Move ruy profiler into ExecutionObserver
 #ifdef RUY_PROFILER
       ruy::profiler::ScopeLabel label(code.op->name());
@@ -69,7 +78,11 @@ void LinearExecutor::executeImpl(const ExecutionObservee &subject)
       bool handle_dynamic_tensor =
         _lowered_graph->getHasDynamicTensor(code.op_ind) || hasDynamicInput();
       fn_seq->enableDynamicShapeInferer(handle_dynamic_tensor);
+      if (_weight_pager)
+        _weight_pager->beforeRun(pos);
       fn_seq->run();
+      if (_weight_pager)
+        _weight_pager->afterRun(pos);
     }
   }
 }
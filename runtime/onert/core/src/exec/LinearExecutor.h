@@ -23,6 +23,7 @@
 #define __ONERT_EXEC_EXECUTOR_H_
 
 #include "ExecutorBase.h"
+#include "WeightPager.h"
 
 #include "compiler/CodeMap.h"
 #include "ir/Index.h"
@@ -45,12 +46,15 @@ public:
    * @param lowered_graph LoweredGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map @c ir::Operation and its code map
+   * @param weight_pager Pager of weights along @c order, or nullptr not to page them
    */
   LinearExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                  backend::BackendContexts &&backend_contexts,
                  const compiler::TensorRegistries &tensor_regs, compiler::CodeMap &&code_map,
-                 const std::vector<ir::OperationIndex> &order, const util::TracingCtx *tracing_ctx)
-    : ExecutorBase{std::move(lowered_graph), std::move(backend_contexts), tensor_regs, tracing_ctx}
+                 const std::vector<ir::OperationIndex> &order, const util::TracingCtx *tracing_ctx,
+                 std::unique_ptr<WeightPager> weight_pager)
+    : ExecutorBase{std::move(lowered_graph), std::move(backend_contexts), tensor_regs, tracing_ctx},
+      _weight_pager{std::move(weight_pager)}
   {
     for (auto &&index : order)
     {
@@ -63,6 +67,7 @@ public:
 
 private:
   std::vector<compiler::CodeAndInfo> _code;
+  std::unique_ptr<WeightPager> _weight_pager;
 };
 
 } // namespace exec
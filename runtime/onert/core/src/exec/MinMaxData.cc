@@ -36,7 +36,7 @@ void RawMinMaxDumper::dump(const exec::IOMinMaxMap &input_minmax,
   // Match with runtime/onert/odc/MinMaxReader.cc
   // TODO Use util to share code and version
   const uint32_t MAGIC_CODE = 0x4F4D4D44;
-  const uint32_t VERSION = 1;
+  const uint32_t VERSION = 2;
   if (!file)
   {
     // If file is not exist, create new file
@@ -100,13 +100,15 @@ void RawMinMaxDumper::dump(const exec::IOMinMaxMap &input_minmax,
   for (auto &&[index, minmax] : op_minmax)
   {
     const uint32_t model_idx = 0;
-    const uint32_t subg_idx = index.first.value();
-    const uint32_t op_idx = index.second.value();
+    const uint32_t subg_idx = std::get<0>(index).value();
+    const uint32_t op_idx = std::get<1>(index).value();
+    const uint32_t output_idx = std::get<2>(index).value();
 
-    // Write model/subg/op index
+    // Write model/subg/op/output index
     std::fwrite(&model_idx, sizeof(uint32_t), 1, file);
     std::fwrite(&subg_idx, sizeof(uint32_t), 1, file);
     std::fwrite(&op_idx, sizeof(uint32_t), 1, file);
+    std::fwrite(&output_idx, sizeof(uint32_t), 1, file);
 
     // Write min/max
     std::fwrite(minmax.data, sizeof(float), 2, file);
@@ -38,10 +38,11 @@ namespace exec
 // uint32_t num of operations
 // uint32_t num of inputs
 
-// For each operation
+// For each operation output
 // uint32_t model id
 // uint32_t subgraph id
 // uint32_t operation id
+// uint32_t output id (since version 2)
 // float min
 // float max
 
@@ -17,84 +17,148 @@
 #include "MinMaxRecorder.h"
 #include "MinMaxData.h"
 #include "backend/ITensor.h"
+#include "util/Utils.h"
 
+#include <atomic>
 #include <cassert>
-#include <cmath>
+#include <limits>
 
-namespace onert
-{
-namespace exec
+namespace
 {
 
-MinMaxRecorder::MinMaxRecorder(const std::string &workspace_dir, const ir::Graph &graph,
-                               const backend::BackendContexts &backend_contexts)
-  : _graph{graph}, _backend_contexts{backend_contexts}, _workspace_dir(workspace_dir)
+using namespace onert;
+
+// Accumulated min/max of float values, min > max means no valid value is found yet
+struct MinMax
 {
-  // DO NOTHING
-}
+  float min = std::numeric_limits<float>::max();
+  float max = std::numeric_limits<float>::lowest();
+};
 
-std::pair<float, float> minmaxFrom(const backend::ITensor *tensor)
+// NOTE Comparisons are written as selects so that compilers can vectorize the loop.
+//      NaN fails every comparison and lowest() is filtered out, so both are skipped
+//      like MinMaxObserver in record-minmax does.
+void minmaxFrom(const float *data, size_t num_elements, MinMax &acc)
 {
-  const auto data = reinterpret_cast<float *>(tensor->buffer());
-  const auto num_elements = tensor->total_size() / sizeof(float);
+  constexpr size_t kLanes = 8;
+  constexpr float lowest = std::numeric_limits<float>::lowest();
 
-  float max = std::numeric_limits<float>::lowest();
-  float min = std::numeric_limits<float>::max();
+  float mins[kLanes];
+  float maxs[kLanes];
+  for (size_t l = 0; l < kLanes; ++l)
+  {
+    mins[l] = acc.min;
+    maxs[l] = acc.max;
+  }
 
-  bool all_nan = true;
-  for (size_t i = 0; i < num_elements; ++i)
+  size_t i = 0;
+  for (; i + kLanes <= num_elements; i += kLanes)
   {
-    const float number = data[i];
-    if (std::isnan(number))
-      continue;
+    for (size_t l = 0; l < kLanes; ++l)
+    {
+      const float x = data[i + l];
+      mins[l] = (x < mins[l] && x != lowest) ? x : mins[l];
+      maxs[l] = (x > maxs[l]) ? x : maxs[l];
+    }
+  }
+  for (; i < num_elements; ++i)
+  {
+    const float x = data[i];
+    mins[0] = (x < mins[0] && x != lowest) ? x : mins[0];
+    maxs[0] = (x > maxs[0]) ? x : maxs[0];
+  }
 
-    if (number == std::numeric_limits<float>::lowest())
-      continue;
+  for (size_t l = 0; l < kLanes; ++l)
+  {
+    acc.min = std::min(acc.min, mins[l]);
+    acc.max = std::max(acc.max, maxs[l]);
+  }
+}
 
-    all_nan = false;
+std::pair<float, float> minmaxFrom(backend::ITensor *tensor)
+{
+  MinMax acc;
+  tensor->access([&](backend::ITensor &t) {
+    const auto shape = t.getShape();
+    if (!t.has_padding())
+    {
+      const auto data = reinterpret_cast<const float *>(t.buffer());
+      minmaxFrom(data, shape.num_elements(), acc);
+      return;
+    }
 
-    if (number > max)
-      max = number;
+    // Scan padded tensors row by row
+    assert(shape.rank() > 0);
+    auto rows = shape;
+    const auto row_size = shape.dim(shape.rank() - 1);
+    rows.dim(shape.rank() - 1) = 1;
+    ShapeLoop(rows, [&](const ir::Coordinates &coords) {
+      const auto data = reinterpret_cast<const float *>(t.buffer() + t.calcOffset(coords));
+      minmaxFrom(data, row_size, acc);
+    });
+  });
+
+  if (acc.min > acc.max)
+    throw std::runtime_error("All values are NaN(Not a Number)");
 
-    if (number < min)
-      min = number;
-  }
+  return {acc.min, acc.max};
+}
 
-  if (all_nan)
-    throw std::runtime_error("All values are NaN(Not a Number)");
+bool isRecordable(const backend::ITensor *tensor)
+{
+  return tensor != nullptr && !tensor->is_constant() &&
+         tensor->data_type() == ir::DataType::FLOAT32 && tensor->getShape().num_elements() > 0;
+}
+
+} // namespace
 
-  return {min, max};
+namespace onert
+{
+namespace exec
+{
+
+MinMaxRecorder::MinMaxRecorder(const std::string &workspace_dir, const ir::Graph &graph,
+                               const backend::BackendContexts &backend_contexts)
+  : _graph{graph}, _backend_contexts{backend_contexts}, _workspace_dir(workspace_dir),
+    _id{[]() {
+      static std::atomic<uint64_t> next_id{1};
+      return next_id++;
+    }()}
+{
+  // DO NOTHING
+}
+
+OpMinMaxMap &MinMaxRecorder::threadOpMinMax()
+{
+  // Map of the recorder this thread recorded last, elements of _thread_op_minmax are never
+  // erased and references to them are not invalidated by insertion of other threads
+  struct Cache
+  {
+    uint64_t recorder_id = 0;
+    OpMinMaxMap *op_minmax = nullptr;
+  };
+  thread_local Cache cache;
+  if (cache.recorder_id == _id)
+    return *cache.op_minmax;
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  cache.op_minmax = &_thread_op_minmax[std::this_thread::get_id()];
+  cache.recorder_id = _id;
+  return *cache.op_minmax;
 }
 
 void MinMaxRecorder::handleJobEnd(IExecutor *, ir::SubgraphIndex subg_idx,
                                   ir::OperationIndex op_idx, const backend::Backend *backend)
 {
-  const auto &tensor_reg = _backend_contexts.at(backend)->tensor_registry;
   const auto &op = _graph.operations().at(op_idx);
-  const auto &outputs = op.getOutputs();
-  // TODO: Support multiple output
-  if (outputs.size() != 1)
-    throw std::runtime_error("Only 1 output operator is supported for recording minmax.");
-
-  auto tensor = tensor_reg->getITensor(outputs.at(0));
 
   // Logic copied from MinMaxObserver.cpp.
 
   // Filter Ops
-  if (tensor->is_constant())
-    return;
-
-  if (tensor->data_type() != ir::DataType::FLOAT32)
-    return;
-
   switch (op.opcode())
   {
-    // Operators with multiple outputs
+    // Outputs of control flow operators are recorded in their subgraphs
     case ir::OpCode::If:
-    case ir::OpCode::Split:
-    case ir::OpCode::SplitV:
-    case ir::OpCode::TopKV2:
-    case ir::OpCode::Unpack:
     case ir::OpCode::While:
       return;
     // NOTE: Sin, Cos, Tanh's output is in [-1, 1]
@@ -102,38 +166,45 @@ void MinMaxRecorder::handleJobEnd(IExecutor *, ir::SubgraphIndex subg_idx,
     default:; // Do Nothing
   }
 
-  // Otherwise, dump!
-  assert(tensor->data_type() == ir::DataType::FLOAT32);
-  auto [min, max] = minmaxFrom(tensor);
-  _op_minmax.append({subg_idx, op_idx}, min, max);
+  const auto &tensor_reg = _backend_contexts.at(backend)->tensor_registry;
+  const auto &outputs = op.getOutputs();
+  for (uint32_t i = 0; i < outputs.size(); ++i)
+  {
+    auto tensor = tensor_reg->getITensor(outputs.at(i));
+    if (!isRecordable(tensor))
+      continue;
+
+    // Otherwise, dump!
+    auto [min, max] = minmaxFrom(tensor);
+    threadOpMinMax().append({subg_idx, op_idx, ir::IOIndex{i}}, min, max);
+  }
 }
 
 void MinMaxRecorder::handleSubgraphBegin(ir::SubgraphIndex subg_idx)
 {
-  // Make sure there is only cpu backend except for builtin backend
-  std::set<std::string> backend_names;
-  backend::ITensorRegistry *tensor_reg = nullptr;
-  for (const auto &[backend, bctx] : _backend_contexts)
   {
-    backend_names.insert(backend->config()->id());
-    if (backend->config()->id() == "cpu")
-    {
-      tensor_reg = bctx->tensor_registry.get();
-    }
+    std::lock_guard<std::mutex> lock{_mutex};
+    for (auto &&[thread_id, op_minmax] : _thread_op_minmax)
+      op_minmax.clear();
   }
-  if (backend_names != std::set<std::string>{"builtin", "cpu"})
-    throw std::runtime_error("MinMaxRecorder must have cpu backend only.");
+  _input_minmax.clear();
 
-  const auto &inputs = _graph.getInputs(); //.at(op_idx);
+  const auto &inputs = _graph.getInputs();
   for (uint32_t i = 0; i < inputs.size(); ++i)
   {
-    auto input_idx = inputs.at(i);
-    auto tensor = tensor_reg->getITensor(input_idx);
+    // Inputs can be registered in several backends, prefer the one used by kernels
+    backend::ITensor *tensor = nullptr;
+    for (const auto &[backend, bctx] : _backend_contexts)
+    {
+      auto candidate = bctx->tensor_registry->getITensor(inputs.at(i));
+      if (candidate == nullptr)
+        continue;
+      if (tensor == nullptr || backend->config()->id() != "builtin")
+        tensor = candidate;
+    }
 
-    if (tensor->is_constant())
-      return;
-    if (tensor->data_type() != ir::DataType::FLOAT32)
-      return;
+    if (!isRecordable(tensor))
+      continue;
 
     auto minmax = minmaxFrom(tensor);
     _input_minmax.append({subg_idx, ir::IOIndex{i}}, minmax.first, minmax.second);
@@ -142,10 +213,18 @@ void MinMaxRecorder::handleSubgraphBegin(ir::SubgraphIndex subg_idx)
 
 void MinMaxRecorder::handleSubgraphEnd(ir::SubgraphIndex)
 {
+  // All jobs are done here, so per-thread maps are not updated anymore
+  OpMinMaxMap op_minmax;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    for (auto &&[thread_id, thread_minmax] : _thread_op_minmax)
+      op_minmax.merge(thread_minmax);
+  }
+
   // It would be better to dump at the end of model execution, not subgraph
   // But it requires more changes than subgraph.
   auto raw_dumper = RawMinMaxDumper(_workspace_dir + "/minmax.bin");
-  raw_dumper.dump(_input_minmax, _op_minmax);
+  raw_dumper.dump(_input_minmax, op_minmax);
 }
 
 } // namespace exec
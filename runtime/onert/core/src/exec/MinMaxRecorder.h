@@ -21,13 +21,24 @@
 #include "ir/Index.h"
 #include "exec/MinMaxMap.h"
 
+#include <cstdint>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 
 namespace onert
 {
 namespace exec
 {
 
+/**
+ * @brief Observer recording min/max of float outputs of every operation and graph inputs
+ *
+ * Jobs may end on different threads (e.g. ParallelExecutor), so each thread records into its own
+ * map and the maps are merged at the end of the subgraph. Each thread caches its map, so the
+ * mutex is taken only when a thread records for the first time.
+ */
 class MinMaxRecorder : public IExecutionObserver
 {
 public:
@@ -44,11 +55,17 @@ public:
   void handleSubgraphEnd(ir::SubgraphIndex) override;
   ObserverType type() const override { return ObserverType::MINMAX_DUMP; }
 
+private:
+  OpMinMaxMap &threadOpMinMax();
+
 private:
   const ir::Graph &_graph;
   const backend::BackendContexts &_backend_contexts;
   std::string _workspace_dir;
-  OpMinMaxMap _op_minmax;
+  // Unique among recorders, unlike this pointer that may be reused after destruction
+  const uint64_t _id;
+  std::mutex _mutex;
+  std::unordered_map<std::thread::id, OpMinMaxMap> _thread_op_minmax;
   IOMinMaxMap _input_minmax;
 };
 
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxRecorder.h"
+
+#include "backend/Backend.h"
+#include "backend/IConfig.h"
+#include "backend/basic/TensorRegistry.h"
+#include "ir/operation/Split.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+using namespace onert;
+using namespace exec;
+using namespace backend;
+
+struct MockConfig : public IConfig
+{
+  std::string id() override { return "b1"; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+};
+
+struct MockBackend : public Backend
+{
+  std::shared_ptr<IConfig> config() const override { return std::make_shared<MockConfig>(); }
+  std::unique_ptr<BackendContext> newContext(ContextData &&) const override { return nullptr; }
+};
+
+struct MockBackendContext : public BackendContext
+{
+  MockBackendContext(const Backend *backend, std::shared_ptr<ITensorRegistry> tensor_registry)
+    : BackendContext(backend, ContextData{}, tensor_registry)
+  {
+  }
+  ITensorRegistry *genTensors() override { return tensor_registry.get(); }
+  FunctionMap genKernels() override { return {}; }
+};
+
+using OpKey = std::tuple<uint32_t, uint32_t, uint32_t>; // subgraph, operation, output
+using InputKey = std::tuple<uint32_t, uint32_t>;        // subgraph, input
+using MinMax = std::pair<float, float>;
+
+// Records of a minmax file, written in the format documented in MinMaxData.h
+struct MinMaxFile
+{
+  uint32_t version = 0;
+  std::vector<std::map<OpKey, MinMax>> op_runs;
+  std::vector<std::map<InputKey, MinMax>> input_runs;
+};
+
+MinMaxFile readMinMaxFile(const std::string &path)
+{
+  MinMaxFile mmf;
+  auto file = std::fopen(path.c_str(), "rb");
+  if (!file)
+    return mmf;
+
+  auto read_u32 = [&]() {
+    uint32_t value = 0;
+    if (std::fread(&value, sizeof(uint32_t), 1, file) != 1)
+      throw std::runtime_error{"Failed to read " + path};
+    return value;
+  };
+  auto read_minmax = [&]() {
+    float minmax[2];
+    if (std::fread(minmax, sizeof(float), 2, file) != 2)
+      throw std::runtime_error{"Failed to read " + path};
+    return MinMax{minmax[0], minmax[1]};
+  };
+
+  read_u32(); // magic code
+  mmf.version = read_u32();
+  const auto num_runs = read_u32();
+  for (uint32_t r = 0; r < num_runs; ++r)
+  {
+    const auto num_ops = read_u32();
+    const auto num_inputs = read_u32();
+    auto &ops = mmf.op_runs.emplace_back();
+    for (uint32_t i = 0; i < num_ops; ++i)
+    {
+      read_u32(); // model
+      const auto subg = read_u32();
+      const auto op = read_u32();
+      const auto output = read_u32();
+      ops[{subg, op, output}] = read_minmax();
+    }
+    auto &inputs = mmf.input_runs.emplace_back();
+    for (uint32_t i = 0; i < num_inputs; ++i)
+    {
+      read_u32(); // model
+      const auto subg = read_u32();
+      const auto input = read_u32();
+      inputs[{subg, input}] = read_minmax();
+    }
+  }
+  std::fclose(file);
+  return mmf;
+}
+
+constexpr uint32_t NUM_ELEMENTS = 4;
+
+/**
+ * @brief Graph of Split operations with two outputs each, all reading the graph input
+ *
+ *   (( input )) -> [ Split ] -> (( output 0 )), (( output 1 ))
+ *               -> [ Split ] -> (( output 0 )), (( output 1 ))
+ *               ...
+ */
+class MinMaxRecorderTest : public ::testing::Test
+{
+protected:
+  void build(uint32_t num_ops)
+  {
+    _workspace_dir = ::testing::TempDir();
+    std::remove(minmaxPath().c_str());
+
+    const ir::TypeInfo float32{ir::DataType::FLOAT32};
+    const ir::Shape shape{NUM_ELEMENTS};
+    _registry = std::make_shared<basic::TensorRegistry>();
+    _graph = std::make_unique<ir::Graph>();
+
+    auto axis = _graph->addOperand(ir::Shape{1}, ir::TypeInfo{ir::DataType::INT32});
+    auto input = _graph->addOperand(shape, float32);
+    _graph->addInput(input);
+    addTensor(input, shape, float32);
+    setValues(input, {-1.f, 0.f, 1.f, 2.f});
+
+    for (uint32_t i = 0; i < num_ops; ++i)
+    {
+      auto out0 = _graph->addOperand(shape, float32);
+      auto out1 = _graph->addOperand(shape, float32);
+      addTensor(out0, shape, float32);
+      addTensor(out1, shape, float32);
+      // Outputs differ by operations and by outputs of an operation
+      setValues(out0, {-1.f * i, 0.f, 1.f, 2.f * i});
+      setValues(out1, {-10.f * i, 0.f, 1.f, 20.f * i + 1});
+      _ops.emplace_back(_graph->addOperation(std::make_unique<ir::operation::Split>(
+        ir::OperandIndexSequence{axis, input}, ir::OperandIndexSequence{out0, out1},
+        ir::operation::Split::Param{2})));
+      _outputs.push_back({out0, out1});
+    }
+
+    _contexts.emplace(&_backend, std::make_unique<MockBackendContext>(&_backend, _registry));
+    _recorder = std::make_unique<MinMaxRecorder>(_workspace_dir, *_graph, _contexts);
+  }
+
+  void addTensor(const ir::OperandIndex &index, const ir::Shape &shape, const ir::TypeInfo &type)
+  {
+    auto tensor = std::make_unique<basic::Tensor>(
+      ir::OperandInfo::createStaticInfo(shape, type), nullptr);
+    _buffers[index].resize(NUM_ELEMENTS);
+    tensor->setBuffer(reinterpret_cast<uint8_t *>(_buffers[index].data()));
+    _registry->setNativeTensor(index, std::move(tensor));
+  }
+
+  void setValues(const ir::OperandIndex &index, const std::vector<float> &values)
+  {
+    _buffers.at(index) = values;
+    _registry->getNativeTensor(index)->setBuffer(
+      reinterpret_cast<uint8_t *>(_buffers.at(index).data()));
+  }
+
+  void recordJob(uint32_t op) { _recorder->handleJobEnd(nullptr, _subg, _ops.at(op), &_backend); }
+
+  std::string minmaxPath() const { return _workspace_dir + "/minmax.bin"; }
+
+  // Expected record of output of operation op
+  MinMax expected(uint32_t op, uint32_t output) const
+  {
+    const auto &values = _buffers.at(_outputs.at(op).at(output));
+    return {*std::min_element(values.begin(), values.end()),
+            *std::max_element(values.begin(), values.end())};
+  }
+
+  void TearDown() override { std::remove(minmaxPath().c_str()); }
+
+  const ir::SubgraphIndex _subg{0};
+  MockBackend _backend;
+  std::string _workspace_dir;
+  std::shared_ptr<basic::TensorRegistry> _registry;
+  std::unique_ptr<ir::Graph> _graph;
+  std::map<ir::OperandIndex, std::vector<float>> _buffers;
+  std::vector<ir::OperationIndex> _ops;
+  std::vector<std::vector<ir::OperandIndex>> _outputs;
+  BackendContexts _contexts;
+  std::unique_ptr<MinMaxRecorder> _recorder;
+};
+
+} // namespace
+
+TEST_F(MinMaxRecorderTest, multiple_outputs)
+{
+  build(2);
+
+  _recorder->handleSubgraphBegin(_subg);
+  recordJob(0);
+  recordJob(1);
+  _recorder->handleSubgraphEnd(_subg);
+
+  const auto mmf = readMinMaxFile(minmaxPath());
+  ASSERT_EQ(mmf.version, 2);
+  ASSERT_EQ(mmf.op_runs.size(), 1);
+  const auto &ops = mmf.op_runs[0];
+  ASSERT_EQ(ops.size(), 4);
+  for (uint32_t op = 0; op < 2; ++op)
+  {
+    for (uint32_t output = 0; output < 2; ++output)
+      EXPECT_EQ(ops.at({0, _ops[op].value(), output}), expected(op, output));
+  }
+
+  const auto &inputs = mmf.input_runs[0];
+  ASSERT_EQ(inputs.size(), 1);
+  EXPECT_EQ(inputs.at({0, 0}), MinMax(-1.f, 2.f));
+}
+
+TEST_F(MinMaxRecorderTest, concurrent_threads)
+{
+  const uint32_t num_ops = 16;
+  build(num_ops);
+
+  // Jobs end on different threads like ParallelExecutor, twice to use cached thread maps
+  for (uint32_t run = 0; run < 2; ++run)
+  {
+    _recorder->handleSubgraphBegin(_subg);
+    std::vector<std::thread> threads;
+    for (uint32_t op = 0; op < num_ops; ++op)
+      threads.emplace_back([this, op]() { recordJob(op); });
+    for (auto &thread : threads)
+      thread.join();
+    _recorder->handleSubgraphEnd(_subg);
+  }
+
+  const auto mmf = readMinMaxFile(minmaxPath());
+  ASSERT_EQ(mmf.op_runs.size(), 2);
+  for (const auto &ops : mmf.op_runs)
+  {
+    ASSERT_EQ(ops.size(), num_ops * 2);
+    for (uint32_t op = 0; op < num_ops; ++op)
+    {
+      for (uint32_t output = 0; output < 2; ++output)
+        EXPECT_EQ(ops.at({0, _ops[op].value(), output}), expected(op, output));
+    }
+  }
+}
+
+TEST_F(MinMaxRecorderTest, same_output_on_threads)
+{
+  build(1);
+
+  // An operation recorded on two threads in a run is widened to cover both records
+  _recorder->handleSubgraphBegin(_subg);
+  std::thread{[this]() { recordJob(0); }}.join();
+  setValues(_outputs[0][0], {-5.f, 0.f, 0.f, 0.f});
+  setValues(_outputs[0][1], {0.f, 0.f, 0.f, 50.f});
+  std::thread{[this]() { recordJob(0); }}.join();
+  _recorder->handleSubgraphEnd(_subg);
+
+  const auto mmf = readMinMaxFile(minmaxPath());
+  ASSERT_EQ(mmf.op_runs.size(), 1);
+  const auto &ops = mmf.op_runs[0];
+  ASSERT_EQ(ops.size(), 2);
+  EXPECT_EQ(ops.at({0, _ops[0].value(), 0}), MinMax(-5.f, 0.f));
+  EXPECT_EQ(ops.at({0, _ops[0].value(), 1}), MinMax(0.f, 50.f));
+}
+
+TEST_F(MinMaxRecorderTest, runs_do_not_mix)
+{
+  build(1);
+
+  // Records of a run are cleared when the next run begins
+  _recorder->handleSubgraphBegin(_subg);
+  recordJob(0);
+  _recorder->handleSubgraphEnd(_subg);
+
+  setValues(_outputs[0][0], {3.f, 4.f, 5.f, 6.f});
+  _recorder->handleSubgraphBegin(_subg);
+  std::thread{[this]() { recordJob(0); }}.join();
+  _recorder->handleSubgraphEnd(_subg);
+
+  const auto mmf = readMinMaxFile(minmaxPath());
+  ASSERT_EQ(mmf.op_runs.size(), 2);
+  EXPECT_EQ(mmf.op_runs[0].at({0, _ops[0].value(), 0}), MinMax(0.f, 1.f));
+  EXPECT_EQ(mmf.op_runs[1].at({0, _ops[0].value(), 0}), MinMax(3.f, 6.f));
+}
+
+TEST_F(MinMaxRecorderTest, neg_all_nan)
+{
+  build(1);
+
+  setValues(_outputs[0][0], std::vector<float>(NUM_ELEMENTS, std::nanf("")));
+  _recorder->handleSubgraphBegin(_subg);
+  EXPECT_ANY_THROW(recordJob(0));
+}
@@ -19,8 +19,11 @@
 #include <cassert>
 
 #include "util/logging.h"
+#include "util/ThreadBudget.h"
 #include "exec/IFunction.h"
 
+#include <algorithm>
+
 namespace onert
 {
 namespace exec
@@ -30,14 +33,16 @@ class HookFunction : public IFunction
 {
 public:
   HookFunction(IFunction *fn, const std::function<void()> &setup,
-               const std::function<void()> &teardown)
-    : _fn{fn}, _setup{setup}, _teardown{teardown}
+               const std::function<void()> &teardown, uint32_t leased_threads)
+    : _fn{fn}, _setup{setup}, _teardown{teardown}, _leased_threads{leased_threads}
   {
   }
 
 public:
   void run() override
   {
+    // Runs on a worker thread, within the lease of the thread that executes this subgraph
+    util::ThreadBudget::SubLease sub_lease{_leased_threads};
     _setup();
     _fn->run();
     _teardown();
@@ -47,6 +52,7 @@ private:
   IFunction *_fn;
   std::function<void()> _setup;
   std::function<void()> _teardown;
+  uint32_t _leased_threads;
 };
 
 void ParallelExecutor::notify(uint32_t finished_job_id)
@@ -82,6 +88,11 @@ void ParallelExecutor::executeImpl(const ExecutionObservee &subject)
 
   _scheduler = std::make_unique<ParallelScheduler>(backends);
 
+  // Workers of backends run jobs at once, so the lease of this thread is split among them
+  const auto leased = util::ThreadBudget::leased();
+  const uint32_t worker_threads =
+    leased > 0 ? std::max<uint32_t>(1, leased / static_cast<uint32_t>(backends.size())) : 0;
+
   assert(noWaitingJobs());
 
   // Execution setup
@@ -142,7 +153,8 @@ void ParallelExecutor::executeImpl(const ExecutionObservee &subject)
       _lowered_graph->getHasDynamicTensor(op_ind) || dynamic_input_exists;
     job->fn_seq()->enableDynamicShapeInferer(handle_dynamic_tensor);
 
-    _scheduler->assign(std::make_unique<HookFunction>(job->fn_seq(), setup, teardown), backend);
+    _scheduler->assign(
+      std::make_unique<HookFunction>(job->fn_seq(), setup, teardown, worker_threads), backend);
     _finished_jobs[job_index] = std::move(job);
   }
 
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WeightPager.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace onert
+{
+namespace exec
+{
+
+WeightPager::WeightPager(uint32_t distance,
+                         const std::vector<std::vector<std::shared_ptr<ir::Data>>> &op_weights)
+  : _distance{distance}, _prefetch(op_weights.size()), _evict(op_weights.size())
+{
+  // The same data may be shared by operands or used by several operations
+  std::unordered_map<const ir::Data *, size_t> last_use;
+  for (size_t pos = 0; pos < op_weights.size(); ++pos)
+  {
+    std::unordered_set<const ir::Data *> seen;
+    for (const auto &data : op_weights[pos])
+    {
+      if (dynamic_cast<const ir::MMapedData *>(data.get()) == nullptr)
+        continue;
+      if (seen.insert(data.get()).second)
+        _prefetch[pos].emplace_back(data);
+      last_use[data.get()] = pos;
+    }
+  }
+
+  for (size_t pos = 0; pos < op_weights.size(); ++pos)
+  {
+    for (const auto &weak_data : _prefetch[pos])
+    {
+      auto data = weak_data.lock();
+      if (last_use.at(data.get()) == pos)
+        _evict[pos].emplace_back(data);
+    }
+  }
+}
+
+void WeightPager::begin() const
+{
+  for (size_t pos = 0; pos < _distance && pos < _prefetch.size(); ++pos)
+    prefetch(pos);
+}
+
+void WeightPager::beforeRun(size_t pos) const
+{
+  if (pos + _distance < _prefetch.size())
+    prefetch(pos + _distance);
+}
+
+void WeightPager::afterRun(size_t pos) const
+{
+  for (const auto &weak_data : _evict[pos])
+  {
+    if (auto data = weak_data.lock())
+      static_cast<const ir::MMapedData &>(*data).evict();
+  }
+}
+
+void WeightPager::prefetch(size_t pos) const
+{
+  for (const auto &weak_data : _prefetch[pos])
+  {
+    if (auto data = weak_data.lock())
+      static_cast<const ir::MMapedData &>(*data).prefetch();
+  }
+}
+
+} // namespace exec
+} // namespace onert
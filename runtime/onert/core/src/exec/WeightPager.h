@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_WEIGHT_PAGER_H__
+#define __ONERT_EXEC_WEIGHT_PAGER_H__
+
+#include "ir/Data.h"
+
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Pages mapped weights in and out along a linear execution order
+ *
+ * Weights of an operation are prefetched some operations ahead of it, and their pages are dropped
+ * after their last use in the order. So resident weights stay bounded for models larger than
+ * memory. Dropped pages are read from the model file again on the next run.
+ *
+ * Only weights in ir::MMapedData are paged. Weights released by backends, e.g. after they are
+ * converted into another form, are skipped.
+ */
+class WeightPager
+{
+public:
+  /**
+   * @param distance   Number of operations to prefetch weights ahead
+   * @param op_weights Weights used by each operation, in execution order
+   */
+  WeightPager(uint32_t distance,
+              const std::vector<std::vector<std::shared_ptr<ir::Data>>> &op_weights);
+
+public:
+  /**
+   * @brief Call this before running the first operation
+   */
+  void begin() const;
+  /**
+   * @brief Call this before running the operation at @c pos in execution order
+   */
+  void beforeRun(size_t pos) const;
+  /**
+   * @brief Call this after running the operation at @c pos in execution order
+   */
+  void afterRun(size_t pos) const;
+
+private:
+  void prefetch(size_t pos) const;
+
+private:
+  uint32_t _distance;
+  // Weights to prefetch before each operation
+  std::vector<std::vector<std::weak_ptr<ir::Data>>> _prefetch;
+  // Weights to drop after each operation
+  std::vector<std::vector<std::weak_ptr<ir::Data>>> _evict;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_WEIGHT_PAGER_H__
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WeightPager.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace onert;
+
+namespace
+{
+
+class WeightPagerTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char path[] = "/tmp/weight_pager_test.XXXXXX";
+    _fd = mkstemp(path);
+    ASSERT_NE(_fd, -1);
+    unlink(path);
+    _page_size = getpagesize();
+    std::vector<uint8_t> content(_page_size * 4, 1);
+    ASSERT_EQ(write(_fd, content.data(), content.size()), static_cast<ssize_t>(content.size()));
+  }
+
+  void TearDown() override { close(_fd); }
+
+  std::shared_ptr<ir::Data> map(size_t page, size_t num_pages)
+  {
+    return std::make_shared<ir::MMapedData>(_fd, page * _page_size, num_pages * _page_size,
+                                            page * _page_size, num_pages * _page_size);
+  }
+
+  // Returns whether the mapping of data has resident pages in this process
+  bool resident(const ir::Data &data)
+  {
+    // mincore() cannot tell it as it reports the page cache of the file
+    const auto addr = reinterpret_cast<unsigned long>(data.base());
+    std::ifstream smaps{"/proc/self/smaps"};
+    std::string line;
+    bool found = false;
+    while (std::getline(smaps, line))
+    {
+      unsigned long begin = 0, end = 0;
+      if (std::sscanf(line.c_str(), "%lx-%lx", &begin, &end) == 2)
+        found = begin <= addr && addr < end;
+      else if (found && line.rfind("Rss:", 0) == 0)
+        return std::stoul(line.substr(4)) > 0;
+    }
+    throw std::runtime_error{"Cannot find the mapping"};
+  }
+
+  int _fd = -1;
+  size_t _page_size = 0;
+};
+
+} // namespace
+
+TEST_F(WeightPagerTest, evict_after_last_use)
+{
+  auto weights1 = map(0, 2);
+  auto weights2 = map(2, 2);
+  const std::vector<std::vector<std::shared_ptr<ir::Data>>> op_weights{
+    {weights1}, {weights2}, {weights1}};
+  exec::WeightPager pager{1, op_weights};
+
+  pager.begin();
+  for (size_t pos = 0; pos < op_weights.size(); ++pos)
+  {
+    pager.beforeRun(pos);
+    // Touch weights as a kernel does
+    volatile uint8_t value = *op_weights[pos][0]->base();
+    (void)value;
+    pager.afterRun(pos);
+  }
+  ASSERT_FALSE(resident(*weights1));
+  ASSERT_FALSE(resident(*weights2));
+
+  // Weights still in use are kept
+  pager.begin();
+  pager.beforeRun(0);
+  volatile uint8_t value = *weights1->base();
+  (void)value;
+  pager.afterRun(0);
+  ASSERT_TRUE(resident(*weights1));
+}
+
+TEST_F(WeightPagerTest, released_weights)
+{
+  auto weights = map(0, 1);
+  auto cached = std::make_shared<ir::CachedData>(weights->base(), weights->size());
+  exec::WeightPager pager{2, {{weights, cached}, {weights}}};
+
+  // Weights released by backends are skipped
+  weights.reset();
+  pager.begin();
+  pager.beforeRun(0);
+  pager.afterRun(0);
+  pager.beforeRun(1);
+  pager.afterRun(1);
+}
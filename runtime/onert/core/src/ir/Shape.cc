@@ -52,18 +52,39 @@ FeatureShape Shape::asFeature() const
 void Shape::extendRank(int to_rank)
 {
   assert(to_rank - rank() >= 0);
-  _dimensions.insert(_dimensions.cbegin(), to_rank - rank(), 1);
+  const auto old_rank = rank();
+  resize(to_rank);
+  std::copy_backward(dimsData(), dimsData() + old_rank, dimsData() + to_rank);
+  std::fill(dimsData(), dimsData() + to_rank - old_rank, 1);
 }
 
 uint64_t Shape::num_elements() const
 {
   // if dimension is 0, it means unspecified and cannot calculate the total number of elements
-  if (std::any_of(_dimensions.begin(), _dimensions.end(),
-                  [](const int32_t &v) { return v == kUnspecifiedDim; }))
+  if (std::any_of(begin(), end(), [](const int32_t &v) { return v == kUnspecifiedDim; }))
     throw std::runtime_error("num_elements() cannot calculate when any dimension is unspecified");
 
-  return std::accumulate(_dimensions.cbegin(), _dimensions.cend(), UINT64_C(1),
-                         std::multiplies<uint64_t>());
+  return std::accumulate(begin(), end(), UINT64_C(1), std::multiplies<uint64_t>());
+}
+
+void Shape::resize(int rank)
+{
+  assert(rank >= 0);
+  if (rank > kInlineRank)
+  {
+    if (_rank <= kInlineRank)
+      _heap_dims.assign(_inline_dims, _inline_dims + _rank);
+    _heap_dims.resize(rank, 0);
+  }
+  else
+  {
+    if (_rank > kInlineRank)
+      std::copy(_heap_dims.begin(), _heap_dims.begin() + rank, _inline_dims);
+    else if (rank > _rank)
+      std::fill(_inline_dims + _rank, _inline_dims + rank, 0);
+    _heap_dims.clear();
+  }
+  _rank = rank;
 }
 
 Shape convertShape(const Shape &shape, const PermuteType &type)
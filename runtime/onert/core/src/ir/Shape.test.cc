@@ -56,3 +56,33 @@ TEST(ShapeTest, neg_basic_test)
     EXPECT_ANY_THROW(shape.num_elements());
   }
 }
+
+TEST(ShapeTest, modify_dims)
+{
+  onert::ir::Shape shape{2, 3};
+  shape.prepend(1);
+  shape.append(4);
+  ASSERT_EQ(shape, (onert::ir::Shape{1, 2, 3, 4}));
+
+  shape.extendRank(6);
+  ASSERT_EQ(shape, (onert::ir::Shape{1, 1, 1, 2, 3, 4}));
+
+  // Beyond the inline rank
+  shape.append(5);
+  shape.extendRank(9);
+  ASSERT_EQ(shape, (onert::ir::Shape{1, 1, 1, 1, 1, 2, 3, 4, 5}));
+  ASSERT_EQ(shape.num_elements(), 120);
+  ASSERT_EQ(shape.dims(), (std::vector<int32_t>{1, 1, 1, 1, 1, 2, 3, 4, 5}));
+
+  onert::ir::Shape copied = shape;
+  copied.dim(8) = 6;
+  ASSERT_NE(copied, shape);
+  ASSERT_EQ(shape.dim(8), 5);
+}
+
+TEST(ShapeTest, neg_dim_out_of_range)
+{
+  onert::ir::Shape shape{2, 3};
+  EXPECT_ANY_THROW(shape.dim(2));
+  EXPECT_ANY_THROW(shape.dim(-1));
+}
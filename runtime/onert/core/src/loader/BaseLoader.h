@@ -71,7 +71,9 @@ public:
   explicit BaseLoader(std::unique_ptr<ir::Model> &model)
     : _base{nullptr}, _pagesize(getpagesize()), _fd(-1), _model(model), _domain_model{nullptr}
   {
-    _use_mmaped_data = util::getConfigBool(util::config::USE_MMAPED_DATA);
+    // Weights can be paged only when they are mapped
+    _use_mmaped_data = util::getConfigBool(util::config::USE_MMAPED_DATA) ||
+                       util::getConfigInt(util::config::WEIGHT_PAGING_DISTANCE) > 0;
   }
 
   /**
@@ -170,6 +172,7 @@ private:
   void loadSplitV(const Operator *op, ir::Graph &subg);
   void loadSqueeze(const Operator *op, ir::Graph &subg);
   void loadStridedSlice(const Operator *op, ir::Graph &subg);
+  void loadTopKV2(const Operator *op, ir::Graph &subg);
   void loadTransposeConv(const Operator *op, ir::Graph &subg);
   void loadUnidirectionalSequenceLSTM(const Operator *op, ir::Graph &subg);
   void loadUnpack(const Operator *op, ir::Graph &subg);
@@ -725,6 +728,31 @@ void BaseLoader<LoaderDomain>::loadDepthwiseConv2D(const Operator *op, ir::Graph
   }
 }
 
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadTopKV2(const Operator *op, ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+
+  if (inputs.size() != 2 || outputs.size() != 2)
+    throw std::runtime_error("TopKV2 Op has wrong number of input or output tensors.");
+
+  // k is given as a tensor, but our IR takes it as a parameter
+  const auto &k = subg.operands().at(inputs.at(1));
+  if (!k.isConstant() || k.typeInfo().type() != ir::DataType::INT32 ||
+      k.shape().num_elements() != 1)
+    throw std::runtime_error("TopKV2: k must be a constant int32 scalar");
+
+  ir::operation::TopKV2::Param param;
+  param.k = k.asScalar<int32_t>();
+
+  std::unique_ptr<ir::Operation> new_op(
+    new ir::operation::TopKV2(ir::OperandIndexSequence{inputs.at(0)}, outputs, param));
+  subg.addOperation(std::move(new_op));
+}
+
 template <typename LoaderDomain>
 void BaseLoader<LoaderDomain>::loadTransposeConv(const Operator *op, ir::Graph &subg)
 {
@@ -1702,6 +1730,9 @@ void BaseLoader<LoaderDomain>::loadOperation(const Operator *op, ir::Graph &subg
     case BuiltinOperator::BuiltinOperator_TILE:
       loadOperationTo<ir::operation::Tile>(op, subg);
       return;
+    case BuiltinOperator::BuiltinOperator_TOPK_V2:
+      loadTopKV2(op, subg);
+      return;
     case BuiltinOperator::BuiltinOperator_RANGE:
       loadOperationTo<ir::operation::Range>(op, subg);
       return;
@@ -1,31 +0,0 @@
-/*
- * Copyright (c) 2019 Samsung Electronics Co., Ltd. All Rights Reserved
- *
- * Licensed under the Apache License, Version 2.0 (the "License");
- * you may not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- *
- *    http://www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an "AS IS" BASIS,
- * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
- */
-
-#include "EventRecorder.h"
-
-void EventRecorder::emit(std::unique_ptr<DurationEvent> &&evt)
-{
-  std::lock_guard<std::mutex> lock{_mu};
-
-  _duration_events.push_back(std::move(evt));
-}
-
-void EventRecorder::emit(const CounterEvent &evt)
-{
-  std::lock_guard<std::mutex> lock{_mu};
-
-  _counter_events.push_back(evt);
-}
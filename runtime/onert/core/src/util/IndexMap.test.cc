@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/Index.h"
+#include "util/IndexMap.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+using namespace onert;
+
+struct TestTag;
+using Index = typename util::Index<uint32_t, TestTag>;
+
+TEST(IndexMap, emplace_at)
+{
+  util::IndexMap<Index, int> map;
+
+  auto res = map.emplace(Index{3}, 100);
+  ASSERT_TRUE(res.second);
+  ASSERT_EQ(res.first->first, Index{3});
+  ASSERT_EQ(map.at(Index{3}), 100);
+  ASSERT_EQ(map.size(), 1);
+
+  // Emplacing an existing index does not overwrite it
+  res = map.emplace(Index{3}, 200);
+  ASSERT_FALSE(res.second);
+  ASSERT_EQ(map.at(Index{3}), 100);
+  ASSERT_EQ(map.size(), 1);
+}
+
+TEST(IndexMap, subscript)
+{
+  util::IndexMap<Index, int> map;
+
+  map[Index{1}] = 10;
+  map[Index{1}] += 5;
+  ASSERT_EQ(map.at(Index{1}), 15);
+  ASSERT_EQ(map[Index{7}], 0);
+  ASSERT_EQ(map.size(), 2);
+}
+
+TEST(IndexMap, iterate_ascending)
+{
+  util::IndexMap<Index, int> map;
+
+  map.emplace(Index{5}, 50);
+  map.emplace(Index{0}, 0);
+  map.emplace(Index{2}, 20);
+
+  std::vector<uint32_t> keys;
+  for (const auto &[index, value] : map)
+  {
+    ASSERT_EQ(value, static_cast<int>(index.value() * 10));
+    keys.push_back(index.value());
+  }
+  ASSERT_EQ(keys, (std::vector<uint32_t>{0, 2, 5}));
+}
+
+TEST(IndexMap, erase)
+{
+  util::IndexMap<Index, int> map{{Index{0}, 0}, {Index{1}, 1}, {Index{2}, 2}};
+
+  ASSERT_EQ(map.erase(Index{1}), 1);
+  ASSERT_EQ(map.count(Index{1}), 0);
+  ASSERT_EQ(map.find(Index{1}), map.end());
+  ASSERT_EQ(map.size(), 2);
+
+  for (auto it = map.begin(); it != map.end();)
+    it = map.erase(it);
+  ASSERT_TRUE(map.empty());
+}
+
+TEST(IndexMap, stable_reference)
+{
+  util::IndexMap<Index, std::unique_ptr<int>> map;
+
+  auto &first = map[Index{0}];
+  first = std::make_unique<int>(1);
+  for (uint32_t i = 1; i < 1000; ++i)
+    map.emplace(Index{i}, std::make_unique<int>(i));
+
+  ASSERT_EQ(&first, &map.at(Index{0}));
+  ASSERT_EQ(*first, 1);
+}
+
+TEST(IndexMap, sparse_index)
+{
+  util::IndexMap<Index, int> map;
+
+  map.emplace(Index{Index::max()}, 2);
+  map.emplace(Index{1}, 1);
+  ASSERT_EQ(map.size(), 2);
+  ASSERT_EQ(map.at(Index{Index::max()}), 2);
+
+  std::vector<uint32_t> keys;
+  for (const auto &e : map)
+    keys.push_back(e.first.value());
+  ASSERT_EQ(keys, (std::vector<uint32_t>{1, Index::max()}));
+
+  ASSERT_EQ(map.erase(Index{Index::max()}), 1);
+  ASSERT_EQ(map.size(), 1);
+}
+
+TEST(IndexMap, copy_move)
+{
+  util::IndexMap<Index, int> map{{Index{4}, 4}};
+
+  util::IndexMap<Index, int> copied;
+  copied = map;
+  ASSERT_EQ(copied.at(Index{4}), 4);
+
+  util::IndexMap<Index, int> moved{std::move(map)};
+  ASSERT_EQ(moved.at(Index{4}), 4);
+  ASSERT_EQ(moved.size(), 1);
+}
+
+TEST(IndexMap, neg_at)
+{
+  util::IndexMap<Index, int> map;
+
+  map.emplace(Index{1}, 1);
+  EXPECT_THROW(map.at(Index{0}), std::out_of_range);
+  EXPECT_THROW(map.at(Index{100}), std::out_of_range);
+}
+
+TEST(IndexMap, neg_undefined_index)
+{
+  util::IndexMap<Index, int> map;
+
+  EXPECT_THROW(map.emplace(Index{}, 1), std::out_of_range);
+  ASSERT_EQ(map.count(Index{}), 0);
+  ASSERT_TRUE(map.empty());
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/PreparedCache.h"
+
+#include "util/logging.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+
+// Bump this when the format of the header or any blob changes
+constexpr uint32_t kFormatVersion = 3;
+
+constexpr char kMagic[8] = {'O', 'N', 'E', 'P', 'R', 'E', 'P', '\0'};
+
+struct Header
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t reserved;
+  uint64_t key;
+  uint64_t source_size;
+  uint64_t blob_size;
+};
+
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+
+inline uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+inline uint64_t round(uint64_t acc, uint64_t input)
+{
+  return rotl(acc + input * kPrime2, 31) * kPrime1;
+}
+
+inline uint64_t readWord(const uint8_t *p)
+{
+  uint64_t word;
+  std::memcpy(&word, p, sizeof(word));
+  return word;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace util
+{
+
+PreparedCache::PreparedCache(const std::string &dir, uint64_t key)
+  : _dir{dir}, _key{key}, _valid{true}
+{
+  if (mkdir(_dir.c_str(), 0755) != 0 && errno != EEXIST)
+  {
+    VERBOSE(PreparedCache) << "Cannot create " << _dir << ": " << std::strerror(errno)
+                           << std::endl;
+    _valid = false;
+  }
+}
+
+uint64_t PreparedCache::hash(const void *ptr, size_t size, uint64_t seed)
+{
+  const auto data = static_cast<const uint8_t *>(ptr);
+  // Four independent lanes keep up with memory bandwidth
+  uint64_t lanes[4] = {seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1};
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32)
+  {
+    lanes[0] = round(lanes[0], readWord(data + i));
+    lanes[1] = round(lanes[1], readWord(data + i + 8));
+    lanes[2] = round(lanes[2], readWord(data + i + 16));
+    lanes[3] = round(lanes[3], readWord(data + i + 24));
+  }
+
+  uint64_t h = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+  h += size;
+  for (; i + 8 <= size; i += 8)
+    h = rotl(h ^ round(0, readWord(data + i)), 27) * kPrime1 + kPrime2;
+  for (; i < size; ++i)
+    h = rotl(h ^ (data[i] * kPrime1), 11) * kPrime2;
+
+  // Final avalanche
+  h ^= h >> 33;
+  h *= kPrime2;
+  h ^= h >> 29;
+  h *= kPrime1;
+  h ^= h >> 32;
+  return h;
+}
+
+uint64_t PreparedCache::fileKey(const std::string &path)
+{
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0)
+    return 0;
+
+  // A file rewritten in place gets a new modification time
+  const uint64_t stamps[] = {static_cast<uint64_t>(st.st_dev),
+                             static_cast<uint64_t>(st.st_ino),
+                             static_cast<uint64_t>(st.st_size),
+                             static_cast<uint64_t>(st.st_mtim.tv_sec),
+                             static_cast<uint64_t>(st.st_mtim.tv_nsec)};
+  return hash(stamps, sizeof(stamps), hash(path.data(), path.size()));
+}
+
+std::shared_ptr<ir::Data> PreparedCache::load(const std::string &name, size_t source_size,
+                                               size_t size) const
+{
+  if (!_valid || size == 0)
+    return nullptr;
+
+  const auto file_path = path(name);
+  int fd = open(file_path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return nullptr;
+
+  struct stat st;
+  Header header;
+  if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) != sizeof(Header) + size ||
+      pread(fd, &header, sizeof(Header), 0) != static_cast<ssize_t>(sizeof(Header)))
+  {
+    VERBOSE(PreparedCache) << "Ignore " << file_path << " of unexpected size" << std::endl;
+    close(fd);
+    return nullptr;
+  }
+
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kFormatVersion ||
+      header.key != _key || header.source_size != source_size || header.blob_size != size)
+  {
+    VERBOSE(PreparedCache) << "Ignore " << file_path << " prepared for other source" << std::endl;
+    close(fd);
+    return nullptr;
+  }
+
+  auto blob =
+    std::make_shared<ir::MMapedData>(fd, 0, sizeof(Header) + size, sizeof(Header), size);
+  // The mapping stays after closing
+  close(fd);
+  if (reinterpret_cast<uintptr_t>(blob->base()) - sizeof(Header) ==
+      reinterpret_cast<uintptr_t>(MAP_FAILED))
+    return nullptr;
+
+  VERBOSE(PreparedCache) << "Loaded " << file_path << std::endl;
+  return blob;
+}
+
+void PreparedCache::store(const std::string &name, size_t source_size, const ir::Data &blob) const
+{
+  if (!_valid)
+    return;
+
+  Header header;
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kFormatVersion;
+  header.reserved = 0;
+  header.key = _key;
+  header.source_size = source_size;
+  header.blob_size = blob.size();
+
+  // Write into a temporary file and rename it, so that others never see a partial blob
+  const auto file_path = path(name);
+  const auto tmp_path = file_path + ".tmp" + std::to_string(getpid());
+  FILE *file = std::fopen(tmp_path.c_str(), "wb");
+  if (file == nullptr)
+    return;
+  const bool written = std::fwrite(&header, sizeof(Header), 1, file) == 1 &&
+                       std::fwrite(blob.base(), 1, blob.size(), file) == blob.size();
+  const bool closed = std::fclose(file) == 0;
+  if (!written || !closed || std::rename(tmp_path.c_str(), file_path.c_str()) != 0)
+  {
+    VERBOSE(PreparedCache) << "Cannot store " << file_path << std::endl;
+    std::remove(tmp_path.c_str());
+    return;
+  }
+
+  VERBOSE(PreparedCache) << "Stored " << file_path << std::endl;
+}
+
+std::string PreparedCache::path(const std::string &name) const
+{
+  char key_str[17];
+  std::snprintf(key_str, sizeof(key_str), "%016llx", static_cast<unsigned long long>(_key));
+  return _dir + "/" + key_str + "_" + name + ".v" + std::to_string(kFormatVersion) + ".bin";
+}
+
+} // namespace util
+} // namespace onert
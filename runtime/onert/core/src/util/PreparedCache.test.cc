@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/PreparedCache.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <unistd.h>
+#include <vector>
+
+using namespace onert;
+
+namespace
+{
+
+std::string makeTempDir()
+{
+  char dir[] = "/tmp/prepared_cache_test.XXXXXX";
+  if (mkdtemp(dir) == nullptr)
+    throw std::runtime_error{"Cannot create a temporary directory"};
+  return dir;
+}
+
+// Truncate every file in the directory by a byte
+void truncateFiles(const std::string &dir)
+{
+  DIR *d = opendir(dir.c_str());
+  ASSERT_NE(d, nullptr);
+  while (auto entry = readdir(d))
+  {
+    if (entry->d_name[0] == '.')
+      continue;
+    const auto path = dir + "/" + entry->d_name;
+    std::ifstream ifs{path, std::ios::binary | std::ios::ate};
+    const auto size = static_cast<off_t>(ifs.tellg());
+    ASSERT_EQ(truncate(path.c_str(), size - 1), 0);
+  }
+  closedir(d);
+}
+
+const std::vector<uint8_t> prepared{10, 20, 30, 40};
+const ir::CachedData prepared_data{prepared.data(), prepared.size()};
+
+// Size of data that blobs are prepared from
+constexpr size_t source_size = 9;
+
+} // namespace
+
+TEST(PreparedCache, store_load)
+{
+  util::PreparedCache cache{makeTempDir(), 1};
+  ASSERT_EQ(cache.load("blob", source_size, prepared.size()), nullptr);
+
+  cache.store("blob", source_size, prepared_data);
+  auto loaded = cache.load("blob", source_size, prepared.size());
+  ASSERT_NE(loaded, nullptr);
+  ASSERT_EQ(loaded->size(), prepared.size());
+  ASSERT_EQ(std::memcmp(loaded->base(), prepared.data(), prepared.size()), 0);
+}
+
+TEST(PreparedCache, hash)
+{
+  const std::string data = "model;0;0;cpu,;Linear;0;1;0;";
+  const auto h = util::PreparedCache::hash(data.data(), data.size());
+  ASSERT_EQ(h, util::PreparedCache::hash(data.data(), data.size()));
+  ASSERT_NE(h, util::PreparedCache::hash(data.data(), data.size() - 1));
+  ASSERT_NE(h, util::PreparedCache::hash(data.data(), data.size(), 1));
+}
+
+TEST(PreparedCache, fileKey)
+{
+  const auto path = makeTempDir() + "/model.circle";
+  {
+    std::ofstream ofs{path, std::ios::binary};
+    ofs << "model";
+  }
+  const auto key = util::PreparedCache::fileKey(path);
+  ASSERT_NE(key, 0);
+  ASSERT_EQ(key, util::PreparedCache::fileKey(path));
+
+  // Another model written to the same path gets another key
+  {
+    std::ofstream ofs{path, std::ios::binary};
+    ofs << "model2";
+  }
+  ASSERT_NE(key, util::PreparedCache::fileKey(path));
+  std::remove(path.c_str());
+}
+
+TEST(PreparedCache, neg_fileKey_no_file)
+{
+  ASSERT_EQ(util::PreparedCache::fileKey(makeTempDir() + "/none.circle"), 0);
+}
+
+TEST(PreparedCache, neg_load_size_mismatch)
+{
+  util::PreparedCache cache{makeTempDir(), 1};
+  cache.store("blob", source_size, prepared_data);
+  ASSERT_EQ(cache.load("blob", source_size, prepared.size() + 1), nullptr);
+  ASSERT_EQ(cache.load("blob", source_size + 1, prepared.size()), nullptr);
+  ASSERT_EQ(cache.load("unknown", source_size, prepared.size()), nullptr);
+}
+
+TEST(PreparedCache, neg_load_other_key)
+{
+  // Caches of other models or options share the directory
+  const auto dir = makeTempDir();
+  util::PreparedCache cache1{dir, 1};
+  util::PreparedCache cache2{dir, 2};
+  cache1.store("blob", source_size, prepared_data);
+  ASSERT_EQ(cache2.load("blob", source_size, prepared.size()), nullptr);
+  ASSERT_NE(cache1.load("blob", source_size, prepared.size()), nullptr);
+}
+
+TEST(PreparedCache, neg_load_truncated)
+{
+  const auto dir = makeTempDir();
+  util::PreparedCache cache{dir, 1};
+  cache.store("blob", source_size, prepared_data);
+  truncateFiles(dir);
+  ASSERT_EQ(cache.load("blob", source_size, prepared.size()), nullptr);
+}
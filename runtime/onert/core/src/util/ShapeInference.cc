@@ -1071,6 +1071,18 @@ ir::Shape inferTileShape(const ir::Shape &in_shape, const int32_t *multiplier_bu
   return new_Shape;
 }
 
+ir::Shape inferTopKV2Shape(const ir::Shape &in_shape, const int32_t k)
+{
+  if (in_shape.rank() < 1)
+    throw std::runtime_error("inferTopKV2Shape failed, input must have rank >= 1");
+  if (k < 0 || k > in_shape.dim(in_shape.rank() - 1))
+    throw std::runtime_error("inferTopKV2Shape failed, bad k: " + std::to_string(k));
+
+  ir::Shape new_shape = in_shape;
+  new_shape.dim(new_shape.rank() - 1) = k;
+  return new_shape;
+}
+
 ir::Shape inferTransposeShape(const ir::Shape &in_shape, const int32_t *perm_buf,
                               const int32_t perm_size)
 {
@@ -356,6 +356,25 @@ TEST(ShapeInference, FullyConnected)
   ASSERT_EQ(infered_out_shape.dim(1), 3);
 }
 
+TEST(ShapeInference, TopKV2)
+{
+  Shape in_shape{2, 3, 10};
+  auto infered_out_shape = onert::shape_inference::inferTopKV2Shape(in_shape, 4);
+
+  ASSERT_EQ(infered_out_shape.rank(), 3);
+  ASSERT_EQ(infered_out_shape.dim(0), 2);
+  ASSERT_EQ(infered_out_shape.dim(1), 3);
+  ASSERT_EQ(infered_out_shape.dim(2), 4);
+}
+
+TEST(ShapeInference, neg_TopKV2)
+{
+  Shape in_shape{2, 10};
+  ASSERT_THROW(onert::shape_inference::inferTopKV2Shape(in_shape, 11), std::runtime_error);
+  ASSERT_THROW(onert::shape_inference::inferTopKV2Shape(in_shape, -1), std::runtime_error);
+  ASSERT_THROW(onert::shape_inference::inferTopKV2Shape(Shape{}, 1), std::runtime_error);
+}
+
 TEST(ShapeInference, Transpose)
 {
   auto check = [&](Shape &in_shape, std::vector<int> perm, Shape &expected) {
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ThreadBudget.h"
+
+#include "util/ConfigSource.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+
+// Threads leased by the execution running on this thread, 0 if there is none
+thread_local uint32_t leased_threads = 0;
+
+} // namespace
+
+namespace onert
+{
+namespace util
+{
+
+ThreadBudget::Lease::Lease(uint32_t quota) : _granted{0}, _outer{leased_threads}
+{
+  auto &budget = ThreadBudget::get();
+  // A nested execution runs within the lease of the outer one
+  const uint32_t requested =
+    std::min(quota > 0 ? quota : budget.total(), _outer > 0 ? _outer : budget.total());
+  if (_outer == 0)
+  {
+    std::lock_guard<std::mutex> lock{budget._mutex};
+    _granted = static_cast<uint32_t>(
+      std::max<int64_t>(1, std::min<int64_t>(requested, budget._available)));
+    budget._available -= _granted;
+  }
+  else
+  {
+    _granted = requested;
+  }
+  leased_threads = _granted;
+}
+
+ThreadBudget::Lease::~Lease()
+{
+  auto &budget = ThreadBudget::get();
+  if (_outer == 0)
+  {
+    std::lock_guard<std::mutex> lock{budget._mutex};
+    budget._available += _granted;
+  }
+  leased_threads = _outer;
+}
+
+ThreadBudget::SubLease::SubLease(uint32_t threads) : _outer{leased_threads}
+{
+  if (threads > 0)
+    leased_threads = threads;
+}
+
+ThreadBudget::SubLease::~SubLease() { leased_threads = _outer; }
+
+uint32_t ThreadBudget::leased() { return leased_threads; }
+
+ThreadBudget &ThreadBudget::get()
+{
+  static ThreadBudget budget;
+  return budget;
+}
+
+ThreadBudget::ThreadBudget()
+{
+  const int configured = getConfigInt(config::THREAD_BUDGET);
+  const uint32_t cores = std::max(1u, std::thread::hardware_concurrency());
+  _total = configured > 0 ? static_cast<uint32_t>(configured) : cores;
+  _available = _total;
+}
+
+uint32_t ThreadBudget::cap(uint32_t requested) const
+{
+  return std::max(1u, std::min(requested, leased_threads > 0 ? leased_threads : _total));
+}
+
+} // namespace util
+} // namespace onert
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ThreadBudget.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace onert::util;
+
+TEST(ThreadBudget, lease)
+{
+  auto &budget = ThreadBudget::get();
+  const auto total = budget.total();
+  ASSERT_GE(total, 1u);
+  ASSERT_EQ(budget.cap(total + 1), total);
+
+  {
+    ThreadBudget::Lease lease{2};
+    ASSERT_GE(lease.granted(), 1u);
+    ASSERT_LE(lease.granted(), 2u);
+    ASSERT_EQ(budget.cap(total + 1), lease.granted());
+
+    // Nested executions run within the outer lease
+    {
+      ThreadBudget::Lease nested{0};
+      ASSERT_EQ(nested.granted(), lease.granted());
+    }
+    ASSERT_EQ(budget.cap(total + 1), lease.granted());
+  }
+  ASSERT_EQ(budget.cap(total + 1), total);
+}
+
+TEST(ThreadBudget, concurrent_leases)
+{
+  auto &budget = ThreadBudget::get();
+  const auto total = budget.total();
+
+  ThreadBudget::Lease lease{0};
+  ASSERT_EQ(lease.granted(), total);
+
+  // Others get the calling thread only while the budget is used up
+  uint32_t other_granted = 0;
+  std::thread other{[&]() {
+    ThreadBudget::Lease other_lease{0};
+    other_granted = other_lease.granted();
+  }};
+  other.join();
+  ASSERT_EQ(other_granted, 1u);
+}
+
+TEST(ThreadBudget, sub_lease)
+{
+  auto &budget = ThreadBudget::get();
+  const auto total = budget.total();
+  ThreadBudget::Lease lease{1};
+  ASSERT_EQ(ThreadBudget::leased(), lease.granted());
+
+  // A worker thread has no lease of its own, and gets the part passed to it
+  uint32_t leased_before = 0;
+  uint32_t capped = 0;
+  uint32_t leased_after = 0;
+  std::thread worker{[&]() {
+    leased_before = ThreadBudget::leased();
+    {
+      ThreadBudget::SubLease sub_lease{lease.granted()};
+      capped = budget.cap(total + 1);
+    }
+    leased_after = ThreadBudget::leased();
+  }};
+  worker.join();
+
+  ASSERT_EQ(leased_before, 0u);
+  ASSERT_EQ(capped, lease.granted());
+  ASSERT_EQ(leased_after, 0u);
+}
+
+TEST(ThreadBudget, neg_sub_lease_without_lease)
+{
+  auto &budget = ThreadBudget::get();
+  const auto total = budget.total();
+
+  // Nothing is passed when the execution has no lease
+  ThreadBudget::SubLease sub_lease{0};
+  ASSERT_EQ(ThreadBudget::leased(), 0u);
+  ASSERT_EQ(budget.cap(total + 1), total);
+}
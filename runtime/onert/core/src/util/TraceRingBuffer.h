@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_TRACE_RING_BUFFER_H__
+#define __ONERT_UTIL_TRACE_RING_BUFFER_H__
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace onert
+{
+namespace backend
+{
+class Backend;
+} // namespace backend
+
+namespace util
+{
+
+/**
+ * @brief Resource usage of the process, sampled in DEBUG build only
+ */
+struct TraceUsage
+{
+  uint32_t maxrss_kb = 0;
+  uint32_t minflt = 0;
+};
+
+/**
+ * @brief Fixed-size record of one traced operation or subgraph run
+ */
+struct TraceEvent
+{
+  static constexpr uint32_t kSubgraph = UINT32_MAX;
+
+  uint64_t begin_us;
+  uint64_t end_us;
+  // Bytes of inputs and outputs of the operation, 0 for subgraph
+  uint64_t bytes;
+  // nullptr for subgraph
+  const backend::Backend *backend;
+  // Graph id from TraceWriter::registerGraph
+  uint32_t graph_id;
+  uint32_t session_index;
+  uint32_t subg_index;
+  // kSubgraph for subgraph
+  uint32_t op_index;
+  TraceUsage begin_usage;
+  TraceUsage end_usage;
+};
+
+/**
+ * @brief Single-producer single-consumer ring buffer of TraceEvent
+ *
+ * The thread that owns this buffer pushes events and a writer thread drains them, without locks.
+ * Events are dropped rather than blocking the owner when the buffer is full.
+ */
+class TraceRingBuffer
+{
+public:
+  static constexpr int kMaxDepth = 16;
+
+public:
+  explicit TraceRingBuffer(size_t capacity)
+    : _events{std::make_unique<TraceEvent[]>(capacity)}, _mask{capacity - 1}
+  {
+    // Capacity must be a power of 2
+    assert(capacity > 0 && (capacity & _mask) == 0);
+  }
+
+public:
+  // Owner thread only
+
+  /**
+   * @brief Remember the beginning of a scope, which may nest such as a subgraph run by an If
+   */
+  void beginScope(uint64_t begin_us, const TraceUsage &usage = TraceUsage{})
+  {
+    if (_depth < kMaxDepth)
+      _scopes[_depth] = Scope{begin_us, usage};
+    ++_depth;
+  }
+
+  /**
+   * @brief Return the beginning of the innermost scope, or 0 if it is too deep to be kept
+   *
+   * @param usage Set to the usage given at the beginning, unless it is nullptr
+   */
+  uint64_t endScope(TraceUsage *usage = nullptr)
+  {
+    assert(_depth > 0);
+    --_depth;
+    const auto scope = _depth < kMaxDepth ? _scopes[_depth] : Scope{};
+    if (usage)
+      *usage = scope.usage;
+    return scope.begin_us;
+  }
+
+  bool push(const TraceEvent &event)
+  {
+    const auto head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load(std::memory_order_acquire) > _mask)
+    {
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    _events[head & _mask] = event;
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Marks that the owner thread will not push anymore
+  void retire() { _retired.store(true, std::memory_order_release); }
+
+public:
+  // Writer thread only
+
+  template <typename Callable> size_t drain(Callable &&fn)
+  {
+    const auto head = _head.load(std::memory_order_acquire);
+    auto tail = _tail.load(std::memory_order_relaxed);
+    const auto count = head - tail;
+    for (; tail != head; ++tail)
+      fn(_events[tail & _mask]);
+    _tail.store(tail, std::memory_order_release);
+    return count;
+  }
+
+  bool retired() const { return _retired.load(std::memory_order_acquire); }
+
+  uint64_t dropped() const { return _dropped.load(std::memory_order_relaxed); }
+
+private:
+  std::unique_ptr<TraceEvent[]> _events;
+  const size_t _mask;
+  std::atomic<size_t> _head{0};
+  std::atomic<size_t> _tail{0};
+  std::atomic<uint64_t> _dropped{0};
+  std::atomic<bool> _retired{false};
+
+  struct Scope
+  {
+    uint64_t begin_us = 0;
+    TraceUsage usage;
+  };
+
+  Scope _scopes[kMaxDepth];
+  int _depth = 0;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_TRACE_RING_BUFFER_H__
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TraceRingBuffer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace onert::util;
+
+namespace
+{
+
+TraceEvent makeEvent(uint32_t op_index)
+{
+  return TraceEvent{op_index, op_index + 1u, 0, nullptr, 0, 0, 0, op_index};
+}
+
+} // namespace
+
+TEST(TraceRingBuffer, push_drain)
+{
+  TraceRingBuffer buffer{4};
+  for (uint32_t i = 0; i < 3; ++i)
+    ASSERT_TRUE(buffer.push(makeEvent(i)));
+
+  std::vector<uint32_t> drained;
+  ASSERT_EQ(buffer.drain([&](const TraceEvent &e) { drained.push_back(e.op_index); }), 3u);
+  ASSERT_EQ(drained, (std::vector<uint32_t>{0, 1, 2}));
+
+  // Wraps around
+  for (uint32_t i = 3; i < 7; ++i)
+    ASSERT_TRUE(buffer.push(makeEvent(i)));
+  drained.clear();
+  buffer.drain([&](const TraceEvent &e) { drained.push_back(e.op_index); });
+  ASSERT_EQ(drained, (std::vector<uint32_t>{3, 4, 5, 6}));
+  ASSERT_EQ(buffer.dropped(), 0u);
+}
+
+TEST(TraceRingBuffer, neg_push_full)
+{
+  TraceRingBuffer buffer{2};
+  ASSERT_TRUE(buffer.push(makeEvent(0)));
+  ASSERT_TRUE(buffer.push(makeEvent(1)));
+  ASSERT_FALSE(buffer.push(makeEvent(2)));
+  ASSERT_EQ(buffer.dropped(), 1u);
+
+  std::vector<uint32_t> drained;
+  buffer.drain([&](const TraceEvent &e) { drained.push_back(e.op_index); });
+  ASSERT_EQ(drained, (std::vector<uint32_t>{0, 1}));
+}
+
+TEST(TraceRingBuffer, nested_scope)
+{
+  TraceRingBuffer buffer{2};
+  buffer.beginScope(10);
+  buffer.beginScope(20);
+  ASSERT_EQ(buffer.endScope(), 20u);
+  ASSERT_EQ(buffer.endScope(), 10u);
+
+  TraceUsage usage;
+  buffer.beginScope(30, TraceUsage{100, 200});
+  ASSERT_EQ(buffer.endScope(&usage), 30u);
+  ASSERT_EQ(usage.maxrss_kb, 100u);
+  ASSERT_EQ(usage.minflt, 200u);
+
+  // Too deep scopes are still balanced
+  for (int i = 0; i < TraceRingBuffer::kMaxDepth + 2; ++i)
+    buffer.beginScope(i + 1);
+  ASSERT_EQ(buffer.endScope(), 0u);
+  ASSERT_EQ(buffer.endScope(), 0u);
+  ASSERT_EQ(buffer.endScope(), static_cast<uint64_t>(TraceRingBuffer::kMaxDepth));
+}
+
+TEST(TraceRingBuffer, concurrent_drain)
+{
+  constexpr uint32_t kEvents = 10000;
+  TraceRingBuffer buffer{64};
+
+  std::thread producer{[&]() {
+    for (uint32_t i = 0; i < kEvents; ++i)
+      while (!buffer.push(makeEvent(i)))
+        std::this_thread::yield();
+    buffer.retire();
+  }};
+
+  uint32_t expected = 0;
+  bool in_order = true;
+  while (true)
+  {
+    const bool retired = buffer.retired();
+    buffer.drain([&](const TraceEvent &e) { in_order &= (e.op_index == expected++); });
+    if (retired)
+      break;
+  }
+  producer.join();
+
+  ASSERT_TRUE(in_order);
+  ASSERT_EQ(expected, kEvents);
+}
@@ -0,0 +1,534 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TraceWriter.h"
+
+#include "backend/Backend.h"
+#include "backend/IConfig.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+
+/**
+ * @brief Version of SNPE format written in trace.json
+ *
+ * - Operation name is a form of "$2 subgraph $3 ADD", meaning ADD op whose operation index 3 in
+ *   a subgraph whose index is 2
+ * - When there are two or more sessions, operation name is a form of
+ *   "$1 session $2 subgraph $3 ADD", meaning the op above was run in 1st session
+ */
+#define SNPE_JSON_SCHEMA_VERSION "2"
+
+namespace
+{
+
+struct ThreadBufferHolder
+{
+  std::shared_ptr<onert::util::TraceRingBuffer> buffer;
+
+  ~ThreadBufferHolder()
+  {
+    if (buffer)
+      buffer->retire();
+  }
+};
+
+std::string sessionLabel(uint32_t session_index)
+{
+  return "$" + std::to_string(session_index) + " sess";
+}
+
+std::string subgLabel(uint32_t subg_index) { return "$" + std::to_string(subg_index) + " subg"; }
+
+const std::string &opName(const std::vector<std::string> &op_names, uint32_t op_index)
+{
+  static const std::string unknown{"Unknown"};
+  return op_index < op_names.size() ? op_names[op_index] : unknown;
+}
+
+void writeMDTableRow(std::ostream &os, const std::vector<std::string> &list)
+{
+  os << "| ";
+  for (const auto &key : list)
+  {
+    os << key << " | ";
+  }
+  os << "\n";
+}
+
+struct UsageRange
+{
+  uint32_t min_rss = UINT32_MAX;
+  uint32_t max_rss = 0;
+  uint32_t min_page_reclaims = UINT32_MAX;
+  uint32_t max_page_reclaims = 0;
+
+  void update(const onert::util::TraceUsage &usage)
+  {
+    min_rss = std::min(min_rss, usage.maxrss_kb);
+    max_rss = std::max(max_rss, usage.maxrss_kb);
+    min_page_reclaims = std::min(min_page_reclaims, usage.minflt);
+    max_page_reclaims = std::max(max_page_reclaims, usage.minflt);
+  }
+
+  void update(const UsageRange &range)
+  {
+    min_rss = std::min(min_rss, range.min_rss);
+    max_rss = std::max(max_rss, range.max_rss);
+    min_page_reclaims = std::min(min_page_reclaims, range.min_page_reclaims);
+    max_page_reclaims = std::max(max_page_reclaims, range.max_page_reclaims);
+  }
+
+  std::vector<std::string> columns() const
+  {
+    return {std::to_string(min_rss), std::to_string(max_rss), std::to_string(min_page_reclaims),
+            std::to_string(max_page_reclaims)};
+  }
+};
+
+UsageRange usageRange(const onert::util::TraceEvent &event)
+{
+  UsageRange range;
+  range.update(event.begin_usage);
+  range.update(event.end_usage);
+  return range;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace util
+{
+
+TraceWriter &TraceWriter::get()
+{
+  static TraceWriter singleton;
+  return singleton;
+}
+
+TraceWriter::~TraceWriter()
+{
+  std::lock_guard<std::mutex> lifecycle_lock{_lifecycle_mutex};
+  // Only when the process exits without finishing every user
+  if (_thread.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      _stop = true;
+    }
+    _cv.notify_one();
+    _thread.join();
+  }
+}
+
+void TraceWriter::startToUse(const std::string &workspace_dir)
+{
+  std::lock_guard<std::mutex> lifecycle_lock{_lifecycle_mutex};
+  if (_ref_count++ > 0)
+    return;
+
+  // The writer thread is not running here, so everything of the last trace is reset
+  _workspace_dir = workspace_dir;
+  _file_count = 0;
+  _dropped = 0;
+  _stats.clear();
+  _table_ops.clear();
+  _table_graphs.clear();
+  _table_count = 0;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stop = false;
+    _dropped_base = 0;
+    for (const auto &thread_buffer : _buffers)
+      _dropped_base += thread_buffer.buffer->dropped();
+  }
+
+  openFile();
+  const auto table_path = _workspace_dir + "/trace.table.md";
+  _table_os.open(table_path, std::ofstream::out);
+  if (!_table_os.is_open())
+    std::cerr << "E: Fail to open trace file " << table_path << std::endl;
+  _thread = std::thread{&TraceWriter::run, this};
+}
+
+void TraceWriter::finishToUse()
+{
+  std::lock_guard<std::mutex> lifecycle_lock{_lifecycle_mutex};
+  if (--_ref_count > 0)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stop = true;
+  }
+  _cv.notify_one();
+  _thread.join();
+
+  try
+  {
+    drain();
+    flushTable();
+    closeFile();
+    writeSummary();
+
+    uint64_t dropped = _dropped;
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      for (const auto &thread_buffer : _buffers)
+        dropped += thread_buffer.buffer->dropped();
+    }
+    _last_dropped = dropped - _dropped_base;
+    if (_last_dropped > 0)
+    {
+      std::cerr << "W: TraceWriter dropped " << _last_dropped
+                << " events as trace buffers were full" << std::endl;
+    }
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "E: Fail to write trace in TraceWriter: " << e.what() << std::endl;
+  }
+}
+
+uint32_t TraceWriter::registerGraph(std::vector<std::string> &&op_names)
+{
+  auto graph = std::make_shared<const std::vector<std::string>>(std::move(op_names));
+  std::lock_guard<std::mutex> lock{_mutex};
+  _graphs.emplace_back(std::move(graph));
+  return static_cast<uint32_t>(_graphs.size() - 1);
+}
+
+TraceRingBuffer &TraceWriter::threadBuffer()
+{
+  thread_local ThreadBufferHolder holder;
+  if (!holder.buffer)
+  {
+    holder.buffer = std::make_shared<TraceRingBuffer>(kBufferEvents);
+    std::lock_guard<std::mutex> lock{_mutex};
+    _buffers.emplace_back(ThreadBuffer{holder.buffer, _next_thread_index++});
+  }
+  return *holder.buffer;
+}
+
+uint64_t TraceWriter::droppedEvents()
+{
+  std::lock_guard<std::mutex> lifecycle_lock{_lifecycle_mutex};
+  return _last_dropped;
+}
+
+void TraceWriter::run()
+{
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _cv.wait_for(lock, std::chrono::milliseconds(kDrainIntervalMs), [this] { return _stop; });
+      if (_stop)
+        return;
+    }
+
+    try
+    {
+      drain();
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << "E: Fail to write trace in TraceWriter: " << e.what() << std::endl;
+      return;
+    }
+  }
+}
+
+void TraceWriter::drain()
+{
+  std::vector<ThreadBuffer> buffers;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    buffers = _buffers;
+  }
+
+  // Operations of subgraph runs drained last time were pushed before them, so are drained by now
+  std::vector<TraceEvent> table_graphs;
+  table_graphs.swap(_table_graphs);
+
+  std::vector<const TraceRingBuffer *> retired_buffers;
+  for (const auto &thread_buffer : buffers)
+  {
+    // Check it before draining, so that nothing is pushed after the drain
+    const bool retired = thread_buffer.buffer->retired();
+    const auto thread_index = thread_buffer.index;
+    thread_buffer.buffer->drain([&](const TraceEvent &event) { write(event, thread_index); });
+    if (retired)
+    {
+      _dropped += thread_buffer.buffer->dropped();
+      retired_buffers.emplace_back(thread_buffer.buffer.get());
+    }
+  }
+
+  if (!retired_buffers.empty())
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _buffers.erase(std::remove_if(_buffers.begin(), _buffers.end(),
+                                  [&](const ThreadBuffer &thread_buffer) {
+                                    return std::find(retired_buffers.begin(),
+                                                     retired_buffers.end(),
+                                                     thread_buffer.buffer.get()) !=
+                                           retired_buffers.end();
+                                  }),
+                   _buffers.end());
+  }
+
+  for (const auto &graph : table_graphs)
+    writeTable(graph);
+
+  _os.flush();
+  _table_os.flush();
+
+  if (_file_bytes > kMaxFileBytes)
+  {
+    closeFile();
+    openFile();
+  }
+}
+
+void TraceWriter::write(const TraceEvent &event, uint32_t thread_index)
+{
+  const uint64_t duration = event.end_us - event.begin_us;
+  const bool is_subgraph = event.op_index == TraceEvent::kSubgraph;
+
+  std::string backend_id{"runtime"};
+  if (!is_subgraph)
+  {
+    auto it = _backend_ids.find(event.backend);
+    if (it == _backend_ids.end())
+      it = _backend_ids.emplace(event.backend, event.backend->config()->id()).first;
+    backend_id = it->second;
+  }
+
+  // Like operations, runs of every subgraph are summed up into one
+  const auto key = is_subgraph ? StatKey{0, 0, 0, TraceEvent::kSubgraph}
+                               : StatKey{event.graph_id, event.session_index, event.subg_index,
+                                         event.op_index};
+  auto &stat = _stats[backend_id][key];
+  stat.sum += duration;
+  stat.count++;
+  stat.max = std::max(stat.max, duration);
+  stat.min = std::min(stat.min, duration);
+
+  if (_table_os.is_open())
+  {
+    if (is_subgraph)
+      _table_graphs.emplace_back(event);
+    else
+      _table_ops[GraphKey{event.graph_id, event.session_index, event.subg_index}].emplace_back(
+        event);
+  }
+
+  if (!_os.is_open())
+    return;
+
+  std::string name;
+  std::string tid = sessionLabel(event.session_index) + ", " + subgLabel(event.subg_index);
+  if (is_subgraph)
+  {
+    name = subgLabel(event.subg_index);
+  }
+  else
+  {
+    name = "@" + std::to_string(event.op_index) + " " +
+           opName(opNames(event.graph_id), event.op_index);
+    tid += ", " + backend_id;
+  }
+
+  std::stringstream ss;
+  ss << "    { \"name\" : \"" << name << "\", \"pid\" : \"0\", \"tid\" : \"" << tid
+     << "\", \"ph\" : \"X\", \"ts\" : " << event.begin_us << ", \"dur\" : " << duration
+     << ", \"args\" : { \"session\" : \"" << event.session_index << "\", \"subgraph\" : \""
+     << event.subg_index << "\", \"bytes\" : \"" << event.bytes << "\", \"thread\" : \""
+     << thread_index << "\" } },\n";
+  // Resource usage is sampled in DEBUG build only
+  if (event.end_usage.maxrss_kb != 0)
+  {
+    ss << "    { \"name\" : \"maxrss\", \"pid\" : \"0\", \"tid\" : \"" << tid
+       << "\", \"ph\" : \"C\", \"ts\" : " << event.end_us << ", \"args\" : { \"value\" : \""
+       << event.end_usage.maxrss_kb << "\" } },\n";
+    ss << "    { \"name\" : \"minflt\", \"pid\" : \"0\", \"tid\" : \"" << tid
+       << "\", \"ph\" : \"C\", \"ts\" : " << event.end_us << ", \"args\" : { \"value\" : \""
+       << event.end_usage.minflt << "\" } },\n";
+  }
+  const auto line = ss.str();
+  _os << line;
+  _file_bytes += line.size();
+}
+
+void TraceWriter::writeTable(const TraceEvent &graph)
+{
+  // Operations of this run are the ones within it. Ones before it are of runs not traced fully.
+  auto &pending_ops = _table_ops[GraphKey{graph.graph_id, graph.session_index, graph.subg_index}];
+  std::vector<TraceEvent> ops;
+  auto done = std::partition(pending_ops.begin(), pending_ops.end(),
+                              [&](const TraceEvent &op) { return op.end_us > graph.end_us; });
+  std::copy_if(done, pending_ops.end(), std::back_inserter(ops),
+               [&](const TraceEvent &op) { return op.begin_us >= graph.begin_us; });
+  pending_ops.erase(done, pending_ops.end());
+  std::stable_sort(ops.begin(), ops.end(), [](const TraceEvent &lhs, const TraceEvent &rhs) {
+    return lhs.begin_us < rhs.begin_us;
+  });
+
+  const uint64_t graph_latency = graph.end_us - graph.begin_us;
+  auto graph_usage = usageRange(graph);
+  for (const auto &op : ops)
+    graph_usage.update(usageRange(op));
+
+  auto &os = _table_os;
+  os << "# Session: " << graph.session_index << ", Subgraph: " << graph.subg_index
+     << ", Running count: " << _table_count++ << "\n";
+
+  writeMDTableRow(os, {"latency(us)", "rss_min(kb)", "rss_max(kb)", "page_reclaims_min",
+                       "page_reclaims_max"});
+  writeMDTableRow(os, {"-----------", "-------", "-------", "-----------------",
+                       "-----------------"});
+  auto graph_row = graph_usage.columns();
+  graph_row.insert(graph_row.begin(), std::to_string(graph_latency));
+  writeMDTableRow(os, graph_row);
+  os << "\n";
+
+  os << "## Op \n";
+  writeMDTableRow(os, {"Op name", "backend", "latency(us)", "latency(%)", "rss_min(kb)",
+                       "rss_max(kb)", "page_reclaims_min", "page_reclaims_max"});
+  writeMDTableRow(os, {"-------", "-------", "-----------", "-----------", "-------", "-------",
+                       "-----------------", "-----------------"});
+  const auto &op_names = opNames(graph.graph_id);
+  for (const auto &op : ops)
+  {
+    const uint64_t op_latency = op.end_us - op.begin_us;
+    const double op_per = static_cast<double>(op_latency) / graph_latency * 100.0;
+    std::vector<std::string> op_row{"$" + std::to_string(op.subg_index) + " subgraph @" +
+                                      std::to_string(op.op_index) + " " +
+                                      opName(op_names, op.op_index),
+                                    _backend_ids.at(op.backend), std::to_string(op_latency),
+                                    std::to_string(op_per)};
+    const auto usage_columns = usageRange(op).columns();
+    op_row.insert(op_row.end(), usage_columns.begin(), usage_columns.end());
+    writeMDTableRow(os, op_row);
+  }
+  os << "\n";
+}
+
+void TraceWriter::flushTable()
+{
+  // Every buffer is drained here, so no operation is left behind
+  for (const auto &graph : _table_graphs)
+    writeTable(graph);
+  _table_graphs.clear();
+  _table_ops.clear();
+  _table_os.close();
+}
+
+const std::vector<std::string> &TraceWriter::opNames(uint32_t graph_id)
+{
+  // Graphs are registered before their events are pushed
+  if (graph_id >= _graph_snapshot.size())
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _graph_snapshot = _graphs;
+  }
+  return *_graph_snapshot.at(graph_id);
+}
+
+void TraceWriter::openFile()
+{
+  // Only files rolled over are numbered
+  const auto index = _file_count++;
+  const auto path = _workspace_dir + "/trace.chrome." +
+                    (index == 0 ? std::string{} : std::to_string(index) + ".") + "json";
+  _os.open(path, std::ofstream::out);
+  if (!_os.is_open())
+  {
+    std::cerr << "E: Fail to open trace file " << path << std::endl;
+    return;
+  }
+  _os << "{\n";
+  _os << "  \"traceEvents\": [\n";
+  _file_bytes = 0;
+}
+
+void TraceWriter::closeFile()
+{
+  if (!_os.is_open())
+    return;
+  _os << "    { }\n";
+  _os << "  ]\n";
+  _os << "}\n";
+  _os.close();
+}
+
+void TraceWriter::writeSummary()
+{
+  bool multiple_sessions = false;
+  uint32_t first_session = UINT32_MAX;
+  for (const auto &backend_stats : _stats)
+  {
+    for (const auto &key_stat : backend_stats.second)
+    {
+      const auto &[graph_id, session_index, subg_index, op_index] = key_stat.first;
+      if (op_index == TraceEvent::kSubgraph)
+        continue;
+      if (first_session == UINT32_MAX)
+        first_session = session_index;
+      else if (session_index != first_session)
+        multiple_sessions = true;
+    }
+  }
+
+  Json::Value root;
+  root["version"] = SNPE_JSON_SCHEMA_VERSION;
+  auto &exec_data = root["Execution_Data"] = Json::Value{Json::objectValue};
+  exec_data["memory"] = Json::Value{Json::objectValue};
+
+  for (const auto &[backend_id, stat_map] : _stats)
+  {
+    auto &json_tid = exec_data[backend_id] = Json::Value{Json::objectValue};
+    for (const auto &[key, stat] : stat_map)
+    {
+      const auto &[graph_id, session_index, subg_index, op_index] = key;
+      std::string name{"Graph"};
+      if (op_index != TraceEvent::kSubgraph)
+      {
+        name = "$" + std::to_string(subg_index) + " subgraph $" + std::to_string(op_index) + " " +
+               opName(opNames(graph_id), op_index);
+        if (multiple_sessions)
+          name = "$" + std::to_string(session_index) + " session " + name;
+      }
+      json_tid[name]["Avg_Time"] = static_cast<Json::UInt64>(stat.sum / stat.count);
+      json_tid[name]["Max_Time"] = static_cast<Json::UInt64>(stat.max);
+      json_tid[name]["Min_Time"] = static_cast<Json::UInt64>(stat.min);
+      json_tid[name]["Runtime"] = backend_id;
+    }
+  }
+
+  std::ofstream os{_workspace_dir + "/trace.json", std::ofstream::out};
+  os << root;
+}
+
+} // namespace util
+} // namespace onert
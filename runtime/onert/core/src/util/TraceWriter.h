@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_TRACE_WRITER_H__
+#define __ONERT_UTIL_TRACE_WRITER_H__
+
+#include "TraceRingBuffer.h"
+
+#include <condition_variable>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Process-wide writer which drains per-thread TraceRingBuffers on a background thread
+ *
+ * Events are written as Chrome trace events into "trace.chrome.json" in the workspace, rolling
+ * into "trace.chrome.<N>.json" when a file grows over kMaxFileBytes. Each subgraph run and its
+ * operations are written into "trace.table.md" as markdown tables. Per-operation statistics are
+ * kept as well, and written into "trace.json" in SNPE benchmark format when the last user
+ * finishes. A writer started again after that overwrites these files.
+ */
+class TraceWriter
+{
+public:
+  static constexpr size_t kBufferEvents = 4096;
+  static constexpr size_t kMaxFileBytes = 64 * 1024 * 1024;
+  static constexpr int kDrainIntervalMs = 50;
+
+public:
+  static TraceWriter &get();
+
+public:
+  /**
+   * @brief Call this when an observer starts tracing. The first one starts the writer thread.
+   */
+  void startToUse(const std::string &workspace_dir);
+
+  /**
+   * @brief Call this when an observer finishes. The last one drains the rest and writes files.
+   */
+  void finishToUse();
+
+  /**
+   * @brief Register operation names of a graph
+   *
+   * @return Graph id to be set in TraceEvent
+   */
+  uint32_t registerGraph(std::vector<std::string> &&op_names);
+
+  /**
+   * @brief Return the ring buffer of the calling thread
+   */
+  TraceRingBuffer &threadBuffer();
+
+  /**
+   * @brief Return the number of events dropped from the last start to the last finish
+   */
+  uint64_t droppedEvents();
+
+private:
+  TraceWriter() = default;
+  ~TraceWriter();
+
+  void run();
+  void drain();
+  void write(const TraceEvent &event, uint32_t thread_index);
+  void writeTable(const TraceEvent &graph);
+  void flushTable();
+  const std::vector<std::string> &opNames(uint32_t graph_id);
+  void openFile();
+  void closeFile();
+  void writeSummary();
+
+private:
+  struct Stat
+  {
+    uint64_t sum = 0;
+    uint64_t count = 0;
+    uint64_t max = 0;
+    uint64_t min = UINT64_MAX;
+  };
+
+  struct ThreadBuffer
+  {
+    std::shared_ptr<TraceRingBuffer> buffer;
+    uint32_t index;
+  };
+
+  using OpNames = std::shared_ptr<const std::vector<std::string>>;
+
+  // Guards users, and is held while the writer thread starts or is joined
+  std::mutex _lifecycle_mutex;
+  int32_t _ref_count = 0;
+  std::thread _thread;
+  uint64_t _last_dropped = 0;
+
+  // Guards buffers, graphs and the stop flag. Not held over file I/O.
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  bool _stop = false;
+  std::vector<ThreadBuffer> _buffers;
+  uint32_t _next_thread_index = 0;
+  std::vector<OpNames> _graphs;
+
+  // Used by the writer thread only, or by users while it is not running
+  std::vector<OpNames> _graph_snapshot;
+  std::string _workspace_dir;
+  std::ofstream _os;
+  size_t _file_bytes = 0;
+  uint32_t _file_count = 0;
+  // Dropped by retired buffers, and by live buffers before the start
+  uint64_t _dropped = 0;
+  uint64_t _dropped_base = 0;
+  std::unordered_map<const backend::Backend *, std::string> _backend_ids;
+  // _stats[backend id][(graph id, session, subgraph, operation)]
+  using StatKey = std::tuple<uint32_t, uint32_t, uint32_t, uint32_t>;
+  std::map<std::string, std::map<StatKey, Stat>> _stats;
+  // Operations waiting for their subgraph run, by (graph id, session, subgraph)
+  using GraphKey = std::tuple<uint32_t, uint32_t, uint32_t>;
+  std::ofstream _table_os;
+  std::map<GraphKey, std::vector<TraceEvent>> _table_ops;
+  // Subgraph runs whose operations on other threads may not be drained yet
+  std::vector<TraceEvent> _table_graphs;
+  uint32_t _table_count = 0;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_TRACE_WRITER_H__
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TraceWriter.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace onert::util;
+
+namespace
+{
+
+std::string makeTempDir()
+{
+  char dir[] = "/tmp/trace_writer_test.XXXXXX";
+  if (mkdtemp(dir) == nullptr)
+    throw std::runtime_error{"Cannot create a temporary directory"};
+  return dir;
+}
+
+std::string readFile(const std::string &path)
+{
+  std::ifstream ifs{path};
+  std::stringstream ss;
+  ss << ifs.rdbuf();
+  return ss.str();
+}
+
+TraceEvent makeSubgEvent(uint32_t graph_id, uint64_t begin_us)
+{
+  return TraceEvent{begin_us, begin_us + 1, 0, nullptr, graph_id, 0, 0, TraceEvent::kSubgraph};
+}
+
+} // namespace
+
+TEST(TraceWriter, write_files)
+{
+  const auto dir = makeTempDir();
+  auto &writer = TraceWriter::get();
+  const auto graph_id = writer.registerGraph({"op"});
+
+  writer.startToUse(dir);
+  ASSERT_TRUE(writer.threadBuffer().push(makeSubgEvent(graph_id, 10)));
+  writer.finishToUse();
+
+  ASSERT_NE(readFile(dir + "/trace.chrome.json").find("\"ph\" : \"X\""), std::string::npos);
+  ASSERT_NE(readFile(dir + "/trace.table.md").find("# Session: 0, Subgraph: 0, Running count: 0"),
+            std::string::npos);
+  ASSERT_NE(readFile(dir + "/trace.json").find("Execution_Data"), std::string::npos);
+  ASSERT_EQ(writer.droppedEvents(), 0u);
+}
+
+TEST(TraceWriter, concurrent_start_finish)
+{
+  constexpr int kThreads = 8;
+  constexpr int kUses = 50;
+  const auto dir = makeTempDir();
+  auto &writer = TraceWriter::get();
+  const auto graph_id = writer.registerGraph({"op"});
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t)
+  {
+    threads.emplace_back([&]() {
+      for (int i = 0; i < kUses; ++i)
+      {
+        writer.startToUse(dir);
+        writer.threadBuffer().push(makeSubgEvent(graph_id, i));
+        writer.finishToUse();
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  // The writer is still usable after all
+  writer.startToUse(dir);
+  ASSERT_TRUE(writer.threadBuffer().push(makeSubgEvent(graph_id, 0)));
+  writer.finishToUse();
+  ASSERT_NE(readFile(dir + "/trace.json").find("Execution_Data"), std::string::npos);
+  ASSERT_EQ(writer.droppedEvents(), 0u);
+}
+
+TEST(TraceWriter, neg_dropped_events)
+{
+  const auto dir = makeTempDir();
+  auto &writer = TraceWriter::get();
+  const auto graph_id = writer.registerGraph({"op"});
+
+  // Pushes faster than the writer drains, from a thread which exits before the finish
+  uint64_t failed = 0;
+  writer.startToUse(dir);
+  std::thread producer{[&]() {
+    for (size_t i = 0; i < 4 * TraceWriter::kBufferEvents; ++i)
+      if (!writer.threadBuffer().push(makeSubgEvent(graph_id, i)))
+        ++failed;
+  }};
+  producer.join();
+  writer.finishToUse();
+  ASSERT_EQ(writer.droppedEvents(), failed);
+
+  // Dropped events are counted again from the next start
+  writer.startToUse(dir);
+  ASSERT_TRUE(writer.threadBuffer().push(makeSubgEvent(graph_id, 0)));
+  writer.finishToUse();
+  ASSERT_EQ(writer.droppedEvents(), 0u);
+}
@@ -18,6 +18,7 @@
 #include "MinMaxReader.h"
 
 #include <luci/IR/CircleNode.h>
+#include <luci/IR/CircleNodes.h>
 #include <luci/IR/CircleQuantParam.h>
 #include <luci/Profile/CircleNodeID.h>
 #include <luci/Service/Validate.h>
@@ -64,6 +65,56 @@ float getNthPercentile(std::vector<float> &vector, float percentile)
   return res;
 }
 
+template <typename OUT>
+bool findOutput(const luci::CircleNode *node, const luci::CircleNode *&op, uint32_t &output_idx)
+{
+  const auto out = dynamic_cast<const OUT *>(node);
+  if (out == nullptr)
+    return false;
+
+  op = loco::must_cast<const luci::CircleNode *>(out->input());
+  output_idx = static_cast<uint32_t>(out->index());
+  return true;
+}
+
+// Operations with multiple outputs are represented with virtual output nodes
+bool findVirtualOutput(const luci::CircleNode *node, const luci::CircleNode *&op,
+                       uint32_t &output_idx)
+{
+  return findOutput<luci::CircleSplitOut>(node, op, output_idx) ||
+         findOutput<luci::CircleSplitVOut>(node, op, output_idx) ||
+         findOutput<luci::CircleTopKV2Out>(node, op, output_idx) ||
+         findOutput<luci::CircleUnpackOut>(node, op, output_idx) ||
+         findOutput<luci::CircleUniqueOut>(node, op, output_idx) ||
+         findOutput<luci::CircleCustomOut>(node, op, output_idx) ||
+         findOutput<luci::CircleBidirectionalSequenceLSTMOut>(node, op, output_idx);
+}
+
+/**
+ * @brief Find the operation and its output index which produces the node
+ *
+ * @return false if the node is not an output of operation (e.g. input/const/output)
+ */
+bool findProducer(const luci::CircleNode *node, const luci::CircleNode *&op, uint32_t &output_idx)
+{
+  if (findVirtualOutput(node, op, output_idx))
+    return luci::has_node_id(op);
+
+  // Skip operations with multiple outputs, which are handled with their virtual output nodes
+  for (auto succ : loco::succs(node))
+  {
+    const luci::CircleNode *succ_op = nullptr;
+    uint32_t succ_idx = 0;
+    if (findVirtualOutput(loco::must_cast<const luci::CircleNode *>(succ), succ_op, succ_idx) &&
+        succ_op == node)
+      return false;
+  }
+
+  op = node;
+  output_idx = 0;
+  return luci::has_node_id(node);
+}
+
 } // namespace
 
 namespace onert
@@ -108,10 +159,15 @@ void Embedder::embed(luci::Module *module, const std::string &minmax_path,
     for (uint32_t i = 0; i < n_nodes; ++i)
     {
       auto node = loco::must_cast<luci::CircleNode *>(graph->nodes()->at(i));
-      if (not luci::has_node_id(node)) // Skip non-op nodes (e.g. input/const/output)
+      const luci::CircleNode *op = nullptr;
+      uint32_t output_idx = 0;
+      if (not findProducer(node, op, output_idx)) // Skip non-op nodes (e.g. input/const/output)
+        continue;
+      auto op_idx = luci::get_node_id(op);
+      auto minmax = mmr.readOP(0, idx, op_idx, output_idx);
+      // Skip outputs not recorded (e.g. non-float outputs)
+      if (minmax.min_vector.empty())
         continue;
-      auto op_idx = luci::get_node_id(node);
-      auto minmax = mmr.readOP(0, idx, op_idx);
       auto min = getNthPercentile(minmax.min_vector, opt.min_percentile);
       auto max = getNthPercentile(minmax.max_vector, opt.max_percentile);
       auto quantparam = std::make_unique<luci::CircleQuantParam>();
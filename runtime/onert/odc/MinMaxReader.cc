@@ -41,13 +41,16 @@ void seekMMFile(FILE *fp, int64_t offset, int whence, const std::string &err_msg
   }
 }
 
-void checkHeader(FILE *file)
+// Returns version of the file
+uint32_t checkHeader(FILE *file)
 {
   // Check magic code and version
   // Match with runtime/onert/core/src/exec/MinMaxData.cc
   // TODO Use util to share code and version
   const uint32_t MAGIC_CODE = 0x4F4D4D44;
-  const uint32_t VERSION = 1;
+  // Version 1 does not have output id of operations
+  const uint32_t MIN_VERSION = 1;
+  const uint32_t VERSION = 2;
   {
     uint32_t read_magic_code = 0;
     uint32_t read_version = 0;
@@ -62,14 +65,22 @@ void checkHeader(FILE *file)
       throw std::runtime_error{"MinMaxReader: Invalid magic code"};
     }
 
-    if (read_version != VERSION)
+    if (read_version < MIN_VERSION || read_version > VERSION)
     {
       std::fclose(file);
       throw std::runtime_error{"MinMaxReader: Invalid version"};
     }
+
+    return read_version;
   }
 }
 
+// Size of a minmax record of operation or input except for min/max
+int64_t indexSize(uint32_t version, bool is_op)
+{
+  return sizeof(uint32_t) * ((is_op && version >= 2) ? 4 : 3);
+}
+
 } // namespace
 
 namespace onert
@@ -82,15 +93,15 @@ MinMaxReader::MinMaxReader(const std::string &filepath) : _filepath(filepath)
   // DO NOTHING
 }
 
-// TODO: Handle multiple output
-MinMaxVectors MinMaxReader::readOP(uint32_t model_idx, uint32_t subg_idx, uint32_t op_idx) const
+MinMaxVectors MinMaxReader::readOP(uint32_t model_idx, uint32_t subg_idx, uint32_t op_idx,
+                                   uint32_t output_idx) const
 {
   // Find file to read
   auto file = std::fopen(_filepath.c_str(), "rb");
   if (!file)
     throw std::runtime_error("Cannot open file: " + _filepath);
 
-  checkHeader(file);
+  const auto version = checkHeader(file);
 
   // Read num_run
   uint32_t num_run = 0;
@@ -98,7 +109,8 @@ MinMaxVectors MinMaxReader::readOP(uint32_t model_idx, uint32_t subg_idx, uint32
 
   MinMaxVectors mmv;
   float minmax[2];
-  const int64_t data_size = sizeof(float) * 2 + sizeof(uint32_t) * 3;
+  const int64_t data_size = sizeof(float) * 2 + indexSize(version, true);
+  const int64_t input_data_size = sizeof(float) * 2 + indexSize(version, false);
 
   // Check num_run overflow
   if (num_run > std::numeric_limits<uint32_t>::max() / data_size)
@@ -125,13 +137,17 @@ MinMaxVectors MinMaxReader::readOP(uint32_t model_idx, uint32_t subg_idx, uint32
       uint32_t model_id_from_file = 0;
       uint32_t subg_idx_from_file = 0;
       uint32_t op_idx_from_file = 0;
+      uint32_t output_idx_from_file = 0;
 
       readMMFile(&model_id_from_file, sizeof(uint32_t), 1, file, "Cannot read model_id from file");
       readMMFile(&subg_idx_from_file, sizeof(uint32_t), 1, file, "Cannot read subg_idx from file");
       readMMFile(&op_idx_from_file, sizeof(uint32_t), 1, file, "Cannot read op_idx from file");
+      if (version >= 2)
+        readMMFile(&output_idx_from_file, sizeof(uint32_t), 1, file,
+                   "Cannot read output_idx from file");
 
       if (model_id_from_file == model_idx && subg_idx_from_file == subg_idx &&
-          op_idx_from_file == op_idx)
+          op_idx_from_file == op_idx && output_idx_from_file == output_idx)
       {
         // Read minmax data
         readMMFile(minmax, sizeof(float), 2, file, "Cannot read minmax data from file");
@@ -151,7 +167,7 @@ MinMaxVectors MinMaxReader::readOP(uint32_t model_idx, uint32_t subg_idx, uint32
     }
 
     // Skip input minmax data
-    seekMMFile(file, static_cast<int64_t>(data_size * num_input), SEEK_CUR,
+    seekMMFile(file, static_cast<int64_t>(input_data_size * num_input), SEEK_CUR,
                "Failed to skip input minmax data");
   }
 
@@ -167,7 +183,7 @@ MinMaxVectors MinMaxReader::readInput(uint32_t model_idx, uint32_t subg_idx,
   if (!file)
     throw std::runtime_error("Cannot open file: " + _filepath);
 
-  checkHeader(file);
+  const auto version = checkHeader(file);
 
   // Read num_run
   uint32_t num_run = 0;
@@ -175,7 +191,8 @@ MinMaxVectors MinMaxReader::readInput(uint32_t model_idx, uint32_t subg_idx,
 
   MinMaxVectors mmv;
   float minmax[2];
-  const int64_t data_size = sizeof(float) * 2 + sizeof(uint32_t) * 3;
+  const int64_t data_size = sizeof(float) * 2 + indexSize(version, false);
+  const int64_t op_data_size = sizeof(float) * 2 + indexSize(version, true);
 
   // Check num_run overflow
   if (num_run > std::numeric_limits<uint32_t>::max() / data_size)
@@ -197,7 +214,7 @@ MinMaxVectors MinMaxReader::readInput(uint32_t model_idx, uint32_t subg_idx,
       throw std::runtime_error("num_input overflow");
 
     // Skip operation minmax data
-    seekMMFile(file, static_cast<int64_t>(data_size * num_op), SEEK_CUR,
+    seekMMFile(file, static_cast<int64_t>(op_data_size * num_op), SEEK_CUR,
                "Cannot skip operation minmax data");
 
     // Find operation
@@ -35,10 +35,11 @@ namespace odc
 // uint32_t num of operations
 // uint32_t num of inputs
 
-// For each operation
+// For each operation output
 // uint32_t model id
 // uint32_t subgraph id
 // uint32_t operation id
+// uint32_t output id (since version 2)
 // float min
 // float max
 
@@ -60,11 +61,12 @@ class MinMaxReader
 public:
   MinMaxReader(const std::string &filepath);
   /**
-   * @brief Returns minmax recording for op {model_idx, subg_idx, op_idx}
+   * @brief Returns minmax recording for output {output_idx} of op {model_idx, subg_idx, op_idx}
    *
    * @return MinMaxVectors
    */
-  MinMaxVectors readOP(uint32_t model_idx, uint32_t subg_idx, uint32_t op_idx) const;
+  MinMaxVectors readOP(uint32_t model_idx, uint32_t subg_idx, uint32_t op_idx,
+                       uint32_t output_idx = 0) const;
   /**
    * @brief Returns minmax recording for input {model_idx, subg_idx, input_idx}
    *
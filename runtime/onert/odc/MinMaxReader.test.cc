@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxReader.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <vector>
+
+using namespace onert::odc;
+
+namespace
+{
+
+const uint32_t MAGIC_CODE = 0x4F4D4D44;
+
+struct OpRecord
+{
+  uint32_t subg;
+  uint32_t op;
+  uint32_t output;
+  float min;
+  float max;
+};
+
+struct InputRecord
+{
+  uint32_t subg;
+  uint32_t input;
+  float min;
+  float max;
+};
+
+struct RunRecords
+{
+  std::vector<OpRecord> ops;
+  std::vector<InputRecord> inputs;
+};
+
+// Writes runs in the format of MinMaxReader.h, without output ids of operations for version 1
+void writeMinMaxFile(const std::string &path, uint32_t version,
+                     const std::vector<RunRecords> &runs, uint32_t magic_code = MAGIC_CODE)
+{
+  auto file = std::fopen(path.c_str(), "wb");
+  ASSERT_NE(file, nullptr);
+
+  auto write_u32 = [&](uint32_t value) { std::fwrite(&value, sizeof(uint32_t), 1, file); };
+  auto write_float = [&](float value) { std::fwrite(&value, sizeof(float), 1, file); };
+
+  const uint32_t model = 0;
+  write_u32(magic_code);
+  write_u32(version);
+  write_u32(runs.size());
+  for (const auto &run : runs)
+  {
+    write_u32(run.ops.size());
+    write_u32(run.inputs.size());
+    for (const auto &rec : run.ops)
+    {
+      write_u32(model);
+      write_u32(rec.subg);
+      write_u32(rec.op);
+      if (version >= 2)
+        write_u32(rec.output);
+      write_float(rec.min);
+      write_float(rec.max);
+    }
+    for (const auto &rec : run.inputs)
+    {
+      write_u32(model);
+      write_u32(rec.subg);
+      write_u32(rec.input);
+      write_float(rec.min);
+      write_float(rec.max);
+    }
+  }
+  std::fclose(file);
+}
+
+class odc_MinMaxReader : public ::testing::Test
+{
+protected:
+  void SetUp() override { _path = ::testing::TempDir() + "odc_minmax_reader.bin"; }
+  void TearDown() override { std::remove(_path.c_str()); }
+
+  // Two runs of an operation with two outputs and a single output operation
+  std::vector<RunRecords> runs(void) const
+  {
+    RunRecords run0;
+    run0.ops = {{0, 3, 0, -1.f, 1.f}, {0, 3, 1, -2.f, 2.f}, {0, 5, 0, -3.f, 3.f}};
+    run0.inputs = {{0, 0, -4.f, 4.f}, {0, 1, -5.f, 5.f}};
+
+    // Records may be in any order
+    RunRecords run1;
+    run1.ops = {{0, 5, 0, -30.f, 30.f}, {0, 3, 1, -20.f, 20.f}, {0, 3, 0, -10.f, 10.f}};
+    run1.inputs = {{0, 1, -50.f, 50.f}, {0, 0, -40.f, 40.f}};
+
+    return {run0, run1};
+  }
+
+  std::string _path;
+};
+
+} // namespace
+
+TEST_F(odc_MinMaxReader, readOP_v2)
+{
+  writeMinMaxFile(_path, 2, runs());
+  MinMaxReader reader(_path);
+
+  auto mmv = reader.readOP(0, 0, 3, 0);
+  EXPECT_EQ(mmv.min_vector, std::vector<float>({-1.f, -10.f}));
+  EXPECT_EQ(mmv.max_vector, std::vector<float>({1.f, 10.f}));
+
+  mmv = reader.readOP(0, 0, 3, 1);
+  EXPECT_EQ(mmv.min_vector, std::vector<float>({-2.f, -20.f}));
+  EXPECT_EQ(mmv.max_vector, std::vector<float>({2.f, 20.f}));
+
+  mmv = reader.readOP(0, 0, 5);
+  EXPECT_EQ(mmv.min_vector, std::vector<float>({-3.f, -30.f}));
+  EXPECT_EQ(mmv.max_vector, std::vector<float>({3.f, 30.f}));
+}
+
+TEST_F(odc_MinMaxReader, readInput_v2)
+{
+  writeMinMaxFile(_path, 2, runs());
+  MinMaxReader reader(_path);
+
+  auto mmv = reader.readInput(0, 0, 0);
+  EXPECT_EQ(mmv.min_vector, std::vector<float>({-4.f, -40.f}));
+  EXPECT_EQ(mmv.max_vector, std::vector<float>({4.f, 40.f}));
+
+  mmv = reader.readInput(0, 0, 1);
+  EXPECT_EQ(mmv.min_vector, std::vector<float>({-5.f, -50.f}));
+  EXPECT_EQ(mmv.max_vector, std::vector<float>({5.f, 50.f}));
+}
+
+TEST_F(odc_MinMaxReader, read_v1)
+{
+  // Version 1 records the first output of operations only
+  auto v1_runs = runs();
+  for (auto &run : v1_runs)
+  {
+    std::vector<OpRecord> ops;
+    for (const auto &rec : run.ops)
+      if (rec.output == 0)
+        ops.emplace_back(rec);
+    run.ops = ops;
+  }
+  writeMinMaxFile(_path, 1, v1_runs);
+  MinMaxReader reader(_path);
+
+  auto mmv = reader.readOP(0, 0, 3);
+  EXPECT_EQ(mmv.min_vector, std::vector<float>({-1.f, -10.f}));
+  EXPECT_EQ(mmv.max_vector, std::vector<float>({1.f, 10.f}));
+
+  mmv = reader.readInput(0, 0, 1);
+  EXPECT_EQ(mmv.min_vector, std::vector<float>({-5.f, -50.f}));
+  EXPECT_EQ(mmv.max_vector, std::vector<float>({5.f, 50.f}));
+}
+
+TEST_F(odc_MinMaxReader, neg_not_recorded)
+{
+  writeMinMaxFile(_path, 2, runs());
+  MinMaxReader reader(_path);
+
+  EXPECT_TRUE(reader.readOP(0, 0, 3, 2).min_vector.empty());
+  EXPECT_TRUE(reader.readOP(0, 1, 3, 0).min_vector.empty());
+  EXPECT_TRUE(reader.readInput(0, 0, 2).min_vector.empty());
+}
+
+TEST_F(odc_MinMaxReader, neg_invalid_header)
+{
+  writeMinMaxFile(_path, 2, runs(), 0);
+  EXPECT_ANY_THROW(MinMaxReader(_path).readOP(0, 0, 3));
+
+  writeMinMaxFile(_path, 3, runs());
+  EXPECT_ANY_THROW(MinMaxReader(_path).readOP(0, 0, 3));
+  EXPECT_ANY_THROW(MinMaxReader(_path).readInput(0, 0, 0));
+}
+
+TEST_F(odc_MinMaxReader, neg_no_file)
+{
+  MinMaxReader reader(_path);
+  EXPECT_ANY_THROW(reader.readOP(0, 0, 3));
+  EXPECT_ANY_THROW(reader.readInput(0, 0, 0));
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file This file measures nnfw_prepare latency of synthetic large graphs.
+ *
+ * Usage: nnfw_api_prepare_benchmark [num_ops] [repeat] [executor...]
+ */
+
+#include "CircleGen.h"
+
+#include <nnfw.h>
+#include <nnfw_experimental.h>
+#include <nnfw_internal.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// A chain of Add operations whose rhs are all constants
+//
+// (( Input )) -> [ Add ] -> [ Add ] -> ... -> [ Add ] -> (( Output ))
+CircleBuffer genAddChainModel(int num_ops)
+{
+  CircleGen cgen;
+  uint32_t rhs_buf = cgen.addBuffer(std::vector<float>{1, 2, 3, 4});
+  int rhs = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32, rhs_buf});
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int lhs = in;
+  for (int i = 0; i < num_ops; ++i)
+  {
+    int out = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+    cgen.addOperatorAdd({{lhs, rhs}, {out}}, circle::ActivationFunctionType_NONE);
+    lhs = out;
+  }
+  cgen.setInputsAndOutputs({in}, {lhs});
+  return cgen.finish();
+}
+
+#define NNPR_ENSURE_STATUS(a)                                           \
+  do                                                                    \
+  {                                                                     \
+    if ((a) != NNFW_STATUS_NO_ERROR)                                    \
+    {                                                                   \
+      std::cerr << "Error: " #a " failed at line " << __LINE__ << "\n"; \
+      std::exit(1);                                                     \
+    }                                                                   \
+  } while (0)
+
+// Returns elapsed time of nnfw_prepare in milliseconds
+double measurePrepare(const CircleBuffer &cbuf, const std::string &executor)
+{
+  nnfw_session *session = nullptr;
+  NNPR_ENSURE_STATUS(nnfw_create_session(&session));
+  NNPR_ENSURE_STATUS(nnfw_load_circle_from_buffer(session, cbuf.buffer(), cbuf.size()));
+  NNPR_ENSURE_STATUS(nnfw_set_available_backends(session, "cpu"));
+  NNPR_ENSURE_STATUS(nnfw_set_config(session, "EXECUTOR", executor.c_str()));
+
+  const auto begin = std::chrono::steady_clock::now();
+  NNPR_ENSURE_STATUS(nnfw_prepare(session));
+  const auto end = std::chrono::steady_clock::now();
+
+  NNPR_ENSURE_STATUS(nnfw_close_session(session));
+  return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  const int num_ops = argc > 1 ? std::atoi(argv[1]) : 5000;
+  const int repeat = argc > 2 ? std::atoi(argv[2]) : 5;
+  std::vector<std::string> executors;
+  for (int i = 3; i < argc; ++i)
+    executors.emplace_back(argv[i]);
+  if (executors.empty())
+    executors = {"Linear", "Dataflow", "Parallel"};
+
+  if (num_ops <= 0 || repeat <= 0)
+  {
+    std::cerr << "Usage: " << argv[0] << " [num_ops] [repeat] [executor...]" << std::endl;
+    return 1;
+  }
+
+  const auto cbuf = genAddChainModel(num_ops);
+  std::cout << "nnfw_prepare of " << num_ops << " Add ops, " << repeat << " times" << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+  for (const auto &executor : executors)
+  {
+    // The first prepare warms up allocators and backend loading
+    measurePrepare(cbuf, executor);
+
+    std::vector<double> elapsed;
+    for (int i = 0; i < repeat; ++i)
+      elapsed.emplace_back(measurePrepare(cbuf, executor));
+    std::sort(elapsed.begin(), elapsed.end());
+
+    double sum = 0;
+    for (auto ms : elapsed)
+      sum += ms;
+    std::cout << std::left << std::setw(10) << executor << std::right << " min "
+              << std::setw(10) << elapsed.front() << " ms, median " << std::setw(10)
+              << elapsed[elapsed.size() / 2] << " ms, mean " << std::setw(10) << sum / repeat
+              << " ms, max " << std::setw(10) << elapsed.back() << " ms" << std::endl;
+  }
+  return 0;
+}
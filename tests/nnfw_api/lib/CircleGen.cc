@@ -531,6 +531,13 @@ uint32_t CircleGen::addOperatorTile(const OperatorParams &params)
                                 circle::BuiltinOptions_TileOptions, options);
 }
 
+uint32_t CircleGen::addOperatorTopKV2(const OperatorParams &params)
+{
+  auto options = circle::CreateTopKV2Options(_fbb).Union();
+  return addOperatorWithOptions(params, circle::BuiltinOperator_TOPK_V2,
+                                circle::BuiltinOptions_TopKV2Options, options);
+}
+
 uint32_t CircleGen::addOperatorWhile(const OperatorParams &params, uint32_t cond_subg,
                                      uint32_t body_subg)
 {
@@ -582,6 +589,23 @@ uint32_t CircleGen::addOperatorBatchToSpaceND(const OperatorParams &params)
                                 circle::BuiltinOptions_BatchToSpaceNDOptions, options);
 }
 
+uint32_t CircleGen::addOperatorBCQFullyConnected(const OperatorParams &params,
+                                                 int32_t weights_hidden_size,
+                                                 circle::ActivationFunctionType actfn)
+{
+  auto options = circle::CreateBCQFullyConnectedOptions(_fbb, weights_hidden_size, actfn).Union();
+  return addOperatorWithOptions(params, circle::BuiltinOperator_BCQ_FULLY_CONNECTED,
+                                circle::BuiltinOptions_BCQFullyConnectedOptions, options);
+}
+
+uint32_t CircleGen::addOperatorBCQGather(const OperatorParams &params, int32_t input_hidden_size,
+                                         int32_t axis)
+{
+  auto options = circle::CreateBCQGatherOptions(_fbb, input_hidden_size, axis).Union();
+  return addOperatorWithOptions(params, circle::BuiltinOperator_BCQ_GATHER,
+                                circle::BuiltinOptions_BCQGatherOptions, options);
+}
+
 // NOTE Please add addOperator functions ABOVE this lie
 //
 // %  How to add a new addOperatorXXX fuction
@@ -148,6 +148,10 @@ public:
                                     int stride_w, int stride_h, int filter_w, int filter_h,
                                     circle::ActivationFunctionType actfn);
   uint32_t addOperatorBatchToSpaceND(const OperatorParams &params);
+  uint32_t addOperatorBCQFullyConnected(const OperatorParams &params, int32_t weights_hidden_size,
+                                        circle::ActivationFunctionType actfn);
+  uint32_t addOperatorBCQGather(const OperatorParams &params, int32_t input_hidden_size,
+                                int32_t axis);
   uint32_t addOperatorCast(const OperatorParams &params, circle::TensorType input_type,
                            circle::TensorType output_type);
   uint32_t addOperatorConcatenation(const OperatorParams &params, int axis,
@@ -225,6 +229,7 @@ public:
                                    int32_t new_axis_mask = 0, int32_t shrink_axis_mask = 0);
   uint32_t addOperatorSub(const OperatorParams &params, circle::ActivationFunctionType actfn);
   uint32_t addOperatorTile(const OperatorParams &params);
+  uint32_t addOperatorTopKV2(const OperatorParams &params);
   uint32_t addOperatorTranspose(const OperatorParams &params);
   uint32_t addOperatorWhile(const OperatorParams &params, uint32_t cond_subg, uint32_t body_subg);
 
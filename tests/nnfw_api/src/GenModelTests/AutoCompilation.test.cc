@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file This file contains test cases of auto compilation through the session API.
+ */
+
+#include "fixtures.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+// (( Input )) -> [ FullyConnected ] -> (( Output ))
+//
+// Weights are constant so that weight-only quantization applies
+CircleBuffer genFullyConnectedModel()
+{
+  CircleGen cgen;
+  uint32_t weight_buf = cgen.addBuffer(std::vector<float>{1, 0, -1, 0.5, 0.25, -0.5, 1, 2});
+  uint32_t bias_buf = cgen.addBuffer(std::vector<float>{1, 0});
+  int in = cgen.addTensor({{1, 4}, circle::TensorType::TensorType_FLOAT32});
+  int weight = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32, weight_buf});
+  int bias = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32, bias_buf});
+  int out = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorFullyConnected({{in, weight, bias}, {out}});
+  cgen.setInputsAndOutputs({in}, {out});
+  return cgen.finish();
+}
+
+std::vector<float> expectedOutput(const std::vector<float> &input)
+{
+  return {1 + input[0] - input[2] + 0.5f * input[3],
+          0.25f * input[0] - 0.5f * input[1] + input[2] + 2 * input[3]};
+}
+
+/**
+ * @brief Workspace directory with a model file, removed at the end of a test
+ */
+class Workspace
+{
+public:
+  Workspace(const CircleBuffer &cbuf)
+  {
+    std::string templ = ::testing::TempDir() + "nnfw_auto_compilation_XXXXXX";
+    if (mkdtemp(&templ[0]) == nullptr)
+      throw std::runtime_error{"Failed to create workspace"};
+    _dir = templ;
+
+    std::ofstream file(modelPath(), std::ios::binary);
+    file.write(reinterpret_cast<const char *>(cbuf.buffer()), cbuf.size());
+  }
+
+  ~Workspace()
+  {
+    for (const auto &path : {modelPath(), quantizedPath(), probePath(), _dir + "/minmax.bin"})
+      std::remove(path.c_str());
+    rmdir(_dir.c_str());
+  }
+
+  const std::string &dir() const { return _dir; }
+  std::string modelPath() const { return _dir + "/model.circle"; }
+  std::string quantizedPath() const { return _dir + "/model.q.circle"; }
+  std::string probePath() const { return _dir + "/probe.q.circle"; }
+
+private:
+  std::string _dir;
+};
+
+// On-device quantizer is an optional library, so check if it works before the test
+bool quantizerAvailable(const Workspace &ws)
+{
+  nnfw_session *session = nullptr;
+  if (nnfw_create_session(&session) != NNFW_STATUS_NO_ERROR)
+    return false;
+  bool available =
+    nnfw_load_model_from_file(session, ws.modelPath().c_str()) == NNFW_STATUS_NO_ERROR &&
+    nnfw_set_quantization_type(session, NNFW_QUANTIZE_TYPE_WO_I8_SYM) == NNFW_STATUS_NO_ERROR &&
+    nnfw_set_quantized_model_path(session, ws.probePath().c_str()) == NNFW_STATUS_NO_ERROR &&
+    nnfw_quantize(session) == NNFW_STATUS_NO_ERROR;
+  nnfw_close_session(session);
+  return available;
+}
+
+void expectNear(const std::vector<float> &actual, const std::vector<float> &expected)
+{
+  ASSERT_EQ(actual.size(), expected.size());
+  // Weight-only int8 quantization keeps values close to float results
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_NEAR(actual[i], expected[i], 0.05f) << "at " << i;
+}
+
+} // namespace
+
+TEST_F(ValidationTestSessionCreated, auto_compilation_swap)
+{
+  auto cbuf = genFullyConnectedModel();
+  Workspace ws(cbuf);
+  if (!quantizerAvailable(ws))
+    GTEST_SKIP() << "On-device quantizer is not available";
+
+  NNFW_ENSURE_SUCCESS(nnfw_set_workspace(_session, ws.dir().c_str()));
+  NNFW_ENSURE_SUCCESS(nnfw_load_model_from_file(_session, ws.modelPath().c_str()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_quantization_type(_session, NNFW_QUANTIZE_TYPE_WO_I8_SYM));
+  NNFW_ENSURE_SUCCESS(nnfw_set_quantized_model_path(_session, ws.quantizedPath().c_str()));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+
+  std::vector<float> input{1, 2, 3, 4};
+  std::vector<float> output(2);
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, input.data(),
+                                     input.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                                      output.size() * sizeof(float)));
+
+  NNFW_ENSURE_SUCCESS(nnfw_set_odc_param_minmax_records_count(_session, 2));
+  NNFW_ENSURE_SUCCESS(nnfw_set_auto_compilation(_session, nullptr, NNFW_CODEGEN_PREF_DEFAULT));
+
+  // Recording runs use the original model
+  int done = 0;
+  for (int i = 0; i < 2; ++i)
+  {
+    NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+    expectNear(output, expectedOutput(input));
+    NNFW_ENSURE_SUCCESS(nnfw_auto_compilation_done(_session, &done));
+    ASSERT_EQ(done, 0);
+  }
+
+  // Compiled executors replace the original ones at the start of a run after compilation
+  for (int i = 0; i < 500 && done == 0; ++i)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+    expectNear(output, expectedOutput(input));
+    NNFW_ENSURE_SUCCESS(nnfw_auto_compilation_done(_session, &done));
+  }
+  ASSERT_EQ(done, 1);
+
+  // Buffers set before the swap are still used without another prepare or set_input
+  input = {-1, 0.5, 2, -3};
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+  expectNear(output, expectedOutput(input));
+}
+
+// Session is closed or its model is replaced while the model is compiled in background
+TEST_F(ValidationTestSessionCreated, auto_compilation_interrupted)
+{
+  auto cbuf = genFullyConnectedModel();
+  Workspace ws(cbuf);
+  if (!quantizerAvailable(ws))
+    GTEST_SKIP() << "On-device quantizer is not available";
+
+  std::vector<float> input{1, 2, 3, 4};
+  std::vector<float> output(2);
+  auto startCompilation = [&](nnfw_session *session) {
+    NNFW_ENSURE_SUCCESS(nnfw_set_workspace(session, ws.dir().c_str()));
+    NNFW_ENSURE_SUCCESS(nnfw_load_model_from_file(session, ws.modelPath().c_str()));
+    NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+    NNFW_ENSURE_SUCCESS(nnfw_set_quantization_type(session, NNFW_QUANTIZE_TYPE_WO_I8_SYM));
+    NNFW_ENSURE_SUCCESS(nnfw_set_quantized_model_path(session, ws.quantizedPath().c_str()));
+    NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+    NNFW_ENSURE_SUCCESS(nnfw_set_input(session, 0, NNFW_TYPE_TENSOR_FLOAT32, input.data(),
+                                       input.size() * sizeof(float)));
+    NNFW_ENSURE_SUCCESS(nnfw_set_output(session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                                        output.size() * sizeof(float)));
+    NNFW_ENSURE_SUCCESS(nnfw_set_odc_param_minmax_records_count(session, 1));
+    NNFW_ENSURE_SUCCESS(nnfw_set_auto_compilation(session, nullptr, NNFW_CODEGEN_PREF_DEFAULT));
+    // Compilation starts in background after the recording run
+    NNFW_ENSURE_SUCCESS(nnfw_run(session));
+  };
+
+  // Closing session waits for the background thread that uses the session
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  startCompilation(session);
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+
+  // Replaced model is not swapped with executors compiled for the previous model
+  startCompilation(_session);
+  for (int i = 0; i < 500; ++i)
+  {
+    NNFW_STATUS status = nnfw_quantize(_session);
+    if (status == NNFW_STATUS_NO_ERROR)
+      break;
+    ASSERT_EQ(status, NNFW_STATUS_INVALID_STATE);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  int done = 1;
+  NNFW_ENSURE_SUCCESS(nnfw_auto_compilation_done(_session, &done));
+  ASSERT_EQ(done, 0);
+}
+
+TEST_F(ValidationTestSessionCreated, neg_auto_compilation_not_prepared)
+{
+  auto cbuf = genFullyConnectedModel();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(_session, cbuf.buffer(), cbuf.size()));
+
+  ASSERT_EQ(nnfw_set_auto_compilation(_session, nullptr, NNFW_CODEGEN_PREF_DEFAULT),
+            NNFW_STATUS_INVALID_STATE);
+}
+
+TEST_F(ValidationTestSessionCreated, neg_auto_compilation_no_workspace)
+{
+  auto cbuf = genFullyConnectedModel();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(_session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+
+  // Neither workspace nor quantized model path is set
+  ASSERT_EQ(nnfw_set_auto_compilation(_session, nullptr, NNFW_CODEGEN_PREF_DEFAULT),
+            NNFW_STATUS_ERROR);
+  int done = 1;
+  NNFW_ENSURE_SUCCESS(nnfw_auto_compilation_done(_session, &done));
+  ASSERT_EQ(done, 0);
+}
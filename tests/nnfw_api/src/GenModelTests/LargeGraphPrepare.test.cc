@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file This file contains test cases that prepare and run large graphs with each executor.
+ */
+
+#include "fixtures.h"
+
+#include <vector>
+
+namespace
+{
+
+// A chain of Add operations whose rhs are all constants
+//
+// (( Input )) -> [ Add ] -> [ Add ] -> ... -> [ Add ] -> (( Output ))
+CircleBuffer genAddChainModel(int num_ops)
+{
+  CircleGen cgen;
+  uint32_t rhs_buf = cgen.addBuffer(std::vector<float>{1, 2, 3, 4});
+  int rhs = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32, rhs_buf});
+  int in = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+  int lhs = in;
+  for (int i = 0; i < num_ops; ++i)
+  {
+    int out = cgen.addTensor({{1, 2, 2, 1}, circle::TensorType::TensorType_FLOAT32});
+    cgen.addOperatorAdd({{lhs, rhs}, {out}}, circle::ActivationFunctionType_NONE);
+    lhs = out;
+  }
+  cgen.setInputsAndOutputs({in}, {lhs});
+  return cgen.finish();
+}
+
+// Every Add of the chain has to be compiled and run once
+void prepareAndRun(nnfw_session *session, const CircleBuffer &cbuf, const char *executor,
+                   int num_ops)
+{
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(session, "EXECUTOR", executor));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  std::vector<float> input{0, 0, 0, 0};
+  std::vector<float> output(4);
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(session, 0, NNFW_TYPE_TENSOR_FLOAT32, input.data(),
+                                     input.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                                      output.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_run(session));
+
+  const std::vector<float> expected{1.f * num_ops, 2.f * num_ops, 3.f * num_ops, 4.f * num_ops};
+  ASSERT_EQ(output, expected);
+}
+
+} // namespace
+
+TEST_F(ValidationTestSessionCreated, large_graph_prepare_Linear)
+{
+  constexpr int num_ops = 5000;
+  auto cbuf = genAddChainModel(num_ops);
+  prepareAndRun(_session, cbuf, "Linear", num_ops);
+}
+
+TEST_F(ValidationTestSessionCreated, large_graph_prepare_Dataflow)
+{
+  constexpr int num_ops = 5000;
+  auto cbuf = genAddChainModel(num_ops);
+  prepareAndRun(_session, cbuf, "Dataflow", num_ops);
+}
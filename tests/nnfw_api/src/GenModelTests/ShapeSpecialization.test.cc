@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file This file contains test cases of shape specialization through the session API.
+ */
+
+#include "fixtures.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+// (( Input )) -> [ Sum(axis = -1) ] -> (( Output ))
+//
+// Inputs of rank 5 run with dynamic shapes, but static compilation rejects them
+CircleBuffer genSumModel()
+{
+  CircleGen cgen;
+  uint32_t axis_buf = cgen.addBuffer(std::vector<int32_t>{-1});
+  int in = cgen.addTensor({{1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int axis = cgen.addTensor({{1}, circle::TensorType::TensorType_INT32, axis_buf});
+  int out = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorReduce({{in, axis}, {out}}, circle::BuiltinOperator_SUM, false);
+  cgen.setInputsAndOutputs({in}, {out});
+  return cgen.finish();
+}
+
+/**
+ * @brief Session test prepared with shape specialization after the given number of runs
+ */
+class ShapeSpecializationTest : public ValidationTestSessionCreated
+{
+protected:
+  void prepare(const char *runs)
+  {
+    _cbuf = genSumModel();
+    NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(_session, _cbuf.buffer(), _cbuf.size()));
+    NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
+    NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "SHAPE_SPECIALIZATION_RUNS", runs));
+    NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+  }
+
+  // Resizes input to the shape, runs with the given values and checks the sums of last axis
+  void run(const std::vector<int32_t> &shape, float base)
+  {
+    nnfw_tensorinfo ti = {NNFW_TYPE_TENSOR_FLOAT32, static_cast<int32_t>(shape.size()), {}};
+    int32_t size = 1;
+    for (size_t i = 0; i < shape.size(); ++i)
+    {
+      ti.dims[i] = shape[i];
+      size *= shape[i];
+    }
+    const int32_t depth = shape.back();
+
+    _input.resize(size);
+    for (int32_t i = 0; i < size; ++i)
+      _input[i] = base + i;
+    _output.assign(size / depth, 0);
+    NNFW_ENSURE_SUCCESS(nnfw_set_input_tensorinfo(_session, 0, &ti));
+    NNFW_ENSURE_SUCCESS(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, _input.data(),
+                                       _input.size() * sizeof(float)));
+    NNFW_ENSURE_SUCCESS(nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, _output.data(),
+                                        _output.size() * sizeof(float)));
+    NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+
+    for (size_t i = 0; i < _output.size(); ++i)
+    {
+      float expected = 0;
+      for (int32_t j = 0; j < depth; ++j)
+        expected += _input[i * depth + j];
+      EXPECT_FLOAT_EQ(_output[i], expected) << "at " << i;
+    }
+  }
+
+  int done()
+  {
+    int done = -1;
+    EXPECT_EQ(nnfw_shape_specialization_done(_session, &done), NNFW_STATUS_NO_ERROR);
+    return done;
+  }
+
+  // Runs until the specialized executors are used, or gives up after a while
+  int runUntilDone(const std::vector<int32_t> &shape)
+  {
+    for (int i = 0; i < 500 && done() == 0; ++i)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      run(shape, i);
+    }
+    return done();
+  }
+
+  CircleBuffer _cbuf;
+  std::vector<float> _input;
+  std::vector<float> _output;
+};
+
+} // namespace
+
+TEST_F(ShapeSpecializationTest, switch_after_runs)
+{
+  prepare("3");
+
+  // Resized inputs run with the prepared executors until they are run enough times
+  for (int i = 0; i < 3; ++i)
+  {
+    run({1, 3, 2}, i);
+    ASSERT_EQ(done(), 0);
+  }
+
+  // Specialized executors are used at the start of a run after compilation
+  ASSERT_EQ(runUntilDone({1, 3, 2}), 1);
+  run({1, 3, 2}, -10);
+  ASSERT_EQ(done(), 1);
+}
+
+TEST_F(ShapeSpecializationTest, shape_change_after_switch)
+{
+  prepare("1");
+  run({1, 3, 2}, 0);
+  ASSERT_EQ(runUntilDone({1, 3, 2}), 1);
+
+  // Prepared shapes run with the prepared executors
+  run({1, 2, 2}, 5);
+  ASSERT_EQ(done(), 0);
+
+  // Other shapes run dynamically until they are specialized too
+  run({2, 4, 3}, 1);
+  ASSERT_EQ(done(), 0);
+  ASSERT_EQ(runUntilDone({2, 4, 3}), 1);
+
+  // Executors specialized before are kept
+  run({1, 3, 2}, 7);
+  ASSERT_EQ(done(), 1);
+}
+
+TEST_F(ShapeSpecializationTest, neg_compilation_failed)
+{
+  prepare("1");
+
+  // Compilation with these shapes fails, so they keep running with the prepared executors
+  for (int i = 0; i < 50; ++i)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    run({1, 1, 1, 3, 2}, i);
+    ASSERT_EQ(done(), 0);
+  }
+
+  // Other shapes are still specialized after the failure
+  run({1, 4, 2}, 0);
+  ASSERT_EQ(runUntilDone({1, 4, 2}), 1);
+}
+
+TEST_F(ShapeSpecializationTest, neg_disabled)
+{
+  prepare("0");
+
+  for (int i = 0; i < 10; ++i)
+  {
+    run({1, 3, 2}, i);
+    ASSERT_EQ(done(), 0);
+  }
+}
+
+TEST_F(ValidationTestSessionCreated, neg_shape_specialization_config_not_loaded)
+{
+  ASSERT_EQ(nnfw_set_config(_session, "SHAPE_SPECIALIZATION_RUNS", "1"),
+            NNFW_STATUS_INVALID_STATE);
+  int done = 1;
+  ASSERT_EQ(nnfw_shape_specialization_done(_session, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+  NNFW_ENSURE_SUCCESS(nnfw_shape_specialization_done(_session, &done));
+  ASSERT_EQ(done, 0);
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file This file contains test cases of cpu operations writing results over their inputs.
+ */
+
+#include "GenModelTest.h"
+
+#include <vector>
+
+namespace
+{
+
+// (( in )) -> [ Add(+1) ] -> (( a )) -> [ Reshape ] -> [ Relu ] -> [ Reshape ] -> (( q ))
+//
+// (( q )) -> [ Mul(q, in or a) ] -> [ Reshape ] -> (( out ))
+//
+// Reshapes keep elementwise operations from being fused, so each of them runs on its own and
+// may write over the memory of its input
+CircleBuffer genChainModel(bool mul_with_a, bool output_a)
+{
+  CircleGen cgen;
+  const auto f32 = circle::TensorType::TensorType_FLOAT32;
+  const auto i32 = circle::TensorType::TensorType_INT32;
+
+  std::vector<int32_t> shape_32{3, 2};
+  std::vector<int32_t> shape_23{2, 3};
+  uint32_t one_buf = cgen.addBuffer(std::vector<float>{1, 1, 1, 1, 1, 1});
+  uint32_t shape_32_buf = cgen.addBuffer(shape_32);
+  uint32_t shape_23_buf = cgen.addBuffer(shape_23);
+
+  int in = cgen.addTensor({{2, 3}, f32});
+  int one = cgen.addTensor({{2, 3}, f32, one_buf});
+  int a = cgen.addTensor({{2, 3}, f32});
+  cgen.addOperatorAdd({{in, one}, {a}}, circle::ActivationFunctionType_NONE);
+
+  int b_shape = cgen.addTensor({{2}, i32, shape_32_buf});
+  int b = cgen.addTensor({{3, 2}, f32});
+  cgen.addOperatorReshape({{a, b_shape}, {b}}, &shape_32);
+  int r = cgen.addTensor({{3, 2}, f32});
+  cgen.addOperatorRelu({{b}, {r}});
+  int q_shape = cgen.addTensor({{2}, i32, shape_23_buf});
+  int q = cgen.addTensor({{2, 3}, f32});
+  cgen.addOperatorReshape({{r, q_shape}, {q}}, &shape_23);
+
+  int m = cgen.addTensor({{2, 3}, f32});
+  cgen.addOperatorMul({{q, mul_with_a ? a : in}, {m}}, circle::ActivationFunctionType_NONE);
+  int out_shape = cgen.addTensor({{2}, i32, shape_32_buf});
+  int out = cgen.addTensor({{3, 2}, f32});
+  cgen.addOperatorReshape({{m, out_shape}, {out}}, &shape_32);
+
+  if (output_a)
+    cgen.setInputsAndOutputs({in}, {out, a});
+  else
+    cgen.setInputsAndOutputs({in}, {out});
+  return cgen.finish();
+}
+
+} // namespace
+
+TEST_F(GenModelTest, SharedMemoryOperands_InPlaceChain)
+{
+  // The input of the model is read again at the end, so it is never written over
+  _context = std::make_unique<GenModelTestContext>(genChainModel(false, false));
+  _context->addTestCase(uniformTCD<float>({{-3, -2, -1, 0, 1, 2}}, {{0, 0, 0, 0, 2, 6}}));
+  _context->addTestCase(uniformTCD<float>({{1, -5, 2, -6, 3, -7}}, {{2, 0, 6, 0, 12, 0}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, SharedMemoryOperands_ReadAfterChain)
+{
+  // a is read again after the chain, so the chain must not write over it
+  _context = std::make_unique<GenModelTestContext>(genChainModel(true, false));
+  _context->addTestCase(uniformTCD<float>({{-3, -2, -1, 0, 1, 2}}, {{0, 0, 0, 1, 4, 9}}));
+  _context->addTestCase(uniformTCD<float>({{1, -5, 2, -6, 3, -7}}, {{4, 0, 9, 0, 16, 0}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, SharedMemoryOperands_OutputInChain)
+{
+  // a is an output of the model, so it keeps its values after the chain runs
+  _context = std::make_unique<GenModelTestContext>(genChainModel(false, true));
+  _context->addTestCase(uniformTCD<float>({{-3, -2, -1, 0, 1, 2}},
+                                          {{0, 0, 0, 0, 2, 6}, {-2, -1, 0, 1, 2, 3}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
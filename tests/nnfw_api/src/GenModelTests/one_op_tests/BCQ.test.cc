@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+#include <memory>
+
+// BCQ weights used below : 1 plane for each of 2 rows with hidden size 4
+//   row 0 : 1 * {+1, -1, +1, -1}
+//   row 1 : 2 * {+1, +1, -1, -1}
+namespace
+{
+const std::vector<int32_t> bcq_clusters{1, 2};
+const std::vector<float> bcq_scales{1, 2};
+const std::vector<int32_t> bcq_binary{0b0101, 0b0011};
+} // namespace
+
+TEST_F(GenModelTest, OneOp_BCQFullyConnected)
+{
+  CircleGen cgen;
+  uint32_t scales_buf = cgen.addBuffer(bcq_scales);
+  uint32_t binary_buf = cgen.addBuffer(bcq_binary);
+  uint32_t bias_buf = cgen.addBuffer(std::vector<float>{1, 0});
+  uint32_t clusters_buf = cgen.addBuffer(bcq_clusters);
+  int input = cgen.addTensor({{4, 1}, circle::TensorType::TensorType_FLOAT32});
+  int scales = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32, scales_buf});
+  int binary = cgen.addTensor({{2, 1}, circle::TensorType::TensorType_INT32, binary_buf});
+  int bias = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32, bias_buf});
+  int clusters = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_INT32, clusters_buf});
+  int output = cgen.addTensor({{2, 1}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBCQFullyConnected({{input, scales, binary, bias, clusters}, {output}}, 4,
+                                    circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 2, 3, 4}}, {{-1, -8}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_BCQGather)
+{
+  CircleGen cgen;
+  uint32_t scales_buf = cgen.addBuffer(bcq_scales);
+  uint32_t binary_buf = cgen.addBuffer(bcq_binary);
+  uint32_t clusters_buf = cgen.addBuffer(bcq_clusters);
+  int scales = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32, scales_buf});
+  int binary = cgen.addTensor({{2, 1}, circle::TensorType::TensorType_INT32, binary_buf});
+  int indices = cgen.addTensor({{2}, circle::TensorType::TensorType_INT32});
+  int clusters = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_INT32, clusters_buf});
+  int output = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBCQGather({{scales, binary, indices, clusters}, {output}}, 4, 0);
+  cgen.setInputsAndOutputs({indices}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(TestCaseData{}.addInput<int32_t>({1, 0}).addOutput<float>(
+    {2, 2, -2, -2, 1, -1, 1, -1}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_BCQGather_InvalidIndex)
+{
+  CircleGen cgen;
+  uint32_t scales_buf = cgen.addBuffer(bcq_scales);
+  uint32_t binary_buf = cgen.addBuffer(bcq_binary);
+  uint32_t clusters_buf = cgen.addBuffer(bcq_clusters);
+  int scales = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32, scales_buf});
+  int binary = cgen.addTensor({{2, 1}, circle::TensorType::TensorType_INT32, binary_buf});
+  int indices = cgen.addTensor({{1}, circle::TensorType::TensorType_INT32});
+  int clusters = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_INT32, clusters_buf});
+  int output = cgen.addTensor({{1, 4}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorBCQGather({{scales, binary, indices, clusters}, {output}}, 4, 0);
+  cgen.setInputsAndOutputs({indices}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(
+    TestCaseData{}.addInput<int32_t>({2}).addOutput<float>({0, 0, 0, 0}).expectFailRun());
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
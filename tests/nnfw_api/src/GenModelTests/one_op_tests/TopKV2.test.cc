@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+#include <memory>
+
+TEST_F(GenModelTest, OneOp_TopKV2)
+{
+  CircleGen cgen;
+  uint32_t k_buf = cgen.addBuffer(std::vector<int32_t>{2});
+  int in = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int k = cgen.addTensor({{1}, circle::TensorType::TensorType_INT32, k_buf});
+  int values = cgen.addTensor({{2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int indices = cgen.addTensor({{2, 2}, circle::TensorType::TensorType_INT32});
+  cgen.addOperatorTopKV2({{in, k}, {values, indices}});
+  cgen.setInputsAndOutputs({in}, {values, indices});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(TestCaseData{}
+                          .addInput<float>({3, 1, 4, 1, 5, 9, 2, 9})
+                          .addOutput<float>({4, 3, 9, 9})
+                          .addOutput<int32_t>({2, 0, 1, 3}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_TopKV2_Int8)
+{
+  CircleGen cgen;
+  uint32_t k_buf = cgen.addBuffer(std::vector<int32_t>{1});
+  int in = cgen.addTensor({{1, 3}, circle::TensorType::TensorType_INT8}, 1.f, 0);
+  int k = cgen.addTensor({{1}, circle::TensorType::TensorType_INT32, k_buf});
+  int values = cgen.addTensor({{1, 1}, circle::TensorType::TensorType_INT8}, 1.f, 0);
+  int indices = cgen.addTensor({{1, 1}, circle::TensorType::TensorType_INT32});
+  cgen.addOperatorTopKV2({{in, k}, {values, indices}});
+  cgen.setInputsAndOutputs({in}, {values, indices});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(
+    TestCaseData{}.addInput<int8_t>({-5, 7, -128}).addOutput<int8_t>({7}).addOutput<int32_t>({1}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_TopKV2_NonConstK)
+{
+  CircleGen cgen;
+  int in = cgen.addTensor({{4}, circle::TensorType::TensorType_FLOAT32});
+  int k = cgen.addTensor({{1}, circle::TensorType::TensorType_INT32});
+  int values = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32});
+  int indices = cgen.addTensor({{2}, circle::TensorType::TensorType_INT32});
+  cgen.addOperatorTopKV2({{in, k}, {values, indices}});
+  cgen.setInputsAndOutputs({in, k}, {values, indices});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->expectFailModelLoad();
+
+  SUCCEED();
+}
@@ -137,4 +137,59 @@ TEST_F(ValidationTestTwoSessionsCreated, two_sessions_run_simple_While_model)
   SUCCEED();
 }
 
+class FullyConnectedModel
+{
+public:
+  FullyConnectedModel(int size, float weight)
+  {
+    CircleGen cgen;
+    std::vector<float> weight_data(size * size, weight);
+    std::vector<float> bias_data(size, 0);
+    uint32_t weight_buf = cgen.addBuffer(weight_data);
+    uint32_t bias_buf = cgen.addBuffer(bias_data);
+    int in = cgen.addTensor({{1, size}, circle::TensorType::TensorType_FLOAT32});
+    int w = cgen.addTensor({{size, size}, circle::TensorType::TensorType_FLOAT32, weight_buf});
+    int b = cgen.addTensor({{size}, circle::TensorType::TensorType_FLOAT32, bias_buf});
+    int out = cgen.addTensor({{1, size}, circle::TensorType::TensorType_FLOAT32});
+    cgen.addOperatorFullyConnected({{in, w, b}, {out}});
+    cgen.setInputsAndOutputs({in}, {out});
+    cbuf = cgen.finish();
+  };
+
+  CircleBuffer cbuf;
+};
+
+TEST_F(ValidationTestTwoSessions, two_sessions_back_to_back_FullyConnected)
+{
+  // Weights of the same shape may be allocated where the ones of the closed session were, so a
+  // session must not get prepacked weights of the other
+  constexpr int size = 64;
+  auto run = [&](nnfw_session *&session, const std::string &backend, float weight) {
+    FullyConnectedModel model(size, weight);
+    NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+    NNFW_ENSURE_SUCCESS(
+      nnfw_load_circle_from_buffer(session, model.cbuf.buffer(), model.cbuf.size()));
+    NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, backend.c_str()));
+    NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+    std::vector<float> in_buf(size, 1.f);
+    std::vector<float> out_buf(size);
+    NNFW_ENSURE_SUCCESS(nnfw_set_input(session, 0, NNFW_TYPE_TENSOR_FLOAT32, in_buf.data(),
+                                       in_buf.size() * sizeof(float)));
+    NNFW_ENSURE_SUCCESS(nnfw_set_output(session, 0, NNFW_TYPE_TENSOR_FLOAT32, out_buf.data(),
+                                        out_buf.size() * sizeof(float)));
+    NNFW_ENSURE_SUCCESS(nnfw_run(session));
+    NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+
+    for (auto value : out_buf)
+      ASSERT_FLOAT_EQ(value, size * weight) << backend;
+  };
+
+  for (std::string backend : {"cpu", "ruy"})
+  {
+    run(_session1, backend, 1.f);
+    run(_session2, backend, 2.f);
+  }
+}
+
 // TODO Write two-session-test with large models run by threads
@@ -251,6 +251,22 @@ void Args::Initialize(void)
     .help({"Path to export target-dependent model.",
            "If it is not set, the generated model will be exported to the same directory of the "
            "original model/package with target backend extension."});
+  _arser.add_argument("--load_workers")
+    .type(arser::DataType::INT32)
+    .default_value(0)
+    .help({"Run in load mode with the given number of concurrent sessions",
+           "'--num_runs' requests are shared by sessions, each of which has its own thread.",
+           "'--warmup_runs' are run on each session before measurement.",
+           "Latency percentiles, throughput and CPU utilization are reported."});
+  _arser.add_argument("--load_qps")
+    .type(arser::DataType::FLOAT)
+    .default_value(0.0f)
+    .help({"Target requests per second in load mode",
+           "Requests arrive as a Poisson process regardless of completion (open-loop).",
+           "If it is 0, each session runs requests back to back (closed-loop)."});
+  _arser.add_argument("--load_report")
+    .type(arser::DataType::STR)
+    .help("JSON filename to write the result of load mode");
 }
 
 void Args::Parse(const int argc, char **argv)
@@ -409,6 +425,16 @@ void Args::Parse(const int argc, char **argv)
     if (_arser["--cpath"])
       _codegen_model_path = _arser.get<std::string>("--cpath");
 
+    _load_workers = _arser.get<int>("--load_workers");
+    _load_qps = _arser.get<float>("--load_qps");
+    if (_arser["--load_report"])
+      _load_report_filename = _arser.get<std::string>("--load_report");
+    if (_load_workers < 0 || _load_qps < 0)
+    {
+      std::cerr << "'--load_workers' and '--load_qps' must not be negative" << std::endl;
+      exit(1);
+    }
+
     // This must be run after parsing as `_warm_up_runs` must have been processed before.
     // Instead of EXECUTE to avoid overhead, memory polling runs on WARMUP
     if (_mem_poll && _warmup_runs == 0)
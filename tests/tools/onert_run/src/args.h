@@ -77,6 +77,9 @@ public:
   const std::string &getQuantizedModelPath(void) const { return _quantized_model_path; }
   const std::string &getCodegen(void) const { return _codegen; }
   const std::string &getCodegenModelPath(void) const { return _codegen_model_path; }
+  const int getLoadWorkers(void) const { return _load_workers; }
+  const float getLoadQps(void) const { return _load_qps; }
+  const std::string &getLoadReportFilename(void) const { return _load_report_filename; }
 
 private:
   void Initialize();
@@ -115,6 +118,9 @@ private:
   std::string _quantized_model_path;
   std::string _codegen;
   std::string _codegen_model_path;
+  int _load_workers = 0;
+  float _load_qps = 0;
+  std::string _load_report_filename;
 };
 
 } // end of namespace onert_run
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "loadgen.h"
+#include "nnfw.h"
+#include "nnfw_util.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <sys/resource.h>
+#include <thread>
+
+namespace
+{
+
+double cpuTime()
+{
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+         (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+// Arrival time of each request in seconds from the start of measurement
+std::vector<double> poissonArrivals(uint32_t requests, double qps)
+{
+  std::mt19937_64 gen(1);
+  std::exponential_distribution<double> interval(qps);
+  std::vector<double> arrivals(requests);
+  double time = 0;
+  for (auto &arrival : arrivals)
+  {
+    time += interval(gen);
+    arrival = time;
+  }
+  return arrivals;
+}
+
+} // namespace
+
+namespace onert_run
+{
+
+double LoadResult::throughput() const
+{
+  return wall_time_s > 0 ? latencies.size() / wall_time_s : 0;
+}
+
+double LoadResult::cpuUtilization() const
+{
+  const auto cores = std::max(1u, std::thread::hardware_concurrency());
+  return wall_time_s > 0 ? 100 * cpu_time_s / (wall_time_s * cores) : 0;
+}
+
+uint64_t LoadResult::percentile(double p) const
+{
+  if (latencies.empty())
+    return 0;
+  // Nearest-rank on sorted latencies
+  auto rank = static_cast<size_t>(std::ceil(p / 100 * latencies.size()));
+  rank = std::min(std::max<size_t>(rank, 1), latencies.size());
+  return latencies[rank - 1];
+}
+
+LoadGenerator::LoadGenerator(const LoadOption &option, const SessionFactory &factory)
+  : _option(option), _sessions(option.workers)
+{
+  if (_option.workers == 0)
+    throw std::runtime_error{"Load generator needs at least one worker"};
+
+  // Sessions are prepared one by one so that compilation does not overlap measurement
+  for (auto &s : _sessions)
+  {
+    factory(s);
+    for (uint32_t i = 0; i < _option.warmup_runs; ++i)
+      NNPR_ENSURE_STATUS(nnfw_run(s.session));
+  }
+}
+
+LoadGenerator::~LoadGenerator()
+{
+  for (auto &s : _sessions)
+  {
+    if (s.session)
+      nnfw_close_session(s.session);
+  }
+}
+
+LoadResult LoadGenerator::run()
+{
+  using Clock = std::chrono::steady_clock;
+
+  const bool open_loop = _option.qps > 0;
+  const auto arrivals =
+    open_loop ? poissonArrivals(_option.requests, _option.qps) : std::vector<double>{};
+
+  std::atomic<uint32_t> next{0};
+  std::vector<std::vector<uint64_t>> latencies(_sessions.size());
+  std::vector<std::thread> threads;
+
+  const auto cpu_begin = cpuTime();
+  const auto start = Clock::now();
+  for (size_t w = 0; w < _sessions.size(); ++w)
+  {
+    threads.emplace_back([&, w]() {
+      auto session = _sessions[w].session;
+      auto &worker_latencies = latencies[w];
+      worker_latencies.reserve(_option.requests / _sessions.size() + 1);
+      for (auto i = next++; i < _option.requests; i = next++)
+      {
+        // On open-loop, latency counts from the arrival even if no worker was free then
+        Clock::time_point begin;
+        if (open_loop)
+        {
+          begin = start + std::chrono::duration_cast<Clock::duration>(
+                            std::chrono::duration<double>(arrivals[i]));
+          std::this_thread::sleep_until(begin);
+        }
+        else
+        {
+          begin = Clock::now();
+        }
+        NNPR_ENSURE_STATUS(nnfw_run(session));
+        worker_latencies.emplace_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin).count());
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  LoadResult result;
+  result.option = _option;
+  result.wall_time_s = std::chrono::duration<double>(Clock::now() - start).count();
+  result.cpu_time_s = cpuTime() - cpu_begin;
+  for (const auto &worker_latencies : latencies)
+    result.latencies.insert(result.latencies.end(), worker_latencies.begin(),
+                            worker_latencies.end());
+  std::sort(result.latencies.begin(), result.latencies.end());
+  return result;
+}
+
+void printLoadResult(const LoadResult &result)
+{
+  const auto &option = result.option;
+  std::cout << "===================================" << std::endl;
+  std::cout << "LOAD       : " << option.workers << " workers, ";
+  if (option.qps > 0)
+    std::cout << option.qps << " qps (open-loop)" << std::endl;
+  else
+    std::cout << "closed-loop" << std::endl;
+  std::cout << "REQUESTS   : " << result.latencies.size() << " in " << result.wall_time_s << " s"
+            << std::endl;
+  std::cout << "THROUGHPUT : " << result.throughput() << " req/s" << std::endl;
+  std::cout << "CPU        : " << result.cpuUtilization() << " %" << std::endl;
+  std::cout << "LATENCY    : p50 " << result.percentile(50) / 1e3 << " ms, p90 "
+            << result.percentile(90) / 1e3 << " ms, p99 " << result.percentile(99) / 1e3
+            << " ms, p999 " << result.percentile(99.9) / 1e3 << " ms" << std::endl;
+  std::cout << "===================================" << std::endl;
+}
+
+void writeLoadResult(const LoadResult &result, const std::string &filename)
+{
+  Json::Value root;
+  root["workers"] = result.option.workers;
+  root["mode"] = result.option.qps > 0 ? "open-loop" : "closed-loop";
+  root["target_qps"] = result.option.qps;
+  root["requests"] = static_cast<Json::UInt64>(result.latencies.size());
+  root["wall_time_s"] = result.wall_time_s;
+  root["throughput_qps"] = result.throughput();
+  root["cpu_time_s"] = result.cpu_time_s;
+  root["cpu_utilization_percent"] = result.cpuUtilization();
+
+  Json::Value &latency = root["latency_us"];
+  latency["min"] = static_cast<Json::UInt64>(result.percentile(0));
+  latency["p50"] = static_cast<Json::UInt64>(result.percentile(50));
+  latency["p90"] = static_cast<Json::UInt64>(result.percentile(90));
+  latency["p99"] = static_cast<Json::UInt64>(result.percentile(99));
+  latency["p999"] = static_cast<Json::UInt64>(result.percentile(99.9));
+  latency["max"] = static_cast<Json::UInt64>(result.percentile(100));
+
+  // Histogram with power-of-two upper bounds
+  std::map<uint64_t, uint64_t> buckets;
+  for (auto l : result.latencies)
+  {
+    uint64_t bound = 1;
+    while (bound < l)
+      bound <<= 1;
+    buckets[bound]++;
+  }
+  Json::Value &histogram = root["histogram"];
+  histogram = Json::Value{Json::arrayValue};
+  for (const auto &bucket : buckets)
+  {
+    Json::Value entry;
+    entry["le_us"] = static_cast<Json::UInt64>(bucket.first);
+    entry["count"] = static_cast<Json::UInt64>(bucket.second);
+    histogram.append(entry);
+  }
+
+  std::ofstream file{filename};
+  if (!file)
+    throw std::runtime_error{"Cannot open " + filename};
+  Json::StreamWriterBuilder builder;
+  builder["indentation"] = "  ";
+  file << Json::writeString(builder, root) << std::endl;
+}
+
+} // namespace onert_run
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_RUN_LOADGEN_H__
+#define __ONERT_RUN_LOADGEN_H__
+
+#include "allocation.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+struct nnfw_session;
+
+namespace onert_run
+{
+
+/**
+ * @brief Session of a load worker and the buffers bound to it
+ */
+struct LoadSession
+{
+  nnfw_session *session = nullptr;
+  std::vector<Allocation> inputs;
+  std::vector<Allocation> outputs;
+};
+
+struct LoadOption
+{
+  // Number of sessions, each of which is run by its own thread
+  uint32_t workers = 1;
+  // Requests per second arriving as a Poisson process (open-loop).
+  // If it is 0, each worker issues requests back to back (closed-loop).
+  double qps = 0;
+  // Total number of requests over all workers
+  uint32_t requests = 1;
+  // Runs of each session before measurement
+  uint32_t warmup_runs = 0;
+};
+
+struct LoadResult
+{
+  LoadOption option;
+  // Latency of each request in microseconds, sorted.
+  // On open-loop, it includes the time a request waits for a free worker.
+  std::vector<uint64_t> latencies;
+  double wall_time_s = 0;
+  // User and system CPU time of the process during measurement
+  double cpu_time_s = 0;
+
+  double throughput() const;
+  // Percentage of all cores kept busy during measurement
+  double cpuUtilization() const;
+  uint64_t percentile(double p) const;
+};
+
+/**
+ * @brief Runs requests on concurrent sessions to measure latency under load
+ */
+class LoadGenerator
+{
+public:
+  // Creates a session that is prepared and ready to run with its buffers bound
+  using SessionFactory = std::function<void(LoadSession &)>;
+
+public:
+  LoadGenerator(const LoadOption &option, const SessionFactory &factory);
+  ~LoadGenerator();
+
+  LoadResult run();
+
+private:
+  LoadOption _option;
+  std::vector<LoadSession> _sessions;
+};
+
+void printLoadResult(const LoadResult &result);
+void writeLoadResult(const LoadResult &result, const std::string &filename);
+
+} // namespace onert_run
+
+#endif // __ONERT_RUN_LOADGEN_H__
@@ -20,6 +20,7 @@
 #if defined(ONERT_HAVE_HDF5) && ONERT_HAVE_HDF5 == 1
 #include "h5formatter.h"
 #endif
+#include "loadgen.h"
 #include "nnfw.h"
 #include "nnfw_util.h"
 #include "nnfw_internal.h"
@@ -100,6 +101,86 @@ std::string genQuantizedModelPathFromPackagePath(const std::string &package_path
   throw std::runtime_error{"Invalid quantization type"};
 }
 
+void setInputShapes(nnfw_session *session, const onert_run::TensorShapeMap &shape_map)
+{
+  for (const auto &pair : shape_map)
+  {
+    nnfw_tensorinfo ti;
+    NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, pair.first, &ti));
+    ti.rank = pair.second.size();
+    for (int i = 0; i < ti.rank; i++)
+      ti.dims[i] = pair.second.at(i);
+    NNPR_ENSURE_STATUS(nnfw_set_input_tensorinfo(session, pair.first, &ti));
+  }
+}
+
+// Runs concurrent sessions on random inputs and reports latency under load
+int runLoad(onert_run::Args &args)
+{
+  using namespace onert_run;
+
+  char *available_backends = std::getenv("BACKENDS");
+  auto prepare_session = [&](LoadSession &s) {
+    NNPR_ENSURE_STATUS(nnfw_create_session(&s.session));
+    if (args.useSingleModel())
+      NNPR_ENSURE_STATUS(
+        nnfw_load_model_from_modelfile(s.session, args.getModelFilename().c_str()));
+    else
+      NNPR_ENSURE_STATUS(nnfw_load_model_from_file(s.session, args.getPackageFilename().c_str()));
+    if (available_backends)
+      NNPR_ENSURE_STATUS(nnfw_set_available_backends(s.session, available_backends));
+
+    setInputShapes(s.session, args.getShapeMapForPrepare());
+    NNPR_ENSURE_STATUS(nnfw_prepare(s.session));
+    setInputShapes(s.session, args.getShapeMapForRun());
+
+    uint32_t num_inputs;
+    uint32_t num_outputs;
+    NNPR_ENSURE_STATUS(nnfw_input_size(s.session, &num_inputs));
+    NNPR_ENSURE_STATUS(nnfw_output_size(s.session, &num_outputs));
+
+    s.inputs.resize(num_inputs);
+    for (uint32_t i = 0; i < num_inputs; i++)
+    {
+      nnfw_tensorinfo ti;
+      NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(s.session, i, &ti));
+      auto input_size_in_bytes = bufsize_for(&ti);
+      s.inputs[i].alloc(input_size_in_bytes, ti.dtype);
+      NNPR_ENSURE_STATUS(
+        nnfw_set_input(s.session, i, ti.dtype, s.inputs[i].data(), input_size_in_bytes));
+      NNPR_ENSURE_STATUS(nnfw_set_input_layout(s.session, i, NNFW_LAYOUT_CHANNELS_LAST));
+    }
+    RandomGenerator().generate(s.inputs);
+
+    s.outputs.resize(num_outputs);
+    for (uint32_t i = 0; i < num_outputs; i++)
+    {
+      nnfw_tensorinfo ti;
+      NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(s.session, i, &ti));
+      uint64_t output_size_in_bytes = bufsize_for(&ti);
+      s.outputs[i].alloc(output_size_in_bytes, ti.dtype);
+      NNPR_ENSURE_STATUS(
+        nnfw_set_output(s.session, i, ti.dtype, s.outputs[i].data(), output_size_in_bytes));
+      NNPR_ENSURE_STATUS(nnfw_set_output_layout(s.session, i, NNFW_LAYOUT_CHANNELS_LAST));
+    }
+  };
+
+  LoadOption option;
+  option.workers = args.getLoadWorkers();
+  option.qps = args.getLoadQps();
+  option.requests = args.getNumRuns();
+  option.warmup_runs = args.getWarmupRuns();
+
+  LoadGenerator generator{option, prepare_session};
+  auto result = generator.run();
+
+  printLoadResult(result);
+  if (!args.getLoadReportFilename().empty())
+    writeLoadResult(result, args.getLoadReportFilename());
+
+  return 0;
+}
+
 int main(const int argc, char **argv)
 {
   using namespace onert_run;
@@ -120,6 +201,9 @@ int main(const int argc, char **argv)
     ruy::profiler::ScopeProfile ruy_profile;
 #endif
 
+    if (args.getLoadWorkers() > 0)
+      return runLoad(args);
+
     // TODO Apply verbose level to phases
     const int verbose = args.getVerboseLevel();
     benchmark::Phases phases(
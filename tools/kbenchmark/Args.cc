@@ -41,7 +41,7 @@ void Args::Initialize(const int argc, char **argv)
   arser.add_argument("--reporter", "-r")
     .type(arser::DataType::STR)
     .default_value("standard")
-    .help("Set reporter types(standard, html, junit, csv)");
+    .help("Set reporter types(standard, html, junit, csv, roofline)");
   arser.add_argument("--filter", "-f")
     .type(arser::DataType::STR)
     .default_value(".*")
@@ -54,6 +54,14 @@ void Args::Initialize(const int argc, char **argv)
     .type(arser::DataType::STR)
     .default_value("")
     .help("Set additional strings for output file name");
+  arser.add_argument("--peak-gflops")
+    .type(arser::DataType::FLOAT)
+    .default_value(0.f)
+    .help("Peak GFLOP/s of roofline reporter, measured if not given");
+  arser.add_argument("--peak-gbps")
+    .type(arser::DataType::FLOAT)
+    .default_value(0.f)
+    .help("Peak memory bandwidth in GB/s of roofline reporter, measured if not given");
 
   try
   {
@@ -97,7 +105,7 @@ void Args::Initialize(const int argc, char **argv)
   if (!_reporter.empty())
   {
     if (_reporter != "junit" && _reporter != "csv" && _reporter != "html" &&
-        _reporter != "standard")
+        _reporter != "standard" && _reporter != "roofline")
     {
       std::cerr << "Invalid reporter" << std::endl;
       exit(1);
@@ -107,6 +115,8 @@ void Args::Initialize(const int argc, char **argv)
   _filter = arser.get<std::string>("--filter");
   _output = arser.get<std::string>("--output");
   _verbose = arser.get<int>("--verbose");
+  _peak_gflops = arser.get<float>("--peak-gflops");
+  _peak_gbps = arser.get<float>("--peak-gbps");
 }
 
 } // namespace kbenchmark
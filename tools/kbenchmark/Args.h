@@ -33,6 +33,8 @@ public:
   const std::string &filter(void) { return _filter; }
   const std::string &output(void) { return _output; }
   int verbose(void) { return _verbose; }
+  float peak_gflops(void) { return _peak_gflops; }
+  float peak_gbps(void) { return _peak_gbps; }
 
 private:
   void Initialize(const int argc, char **argv);
@@ -44,6 +46,8 @@ private:
   std::string _filter;
   std::string _output;
   int _verbose;
+  float _peak_gflops;
+  float _peak_gbps;
 };
 
 } // namespace kbenchmark
@@ -17,6 +17,7 @@
 #include "Args.h"
 #include "ConfigFile.h"
 #include "OperationLoader.h"
+#include "RooflineReporter.h"
 
 #include <nonius/nonius.h++>
 
@@ -94,7 +95,7 @@ int main(int argc, char *argv[])
 
   std::string reporter{args.reporter()};
   std::string ext{"." + reporter};
-  if (reporter == "standard")
+  if (reporter == "standard" || reporter == "roofline")
   {
     ext = ".txt";
   }
@@ -108,6 +109,10 @@ int main(int argc, char *argv[])
   cfg.output_file = test_name + ext;
   cfg.summary = true;
 
+  // Peaks of roofline reporter, which are measured unless given
+  Roofline::given().flops = args.peak_gflops() * 1e9;
+  Roofline::given().bandwidth = args.peak_gbps() * 1e9;
+
   // Create ConfigFile object from config file
   ConfigFile cf(args.config());
 
@@ -131,6 +136,7 @@ int main(int argc, char *argv[])
 
       nonius::parameters op_params = opl[cf.name()]->params(c.first, c.second);
       cfg.params.map = cfg.params.map.merged(op_params);
+      RooflineReporter::workload() = opl[cf.name()]->workload(c.second);
 
       nonius::go(cfg, benchmarks);
     }
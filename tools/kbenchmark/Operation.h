@@ -24,12 +24,25 @@
 namespace kbenchmark
 {
 
+/**
+ * @brief Amount of work of an operation, which places it on the roofline
+ */
+struct Workload
+{
+  // Floating point operations (a multiply-add counts as two)
+  double flops = 0;
+  // Bytes of inputs, weights and outputs that are read or written at least once
+  double bytes = 0;
+};
+
 class Operation
 {
 public:
   Operation() = default;
 
   virtual nonius::parameters params(int layer_num, OperationInfo &info) = 0;
+
+  virtual Workload workload(OperationInfo &info) = 0;
 };
 
 } // namespace kbenchmark
@@ -22,6 +22,9 @@
 
 #include "Operation.h"
 #include "operations/Convolution.h"
+#include "operations/DepthwiseConvolution.h"
+#include "operations/FullyConnected.h"
+#include "operations/TopKV2.h"
 #include "operations/TransposeConv.h"
 
 namespace kbenchmark
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_ROOFLINE_REPORTER_H__
+#define __KBENCHMARK_ROOFLINE_REPORTER_H__
+
+#include "Operation.h"
+
+#include <nonius/nonius.h++>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+namespace kbenchmark
+{
+
+/**
+ * @brief Single core peaks of this machine, which bound the roofline
+ */
+struct Roofline
+{
+  // Bytes per second streamed from memory
+  double bandwidth = 0;
+  // Floating point operations per second
+  double flops = 0;
+
+  // Peaks given by users, where 0 is measured instead
+  static Roofline &given()
+  {
+    static Roofline roofline;
+    return roofline;
+  }
+
+  // Measured once on the first use
+  static const Roofline &get()
+  {
+    static const Roofline roofline = measure(given());
+    return roofline;
+  }
+
+  double attainable(double intensity) const { return std::min(flops, intensity * bandwidth); }
+
+private:
+  template <typename Fn> static double best_seconds(Fn fn)
+  {
+    double best = 0;
+    for (int i = 0; i < 5; ++i)
+    {
+      const auto begin = std::chrono::steady_clock::now();
+      fn();
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+      if (i == 0 || elapsed.count() < best)
+        best = elapsed.count();
+    }
+    return best;
+  }
+
+  static double measure_bandwidth()
+  {
+    // STREAM triad over arrays much larger than the last level cache
+    const size_t size = 8 * 1024 * 1024;
+    std::vector<float> a(size, 0.f), b(size, 1.f), c(size, 2.f);
+    const auto seconds = best_seconds([&]() {
+      for (size_t i = 0; i < size; ++i)
+        a[i] = b[i] + 0.5f * c[i];
+    });
+
+    // Keep results alive
+    volatile float sink = a[size / 2];
+    (void)sink;
+
+    return 3 * size * sizeof(float) / seconds;
+  }
+
+  static double measure_flops()
+  {
+    // Vectors as wide as the widest registers the compiler targets, so that the peak is what
+    // kernels built with the same flags can reach
+#if defined(__AVX512F__)
+    using Vector = float __attribute__((vector_size(64)));
+#elif defined(__AVX__)
+    using Vector = float __attribute__((vector_size(32)));
+#else
+    using Vector = float __attribute__((vector_size(16)));
+#endif
+    constexpr int lanes = sizeof(Vector) / sizeof(float);
+    // Independent accumulators hide the latency of multiply-adds on all pipes, and still fit in
+    // registers with the two constants
+    constexpr int accumulators = 12;
+    const int iterations = 10000000;
+
+    // Accumulators start apart, so that the compiler cannot merge them into one
+    Vector acc[accumulators];
+    for (int k = 0; k < accumulators; ++k)
+      for (int l = 0; l < lanes; ++l)
+        acc[k][l] = k * lanes + l;
+    const Vector scale = Vector{} + 0.999f;
+    const Vector bias = Vector{} + 0.001f;
+
+    const auto seconds = best_seconds([&]() {
+      Vector x[accumulators];
+      std::copy(acc, acc + accumulators, x);
+      for (int i = 0; i < iterations; ++i)
+      {
+#pragma GCC unroll 12
+        for (int k = 0; k < accumulators; ++k)
+          x[k] = x[k] * scale + bias;
+      }
+      std::copy(x, x + accumulators, acc);
+    });
+
+    // Keep results alive
+    volatile float sink = 0;
+    for (int k = 0; k < accumulators; ++k)
+      sink = sink + acc[k][0];
+
+    return 2.0 * accumulators * lanes * iterations / seconds;
+  }
+
+  static Roofline measure(const Roofline &given)
+  {
+    Roofline roofline;
+    roofline.bandwidth = given.bandwidth > 0 ? given.bandwidth : measure_bandwidth();
+    roofline.flops = given.flops > 0 ? given.flops : measure_flops();
+    return roofline;
+  }
+};
+
+/**
+ * @brief nonius reporter that places each benchmark on the roofline of this machine
+ */
+class RooflineReporter final : public nonius::reporter
+{
+public:
+  // Workload of the layer that is measured by the next nonius::go()
+  static Workload &workload()
+  {
+    static Workload workload;
+    return workload;
+  }
+
+private:
+  std::string description() override
+  {
+    return "reports achieved GFLOP/s and GB/s against the single core roofline";
+  }
+
+  void do_suite_start() override
+  {
+    const auto &roofline = Roofline::get();
+    const auto &w = workload();
+    stream() << std::fixed << std::setprecision(3);
+    stream() << "peak: " << roofline.flops * 1e-9 << " GFLOP/s, " << roofline.bandwidth * 1e-9
+             << " GB/s\n";
+    stream() << "workload: " << w.flops * 1e-9 << " GFLOP, " << w.bytes * 1e-6 << " MB, "
+             << intensity() << " FLOP/byte\n";
+    stream() << "attainable: " << roofline.attainable(intensity()) * 1e-9 << " GFLOP/s ("
+             << (intensity() < ridge() ? "memory" : "compute") << " bound)\n\n";
+  }
+
+  void do_benchmark_start(std::string const &name) override { _name = name; }
+
+  void do_measurement_complete(std::vector<nonius::fp_seconds> const &samples) override
+  {
+    _samples = samples;
+  }
+
+  void do_benchmark_failure(std::exception_ptr) override
+  {
+    stream() << _name << ": failed\n";
+    _samples.clear();
+  }
+
+  void do_benchmark_complete() override
+  {
+    if (_samples.empty())
+      return;
+
+    double mean = 0;
+    for (const auto &s : _samples)
+      mean += s.count();
+    mean /= _samples.size();
+
+    const auto &w = workload();
+    const double flops = w.flops / mean;
+    const double bandwidth = w.bytes / mean;
+    stream() << _name << ": " << mean * 1e3 << " ms, " << flops * 1e-9 << " GFLOP/s, "
+             << bandwidth * 1e-9 << " GB/s, ";
+    // Workloads without floating point operations, such as sorting, are bound by bandwidth only
+    if (w.flops > 0)
+      stream() << 100 * flops / Roofline::get().attainable(intensity()) << "% of roofline\n";
+    else
+      stream() << 100 * bandwidth / Roofline::get().bandwidth << "% of peak bandwidth\n";
+    _samples.clear();
+  }
+
+  double intensity() const
+  {
+    const auto &w = workload();
+    return w.bytes > 0 ? w.flops / w.bytes : 0;
+  }
+
+  // Intensity where the kernel stops being memory bound
+  double ridge() const { return Roofline::get().flops / Roofline::get().bandwidth; }
+
+  std::string _name;
+  std::vector<nonius::fp_seconds> _samples;
+};
+
+} // namespace kbenchmark
+
+NONIUS_REPORTER("roofline", kbenchmark::RooflineReporter);
+
+#endif // __KBENCHMARK_ROOFLINE_REPORTER_H__
@@ -65,6 +65,36 @@ std::string get_key_string(const std::string &key, OperationInfo &info)
   return info[key];
 }
 
+double num_elements(const std::vector<int> &dims)
+{
+  double num = 1;
+  for (auto d : dims)
+    num *= d;
+  return num;
+}
+
+int type_size(const std::string &type)
+{
+  if (type == "FLOAT16" || type == "INT16")
+    return 2;
+  if (type == "UINT8" || type == "INT8" || type == "BOOL")
+    return 1;
+  if (type == "INT64" || type == "FLOAT64")
+    return 8;
+  // FLOAT32, INT32 and unknown types
+  return 4;
+}
+
+// Returns 0 for optional tensors that are not given, e.g. bias
+double get_key_bytes(const std::string &key, OperationInfo &info)
+{
+  if (info.find(key) == info.end())
+    return 0;
+  const auto type_key = key + "_type";
+  const auto type = (info.find(type_key) != info.end()) ? info[type_key] : std::string{};
+  return num_elements(dims(info[key])) * type_size(type);
+}
+
 } // namespace kbenchmark
 
 #endif // __KBENCHMARK_UTILS_H__
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Conv2D benchmark with cker kernels of the cpu backend
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/Conv.h>
+#include <cker/PortableTensorUtils.h>
+
+#include <ruy/context.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "cpu_common/Utils.h"
+
+using namespace kbenchmark::kernels::cpu_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(IFM_C, 3);
+NONIUS_PARAM(IFM_H, 244);
+NONIUS_PARAM(IFM_W, 244);
+
+NONIUS_PARAM(OFM_C, 3);
+NONIUS_PARAM(OFM_H, 244);
+NONIUS_PARAM(OFM_W, 244);
+
+NONIUS_PARAM(KER_H, 3);
+NONIUS_PARAM(KER_W, 3);
+
+NONIUS_PARAM(STRIDE_H, 1);
+NONIUS_PARAM(STRIDE_W, 1);
+
+NONIUS_PARAM(PADDING, std::string{"SAME"})
+NONIUS_PARAM(FUSED_ACT, std::string{"RELU"})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  int32_t batch;
+  int32_t ifm_C;
+  int32_t ifm_H;
+  int32_t ifm_W;
+  int32_t ofm_C;
+  int32_t ofm_H;
+  int32_t ofm_W;
+  int32_t ker_H;
+  int32_t ker_W;
+
+  nnfw::cker::ConvParams params;
+
+  Configuration(nonius::chronometer meter)
+  {
+    batch = meter.param<BATCH>();
+    ifm_C = meter.param<IFM_C>();
+    ifm_H = meter.param<IFM_H>();
+    ifm_W = meter.param<IFM_W>();
+    ofm_C = meter.param<OFM_C>();
+    ofm_H = meter.param<OFM_H>();
+    ofm_W = meter.param<OFM_W>();
+    ker_H = meter.param<KER_H>();
+    ker_W = meter.param<KER_W>();
+
+    const int32_t vertical_stride = meter.param<STRIDE_H>();
+    const int32_t horizontal_stride = meter.param<STRIDE_W>();
+    const auto padding_name = meter.param<PADDING>();
+    const auto padding = calculatePadding(padding_name, ifm_H, ifm_W, ofm_H, ofm_W,
+                                          vertical_stride, horizontal_stride, ker_H, ker_W);
+    const auto range = asActivationRange(meter.param<FUSED_ACT>());
+
+    params.padding_type = (padding_name == "SAME") ? nnfw::cker::PaddingType::kSame
+                                                   : nnfw::cker::PaddingType::kValid;
+    params.padding_values.width = padding.left;
+    params.padding_values.height = padding.top;
+    params.stride_width = horizontal_stride;
+    params.stride_height = vertical_stride;
+    params.dilation_width_factor = 1;
+    params.dilation_height_factor = 1;
+    params.float_activation_min = range.min;
+    params.float_activation_max = range.max;
+  }
+
+  nnfw::cker::Shape ifm_shape() const { return nnfw::cker::Shape{batch, ifm_H, ifm_W, ifm_C}; }
+  nnfw::cker::Shape ofm_shape() const { return nnfw::cker::Shape{batch, ofm_H, ofm_W, ofm_C}; }
+  nnfw::cker::Shape ker_shape() const { return nnfw::cker::Shape{ofm_C, ker_H, ker_W, ifm_C}; }
+  nnfw::cker::Shape bias_shape() const { return nnfw::cker::Shape{ofm_C}; }
+};
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                          \
+  namespace                                                                                        \
+  {                                                                                                \
+  static ::nonius::benchmark_registrar                                                             \
+    NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, __VA_ARGS__); \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CkerConv_NHWC", [](nonius::chronometer meter) {
+  // Configure
+  Configuration p{meter};
+  const auto ifm_shape = p.ifm_shape();
+  const auto ofm_shape = p.ofm_shape();
+  const auto ker_shape = p.ker_shape();
+  const auto bias_shape = p.bias_shape();
+
+  auto ifm = randomData(ifm_shape.FlatSize());
+  auto ker = randomData(ker_shape.FlatSize());
+  auto bias = randomData(bias_shape.FlatSize());
+  std::vector<float> ofm(ofm_shape.FlatSize());
+
+  // Constant weights are prepared once as ConvolutionLayer does
+  nnfw::cker::Conv conv;
+  bool is_replaced_weights = false;
+  conv.prepareF32(ker_shape, ker.data(), p.params.padding_type, is_replaced_weights, 1, 1);
+
+  // Run!
+  meter.measure([&](int) {
+    conv(p.params, ifm_shape, ifm.data(), ker_shape, ker.data(), bias_shape, bias.data(),
+         ofm_shape, ofm.data());
+  });
+})
+
+// Same shapes with int16 activations and int8 weights, to compare with fp32 above
+NONIUS_LOCAL_BENCHMARK("CkerConv_NHWC_Int16x8", [](nonius::chronometer meter) {
+  // Configure
+  Configuration p{meter};
+  const auto ifm_shape = p.ifm_shape();
+  const auto ofm_shape = p.ofm_shape();
+  const auto ker_shape = p.ker_shape();
+  const auto bias_shape = p.bias_shape();
+
+  auto ifm = randomQuantData<int16_t>(ifm_shape.FlatSize());
+  auto ker = randomQuantData<int8_t>(ker_shape.FlatSize());
+  std::vector<int64_t> bias(bias_shape.FlatSize(), 0);
+  std::vector<int16_t> ofm(ofm_shape.FlatSize());
+
+  // Per-channel multipliers of 2^-16, precomputed by ConvolutionLayer in the cpu backend
+  nnfw::cker::Conv conv;
+  conv.per_channel_output_multiplier().assign(p.ofm_C, 1 << 30);
+  conv.per_channel_output_shift().assign(p.ofm_C, -15);
+  p.params.quantized_activation_min = std::numeric_limits<int16_t>::min();
+  p.params.quantized_activation_max = std::numeric_limits<int16_t>::max();
+
+  // Single thread like the other kernels of this library
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(1);
+
+  // Run!
+  meter.measure([&](int) {
+    conv(p.params, ifm_shape, ifm.data(), ker_shape, ker.data(), bias_shape, bias.data(),
+         ofm_shape, ofm.data(), &ruy_context);
+  });
+})
+
+// Same shapes with float activations quantized per batch at run time and int8 weights
+NONIUS_LOCAL_BENCHMARK("CkerConv_NHWC_Hybrid", [](nonius::chronometer meter) {
+  // Configure
+  Configuration p{meter};
+  const auto ifm_shape = p.ifm_shape();
+  const auto ofm_shape = p.ofm_shape();
+  const auto ker_shape = p.ker_shape();
+  const auto bias_shape = p.bias_shape();
+
+  auto ifm = randomData(ifm_shape.FlatSize());
+  auto ker = randomQuantData<int8_t>(ker_shape.FlatSize());
+  auto bias = randomData(bias_shape.FlatSize());
+  std::vector<float> per_channel_scale(p.ofm_C, 1.f / 127);
+  std::vector<float> ofm(ofm_shape.FlatSize());
+
+  // Filter row sums are computed once as ConvolutionLayer does
+  const int input_size = ifm_shape.FlatSize() / p.batch;
+  nnfw::cker::ConvHybridTempArena arena(p.batch, input_size);
+  nnfw::cker::optimized_integer_ops::ComputeHybridConvRowSums(ker_shape, ker.data(),
+                                                              arena.filter_row_sums);
+
+  // Single thread like the other kernels of this library
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(1);
+
+  // Run! Input quantization is a part of each run
+  meter.measure([&](int) {
+    for (int b = 0; b < p.batch; ++b)
+    {
+      const int offset = b * input_size;
+      nnfw::cker::PortableAsymmetricQuantizeFloats(
+        ifm.data() + offset, input_size, arena.input_quantized.data() + offset,
+        &arena.input_scaling_factors[b], &arena.input_offsets[b]);
+    }
+    nnfw::cker::optimized_integer_ops::HybridConvPerChannel(
+      p.params, arena.input_scaling_factors.data(), ifm_shape, arena.input_quantized.data(),
+      ker_shape, ker.data(), bias_shape, bias.data(), ofm_shape, ofm.data(),
+      per_channel_scale.data(), arena.input_offsets.data(), arena.filter_row_sums.data(),
+      arena.im2col, arena.accum, &ruy_context);
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
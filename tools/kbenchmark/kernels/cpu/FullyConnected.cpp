@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file FullyConnected benchmark with cker kernels of the cpu backend
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/FullyConnected.h>
+
+#include <ruy/context.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "cpu_common/Utils.h"
+
+using namespace kbenchmark::kernels::cpu_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(INPUT_SIZE, 1024);
+NONIUS_PARAM(OUTPUT_SIZE, 1024);
+
+NONIUS_PARAM(FUSED_ACT, std::string{"NONE"})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  int32_t batch;
+  int32_t input_size;
+  int32_t output_size;
+
+  nnfw::cker::FullyConnectedParams params;
+
+  Configuration(nonius::chronometer meter)
+  {
+    batch = meter.param<BATCH>();
+    input_size = meter.param<INPUT_SIZE>();
+    output_size = meter.param<OUTPUT_SIZE>();
+
+    const auto range = asActivationRange(meter.param<FUSED_ACT>());
+    params.float_activation_min = range.min;
+    params.float_activation_max = range.max;
+    // Weights are constant and inputs change on every run
+    params.lhs_cacheable = true;
+    params.rhs_cacheable = false;
+  }
+
+  nnfw::cker::Shape input_shape() const { return nnfw::cker::Shape{batch, input_size}; }
+  nnfw::cker::Shape weights_shape() const { return nnfw::cker::Shape{output_size, input_size}; }
+  nnfw::cker::Shape bias_shape() const { return nnfw::cker::Shape{output_size}; }
+  nnfw::cker::Shape output_shape() const { return nnfw::cker::Shape{batch, output_size}; }
+};
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                          \
+  namespace                                                                                        \
+  {                                                                                                \
+  static ::nonius::benchmark_registrar                                                             \
+    NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, __VA_ARGS__); \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CkerFullyConnected", [](nonius::chronometer meter) {
+  // Configure
+  Configuration p{meter};
+  const auto input_shape = p.input_shape();
+  const auto weights_shape = p.weights_shape();
+  const auto bias_shape = p.bias_shape();
+  const auto output_shape = p.output_shape();
+
+  auto input = randomData(input_shape.FlatSize());
+  auto weights = randomData(weights_shape.FlatSize());
+  auto bias = randomData(bias_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  // Run!
+  meter.measure([&](int) {
+    nnfw::cker::FullyConnected(p.params, input_shape, input.data(), weights_shape, weights.data(),
+                               bias_shape, bias.data(), output_shape, output.data());
+  });
+})
+
+// Same shapes with int16 activations and int8 weights, to compare with fp32 above
+NONIUS_LOCAL_BENCHMARK("CkerFullyConnected_Int16x8", [](nonius::chronometer meter) {
+  // Configure
+  Configuration p{meter};
+  const auto input_shape = p.input_shape();
+  const auto weights_shape = p.weights_shape();
+  const auto bias_shape = p.bias_shape();
+  const auto output_shape = p.output_shape();
+
+  auto input = randomQuantData<int16_t>(input_shape.FlatSize());
+  auto weights = randomQuantData<int8_t>(weights_shape.FlatSize());
+  std::vector<int64_t> bias(bias_shape.FlatSize(), 0);
+  std::vector<int16_t> output(output_shape.FlatSize());
+
+  // Per-channel multipliers of 2^-16, precomputed by FullyConnectedLayer in the cpu backend
+  const std::vector<int32_t> output_multiplier(p.output_size, 1 << 30);
+  const std::vector<int> output_shift(p.output_size, -15);
+  p.params.quantized_activation_min = std::numeric_limits<int16_t>::min();
+  p.params.quantized_activation_max = std::numeric_limits<int16_t>::max();
+  std::vector<int32_t> accum_scratch;
+
+  // Single thread like the other kernels of this library
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(1);
+
+  // Run!
+  meter.measure([&](int) {
+    nnfw::cker::FullyConnected16x8(p.params, output_multiplier.data(), output_shift.data(),
+                                   input_shape, input.data(), weights_shape, weights.data(),
+                                   bias_shape, bias.data(), output_shape, output.data(),
+                                   accum_scratch, &ruy_context);
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file TopKV2 benchmark with the cker kernel of the cpu backend, against a full sort
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/TopKV2.h>
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "cpu_common/Utils.h"
+
+using namespace kbenchmark::kernels::cpu_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(ROWS, 1);
+NONIUS_PARAM(ROW_SIZE, 32000);
+NONIUS_PARAM(K, 10);
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                          \
+  namespace                                                                                        \
+  {                                                                                                \
+  static ::nonius::benchmark_registrar                                                             \
+    NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, __VA_ARGS__); \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CkerTopKV2", [](nonius::chronometer meter) {
+  // Configure
+  const int32_t rows = meter.param<ROWS>();
+  const int32_t row_size = meter.param<ROW_SIZE>();
+  const int32_t k = meter.param<K>();
+  const nnfw::cker::Shape input_shape{rows, row_size};
+  const nnfw::cker::Shape values_shape{rows, k};
+
+  auto input = randomData(input_shape.FlatSize());
+  std::vector<float> values(values_shape.FlatSize());
+  std::vector<int32_t> indices(values_shape.FlatSize());
+
+  // Single thread like the other kernels of this library
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(1);
+
+  // Run!
+  meter.measure([&](int) {
+    nnfw::cker::TopKV2(input_shape, input.data(), k, values_shape, values.data(), indices.data(),
+                       &ruy_context);
+  });
+})
+
+// Baseline that sorts the indices of each whole row and takes the first k
+NONIUS_LOCAL_BENCHMARK("StdSortTopKV2", [](nonius::chronometer meter) {
+  // Configure
+  const int32_t rows = meter.param<ROWS>();
+  const int32_t row_size = meter.param<ROW_SIZE>();
+  const int32_t k = meter.param<K>();
+
+  auto input = randomData(static_cast<size_t>(rows) * row_size);
+  std::vector<float> values(static_cast<size_t>(rows) * k);
+  std::vector<int32_t> indices(static_cast<size_t>(rows) * k);
+  std::vector<int32_t> order(row_size);
+
+  // Run! Indices are reset on each row as the kernel does
+  meter.measure([&](int) {
+    for (int32_t r = 0; r < rows; ++r)
+    {
+      const float *row = input.data() + static_cast<size_t>(r) * row_size;
+      for (int32_t i = 0; i < row_size; ++i)
+        order[i] = i;
+      std::sort(order.begin(), order.end(), [row](int32_t a, int32_t b) {
+        return nnfw::cker::topk_v2::Greater(row[a], row[b]) ||
+               (!nnfw::cker::topk_v2::Greater(row[b], row[a]) && a < b);
+      });
+      for (int32_t i = 0; i < k; ++i)
+      {
+        indices[r * k + i] = order[i];
+        values[r * k + i] = row[order[i]];
+      }
+    }
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
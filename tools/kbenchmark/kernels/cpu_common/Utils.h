@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_KERNELS_CPU_COMMON_UTILS_H__
+#define __KBENCHMARK_KERNELS_CPU_COMMON_UTILS_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace kbenchmark
+{
+namespace kernels
+{
+namespace cpu_common
+{
+
+struct PaddingInfo
+{
+  uint32_t top;
+  uint32_t bottom;
+  uint32_t left;
+  uint32_t right;
+};
+
+PaddingInfo calculatePadding(const std::string &padding_name, const uint32_t ifm_H,
+                             const uint32_t ifm_W, const uint32_t ofm_H, const uint32_t ofm_W,
+                             const uint32_t vertical_stride, const uint32_t horizontal_stride,
+                             const uint32_t ker_H, const uint32_t ker_W)
+{
+  uint32_t top = 0;
+  uint32_t bottom = 0;
+  uint32_t left = 0;
+  uint32_t right = 0;
+
+  if (padding_name == "SAME")
+  {
+    const int32_t vertical_needed_input = (ofm_H - 1) * vertical_stride + ker_H;
+    const int32_t vertical_total_padding = std::max(0, vertical_needed_input - (int32_t)ifm_H);
+
+    const int32_t horizontal_needed_input = (ofm_W - 1) * horizontal_stride + ker_W;
+    const int32_t horizontal_total_padding = std::max(0, horizontal_needed_input - (int32_t)ifm_W);
+
+    top = vertical_total_padding / 2;
+    bottom = (vertical_total_padding + 1) / 2;
+    left = horizontal_total_padding / 2;
+    right = (horizontal_total_padding + 1) / 2;
+  }
+  else if (padding_name != "VALID")
+  {
+    throw std::runtime_error{"Not support padding type " + padding_name};
+  }
+
+  return PaddingInfo{top, bottom, left, right};
+}
+
+struct ActivationRange
+{
+  float min;
+  float max;
+};
+
+ActivationRange asActivationRange(const std::string &act_name)
+{
+  if (act_name == "NONE")
+  {
+    return ActivationRange{std::numeric_limits<float>::lowest(),
+                           std::numeric_limits<float>::max()};
+  }
+  else if (act_name == "RELU")
+  {
+    return ActivationRange{0.f, std::numeric_limits<float>::max()};
+  }
+  else if (act_name == "RELU6")
+  {
+    return ActivationRange{0.f, 6.f};
+  }
+  else
+  {
+    throw std::runtime_error{"Not support activation " + act_name};
+  }
+}
+
+// Values do not matter for speed, but denormals and NaNs would skew it
+std::vector<float> randomData(size_t size)
+{
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  std::vector<float> data(size);
+  for (auto &e : data)
+    e = dist(gen);
+  return data;
+}
+
+// Quantized values over the whole range of T, whose zero point is 0
+template <typename T> std::vector<T> randomQuantData(size_t size)
+{
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int32_t> dist(std::numeric_limits<T>::min(),
+                                              std::numeric_limits<T>::max());
+  std::vector<T> data(size);
+  for (auto &e : data)
+    e = static_cast<T>(dist(gen));
+  return data;
+}
+
+} // namespace cpu_common
+} // namespace kernels
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_KERNELS_CPU_COMMON_UTILS_H__
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file FullyConnected benchmark with ruy kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <ruy/context.h>
+#include <ruy/operation/FullyConnected.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "cpu_common/Utils.h"
+
+using namespace kbenchmark::kernels::cpu_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(INPUT_SIZE, 1024);
+NONIUS_PARAM(OUTPUT_SIZE, 1024);
+
+NONIUS_PARAM(FUSED_ACT, std::string{"NONE"})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  int32_t batch;
+  int32_t input_size;
+  int32_t output_size;
+
+  nnfw::ruy::FullyConnectedParams params;
+
+  Configuration(nonius::chronometer meter)
+  {
+    batch = meter.param<BATCH>();
+    input_size = meter.param<INPUT_SIZE>();
+    output_size = meter.param<OUTPUT_SIZE>();
+
+    const auto range = asActivationRange(meter.param<FUSED_ACT>());
+    params.float_activation_min = range.min;
+    params.float_activation_max = range.max;
+    // Weights are constant and inputs change on every run
+    params.lhs_cacheable = true;
+    params.rhs_cacheable = false;
+  }
+
+  nnfw::ruy::Shape input_shape() const { return nnfw::ruy::Shape{batch, input_size}; }
+  nnfw::ruy::Shape weights_shape() const { return nnfw::ruy::Shape{output_size, input_size}; }
+  nnfw::ruy::Shape bias_shape() const { return nnfw::ruy::Shape{output_size}; }
+  nnfw::ruy::Shape output_shape() const { return nnfw::ruy::Shape{batch, output_size}; }
+};
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+// Single thread to compare kernels against the single core roofline
+inline ::ruy::Context *ruy_context()
+{
+  static ::ruy::Context context;
+  context.set_max_num_threads(1);
+  return &context;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                          \
+  namespace                                                                                        \
+  {                                                                                                \
+  static ::nonius::benchmark_registrar                                                             \
+    NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, __VA_ARGS__); \
+  }
+
+NONIUS_LOCAL_BENCHMARK("RuyFullyConnected", [](nonius::chronometer meter) {
+  // Configure
+  Configuration p{meter};
+  const auto input_shape = p.input_shape();
+  const auto weights_shape = p.weights_shape();
+  const auto bias_shape = p.bias_shape();
+  const auto output_shape = p.output_shape();
+
+  auto input = randomData(input_shape.FlatSize());
+  auto weights = randomData(weights_shape.FlatSize());
+  auto bias = randomData(bias_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  auto context = ruy_context();
+
+  // Run!
+  meter.measure([&](int) {
+    nnfw::ruy::FullyConnected(p.params, input_shape, input.data(), weights_shape, weights.data(),
+                              bias_shape, bias.data(), output_shape, output.data(), context);
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Conv2D benchmark with XNNPACK kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <xnnpack.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "cpu_common/Utils.h"
+
+using namespace kbenchmark::kernels::cpu_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(IFM_C, 3);
+NONIUS_PARAM(IFM_H, 244);
+NONIUS_PARAM(IFM_W, 244);
+
+NONIUS_PARAM(OFM_C, 3);
+NONIUS_PARAM(OFM_H, 244);
+NONIUS_PARAM(OFM_W, 244);
+
+NONIUS_PARAM(KER_H, 3);
+NONIUS_PARAM(KER_W, 3);
+
+NONIUS_PARAM(STRIDE_H, 1);
+NONIUS_PARAM(STRIDE_W, 1);
+
+NONIUS_PARAM(PADDING, std::string{"SAME"})
+NONIUS_PARAM(FUSED_ACT, std::string{"RELU"})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  uint32_t batch;
+  uint32_t ifm_C;
+  uint32_t ifm_H;
+  uint32_t ifm_W;
+  uint32_t ofm_C;
+  uint32_t ofm_H;
+  uint32_t ofm_W;
+  uint32_t ker_H;
+  uint32_t ker_W;
+
+  uint32_t vertical_stride;
+  uint32_t horizontal_stride;
+
+  PaddingInfo padding;
+  ActivationRange range;
+
+  Configuration(nonius::chronometer meter)
+  {
+    batch = meter.param<BATCH>();
+    ifm_C = meter.param<IFM_C>();
+    ifm_H = meter.param<IFM_H>();
+    ifm_W = meter.param<IFM_W>();
+    ofm_C = meter.param<OFM_C>();
+    ofm_H = meter.param<OFM_H>();
+    ofm_W = meter.param<OFM_W>();
+    ker_H = meter.param<KER_H>();
+    ker_W = meter.param<KER_W>();
+
+    vertical_stride = meter.param<STRIDE_H>();
+    horizontal_stride = meter.param<STRIDE_W>();
+
+    padding = calculatePadding(meter.param<PADDING>(), ifm_H, ifm_W, ofm_H, ofm_W,
+                               vertical_stride, horizontal_stride, ker_H, ker_W);
+    range = asActivationRange(meter.param<FUSED_ACT>());
+  }
+};
+
+inline void check(xnn_status status, const char *what)
+{
+  if (status != xnn_status_success)
+    throw std::runtime_error{std::string{"failed to "} + what};
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                          \
+  namespace                                                                                        \
+  {                                                                                                \
+  static ::nonius::benchmark_registrar                                                             \
+    NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, __VA_ARGS__); \
+  }
+
+NONIUS_LOCAL_BENCHMARK("XnnpackConv_NHWC", [](nonius::chronometer meter) {
+  // Configure
+  Configuration p{meter};
+
+  auto ifm = randomData(p.batch * p.ifm_H * p.ifm_W * p.ifm_C);
+  auto ker = randomData(p.ofm_C * p.ker_H * p.ker_W * p.ifm_C);
+  auto bias = randomData(p.ofm_C);
+  std::vector<float> ofm(p.batch * p.ofm_H * p.ofm_W * p.ofm_C);
+
+  check(xnn_initialize(nullptr /* allocator */), "initialize XNNPACK");
+
+  xnn_operator_t op = nullptr;
+  check(xnn_create_convolution2d_nhwc_f32(
+          p.padding.top, p.padding.right, p.padding.bottom, p.padding.left, p.ker_H, p.ker_W,
+          p.vertical_stride, p.horizontal_stride, 1, 1, 1 /* groups */, p.ifm_C, p.ofm_C,
+          p.ifm_C /* input_channel_stride */, p.ofm_C /* output_channel_stride */, ker.data(),
+          bias.data(), p.range.min, p.range.max, 0, nullptr, nullptr, &op),
+        "create Convolution operator");
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> op_guard{op, xnn_delete_operator};
+
+  // No threadpool to compare kernels against the single core roofline
+  size_t workspace_size = 0;
+  size_t workspace_alignment = 0;
+  check(xnn_reshape_convolution2d_nhwc_f32(op, p.batch, p.ifm_H, p.ifm_W, &workspace_size,
+                                           &workspace_alignment, nullptr, nullptr, nullptr),
+        "reshape Convolution operator");
+  std::vector<uint8_t> workspace(workspace_size);
+  check(xnn_setup_convolution2d_nhwc_f32(op, workspace.data(), ifm.data(), ofm.data()),
+        "setup Convolution operator");
+
+  // Run!
+  meter.measure([&](int) { check(xnn_run_operator(op, nullptr), "run Convolution operator"); });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
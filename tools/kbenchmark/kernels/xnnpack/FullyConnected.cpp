@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file FullyConnected benchmark with XNNPACK kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <xnnpack.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "cpu_common/Utils.h"
+
+using namespace kbenchmark::kernels::cpu_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(INPUT_SIZE, 1024);
+NONIUS_PARAM(OUTPUT_SIZE, 1024);
+
+NONIUS_PARAM(FUSED_ACT, std::string{"NONE"})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  uint32_t batch;
+  uint32_t input_size;
+  uint32_t output_size;
+
+  ActivationRange range;
+
+  Configuration(nonius::chronometer meter)
+  {
+    batch = meter.param<BATCH>();
+    input_size = meter.param<INPUT_SIZE>();
+    output_size = meter.param<OUTPUT_SIZE>();
+
+    range = asActivationRange(meter.param<FUSED_ACT>());
+  }
+};
+
+inline void check(xnn_status status, const char *what)
+{
+  if (status != xnn_status_success)
+    throw std::runtime_error{std::string{"failed to "} + what};
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                          \
+  namespace                                                                                        \
+  {                                                                                                \
+  static ::nonius::benchmark_registrar                                                             \
+    NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, __VA_ARGS__); \
+  }
+
+NONIUS_LOCAL_BENCHMARK("XnnpackFullyConnected", [](nonius::chronometer meter) {
+  // Configure
+  Configuration p{meter};
+
+  auto input = randomData(p.batch * p.input_size);
+  auto weights = randomData(p.output_size * p.input_size);
+  auto bias = randomData(p.output_size);
+  std::vector<float> output(p.batch * p.output_size);
+
+  check(xnn_initialize(nullptr /* allocator */), "initialize XNNPACK");
+
+  xnn_operator_t op = nullptr;
+  check(xnn_create_fully_connected_nc_f32(
+          p.input_size, p.output_size, p.input_size /* input stride */,
+          p.output_size /* output stride */, weights.data(), bias.data(), p.range.min,
+          p.range.max, 0, nullptr, nullptr, &op),
+        "create FullyConnected operator");
+  std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> op_guard{op, xnn_delete_operator};
+
+  // No threadpool to compare kernels against the single core roofline
+  check(xnn_reshape_fully_connected_nc_f32(op, p.batch, nullptr),
+        "reshape FullyConnected operator");
+  check(xnn_setup_fully_connected_nc_f32(op, input.data(), output.data()),
+        "setup FullyConnected operator");
+
+  // Run!
+  meter.measure(
+    [&](int) { check(xnn_run_operator(op, nullptr), "run FullyConnected operator"); });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
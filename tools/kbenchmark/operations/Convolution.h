@@ -65,6 +65,19 @@ public:
 
     return params;
   }
+
+  Workload workload(OperationInfo &info) override
+  {
+    auto _weights = get_key_dims({"weights"}, info);
+    auto _output0 = get_key_dims({"output0"}, info);
+
+    Workload workload;
+    // Each output element needs KER_H * KER_W * IFM_C multiply-adds
+    workload.flops = 2 * num_elements(_output0) * _weights[1] * _weights[2] * _weights[3];
+    workload.bytes = get_key_bytes("input", info) + get_key_bytes("weights", info) +
+                     get_key_bytes("bias", info) + get_key_bytes("output0", info);
+    return workload;
+  }
 };
 
 } // namespace operation
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_FULLY_CONNECTED_H__
+#define __KBENCHMARK_OPERATIONS_FULLY_CONNECTED_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class FullyConnected final : public Operation
+{
+public:
+  FullyConnected() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    // Config saver lists inputs in order of input, weights and bias
+    // Input is flattened into [BATCH, INPUT_SIZE]
+    auto _weights = get_key_dims({"input1"}, info);
+    auto _input = get_key_dims({"input0"}, info);
+    params.insert({"OUTPUT_SIZE", nonius::param{_weights[0]}});
+    params.insert({"INPUT_SIZE", nonius::param{_weights[1]}});
+    params.insert(
+      {"BATCH", nonius::param{static_cast<int>(num_elements(_input)) / _weights[1]}});
+
+    // Config saver omits fused_act of NONE
+    auto _act = (info.find("fused_act") != info.end()) ? get_key_string({"fused_act"}, info)
+                                                       : std::string{"NONE"};
+    params.insert({"FUSED_ACT", nonius::param{_act}});
+
+    return params;
+  }
+
+  Workload workload(OperationInfo &info) override
+  {
+    auto _weights = get_key_dims({"input1"}, info);
+    auto _input = get_key_dims({"input0"}, info);
+
+    Workload workload;
+    // Each input element is multiplied by a column of weights
+    workload.flops = 2 * num_elements(_input) * _weights[0];
+    workload.bytes = get_key_bytes("input0", info) + get_key_bytes("input1", info) +
+                     get_key_bytes("input2", info) + get_key_bytes("output0", info);
+    return workload;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_FULLY_CONNECTED_H__
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_TOPK_V2_H__
+#define __KBENCHMARK_OPERATIONS_TOPK_V2_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class TopKV2 final : public Operation
+{
+public:
+  TopKV2() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    // Input is flattened into [ROWS, ROW_SIZE], and k is the last dimension of values
+    auto _input = get_key_dims({"input0"}, info);
+    auto _output0 = get_key_dims({"output0"}, info);
+    params.insert({"ROW_SIZE", nonius::param{_input.back()}});
+    params.insert(
+      {"ROWS", nonius::param{static_cast<int>(num_elements(_input)) / _input.back()}});
+    params.insert({"K", nonius::param{_output0.back()}});
+
+    return params;
+  }
+
+  Workload workload(OperationInfo &info) override
+  {
+    Workload workload;
+    // Only comparisons, so the roofline reporter compares it with the bandwidth
+    workload.flops = 0;
+    workload.bytes = get_key_bytes("input0", info) + get_key_bytes("output0", info) +
+                     get_key_bytes("output1", info);
+    return workload;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_TOPK_V2_H__
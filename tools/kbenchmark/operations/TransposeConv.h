@@ -65,6 +65,19 @@ public:
 
     return params;
   }
+
+  Workload workload(OperationInfo &info) override
+  {
+    auto _weights = get_key_dims({"input1"}, info);
+    auto _input = get_key_dims({"input2"}, info);
+
+    Workload workload;
+    // Each input element is scattered with KER_H * KER_W * OFM_C multiply-adds
+    workload.flops = 2 * num_elements(_input) * _weights[0] * _weights[1] * _weights[2];
+    workload.bytes = get_key_bytes("input2", info) + get_key_bytes("input1", info) +
+                     get_key_bytes("output0", info);
+    return workload;
+  }
 };
 
 } // namespace operation